@@ -1,6 +1,7 @@
 import os, sys
 from yaplctargets.toolchain_yaplc_stm32 import toolchain_yaplc_stm32
 from yaplctargets.toolchain_yaplc_stm32 import plc_rt_dir as plc_rt_dir
+from yaplctargets import plc_tasks
 
 class plc411_target(toolchain_yaplc_stm32):
     def __init__(self, CTRInstance):
@@ -14,3 +15,7 @@ class plc411_target(toolchain_yaplc_stm32):
         self.bsp_dir          = os.path.join(os.path.join(plc_rt_dir, "bsp"), "plc411")
         self.find_dirs        = ["-I\"" + self.bsp_dir + "\""]
 
+    def build(self):
+        #Tasks of resources are run by RTE (plc_tasks.h)
+        plc_tasks.generate(self)
+        return toolchain_yaplc_stm32.build(self)
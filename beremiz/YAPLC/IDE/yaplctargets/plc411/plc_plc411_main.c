@@ -131,6 +131,14 @@ plc_loc_tbl_t plc_loc_table[] =
 uint32_t plc_loc_weigth[PLC_LOC_TBL_SIZE];
 
 
+/** TASKS
+ *  generated by target from resources (yaplctargets/plc_tasks.py):
+ *  PLC_TASKS_SZ, PLC_TASKS_TAB, PLC_TASKS_EVT, plc_tasks_sel__, plc_tasks_run__()
+ */
+
+#include "plc_tasks.h"
+
+
 /** LOCATED FUNCTIONS
  */
 
@@ -153,7 +161,17 @@ plc_app_funcs_t PlcAppFuncs =
     
     .SoftReset  = 0,
     .GetTime    = 0,
-    .LedUser    = 0
+    .LedUser    = 0,
+    .SetTimer   = 0,
+
+    .RetainCheck      = 0,
+    .RetainInvalidate = 0,
+    .RetainValidate   = 0,
+    .Retain           = 0,
+    .Remind           = 0,
+
+    .DICntrCmp  = 0,
+    .DOPto      = 0
 };
 
 
@@ -167,6 +185,10 @@ plc_app_funcs_t PlcAppFuncs =
 __attribute__ ((section(".plc_md5_sec"))) char plc_md5[] = PLC_MD5_STR2(PLC_MD5);
 //App ABI, placed at the .text end
 __attribute__ ((section(".plc_check_sec"))) char plc_check_md5[] = PLC_MD5_STR2(PLC_MD5);
+//CRC of image, placed after .plc_check_sec (the last word of image),
+//placeholder is replaced by CRC after build (plc_crc.py)
+#define PLC_CRC_PLACEHOLDER 0x50434352
+__attribute__ ((section(".plc_crc_sec"))) const uint32_t plc_crc = PLC_CRC_PLACEHOLDER;
 
 //Linker added symbols
 extern uint32_t _plc_data_loadaddr, _plc_data_start, _plc_data_end, _plc_bss_end, _plc_sstart;
@@ -178,6 +200,7 @@ extern app_fp_t _plc_fia_start,_plc_fia_end;
 extern int startPLC(int argc,char **argv);
 extern int stopPLC();
 extern void runPLC(void);
+extern void runPLCTasks(uint32_t mask);
 
 extern void resumeDebug(void);
 extern void suspendDebug(int disable);
@@ -219,7 +242,7 @@ __attribute__ ((section(".plc_app_abi_sec"))) plc_app_abi_t plc_yaplc_app =
 
     //Must be run on compatible RTE
     .rte_ver_major = 1,
-    .rte_ver_minor = 0,
+    .rte_ver_minor = 7,
     .rte_ver_patch = 0,
     
     .hw_id = 411,
@@ -255,7 +278,16 @@ __attribute__ ((section(".plc_app_abi_sec"))) plc_app_abi_t plc_yaplc_app =
     .log_cnt_get   = GetLogCount,
     .log_msg_get   = GetLogMessage,
     .log_cnt_reset = ResetLogCount,
-    .log_msg_post  = LogMessage
+    .log_msg_post  = LogMessage,
+
+    //Tasks
+    .t_tab     = PLC_TASKS_TAB,
+    .t_sz      = PLC_TASKS_SZ,
+    .run_tasks = runPLCTasks,
+    .t_evt     = PLC_TASKS_EVT,
+
+    //CRC of image
+    .crc = &plc_crc
 };
 
 //Redefine LOG_BUFFER_SIZE
@@ -276,10 +308,11 @@ void PLC_GetTime(IEC_TIME *CURRENT_TIME)
 
 void PLC_SetTimer(unsigned long long next, unsigned long long period)
 {
-    //@TODO ???
     //PLC_RTE->set_timer( next, period );
-    (void)next;
-    (void)period;
+    if(PlcAppFuncs.SetTimer)
+    {
+        PlcAppFuncs.SetTimer(next, period);
+    }
 }
 
 long AtomicCompareExchange(long* atomicvar,long compared, long exchange)
@@ -357,15 +390,27 @@ int WaitDebugData(unsigned long *tick)
 void ValidateRetainBuffer(void)
 {
     //PLC_RTE->validate_retain_buf();
+    if(PlcAppFuncs.RetainValidate)
+    {
+        PlcAppFuncs.RetainValidate();
+    }
 }
 void InValidateRetainBuffer(void)
 {
     //PLC_RTE->invalidate_retain_buf();
+    if(PlcAppFuncs.RetainInvalidate)
+    {
+        PlcAppFuncs.RetainInvalidate();
+    }
 }
 int CheckRetainBuffer(void)
 {
     //return PLC_RTE->check_retain_buf();
-    return (1);
+    if(PlcAppFuncs.RetainCheck)
+    {
+        return PlcAppFuncs.RetainCheck();
+    }
+    return (0);
 }
 
 void InitRetain(void)
@@ -379,10 +424,18 @@ void CleanupRetain(void)
 void Retain(unsigned int offset, unsigned int count, void *p)
 {
     //PLC_RTE->retain( offset, count, p );
+    if(PlcAppFuncs.Retain)
+    {
+        PlcAppFuncs.Retain(offset, count, p);
+    }
 }
 void Remind(unsigned int offset, unsigned int count, void *p)
 {
     //PLC_RTE->remind( offset, count, p );
+    if(PlcAppFuncs.Remind)
+    {
+        PlcAppFuncs.Remind(offset, count, p);
+    }
 }
 
 int startPLC(int argc,char **argv)
@@ -407,6 +460,20 @@ void runPLC(void)
     __run();
 }
 
+void runPLCTasks(uint32_t mask)
+{
+    if(mask & PLC_APP_TASK_MAIN)
+    {
+        //tasks of the main run are run by config_run__ (within __run, with debug and retain)
+        plc_tasks_sel__ = mask;
+        runPLC();
+    }
+    else
+    {
+        plc_tasks_run__(mask);
+    }
+}
+
 
 
 /** F(B) C-code
@@ -566,6 +633,31 @@ void App_DIEnc(DIENC *DataIn)
     }
 }
 
+/** @brief  DICntrCmp.
+ *  @param  DataIn - FB-arguments.
+ *  @return None.
+ */
+void App_DICntrCmp(DICNTRCMP *DataIn)
+{
+    if(DataIn && PlcAppFuncs.DICntrCmp)
+    {
+        BYTE  DIn   = __GET_VAR(DataIn->DIN);
+        DWORD Ref   = __GET_VAR(DataIn->REF);
+        BOOL  CmpEn = __GET_VAR(DataIn->CMPEN);
+        BYTE  DOn   = __GET_VAR(DataIn->DON);
+        BOOL  DOv   = __GET_VAR(DataIn->DOV);
+        DWORD Ov    = 0;
+        BOOL  Ocmp  = 0;
+        BYTE  Ok    = 0;
+        
+        PlcAppFuncs.DICntrCmp(&DIn, &Ref, &CmpEn, &DOn, &DOv, &Ov, &Ocmp, &Ok);
+        
+        __SET_VAR(DataIn->, OV,, Ov);
+        __SET_VAR(DataIn->, OCMP,, Ocmp);
+        __SET_VAR(DataIn->, OK,, Ok);
+    }
+}
+
 #endif // APP_DI
 
 
@@ -657,6 +749,33 @@ void App_DOPwm(DOPWM *DataIn)
     }
 }
 
+/** @brief  DOPto.
+ *  @param  DataIn - FB-arguments.
+ *  @return None.
+ */
+void App_DOPto(DOPTO *DataIn)
+{
+    if(DataIn && PlcAppFuncs.DOPto)
+    {
+        BOOL En   = __GET_VAR(DataIn->ENX);
+        BYTE DOn  = __GET_VAR(DataIn->DON);
+        DWORD N   = __GET_VAR(DataIn->N);
+        DWORD F0  = __GET_VAR(DataIn->F0);
+        DWORD F1  = __GET_VAR(DataIn->F1);
+        DWORD Acc = __GET_VAR(DataIn->ACC);
+        BYTE Prof = __GET_VAR(DataIn->PROF);
+        BOOL Ob   = 0;
+        BOOL Od   = 0;
+        BYTE Ok   = 0;
+        
+        PlcAppFuncs.DOPto(&En, &DOn, &N, &F0, &F1, &Acc, &Prof, &Ob, &Od, &Ok);
+        
+        __SET_VAR(DataIn->, OB,, Ob);
+        __SET_VAR(DataIn->, OD,, Od);
+        __SET_VAR(DataIn->, OK,, Ok);
+    }
+}
+
 #endif // APP_DO
 
 
@@ -0,0 +1,77 @@
+"""
+Beremiz YAPLC CRC of application image
+
+- CRC-32 of STM32 CRC unit: polynomial 0x04C11DB7, initial value 0xFFFFFFFF,
+  no reflection, no final XOR, every 32-bit word of image (little-endian)
+  is processed MSB first
+- the last word of image (.plc_crc_sec, plc_app_abi_t.crc) holds the placeholder
+  after link, it is replaced by CRC of image before the word
+- RTE checks CRC at boot and in background (ABI 1.5)
+
+Usage: python plc_crc.py plc.elf.bin
+"""
+
+import struct, sys
+
+PLC_CRC_PLACEHOLDER = 0x50434352    # plc_crc (plc_<target>_main.c)
+PLC_CRC_POLY        = 0x04C11DB7
+
+
+class PlcCrcError(Exception):
+    pass
+
+
+def _table():
+    tab = []
+    for i in range(256):
+        c = i << 24
+        for _ in range(8):
+            c = ((c << 1) ^ PLC_CRC_POLY) if (c & 0x80000000) else (c << 1)
+        tab.append(c & 0xFFFFFFFF)
+    return tab
+
+_tab = _table()
+
+
+def crc32_stm32(data):
+    """CRC of STM32 CRC unit (data is a multiple of 4 bytes)."""
+    data = bytearray(data)
+    if len(data) % 4:
+        raise PlcCrcError("size of data is not a multiple of 4 bytes")
+    crc = 0xFFFFFFFF
+    for i in range(0, len(data), 4):
+        # MSB of little-endian word first
+        for b in (data[i+3], data[i+2], data[i+1], data[i]):
+            crc = ((crc << 8) & 0xFFFFFFFF) ^ _tab[(crc >> 24) ^ b]
+    return crc
+
+
+def stamp(path):
+    """Replace the placeholder (the last word of image) by CRC, return CRC."""
+    with open(path, "rb") as f:
+        data = bytearray(f.read())
+    if len(data) < 8 or len(data) % 4:
+        raise PlcCrcError("%s: size of image is not a multiple of 4 bytes" % path)
+
+    crc  = crc32_stm32(data[:-4])
+    last = struct.unpack("<I", bytes(data[-4:]))[0]
+    if last == crc:
+        return crc                  # image is stamped already
+    if last != PLC_CRC_PLACEHOLDER:
+        raise PlcCrcError("%s: CRC placeholder is not the last word of image" % path)
+
+    data[-4:] = struct.pack("<I", crc)
+    with open(path, "wb") as f:
+        f.write(bytes(data))
+    return crc
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.stderr.write("Usage: python plc_crc.py plc.elf.bin\n")
+        sys.exit(2)
+    try:
+        print("CRC: 0x%08X" % stamp(sys.argv[1]))
+    except (PlcCrcError, IOError, OSError) as e:
+        sys.stderr.write("%s\n" % str(e))
+        sys.exit(1)
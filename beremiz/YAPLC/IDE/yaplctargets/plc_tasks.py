@@ -0,0 +1,356 @@
+"""
+Beremiz YAPLC Tasks
+
+- Resources generated by matiec run all tasks by <RES>_run__(tick), every
+  task is selected by the common ticktime (tick % interval)
+- <RES>_run_tasks__(mask) is added to every resource, so RTE runs every
+  task by its own interval and priority (plc_app_abi_t.run_tasks)
+- plc_tasks.h (task table, located variables used by tasks) is generated
+  into the build folder and included by the target C-file
+- the original <RES>_run__ is kept as <RES>_run_tick__ and is used while
+  plc_tasks_sel__ = 0 (RTE without tasks)
+- SINGLE of task must be a located BOOL (directly or by a global variable),
+  it is passed to RTE (plc_app_abi_t.t_evt), so the task is released by rising
+  edge of the variable (DI, counter setpoint, AI threshold) instead of R_TRIG
+  of the resource, task without INTERVAL has 0 ticks
+"""
+
+import os, re
+
+PLC_TASKS_HDR       = "plc_tasks.h"
+PLC_TASKS_MAX       = 8      # PLC_APP_TASK_MAX (plc_abi.h)
+PLC_TASKS_PRIO_NONE = 255    # programs without task (the lowest priority)
+
+PLC_TASKS_MARK  = "/* plc_tasks: tasks are run by RTE (see plc_tasks.h) */\n"
+PLC_TASKS_BEGIN = "/* plc_tasks: begin */\n"
+
+_re_run  = re.compile(r"void\s+(\w+)_run__\s*\(\s*unsigned\s+long\s+tick\s*\)\s*\{")
+_re_call = re.compile(r"\b(\w+)_run__\s*\(\s*tick\s*\)")
+_re_flag = re.compile(r"^\s*(\w+)\s*=\s*(?:__GET_VAR\(\s*(\w+)\s*\.\s*Q\s*,?\s*\)\s*(?:\|\|\s*)?)?(?:!\(\s*tick\s*%\s*(\d+)\s*\))?\s*;\s*$")
+_re_clk  = re.compile(r"^\s*__SET_VAR\(\s*(\w+)\s*\.\s*,\s*CLK\s*,\s*,\s*(.+)\);\s*$")
+_re_trig = re.compile(r"^\s*R_TRIG_body__\s*\(\s*&\s*(\w+)\s*\);\s*$")
+_re_glob = re.compile(r"__INIT_GLOBAL_LOCATED\(\s*\w+\s*,\s*(\w+)\s*,\s*(__[IQM]\w+)\s*,")
+_re_if   = re.compile(r"^(\s*)if\s*\(\s*(\w+)\s*\)\s*\{\s*$")
+_re_body = re.compile(r"\b(\w+)_body__\s*\(")
+_re_init = re.compile(r"void\s+(\w+)_init__\s*\(\s*\w+\s*\*\s*data__\s*,\s*BOOL\s+retain\s*\)\s*\{")
+_re_lvar = re.compile(r"__LOCATED_VAR\(\s*\w+\s*,\s*(\w+)\s*,")
+_re_lref = re.compile(r"\b(__[IQM]\w+)\b")
+
+
+class PlcTasksError(Exception):
+    pass
+
+
+def _block_end(text, start):
+    """Position of '}' closing '{' at start (string literals are skipped)."""
+    depth = 0
+    i = start
+    while i < len(text):
+        c = text[i]
+        if c == '"' or c == "'":
+            i += 1
+            while i < len(text) and text[i] != c:
+                i += 2 if text[i] == "\\" else 1
+        elif c == "{":
+            depth += 1
+        elif c == "}":
+            depth -= 1
+            if depth == 0:
+                return i
+        i += 1
+    raise PlcTasksError("unbalanced braces")
+
+
+def _restore(text):
+    """Source of resource as generated by matiec (file may be patched by the previous build)."""
+    if not text.startswith(PLC_TASKS_MARK):
+        return text
+    text = text[len(PLC_TASKS_MARK):]
+    if ("\n" + PLC_TASKS_BEGIN) in text:
+        text = text[:text.find("\n" + PLC_TASKS_BEGIN)]
+    return re.sub(r"(void\s+\w+)_run_tick__(\s*\(\s*unsigned\s+long\s+tick\s*\))", r"\1_run__\2", text)
+
+
+def _single(res, expr, globs):
+    """Located BOOL of SINGLE (direct variable or global variable located by configuration)."""
+    names = _re_lref.findall(expr)
+    for tok in re.findall(r"\w+", expr):
+        tok = re.sub(r"^__GET_GLOBAL_", "", tok)
+        if tok in globs:
+            names.append(globs[tok])
+    for name in names:
+        if name[3:4] == "X":
+            return name
+    raise PlcTasksError("%s: SINGLE is not a located BOOL: %s" % (res, expr.strip()))
+
+
+def _parse_run(res, body, globs):
+    """Tasks of resource and items of <RES>_run__: ("task", flag, lines) or ("none", line)."""
+    tasks = []
+    flags = {}
+    items = []
+    trigs = {}
+    lines = body.split("\n")
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        i += 1
+        if not line.strip():
+            continue
+
+        # SINGLE: edge is taken by RTE (lines are not used by <RES>_run_tasks__)
+        m = _re_clk.match(line)
+        if m:
+            trigs[m.group(1)] = _single(res, m.group(2), globs)
+            continue
+        if _re_trig.match(line):
+            continue
+
+        m = _re_flag.match(line)
+        if m and (m.group(2) or m.group(3)):
+            if m.group(2) and m.group(2) not in trigs:
+                raise PlcTasksError("%s: SINGLE of %s is not found" % (res, m.group(1)))
+            flags[m.group(1)] = len(tasks)
+            tasks.append({"res": res, "name": m.group(1),
+                          "ticks": int(m.group(3)) if m.group(3) else 0,
+                          "evt": trigs[m.group(2)] if m.group(2) else None,
+                          "progs": set()})
+            continue
+
+        m = _re_if.match(line)
+        if m and m.group(2) in flags:
+            task = tasks[flags[m.group(2)]]
+            block = []
+            depth = 1
+            while i < len(lines) and depth > 0:
+                depth += lines[i].count("{") - lines[i].count("}")
+                if depth > 0:
+                    block.append(lines[i])
+                    task["progs"].update(_re_body.findall(lines[i]))
+                i += 1
+            items.append(("task", m.group(2), m.group(1), block))
+            continue
+
+        # program without task (a single call)
+        if _re_body.search(line) and "{" not in line and "}" not in line and "=" not in line:
+            items.append(("none", line, _re_body.findall(line)))
+            continue
+
+        raise PlcTasksError("%s: unsupported statement: %s" % (res, line.strip()))
+
+    return tasks, flags, items
+
+
+def _priorities(project):
+    """Priorities of tasks from the project: {(RESOURCE, TASK): priority}."""
+    prio = {}
+    try:
+        for config in project.getconfigurations():
+            for res in config.getresource():
+                for task in res.gettask():
+                    prio[(res.getname().upper(), task.getname().upper())] = int(task.getpriority())
+    except Exception:
+        pass
+    return prio
+
+
+def _gen_header(tasks, resources, located):
+    words = max(1, (len(located) + 31) // 32)
+    hdr = ["/* %s" % PLC_TASKS_HDR,
+           " * generated by yaplctargets (plc_tasks.py), do not edit",
+           " */",
+           "",
+           "#define PLC_TASKS_SZ %d" % len(tasks),
+           "",
+           "unsigned long plc_tasks_sel__ = 0;",
+           ""]
+    if not tasks:
+        hdr += ["#define PLC_TASKS_TAB 0",
+                "#define PLC_TASKS_EVT 0",
+                "",
+                "static void plc_tasks_run__(unsigned long mask)",
+                "{",
+                "    (void)mask;",
+                "}",
+                ""]
+        return "\n".join(hdr)
+
+    hdr += ["void %s_run_tasks__(unsigned long mask);" % res for res, fname in resources]
+    hdr += ["",
+            "static void plc_tasks_run__(unsigned long mask)",
+            "{"]
+    hdr += ["    %s_run_tasks__(mask);" % res for res, fname in resources]
+    hdr += ["}", ""]
+
+    for k, task in enumerate(tasks):
+        lmap = [0] * words
+        for i, name in enumerate(located):
+            if name in task["located"]:
+                lmap[i // 32] |= 1 << (i % 32)
+        hdr += ["/* %s.%s: %d tick(s), priority %d%s */" % (task["res"], task["name"], task["ticks"], task["priority"],
+                                                           ", SINGLE %s" % task["evt"] if task["evt"] else ""),
+                "static const uint32_t plc_tasks_lmap_%d[%d] = {%s};" % (k, words, ", ".join(["0x%08XUL" % w for w in lmap])),
+                ""]
+
+    hdr += ["const plc_app_task_t plc_tasks[PLC_TASKS_SZ] =", "{"]
+    hdr += ["    {.ticks = %d, .priority = %d, .l_map = plc_tasks_lmap_%d}," % (task["ticks"], task["priority"], k)
+            for k, task in enumerate(tasks)]
+    hdr += ["};",
+            "",
+            "#define PLC_TASKS_TAB (&plc_tasks[0])",
+            ""]
+
+    if not [task for task in tasks if task["evt"]]:
+        hdr += ["#define PLC_TASKS_EVT 0", ""]
+        return "\n".join(hdr)
+
+    hdr += ["static const plc_loc_dsc_t *const plc_tasks_evt[PLC_TASKS_SZ] =", "{"]
+    hdr += ["    %s," % ("&%s_LDSC" % task["evt"] if task["evt"] else "0") for task in tasks]
+    hdr += ["};",
+            "",
+            "#define PLC_TASKS_EVT (&plc_tasks_evt[0])",
+            ""]
+    return "\n".join(hdr)
+
+
+def _gen_run(res, items, index):
+    code = [PLC_TASKS_BEGIN,
+            "extern unsigned long plc_tasks_sel__;",
+            "",
+            "void %s_run_tasks__(unsigned long mask) {" % res]
+    for item in items:
+        if item[0] == "task":
+            code.append("%sif (mask & (1UL << %d)) {" % (item[2], index[item[1]]))
+            code += item[3]
+            code.append("%s}" % item[2])
+        else:
+            code += ["  if (mask & (1UL << %d)) {" % index[None],
+                     "  " + item[1],
+                     "  }"]
+    code += ["}",
+             "",
+             "void %s_run__(unsigned long tick) {" % res,
+             "  if (plc_tasks_sel__) {",
+             "    %s_run_tasks__(plc_tasks_sel__);" % res,
+             "  } else {",
+             "    %s_run_tick__(tick);" % res,
+             "  }",
+             "}",
+             ""]
+    return "\n".join(code)
+
+
+def _split(buildpath, project):
+    """Patched sources {file name: text} and task table."""
+    sources = {}
+    for fname in os.listdir(buildpath):
+        if fname.endswith(".c"):
+            with open(os.path.join(buildpath, fname)) as f:
+                sources[fname] = _restore(f.read())
+
+    if "config.c" not in sources:
+        raise PlcTasksError("config.c is not found")
+    globs = dict(_re_glob.findall(sources["config.c"]))
+
+    with open(os.path.join(buildpath, "LOCATED_VARIABLES.h")) as f:
+        located = _re_lvar.findall(f.read())
+
+    # resources in order of config_run__
+    m = _re_run.search(sources["config.c"])
+    if not m:
+        raise PlcTasksError("config_run__ is not found")
+    body = sources["config.c"][m.end():_block_end(sources["config.c"], m.end() - 1)]
+    order = _re_call.findall(body)
+
+    runs = {}
+    for fname, text in sources.items():
+        for m in _re_run.finditer(text):
+            if m.group(1) in order:
+                runs[m.group(1)] = (fname, m)
+    if len(runs) != len(order):
+        raise PlcTasksError("resources are not found: %s" % ", ".join(set(order) - set(runs)))
+    resources = [(res, runs[res][0]) for res in order]
+
+    # tasks: tasks of resources, then programs without task
+    tasks = []
+    parsed = {}
+    for res, fname in resources:
+        m = runs[res][1]
+        text = sources[fname]
+        end = _block_end(text, m.end() - 1)
+        rtasks, flags, items = _parse_run(res, text[m.end():end], globs)
+        index = dict([(flag, len(tasks) + k) for flag, k in flags.items()])
+        tasks += rtasks
+        parsed[res] = (items, index)
+
+    none = {"res": "*", "name": "NONE", "ticks": 1, "priority": PLC_TASKS_PRIO_NONE, "evt": None, "progs": set()}
+    for res, fname in resources:
+        items, index = parsed[res]
+        for item in items:
+            if item[0] == "none":
+                none["progs"].update(item[2])
+                index[None] = len(tasks)
+    if none["progs"]:
+        tasks.append(none)
+
+    if len(tasks) > PLC_TASKS_MAX:
+        raise PlcTasksError("%d tasks (max. %d)" % (len(tasks), PLC_TASKS_MAX))
+
+    # priorities (rate monotonic if the project is not available, tasks released by event only are the first)
+    prio  = _priorities(project)
+    ticks = sorted(set([t["ticks"] for t in tasks if t is not none]))
+    for t in tasks:
+        if t is not none:
+            t["priority"] = min(254, max(0, prio.get((t["res"], t["name"]), ticks.index(t["ticks"]))))
+
+    # located variables: of programs (bound by <PROGRAM>_init__), others are used by every task
+    progs = {}
+    for text in sources.values():
+        for m in _re_init.finditer(text):
+            end = _block_end(text, m.end() - 1)
+            progs[m.group(1)] = set(_re_lref.findall(text[m.end():end])) & set(located)
+    bound = set()
+    for t in tasks:
+        for p in t["progs"]:
+            bound |= progs.get(p, set())
+    shared = set(located) - bound
+    for res, fname in resources:
+        shared |= set(_re_lref.findall(sources[fname])) & set(located)
+    shared |= set(_re_lref.findall(sources["config.c"])) & set(located)
+    for t in tasks:
+        t["located"] = set(shared)
+        for p in t["progs"]:
+            t["located"] |= progs.get(p, set())
+
+    # <RES>_run_tasks__
+    patched = {}
+    for res, fname in resources:
+        items, index = parsed[res]
+        text = patched.get(fname, sources[fname])
+        text = _re_run.sub(lambda m: "void %s_run_tick__(unsigned long tick) {" % m.group(1) if m.group(1) == res else m.group(0), text)
+        if not text.startswith(PLC_TASKS_MARK):
+            text = PLC_TASKS_MARK + text
+        patched[fname] = text + "\n" + _gen_run(res, items, index)
+
+    return patched, _gen_header(tasks, resources, located), tasks
+
+
+def generate(builder):
+    """Patch resources and generate plc_tasks.h (called before build)."""
+    buildpath = builder.buildpath
+    logger = builder.CTRInstance.logger
+    try:
+        patched, header, tasks = _split(buildpath, getattr(builder.CTRInstance, "Project", None))
+    except (PlcTasksError, IOError, OSError) as e:
+        logger.write_warning("Tasks are run by common ticktime: %s\n" % str(e))
+        patched, header, tasks = {}, _gen_header([], [], []), []
+
+    for fname, text in patched.items():
+        with open(os.path.join(buildpath, fname), "w") as f:
+            f.write(text)
+    with open(os.path.join(buildpath, PLC_TASKS_HDR), "w") as f:
+        f.write(header)
+
+    for t in tasks:
+        logger.write("   [TASK]  %s.%s: %d tick(s), priority %d, %d located%s\n" % (t["res"], t["name"], t["ticks"], t["priority"], len(t["located"]),
+                                                                                  ", SINGLE %s" % t["evt"] if t["evt"] else ""))
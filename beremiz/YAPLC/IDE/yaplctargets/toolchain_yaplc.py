@@ -1,6 +1,7 @@
 import os, sys
 from util.ProcessLogger import ProcessLogger
 from targets.toolchain_gcc import toolchain_gcc
+from yaplctargets import plc_crc
 
 toolchain_dir  = os.path.dirname(os.path.realpath(__file__))
 base_dir       = os.path.join(os.path.join(toolchain_dir, ".."), "..")
@@ -71,15 +72,26 @@ class toolchain_yaplc(toolchain_gcc):
         self.cflags = ["-DPLC_MD5=" + self.calc_md5()]
         
         if toolchain_gcc.build(self):
-	    #Run objcopy on success
-	    self.CTRInstance.logger.write("   [OBJCOPY]  " + self.exe +" -> " + self.exe + ".hex\n")
-	    
-	    objcpy = [self.toolchain_prefix + "objcopy", "--change-address", self.load_addr,  "-O", "ihex", self.exe_path, self.exe_path + ".hex"]
-	    ProcessLogger( self.CTRInstance.logger, objcpy).spin()
+            #Run objcopy on success
+            self.CTRInstance.logger.write("   [OBJCOPY]  " + self.exe +" -> " + self.exe + ".bin\n")
 
             objcpy = [self.toolchain_prefix + "objcopy", "--change-address", self.load_addr,  "-O", "binary", self.exe_path, self.exe_path + ".bin"]
-	    ProcessLogger( self.CTRInstance.logger, objcpy).spin()
-	    
+            ProcessLogger( self.CTRInstance.logger, objcpy).spin()
+
+            #Stamp CRC of image (the last word of image)
+            try:
+                crc = plc_crc.stamp(self.exe_path + ".bin")
+            except (plc_crc.PlcCrcError, IOError, OSError) as e:
+                self.CTRInstance.logger.write_error("CRC is not stamped: %s\n" % str(e))
+                return False
+            self.CTRInstance.logger.write("   [CRC]      " + self.exe + ".bin: 0x%08X\n" % crc)
+
+            #HEX is made of the stamped image (gaps between sections are filled as in BIN)
+            self.CTRInstance.logger.write("   [OBJCOPY]  " + self.exe +".bin -> " + self.exe + ".hex\n")
+
+            objcpy = [self.toolchain_prefix + "objcopy", "-I", "binary", "-O", "ihex", "--change-addresses", self.load_addr, self.exe_path + ".bin", self.exe_path + ".hex"]
+            ProcessLogger( self.CTRInstance.logger, objcpy).spin()
+
 	    self.CTRInstance.logger.write("Output size:\n")
 	    
 	    size = [self.toolchain_prefix + "size", self.exe_path]
@@ -0,0 +1,255 @@
+/*	JAVASCRIPT DOCUMENT
+*	UTF-8
+*/
+
+/*  pro1003
+*   webSCADA client / AI waveform capture decoder
+*   AT09 (atgroup09@gmail.com), 2023
+*
+*   The JavaScript code in this page is free software: you can
+*   redistribute it and/or modify it under the terms of the GNU
+*   General Public License (GNU GPL) as published by the Free Software
+*   Foundation, either version 3 of the License, or (at your option)
+*   any later version.  The code is distributed WITHOUT ANY WARRANTY;
+*   without even the implied warranty of MERCHANTABILITY or FITNESS
+*   FOR A PARTICULAR PURPOSE.  See the GNU GPL for more details.
+*
+*   As additional permission under GNU GPL version 3 section 7, you
+*   may distribute non-source (e.g., minimized or compacted) forms of
+*   that code without the copy of the GNU GPL normally required by
+*   section 4, provided you include this license notice and a URL
+*   through which recipients can access the Corresponding Source.
+*/
+
+/** Registers of PLC411::RTE (Modbus addresses from 0):
+ *    + AI.CAP_SET  (hold 100 ... 104): CH, EDGE, LEVEL, PRE, POST
+ *    + AI.CAP_CMD  (hold 105 ... 106): CMD (1 - arm, 2 - release), CURSOR
+ *    + AI.CAP_STAT (inpt 72 ... 77):   STATE, LEN, TRIG, RATE, CH_SZ, WIN
+ *    + AI.CAP_WIN  (inpt 78 ... 173):  32 scans from CURSOR, CH_SZ ADC-codes per scan
+ *
+ *  Read-out of a frozen capture (STATE = 3):
+ *    CURSOR = 0, 32, 64, ... < LEN; read AI.CAP_WIN as soon as WIN = CURSOR.
+ */
+
+
+//** GLOBAL VARIABLES
+
+//Addresses of registers
+var G_CAP_HOLD_SET      = 100;
+var G_CAP_HOLD_CMD      = 105;
+var G_CAP_HOLD_CURSOR   = 106;
+var G_CAP_INPT_STAT     = 72;
+var G_CAP_INPT_WIN      = 78;
+
+//Window (scans), max. channels per scan, max. polls of window status
+var G_CAP_WIN_SCANS     = 32;
+var G_CAP_WIN_CH_MAX    = 3;
+var G_CAP_WIN_POLL_MAX  = 10;
+
+//States
+var G_CAP_STATE_IDLE    = 0;
+var G_CAP_STATE_ARMED   = 1;
+var G_CAP_STATE_TRIG    = 2;
+var G_CAP_STATE_FROZEN  = 3;
+
+//Commands
+var G_CAP_CMD_ARM       = 1;
+var G_CAP_CMD_RELEASE   = 2;
+
+//ADC-code > V (12 bit, 0 ... 3.3 V), no measurement
+var G_CAP_CODE_MAX      = 4095;
+var G_CAP_VOLT_MAX      = 3.3;
+var G_CAP_CODE_NONE     = 0xFFFF;
+
+
+//** FUNCTIONS
+
+/*
+@brief  Decode status of capture.
+@param  WordsIn - AI.CAP_STAT (6 words) [ARRAY]
+@return Status {State, Len, Trig, Rate, ChSz, Win} or null [OBJECT]
+*/
+function capDecodeStat(WordsIn)
+{
+	if(typeof WordsIn != "object" || !WordsIn || WordsIn.length < 6) return (null);
+
+	return ({ State: WordsIn[0], Len: WordsIn[1], Trig: WordsIn[2], Rate: WordsIn[3], ChSz: WordsIn[4], Win: WordsIn[5] });
+}
+
+/*
+@brief  Convert ADC-code into voltage.
+@param  CodeIn - ADC-code [NUMBER]
+@return Voltage (V) [NUMBER]
+*/
+function capCodeToVolt(CodeIn)
+{
+	return ((CodeIn*G_CAP_VOLT_MAX)/G_CAP_CODE_MAX);
+}
+
+/*
+@brief  Get the next cursor of read-out.
+@param  StatIn - status [OBJECT]
+@param  CursorIn - the current cursor [NUMBER]
+@return The next cursor or -1 (capture is read out) [NUMBER]
+*/
+function capNextCursor(StatIn, CursorIn)
+{
+	var Next = CursorIn+G_CAP_WIN_SCANS;
+	return ((StatIn && Next < StatIn.Len) ? Next : -1);
+}
+
+/*
+@brief  Create empty series of capture (one per channel).
+@param  StatIn - status [OBJECT]
+@return Series [[ [X.msec, Y.V], ... ], ...] [ARRAY]
+*/
+function capNewSeries(StatIn)
+{
+	var Series = [];
+
+	if(StatIn)
+	{
+		for(var i=0; i<StatIn.ChSz && i<G_CAP_WIN_CH_MAX; i++) Series.push([]);
+	}
+	return (Series);
+}
+
+/*
+@brief  Decode window of capture into series.
+@param  StatIn - status [OBJECT]
+@param  CursorIn - the first scan of window (AI.CAP_CMD.CURSOR) [NUMBER]
+@param  WordsIn - AI.CAP_WIN [ARRAY]
+@param  SeriesIO - series (capNewSeries) [ARRAY]
+@return Quantity of decoded scans [NUMBER]
+@note   Scans are interleaved (Scan0.Ch0, Scan0.Ch1, ..., Scan1.Ch0, ...),
+        X is time from trigger (ms), codes beyond capture are skipped.
+*/
+function capDecodeWin(StatIn, CursorIn, WordsIn, SeriesIO)
+{
+	var Cnt = 0;
+
+	if(!StatIn || !StatIn.Rate || typeof WordsIn != "object" || !WordsIn || typeof SeriesIO != "object" || !SeriesIO) return (0);
+
+	for(var i=0; i<G_CAP_WIN_SCANS && CursorIn+i < StatIn.Len; i++)
+	{
+		var X = ((CursorIn+i-StatIn.Trig)*1000)/StatIn.Rate;
+
+		for(var j=0; j<SeriesIO.length; j++)
+		{
+			var Code = WordsIn[i*StatIn.ChSz+j];
+			if(typeof Code == "number" && Code != G_CAP_CODE_NONE) SeriesIO[j].push([X, capCodeToVolt(Code)]);
+		}
+		Cnt++;
+	}
+	return (Cnt);
+}
+
+
+//** CLASSES
+
+/*	Class:	read-out of capture.
+*	Input:
+*			ReadInptIn - function(Addr, Qty, Callback(Words)) reads input registers.	[FUNCTION]
+*			WriteHoldIn - function(Addr, Value, Callback()) writes holding register.	[FUNCTION]
+*/
+function CapReader(ReadInptIn, WriteHoldIn)
+{
+	//Public properties
+
+	//* status of the latest read-out	[OBJECT]
+	this.Stat		= null;
+
+	//* series (one per channel)	[ARRAY]
+	this.Series		= [];
+
+
+	//Private properties
+
+	var mRead		= ReadInptIn;
+	var mWrite		= WriteHoldIn;
+	var mSelf		= this;
+
+
+	//Methods
+
+	//Method:	read out frozen capture.
+	//Input:
+	//			DoneIn - function(Series, Stat), Series is null if capture is not frozen or lost.	[FUNCTION]
+	//Output:
+	//			none.
+	//
+	this.run = function(DoneIn)
+		{
+			mRead(G_CAP_INPT_STAT, 6, function(Words)
+				{
+					mSelf.Stat   = capDecodeStat(Words);
+					mSelf.Series = capNewSeries(mSelf.Stat);
+
+					if(!mSelf.Stat || mSelf.Stat.State != G_CAP_STATE_FROZEN || !mSelf.Stat.Len)
+					{
+						if(typeof DoneIn == "function") DoneIn(null, mSelf.Stat);
+						return;
+					}
+
+					var done = function(SeriesIn)
+						{
+							if(typeof DoneIn == "function") DoneIn(SeriesIn, mSelf.Stat);
+						};
+
+					var read = function(Cursor)
+						{
+							mRead(G_CAP_INPT_WIN, G_CAP_WIN_SCANS*mSelf.Stat.ChSz, function(Win)
+								{
+									capDecodeWin(mSelf.Stat, Cursor, Win, mSelf.Series);
+
+									var Next = capNextCursor(mSelf.Stat, Cursor);
+									if(Next >= 0) step(Next);
+									else done(mSelf.Series);
+								});
+						};
+
+					//window is refreshed by PLC after the cursor is written
+					var poll = function(Cursor, Cnt)
+						{
+							mRead(G_CAP_INPT_STAT, 6, function(Words)
+								{
+									var Stat = capDecodeStat(Words);
+
+									if(!Stat || Stat.State != G_CAP_STATE_FROZEN) done(null);
+									else if(Stat.Win == Cursor) read(Cursor);
+									else if(Cnt < G_CAP_WIN_POLL_MAX) poll(Cursor, Cnt+1);
+									else done(null);
+								});
+						};
+
+					var step = function(Cursor)
+						{
+							mWrite(G_CAP_HOLD_CURSOR, Cursor, function() { poll(Cursor, 0); });
+						};
+
+					step(0);
+				});
+		};
+
+	//Method:	arm capture.
+	//Input:
+	//			DoneIn - callback.	[FUNCTION]
+	//Output:
+	//			none.
+	//
+	this.arm = function(DoneIn)
+		{
+			mWrite(G_CAP_HOLD_CMD, G_CAP_CMD_ARM, DoneIn);
+		};
+
+	//Method:	release capture (ring is returned to ADC).
+	//Input:
+	//			DoneIn - callback.	[FUNCTION]
+	//Output:
+	//			none.
+	//
+	this.release = function(DoneIn)
+		{
+			mWrite(G_CAP_HOLD_CMD, G_CAP_CMD_RELEASE, DoneIn);
+		};
+}
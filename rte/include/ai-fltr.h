@@ -0,0 +1,115 @@
+/* @page ai-fltr.h
+ *       AI streaming filters (moving average, IIR, median)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Filter is fed by every ADC-code (12 ... 16 bit) of a channel,
+ *        only integer arithmetic is used (called from DMA ISR).
+ *
+ *        Types and parameter (Prm):
+ *        - PLC_AI_FLTR_OFF: no filter (average of the survey period)
+ *        - PLC_AI_FLTR_MA:  moving average (running sum)
+ *                           Prm = window (samples), 1 ... PLC_AI_FLTR_MA_SZ__MAX
+ *        - PLC_AI_FLTR_IIR: first-order IIR, y += K*(x-y)
+ *                           Prm = time constant (ms), 1 ... PLC_AI_FLTR_IIR_TAU__MAX
+ *                           K = Ts/(Tau+Ts) (Q24), state y is Q16
+ *        - PLC_AI_FLTR_MED: median (spike rejection)
+ *                           Prm = window (samples, odd), 3 ... PLC_AI_FLTR_MED_SZ__MAX
+ *
+ *        Output is the average of the values that are already fed
+ *        until the window is full (MA, MED), IIR starts from the first value.
+ */
+
+#ifndef AI_FLTR_H_
+#define AI_FLTR_H_
+
+#include <stdint.h>
+#include "bit.h"
+
+
+/** @def Types
+ */
+#define PLC_AI_FLTR_OFF                          (uint8_t)0  //off
+#define PLC_AI_FLTR_MA                           (uint8_t)1  //moving average
+#define PLC_AI_FLTR_IIR                          (uint8_t)2  //first-order IIR
+#define PLC_AI_FLTR_MED                          (uint8_t)3  //median
+//by default
+#define PLC_AI_FLTR_DEF                          PLC_AI_FLTR_OFF
+
+/** @def Parameter
+ */
+#define PLC_AI_FLTR_MA_SZ__MAX                   (uint16_t)64     //samples
+#define PLC_AI_FLTR_MED_SZ__MIN                  (uint16_t)3      //samples
+#define PLC_AI_FLTR_MED_SZ__MAX                  (uint16_t)7      //samples
+#define PLC_AI_FLTR_IIR_TAU__MAX                 (uint16_t)10000  //ms
+//by default
+#define PLC_AI_FLTR_PRM_DEF                      (uint16_t)0
+
+/** @def Fixed point
+ */
+#define PLC_AI_FLTR_Y_Q                          16  //IIR state
+#define PLC_AI_FLTR_K_Q                          24  //IIR factor
+
+
+/** @typedef Filter
+ */
+typedef struct PlcAI_Fltr_t_
+{
+	//SETTINGS
+
+	//@var Type
+	uint8_t Type;
+
+	//@var Window (MA, MED)
+	uint16_t Sz;
+
+	//@var Factor (IIR, Q24)
+	uint32_t K;
+
+	//STATE
+
+	//@var Ring buffer (MA, MED)
+	uint16_t Buff[PLC_AI_FLTR_MA_SZ__MAX];
+	uint16_t iBuff;
+	uint16_t Cnt;
+
+	//@var Running sum (MA)
+	uint32_t Sum;
+
+	//@var State (IIR, Q16)
+	int64_t Y;
+
+	//@var Output (ADC-code)
+	uint16_t Out;
+
+} PlcAI_Fltr_t;
+
+
+/** @brief  Set filter.
+ *  @param  FltrIn - pointer to filter.
+ *  @param  TypeIn - type (PLC_AI_FLTR_...).
+ *  @param  PrmIn - parameter (limited by type).
+ *  @param  TsIn - sample period (us).
+ *  @return Result:
+ *  @arg    = 0 - unknown type (filter is off)
+ *  @arg    = 1 - OK
+ *  @note   Filter is reset.
+ */
+uint8_t PlcAI_Fltr_Set(PlcAI_Fltr_t *FltrIn, uint8_t TypeIn, uint16_t PrmIn, uint32_t TsIn);
+
+/** @brief  Reset state of filter.
+ *  @param  FltrIn - pointer to filter.
+ *  @return None.
+ */
+void PlcAI_Fltr_Reset(PlcAI_Fltr_t *FltrIn);
+
+/** @brief  Feed filter by a value.
+ *  @param  FltrIn - pointer to filter.
+ *  @param  ValIn - value (ADC-code).
+ *  @return Output (ADC-code).
+ */
+uint16_t PlcAI_Fltr_Put(PlcAI_Fltr_t *FltrIn, uint16_t ValIn);
+
+#endif /* AI_FLTR_H_ */
@@ -0,0 +1,106 @@
+/* @page ai-lin.h
+ *       AI linearization (piecewise-linear table, polynomial)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Linearization is the last stage of scaling: Y = Lin(Ka*V+Kb),
+ *        it is defined by data only (type, size and table of REAL values).
+ *
+ *        Types and table (Tbl[0 ... PLC_AI_LIN_TBL_SZ-1], Sz):
+ *        - PLC_AI_LIN_OFF:  Y = X
+ *        - PLC_AI_LIN_TBL:  piecewise-linear table of Sz points (2 ... PLC_AI_LIN_PTS__MAX)
+ *                           Tbl = X0, Y0, X1, Y1, ... (X is strictly ascending)
+ *                           uniform step of X is indexed directly (O(1)),
+ *                           otherwise segment is found by binary search
+ *        - PLC_AI_LIN_POLY: polynomial of Sz coefficients (1 ... PLC_AI_LIN_POLY__MAX)
+ *                           of normalized input U = (X-Xmin)/(Xmax-Xmin), 0 ... 1
+ *                           Tbl = Xmin, Xmax, C0, C1, ... (Y = C0 + C1*U + C2*U^2 + ...)
+ *
+ *        Output is limited by the first and the last point (TBL), by Xmin and Xmax (POLY).
+ *
+ *        Only integer arithmetic is used for evaluation:
+ *        X, Y and coefficients are Q16 (|value| < PLC_AI_LIN_VAL__MAX), U is Q30,
+ *        coefficients of normalized input are of the same order as Y
+ *        (coefficients of a polynomial of X should be refitted on U).
+ */
+
+#ifndef AI_LIN_H_
+#define AI_LIN_H_
+
+#include <stdint.h>
+#include "bit.h"
+
+
+/** @def Types
+ */
+#define PLC_AI_LIN_OFF                           (uint8_t)0  //off
+#define PLC_AI_LIN_TBL                           (uint8_t)1  //piecewise-linear table
+#define PLC_AI_LIN_POLY                          (uint8_t)2  //polynomial
+//by default
+#define PLC_AI_LIN_DEF                           PLC_AI_LIN_OFF
+
+/** @def Size of table
+ */
+#define PLC_AI_LIN_PTS__MAX                      (uint8_t)16                        //points (TBL)
+#define PLC_AI_LIN_POLY__MAX                     (uint8_t)8                         //coefficients (POLY)
+#define PLC_AI_LIN_TBL_SZ                        (uint16_t)(2*PLC_AI_LIN_PTS__MAX)  //REAL values per channel
+//by default
+#define PLC_AI_LIN_SZ_DEF                        (uint8_t)0
+#define PLC_AI_LIN_TBL_DEF                       (float)0.0
+
+/** @def Fixed point
+ */
+#define PLC_AI_LIN_Q                             16             //X, Y, coefficients
+#define PLC_AI_LIN_U_Q                           30             //normalized input
+#define PLC_AI_LIN_VAL__MAX                      (float)32767.0 //limit of values
+
+
+/** @typedef Linearization
+ */
+typedef struct PlcAI_Lin_t_
+{
+	//@var Type
+	uint8_t Type;
+
+	//@var Quantity of points (TBL) or coefficients (POLY)
+	uint8_t Sz;
+
+	//@var Points X, Y (TBL, Q16)
+	//     Xmin, Xmax (POLY: X[0], X[1], Q16), coefficients (POLY: Y[], Q16)
+	int32_t X[PLC_AI_LIN_PTS__MAX];
+	int32_t Y[PLC_AI_LIN_PTS__MAX];
+
+	//@var Step of X (TBL, Q16, 0 - not uniform)
+	int32_t Step;
+
+} PlcAI_Lin_t;
+
+
+/** @brief  Set linearization.
+ *  @param  LinIn - pointer to linearization.
+ *  @param  TypeIn - type (PLC_AI_LIN_...).
+ *  @param  SzIn - quantity of points (TBL) or coefficients (POLY).
+ *  @param  TblIn - table [PLC_AI_LIN_TBL_SZ].
+ *  @return Result:
+ *  @arg    = 0 - invalid type or table (linearization is off)
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcAI_Lin_Set(PlcAI_Lin_t *LinIn, uint8_t TypeIn, uint8_t SzIn, const float *TblIn);
+
+/** @brief  Calculate output (fixed point).
+ *  @param  LinIn - pointer to linearization.
+ *  @param  XIn - input (Q16).
+ *  @return Output (Q16).
+ */
+int32_t PlcAI_Lin_Calc(const PlcAI_Lin_t *LinIn, int32_t XIn);
+
+/** @brief  Calculate output.
+ *  @param  LinIn - pointer to linearization.
+ *  @param  XIn - input.
+ *  @return Output.
+ */
+float PlcAI_Lin_Put(const PlcAI_Lin_t *LinIn, float XIn);
+
+#endif /* AI_LIN_H_ */
@@ -0,0 +1,137 @@
+/* @page app-prof.h
+ *       Scan-time profiler of application (min/max/avg, histogram)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Profiler is fed by durations of phases of every scan (any time unit,
+ *        e.g. core clock cycles), only integer arithmetic is used.
+ *
+ *        Phases:
+ *        - PLC_APP_PROF_LOCK: waiting for Modbus tables (both locks of scan)
+ *        - PLC_APP_PROF_IN:   input image and REG_CopyMbToApp()
+ *        - PLC_APP_PROF_RUN:  PlcApp_Run()
+ *        - PLC_APP_PROF_OUT:  REG_CopyAppToMb()
+ *        - PLC_APP_PROF_SCAN: whole scan (from release to the end)
+ *
+ *        Statistics of phase: min., max. and rolling average
+ *        (exponential, weight of the latest scan is 1/2^PLC_APP_PROF_AVG_SH).
+ *
+ *        Histogram of scan: PLC_APP_PROF_HIST_SZ bins of equal width
+ *        in fractions of scan period, bin i counts scans of
+ *        i/HIST_SZ ... (i+1)/HIST_SZ of period, the last bin counts all
+ *        longer scans too; read-out is a share of scans (0.01 %).
+ *
+ *        Statistics are accumulated until reset.
+ */
+
+#ifndef APP_PROF_H_
+#define APP_PROF_H_
+
+#include <stdint.h>
+#include "bit.h"
+
+
+/** @def Phases
+ */
+#define PLC_APP_PROF_LOCK                        (uint8_t)0  //waiting for Modbus tables
+#define PLC_APP_PROF_IN                          (uint8_t)1  //input image, REG_CopyMbToApp()
+#define PLC_APP_PROF_RUN                         (uint8_t)2  //PlcApp_Run()
+#define PLC_APP_PROF_OUT                         (uint8_t)3  //REG_CopyAppToMb()
+#define PLC_APP_PROF_SCAN                        (uint8_t)4  //whole scan
+//number of phases
+#define PLC_APP_PROF_SZ                          (uint8_t)5
+
+/** @def Histogram of scan
+ */
+#define PLC_APP_PROF_HIST_SZ                     (uint8_t)8      //bins
+#define PLC_APP_PROF_HIST_FULL                   (uint16_t)10000 //share of all scans (0.01 %)
+
+/** @def Rolling average (weight of the latest scan is 1/2^SH)
+ */
+#define PLC_APP_PROF_AVG_SH                      4
+
+
+/** @typedef Statistics of phase
+ */
+typedef struct PlcAppProf_Ph_t_
+{
+	//@var Min. (0xFFFFFFFF - no scans)
+	uint32_t Min;
+
+	//@var Max.
+	uint32_t Max;
+
+	//@var Rolling average (<< PLC_APP_PROF_AVG_SH)
+	uint64_t Avg;
+
+} PlcAppProf_Ph_t;
+
+/** @typedef Profiler
+ */
+typedef struct PlcAppProf_t_
+{
+	//@var Phases
+	PlcAppProf_Ph_t Ph[PLC_APP_PROF_SZ];
+
+	//@var Histogram of scan
+	uint32_t Hist[PLC_APP_PROF_HIST_SZ];
+
+	//@var Quantity of scans
+	uint32_t Cnt;
+
+} PlcAppProf_t;
+
+
+/** @brief  Reset profiler.
+ *  @param  ProfIn - pointer to profiler.
+ *  @return None.
+ */
+void PlcAppProf_Reset(PlcAppProf_t *ProfIn);
+
+/** @brief  Put duration of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_LOCK ... PLC_APP_PROF_OUT).
+ *  @param  ValIn - duration.
+ *  @return None.
+ */
+void PlcAppProf_Put(PlcAppProf_t *ProfIn, uint8_t PhIn, uint32_t ValIn);
+
+/** @brief  Put duration of scan (the last phase of scan).
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  ValIn - duration.
+ *  @param  PeriodIn - scan period (the same unit, 0 - unknown).
+ *  @return None.
+ */
+void PlcAppProf_PutScan(PlcAppProf_t *ProfIn, uint32_t ValIn, uint32_t PeriodIn);
+
+/** @brief  Get min. of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_...).
+ *  @return Min. (0 - no scans).
+ */
+uint32_t PlcAppProf_GetMin(const PlcAppProf_t *ProfIn, uint8_t PhIn);
+
+/** @brief  Get max. of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_...).
+ *  @return Max.
+ */
+uint32_t PlcAppProf_GetMax(const PlcAppProf_t *ProfIn, uint8_t PhIn);
+
+/** @brief  Get rolling average of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_...).
+ *  @return Average.
+ */
+uint32_t PlcAppProf_GetAvg(const PlcAppProf_t *ProfIn, uint8_t PhIn);
+
+/** @brief  Get bin of histogram.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  BinIn - bin (0 ... PLC_APP_PROF_HIST_SZ-1).
+ *  @return Share of scans (0 ... PLC_APP_PROF_HIST_FULL).
+ */
+uint16_t PlcAppProf_GetHist(const PlcAppProf_t *ProfIn, uint8_t BinIn);
+
+#endif /* APP_PROF_H_ */
@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include "plc_abi.h"
 #include "di.h"
+#include "do.h"
 #include "reg.h"
 #include "rtos.h"
 
@@ -23,6 +24,7 @@
 #define PLC_APP_DI_ERR_NOT_TACH  2  //the channel is not Tachometer
 #define PLC_APP_DI_ERR_NOT_CNTR  2  //the channel is not Counter
 #define PLC_APP_DI_ERR_INC       3  //try to set inc-mode for not Master-channels
+#define PLC_APP_DI_ERR_DON       4  //invalid DO-channel number
 
 
 /** @brief DIMode.
@@ -72,6 +74,24 @@ void PlcApp_DITach(BYTE *DIn, WORD *Ref, BOOL *RefEn, WORD *Ov, BOOL *Oref, BYTE
  */
 void PlcApp_DICntr(BYTE *DIn, DWORD *Ref, BOOL *RefEn, DWORD *Ov, BOOL *Oref, BYTE *Ok);
 
+/** @brief DICntrCmp (counter compare-match).
+ *         The DO-channel is switched from EXTI as soon as the counter reaches the reference
+ *         and holds the value until the counter is reset or the compare-match is re-armed.
+ *  @param DIn  - channel number:
+ *  @arg      = 0..7
+ *  @param Ref - reference
+ *  @param CmpEn - allow compare-match
+ *  @arg      = false - not allow
+ *  @arg      = true  - allow
+ *  @param DOn  - DO-channel number
+ *  @param DOv  - DO-value that is set on compare-match
+ *  @param Ov   - counter value
+ *  @param Ocmp - compare-match status
+ *  @param Ok   - result code
+ *  @return None.
+ */
+void PlcApp_DICntrCmp(BYTE *DIn, DWORD *Ref, BOOL *CmpEn, BYTE *DOn, BOOL *DOv, DWORD *Ov, BOOL *Ocmp, BYTE *Ok);
+
 /** @brief DICntrRst.
  *  @param DIn  - channel number:
  *  @arg      = 0..7
@@ -22,6 +22,8 @@
 #define PLC_APP_DO_ERR_NOT_NORM  2  //the channel is not Normal
 #define PLC_APP_DO_ERR_NOT_FAST  2  //the channel is not Fast
 #define PLC_APP_DO_ERR_NOT_PWM   2  //the channel is not PWM
+#define PLC_APP_DO_ERR_NOT_PTO   2  //the channel is not PTO
+#define PLC_APP_DO_ERR_PTO       3  //invalid PTO settings (train is not started)
 
 
 /** @brief DOMode.
@@ -74,4 +76,26 @@ void PlcApp_DOFast(BYTE *DOn, BOOL *V, BOOL *Ov, BYTE *Ok);
  */
 void PlcApp_DOPwm(BOOL *En, BYTE *DOn, REAL *Tm, REAL *D, BOOL *Ow, BYTE *Ok);
 
+/** @brief DOPto.
+ *  @param En - start/stop of pulse train:
+ *  @arg      = rising edge  - start
+ *  @arg      = falling edge - stop (abort)
+ *  @param DOn  - channel number:
+ *  @arg      = 0..7
+ *  @param N   - number of pulses:
+ *  @arg      = 1..16777216
+ *  @param F0  - start frequency (Hz)
+ *  @param F1  - max. frequency (Hz)
+ *  @param Acc - acceleration (Hz/s):
+ *  @arg      = 0 - no ramps
+ *  @param Prof - profile:
+ *  @arg      = 0 - trapezoid
+ *  @arg      = 1 - S-curve
+ *  @param Ob - pulse train is running (busy)
+ *  @param Od - pulse train is done
+ *  @param Ok - result code
+ *  @return None.
+ */
+void PlcApp_DOPto(BOOL *En, BYTE *DOn, DWORD *N, DWORD *F0, DWORD *F1, DWORD *Acc, BYTE *Prof, BOOL *Ob, BOOL *Od, BYTE *Ok);
+
 #endif //APP_DO_H
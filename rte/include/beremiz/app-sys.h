@@ -12,6 +12,8 @@
 #include "soft-reset.h"
 #include "reg.h"
 #include "rtos.h"
+#include "plc_rtc.h"
+#include "plc_tick.h"
 
 #ifdef DEBUG
 #include "debug-log.h"
@@ -27,11 +29,19 @@
 void PlcApp_SoftwareReset(BOOL Ex);
 
 /** @brief  Get SysTime.
- *  @param  None.
+ *  @param  CurrentTimeIn - pointer to time (result).
  *  @return None.
+ *  @note   Time of the current scan (wall clock, ns), see plc_rtc.h.
  */
 void PlcApp_GetTime(IEC_TIME *CurrentTimeIn);
 
+/** @brief  Set scan timer.
+ *  @param  NextIn - delay of the first scan (ns), 0 - at once.
+ *  @param  PeriodIn - scan period (ns), 0 - scans are not released.
+ *  @return None.
+ */
+void PlcApp_SetTimer(unsigned long long NextIn, unsigned long long PeriodIn);
+
 /** @brief LED_USER Control.
  *  @param V  - output level:
  *  @arg      = 0
@@ -0,0 +1,84 @@
+/* @page dt.h
+ *       Date and time (calendar <-> seconds)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Seconds are counted since 1970-01-01 00:00:00 (epoch of IEC DT),
+ *        leap seconds are not counted.
+ *
+ *        Valid range is the range of RTC:
+ *        PLC_DT_YEAR__MIN-01-01 00:00:00 ... PLC_DT_YEAR__MAX-12-31 23:59:59
+ */
+
+#ifndef DT_H_
+#define DT_H_
+
+#include <stdint.h>
+#include "bit.h"
+
+
+/** @def Range of years
+ */
+#define PLC_DT_YEAR__MIN                         (uint16_t)2000
+#define PLC_DT_YEAR__MAX                         (uint16_t)2099
+
+/** @def Seconds per day
+ */
+#define PLC_DT_SEC_PER_DAY                       (uint32_t)86400
+
+
+/** @typedef Date and time
+ */
+typedef struct PlcDt_t_
+{
+	//@var Year (PLC_DT_YEAR__MIN ... PLC_DT_YEAR__MAX)
+	uint16_t Year;
+
+	//@var Month (1 ... 12)
+	uint8_t Mon;
+
+	//@var Day of month (1 ... 31)
+	uint8_t Day;
+
+	//@var Hours (0 ... 23)
+	uint8_t Hour;
+
+	//@var Minutes (0 ... 59)
+	uint8_t Min;
+
+	//@var Seconds (0 ... 59)
+	uint8_t Sec;
+
+} PlcDt_t;
+
+
+/** @brief  Check date and time.
+ *  @param  DtIn - pointer to date and time.
+ *  @return Result:
+ *  @arg    = 0 - invalid
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcDt_IsValid(const PlcDt_t *DtIn);
+
+/** @brief  Convert date and time into seconds.
+ *  @param  DtIn - pointer to date and time (valid).
+ *  @return Seconds since 1970-01-01.
+ */
+uint32_t PlcDt_ToSec(const PlcDt_t *DtIn);
+
+/** @brief  Convert seconds into date and time.
+ *  @param  SecIn - seconds since 1970-01-01.
+ *  @param  DtOut - pointer to date and time.
+ *  @return None.
+ */
+void PlcDt_FromSec(uint32_t SecIn, PlcDt_t *DtOut);
+
+/** @brief  Get day of week.
+ *  @param  DtIn - pointer to date and time (valid).
+ *  @return Day of week (1 - Monday ... 7 - Sunday).
+ */
+uint8_t PlcDt_GetWday(const PlcDt_t *DtIn);
+
+#endif /* DT_H_ */
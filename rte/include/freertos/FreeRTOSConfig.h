@@ -82,7 +82,11 @@ extern uint32_t SystemCoreClock;
 #define configUSE_APPLICATION_TASK_TAG			0
 
 /* Hook function related definitions */
+#ifdef RTE_MOD_APP
+#define configUSE_IDLE_HOOK						1	//background check of application image (rtos-app.c)
+#else
 #define configUSE_IDLE_HOOK						0
+#endif //RTE_MOD_APP
 #define configUSE_TICK_HOOK						0
 #define configCHECK_FOR_STACK_OVERFLOW			0
 #define configUSE_MALLOC_FAILED_HOOK			0
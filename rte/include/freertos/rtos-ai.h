@@ -21,10 +21,10 @@
 
 #ifdef RTE_MOD_AI
 
-/** @brief  AI_TIM Handler (one-shot).
+/** @brief  TIM_AI Handler (auto-reload).
  *  @param  TimerIn - timer.
  *  @return None.
- *  @note   Delay of ADC conversion.
+ *  @note   Publish of values accumulated by ADC since the last period.
  */
 void RTOS_AI_TIM_Handler(TimerHandle_t TimerIn);
 
@@ -34,6 +34,14 @@ void RTOS_AI_TIM_Handler(TimerHandle_t TimerIn);
   */
 void RTOS_AI_Task(void *ParamsIn);
 
+/** @brief  Latch values of all channels (input image).
+ *  @param  ValOut - values [PLC_AI_SZ].
+ *  @return None.
+ *  @note   Called by APP_T at the start of scan (scheduler is suspended).
+ *          Values of the latest survey period are returned (not limited by deadband).
+ */
+void RTOS_AI_Latch(float *ValOut);
+
 #endif //RTE_MOD_AI
 
 #endif //RTOS_AI_H
@@ -15,23 +15,90 @@
 #endif //RTE_MOD_APP_DEBUG_HANDLER
 
 #include "rtos-led.h"
+#include "rtos-di.h"
+#include "rtos-ai.h"
+#include "app-prof.h"
+#include "dwt.h"
+
+#ifdef RTE_MOD_DO
+#include "sfty.h"
+#endif //RTE_MOD_DO
+
+#ifdef RTE_MOD_APP_TIM
+#include "tim4.h"
+#endif //RTE_MOD_APP_TIM
 
 #ifdef DEBUG
 #include "debug-log.h"
 #endif // DEBUG
 
 
-/** @brief  Task APP_T (non-blocking)
+/** @typedef Input image
+ *           (latched at the start of scan, copied into located variables)
+ */
+typedef struct RTOS_APP_InImg_t_
+{
+	//@var Time of latch (ms)
+	uint32_t Ts;
+
+#ifdef RTE_MOD_DI
+	//@var DI normal values
+	uint8_t DiNorm[PLC_DI_SZ];
+
+	//@var DI counter values
+	uint32_t DiCntr[PLC_DI_SZ];
+
+	//@var DI tachometer values
+	uint16_t DiTach[PLC_DI_SZ];
+#endif //RTE_MOD_DI
+
+#ifdef RTE_MOD_AI
+	//@var AI values
+	float AiVal[PLC_AI_SZ];
+#endif //RTE_MOD_AI
+
+} RTOS_APP_InImg_t;
+
+
+#ifdef RTE_MOD_APP_TIM
+/** @typedef Group of tasks of application
+ *           (tasks of the same priority run by one RTOS-task)
+ */
+typedef struct RTOS_APP_Grp_t_
+{
+	//@var RTOS-task (group 0 - APP_T, group of event tasks - APPE_T)
+	TaskHandle_t T;
+
+	//@var Tasks of group (bit i - task i)
+	uint8_t Tasks;
+
+	//@var Tasks released by the current tick of scan timer
+	uint8_t Rel;
+
+	//@var Tasks of the current run
+	volatile uint8_t Due;
+
+	//@var Run is released and not completed (set by TIM4 ISR, reset by RTOS-task; APP_T - RTOS_APP_BUSY)
+	volatile uint8_t Busy;
+
+} RTOS_APP_Grp_t;
+#endif //RTE_MOD_APP_TIM
+
+
+/** @brief  Request reset of scan statistics (SYS_CMD.PROF_RST).
+ *  @param  None.
+ *  @return None.
+ *  @note   Statistics are reset by APP_T before the next scan
+ *          (profiler, overruns, max. of release jitter).
+ */
+void RTOS_APP_ProfReset(void);
+
+/** @brief  Task APP_T
  *  @param  ParamsIn - pointer to additional task parameters.
  *  @return none.
  */
 void RTOS_APP_Task(void *ParamsIn);
 
-/** @brief  APP_TIM Handler (one-shot)
- *  @param  TimerIn - timer.
- *  @return none.
- */
-void RTOS_APP_TIM_Handler(TimerHandle_t TimerIn);
 
 
 #endif //RTOS_TASK_APP_H
@@ -17,6 +17,10 @@
 
 #include "rtos-led.h"
 
+#ifdef RTE_MOD_DO
+#include "sfty.h"
+#endif //RTE_MOD_DO
+
 
 #ifdef RTE_MOD_COM2
 
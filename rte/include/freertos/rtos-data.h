@@ -12,10 +12,12 @@
 
 #ifdef RTE_MOD_DI
 #include "di.h"
+#include "rtos-di.h"
 #endif //RTE_MOD_DI
 
 #ifdef RTE_MOD_DO
 #include "do.h"
+#include "sfty.h"
 #endif //RTE_MOD_DO
 
 #ifdef RTE_MOD_AI
@@ -24,6 +26,19 @@
 
 #include "rtos-led.h"
 
+#ifdef RTE_MOD_APP
+#include "rtos-app.h"
+#endif //RTE_MOD_APP
+
+#ifdef RTE_MOD_SYS_REG
+#include "plc_rtc.h"
+#endif //RTE_MOD_SYS_REG
+
+#ifdef RTE_MOD_RETAIN
+#include "plc_app.h"
+#include "plc_backup.h"
+#endif //RTE_MOD_RETAIN
+
 
 /** @brief  Task DATA_T
  *  @param  ParamsIn - pointer to additional task parameters.
@@ -8,9 +8,11 @@
 #define RTOS_TASK_DI_H
 
 #include "di.h"
+#include "do.h"
 
 #include "reg.h"
 #include "rtos.h"
+#include "systick.h"
 
 #ifdef DEBUG
 #include "debug-log.h"
@@ -31,6 +33,24 @@ void RTOS_DI_IRQ_Task(void *ParamsIn);
  */
 void RTOS_DI_Task(void *ParamsIn);
 
+/** @brief  Read Event log record.
+ *  @param  ChIn  - channel number.
+ *  @param  SeqIn - record number.
+ *  @return Record or PLC_DI_EVT_REC_NONE (not captured yet or overwritten).
+ */
+uint32_t RTOS_DI_ReadEvt(uint8_t ChIn, uint32_t SeqIn);
+
+/** @brief  Latch input values of all channels (input image).
+ *  @param  NormOut - normal values [PLC_DI_SZ].
+ *  @param  CntrOut - counter values [PLC_DI_SZ].
+ *  @param  TachOut - tachometer values [PLC_DI_SZ].
+ *  @return None.
+ *  @note   Called by APP_T at the start of scan (scheduler is suspended).
+ *          Pins are read by one pass of GPIO (IDR),
+ *          filtered channels return the filtered value.
+ */
+void RTOS_DI_Latch(uint8_t *NormOut, uint32_t *CntrOut, uint16_t *TachOut);
+
 
 /** @brief  DI_TACH_TIM Handler (one-shot)
  *  @param  TimerIn - timer.
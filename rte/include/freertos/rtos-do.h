@@ -8,6 +8,7 @@
 #define RTOS_TASK_DO_H
 
 #include "do.h"
+#include "sfty.h"
 
 #include "reg.h"
 #include "rtos.h"
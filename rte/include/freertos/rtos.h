@@ -107,6 +107,10 @@ extern TimerHandle_t RTOS_DI_TACH_TIM;
 #define RTOS_DI_FLTR_TIM_TM            (TickType_t)PLC_DI_FLTR_DELAY_MS
 extern TimerHandle_t RTOS_DI_FLTR_TIM;
 
+/** @def Event log survey period (DI_T)
+ */
+#define RTOS_DI_EVT_SURVEY_TM          (TickType_t)PLC_DI_EVT_SURVEY_PERIOD_MS
+
 #endif //RTE_MOD_DI
 
 
@@ -161,8 +165,8 @@ extern QueueHandle_t RTOS_AI_Q;
 #define RTOS_AI_DATA_Q_SZ     		   (UBaseType_t)(PLC_AI_SZ*16)
 extern QueueHandle_t RTOS_AI_DATA_Q;
 
-/** @var Timer AI_TIM (one-shot)
- *  @note survey period
+/** @var Timer AI_TIM (auto-reload)
+ *  @note survey (publish) period
  */
 #define RTOS_AI_TIM_NAME               "AI_TIM"
 #define RTOS_AI_TIM_TM                 (TickType_t)PLC_AI_SURVEY_PERIOD_MS
@@ -199,6 +203,28 @@ extern QueueHandle_t RTOS_LED_Q;
 #define RTOS_DATA_T_STACK_SZ           (configSTACK_DEPTH_TYPE)256
 #define RTOS_DATA_T_PRIORITY           (UBaseType_t)PLC_RTOS_PRIO_T_DATA
 
+/** @def Period of publishing of wall clock (ms)
+ *  @note SYS_STAT.RTC_... are written on change of second
+ */
+#define RTOS_DATA_RTC_PUB_TM           (uint32_t)100
+
+/** @def Period of checking of wall clock by RTC (ms)
+ */
+#define RTOS_DATA_RTC_SYNC_TM          (uint32_t)60000
+
+/** @def Period of committing of retain-data into flash while application is started (ms)
+ *  @note changes of the last period may be lost by power loss,
+ *        a shorter period wears flash faster (wear budget see retain.h),
+ *        while application is stopped retain-data are committed at once
+ */
+#define RTOS_DATA_RETAIN_FLUSH_TM      (uint32_t)60000
+
+/** @def Delay of reclaim of the spare sector after commit while application is started (ms)
+ *  @note the old sector of the last compaction is erased once between commits
+ *        (CPU is stalled by erasing, see retain.h), so commits are not deferred
+ */
+#define RTOS_DATA_RETAIN_PREP_TM       (uint32_t)(RTOS_DATA_RETAIN_FLUSH_TM/2)
+
 #endif // RTE_MOD_DATA
 
 
@@ -238,22 +264,85 @@ extern QueueHandle_t RTOS_COM2_Q;
 
 #ifdef RTE_MOD_APP
 
-/** @def Task APP_T (non-blocking)
+/** @def Task APP_T
+ *  @note scan is released by notification from scan timer (TIM4, RTE_MOD_APP_TIM),
+ *        the task is woken every RTOS_APP_T_POLL_TM to serve debug-handler
  */
 #define RTOS_APP_T_NAME                "APP_T"
 #define RTOS_APP_T_STACK_SZ            (configSTACK_DEPTH_TYPE)2048
 #define RTOS_APP_T_PRIORITY            (UBaseType_t)PLC_RTOS_PRIO_T_APP
+#define RTOS_APP_T_POLL_TM             (TickType_t)1
+extern TaskHandle_t RTOS_APP_T;
+
+/** @def Tasks APPG_T (groups of tasks of application)
+ *  @note tasks of application are grouped by priority, group 0 is run by APP_T,
+ *        group i is run by APPG_T of priority RTOS_APP_T_PRIORITY-i (created by APP_T if it is needed),
+ *        so PLC_RTOS_PRIO_T_APP must be >= RTOS_APP_GRP_SZ
+ */
+#define RTOS_APP_GRP_SZ                (uint8_t)3
+#define RTOS_APPG_T_NAME               "APPG_T"
+#define RTOS_APPG_T_STACK_SZ           (configSTACK_DEPTH_TYPE)1024
+
+/** @def Mutex APP_RUN (RTE_MOD_APP_SERIAL: runs of periodic tasks of application by APP_T, APPG_T)
+ *  @note By default runs of groups preempt each other (the start of a group is not delayed by lower groups),
+ *        tasks of application share variables without locking, so every variable is owned by one group:
+ *        - located variables are synced by registers of due tasks only (REG_t.AppTasks),
+ *        - non-located variable is written by tasks of one group only (the same IEC priority, or event tasks),
+ *          tasks of other groups may read it (up to 32 bits it is consistent, LREAL, LINT, strings
+ *          and structures may be read in the middle of update),
+ *        - retain and debug-handler are served by APP_T, values of other groups may be taken in the middle of their run.
+ *        RTE_MOD_APP_SERIAL (config.h) - runs of APP_T and APPG_T are serialized (one run at a time, as by a single scan):
+ *        a run waits for the current run of a lower group (priority inheritance) up to RTOS_APP_RUN_MTX_TM,
+ *        on timeout the run is missed (overrun) and debug-handler is served by the next poll.
+ *        APPE_T never waits for the mutex (latency of event does not depend on runs of periodic tasks),
+ *        so variables of event tasks are owned by event tasks in both modes.
+ */
+#ifdef RTE_MOD_APP_SERIAL
+#define RTOS_APP_RUN_MTX_TM            (TickType_t)1
+extern SemaphoreHandle_t RTOS_APP_RUN_MTX;
+#endif //RTE_MOD_APP_SERIAL
+
+/** @def Task APPE_T (tasks of application released by events, SINGLE)
+ *  @note created by APP_T if any task has event,
+ *        priority is above APP_T and below DI_IRQ_T (DI value is taken before the run),
+ *        latency of event = ISR + task switch + wait for RTOS_MBTABLES_MTX (critical section of holder),
+ *        APPE_T preempts runs of APP_T and APPG_T in any mode (see RTOS_APP_RUN_MTX)
+ */
+#define RTOS_APPE_T_NAME               "APPE_T"
+#define RTOS_APPE_T_STACK_SZ           (configSTACK_DEPTH_TYPE)1024
+#define RTOS_APPE_T_PRIORITY           (UBaseType_t)PLC_RTOS_PRIO_T_APP_EVT
+#define RTOS_APP_GRP_EVT               RTOS_APP_GRP_SZ    //group of tasks run by APPE_T
+
+/** @def Sources of events (SINGLE of tasks of application)
+ */
+#define RTOS_APP_TRIG_DI_EDGE          (uint8_t)0     //rising edge of DI (DI.NORM_VAL)
+#define RTOS_APP_TRIG_DI_CNTR          (uint8_t)1     //counter setpoint is reached (DI.CNTR_SETPOINT_REACHED)
+#define RTOS_APP_TRIG_AI_THR           (uint8_t)2     //threshold is reached (AI.THR_REACHED)
+#define RTOS_APP_TRIG_SZ               (uint8_t)3
+#define RTOS_APP_TRIG_CH_SZ            (uint8_t)32    //channels of source (bits of RTOS_APP_Trig_t.Ch)
+
+/** @typedef Events of sources (set by APP_T, called by sources)
+ */
+typedef struct RTOS_APP_Trig_t_
+{
+	//@var Channels of source bound to events (bit i - channel i)
+	volatile uint32_t Ch[RTOS_APP_TRIG_SZ];
+
+	//@var Release tasks bound to event (TaskWokenOut: ISR, NULL - RTOS-task), set before Ch
+	void (*Func)(uint8_t SrcIn, uint8_t ChIn, BaseType_t *TaskWokenOut);
+
+} RTOS_APP_Trig_t;
+
+extern RTOS_APP_Trig_t RTOS_APP_TRIG;
 
-/** @def Semaphore APP_SEMA
+/** @def Scan period by default (ns)
+ *  @note application has no common_ticktime
  */
-extern SemaphoreHandle_t RTOS_APP_SEMA;
+#define RTOS_APP_TIM_TM_NS             (uint64_t)1000000
 
-/** @var Timer APP_TIM (one-shot)
- *  @note application period
+/** @def Period of publishing of scan statistics (ms)
  */
-#define RTOS_APP_TIM_NAME              "APP_TIM"
-#define RTOS_APP_TIM_TM                (TickType_t)1
-extern TimerHandle_t RTOS_APP_TIM;
+#define RTOS_APP_PROF_PUB_TM           (uint32_t)100
 
 #endif //RTE_MOD_APP
 
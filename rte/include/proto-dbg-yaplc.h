@@ -15,6 +15,7 @@
 #include "uart1.h"
 
 #include "plc_app.h"
+#include "plc_rtc.h"
 
 #ifdef DEBUG
 #include "debug-log.h"
@@ -0,0 +1,140 @@
+/* @page pto.h
+ *       Pulse train profiles (PTO)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Profile is a sequence of runs (N pulses with the same period):
+ *
+ *        accel. runs -> cruise run -> decel. runs (mirror of accel.) -> terminal step
+ *
+ *        Every ramp is split into PLC_PTO_RAMP_SZ runs max.,
+ *        short ramps are built pulse-by-pulse (1 pulse per run).
+ *
+ *        Runs are packed into segments for the output driver:
+ *        - Segment.First ... Segment.First+Segment.Qty-1 - steps written one per pulse
+ *        - Segment.Rep                                   - extra pulses of the last step
+ *
+ *        Total quantity of pulses is exactly Cfg.Pulses.
+ *
+ *        Step layout matches TIMx registers ARR, RCR, CCR1, CCR2
+ *        (the driver writes a step by one DMA-burst).
+ */
+
+#ifndef PTO_H_
+#define PTO_H_
+
+#include <stdint.h>
+
+
+/** @def Max. quantity of runs per ramp
+ */
+#define PLC_PTO_RAMP_SZ                          64
+
+/** @def Max. quantity of steps (and segments) in profile
+ *       (accel. + cruise + decel. + terminal)
+ */
+#define PLC_PTO_STEPS_SZ                         (2*PLC_PTO_RAMP_SZ+2)
+
+/** @def Profile types
+ */
+#define PLC_PTO_PROFILE_TRAP                     (uint8_t)0  //trapezoid (constant acceleration)
+#define PLC_PTO_PROFILE_SCURVE                   (uint8_t)1  //S-curve (smoothstep, limited jerk)
+
+/** @def Result codes
+ */
+#define PLC_PTO_OK                               (uint8_t)0  //OK
+#define PLC_PTO_ERR_ARG                          (uint8_t)1  //invalid argument
+#define PLC_PTO_ERR_PULSES                       (uint8_t)2  //invalid quantity of pulses
+#define PLC_PTO_ERR_FREQ                         (uint8_t)3  //invalid frequency
+#define PLC_PTO_ERR_PROFILE                      (uint8_t)4  //invalid profile type
+
+/** @def Output channel (position of CCR in step)
+ */
+#define PLC_PTO_CCR1                             (uint8_t)0
+#define PLC_PTO_CCR2                             (uint8_t)1
+
+
+/** @typedef Step (one DMA-burst: ARR, RCR, CCR1, CCR2)
+ */
+typedef struct PlcPto_Step_t_
+{
+	//@var Period (ticks-1)
+	uint32_t Arr;
+	//@var Repetition counter (not used, keeps burst layout)
+	uint32_t Rcr;
+	//@var Pulse (ticks)
+	uint32_t Ccr[2];
+
+} PlcPto_Step_t;
+
+/** @typedef Segment
+ */
+typedef struct PlcPto_Seg_t_
+{
+	//@var Index of the first step
+	uint16_t First;
+	//@var Quantity of steps (one pulse per step)
+	uint16_t Qty;
+	//@var Extra pulses of the last step
+	uint32_t Rep;
+
+} PlcPto_Seg_t;
+
+/** @typedef Profile settings
+ */
+typedef struct PlcPto_Cfg_t_
+{
+	//@var Quantity of pulses
+	uint32_t Pulses;
+	//@var Start frequency (Hz)
+	uint32_t FreqStart;
+	//@var Max. frequency (Hz)
+	uint32_t FreqMax;
+	//@var Acceleration (Hz/s)
+	//@arg = 0 - no ramps (all pulses at FreqMax)
+	uint32_t Accel;
+	//@var Profile type
+	uint8_t  Profile;
+	//@var Output channel (PLC_PTO_CCR1, PLC_PTO_CCR2)
+	uint8_t  Ccr;
+	//@var Timer tick frequency (Hz)
+	uint32_t TickHz;
+	//@var Period limits (ARR)
+	uint32_t ArrMin;
+	uint32_t ArrMax;
+
+} PlcPto_Cfg_t;
+
+/** @typedef Profile
+ */
+typedef struct PlcPto_Prof_t_
+{
+	//@var Steps
+	PlcPto_Step_t Steps[PLC_PTO_STEPS_SZ];
+	//@var Quantity of steps (terminal step included)
+	uint16_t StepsQty;
+
+	//@var Segments
+	PlcPto_Seg_t Segs[PLC_PTO_STEPS_SZ];
+	//@var Quantity of segments
+	uint16_t SegsQty;
+
+	//@var Quantity of pulses in every ramp
+	uint32_t RampPulses;
+
+} PlcPto_Prof_t;
+
+
+/** @brief  Build profile.
+ *  @param  CfgIn  - pointer to settings.
+ *  @param  ProfIn - pointer to profile (result).
+ *  @return Result code:
+ *  @arg    = PLC_PTO_OK
+ *  @arg    = PLC_PTO_ERR_...
+ *  @note   Terminal step (CCR=0) holds output low after the last pulse.
+ */
+uint8_t PlcPto_Build(const PlcPto_Cfg_t *CfgIn, PlcPto_Prof_t *ProfIn);
+
+#endif /* PTO_H_ */
@@ -0,0 +1,99 @@
+/* @page pwm-plan.h
+ *       PWM period planner (prescaler, period)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Period of timer = (PSC+1)*(ARR+1) ticks of timer clock.
+ *
+ *        Requested period is given by frequency (Hz) or by period (ns)
+ *        and is kept as exact fraction of timer clock ticks (Num/Den),
+ *        only integer arithmetic is used.
+ *
+ *        Planner:
+ *        - Pmin = the least PSC+1 that fits ARR (the best resolution)
+ *        - Pmin ... Pmin+PLC_PWM_PLAN_SEARCH_SZ-1 are checked while ARR+1 >= requested resolution
+ *        - the least error of period wins, the least PSC wins on equal error
+ *
+ *        Error of Pmin is already below a half of prescaled tick,
+ *        greater PSC can only hit an exact divider (at the cost of resolution).
+ */
+
+#ifndef PWM_PLAN_H_
+#define PWM_PLAN_H_
+
+#include <stdint.h>
+
+
+/** @def Max. quantity of checked prescalers
+ */
+#define PLC_PWM_PLAN_SEARCH_SZ                   (uint32_t)256
+
+/** @def Units of request
+ */
+#define PLC_PWM_PLAN_UNIT_HZ                     (uint8_t)0  //frequency (Hz)
+#define PLC_PWM_PLAN_UNIT_NS                     (uint8_t)1  //period (ns)
+
+/** @def Result codes
+ */
+#define PLC_PWM_PLAN_OK                          (uint8_t)0  //OK
+#define PLC_PWM_PLAN_ERR_ARG                     (uint8_t)1  //invalid argument (plan is not changed)
+#define PLC_PWM_PLAN_ERR_RANGE                   (uint8_t)2  //period is out of timer range (limited)
+#define PLC_PWM_PLAN_ERR_RES                     (uint8_t)3  //resolution is not reached (the best one is used)
+
+
+/** @typedef Timer limits
+ */
+typedef struct PlcPwmPlan_Tim_t_
+{
+	//@var Timer clock (Hz)
+	uint32_t ClkHz;
+	//@var Max. prescaler (PSC)
+	uint32_t PscMax;
+	//@var Period limits (ARR)
+	uint32_t ArrMin;
+	uint32_t ArrMax;
+
+} PlcPwmPlan_Tim_t;
+
+/** @typedef Plan
+ */
+typedef struct PlcPwmPlan_t_
+{
+	//@var Prescaler (PSC)
+	uint32_t Psc;
+	//@var Period (ARR)
+	uint32_t Arr;
+
+} PlcPwmPlan_t;
+
+
+/** @brief  Calculate prescaler and period.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  UnitIn - unit of request (PLC_PWM_PLAN_UNIT_...).
+ *  @param  ValIn - requested frequency (Hz) or period (ns).
+ *  @param  ResIn - min. resolution (ARR+1) accepted to improve accuracy of period:
+ *  @arg    = 0 - the best resolution only
+ *  @param  PlanIn - pointer to plan (result).
+ *  @return Result code:
+ *  @arg    = PLC_PWM_PLAN_OK
+ *  @arg    = PLC_PWM_PLAN_ERR_...
+ */
+uint8_t PlcPwmPlan_Calc(const PlcPwmPlan_Tim_t *TimIn, uint8_t UnitIn, uint64_t ValIn, uint32_t ResIn, PlcPwmPlan_t *PlanIn);
+
+/** @brief  Get frequency of plan.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  PlanIn - pointer to plan.
+ *  @return Frequency (mHz, rounded).
+ */
+uint64_t PlcPwmPlan_FreqMilliHz(const PlcPwmPlan_Tim_t *TimIn, const PlcPwmPlan_t *PlanIn);
+
+/** @brief  Get period of plan.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  PlanIn - pointer to plan.
+ *  @return Period (ns, rounded).
+ */
+uint64_t PlcPwmPlan_PeriodNs(const PlcPwmPlan_Tim_t *TimIn, const PlcPwmPlan_t *PlanIn);
+
+#endif /* PWM_PLAN_H_ */
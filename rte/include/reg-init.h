@@ -50,6 +50,26 @@ typedef struct REG_SysStat1_Pack_t_ {
     //  = 1 - on
     uint16_t LedUser:1;
 
+    //WD-timer status
+    //  = 0 - timer is not completed count
+    //  = 1 - timer is completed count
+    uint16_t WdTimCplt:1;
+
+    //Application image CRC status (checked in background)
+    //  = 0 - image is valid
+    //  = 1 - image is corrupted (application is stopped, DO are in safe state)
+    uint16_t AppCrcErr:1;
+
+    //Retain-data commit status
+    //  = 0 - committed into flash
+    //  = 1 - commit is deferred (spare sector of journal is not erased yet, or error of flash), changes are kept in RAM
+    uint16_t RetainWait:1;
+
+    //Retain-data size status
+    //  = 0 - all RETAIN variables of application are retained
+    //  = 1 - RETAIN variables beyond PLC_RETAIN_SZ are not retained (default values after restart)
+    uint16_t RetainOvf:1;
+
 } REG_SysStat1_Pack_t;
 
 typedef union {
@@ -68,6 +88,10 @@ typedef union {
 #define PLC_SYS_STAT1_SFTY_TIM_CPLT  (uint8_t)4
 #define PLC_SYS_STAT1_WD_TIM_SET     (uint8_t)5
 #define PLC_SYS_STAT1_LED_USER       (uint8_t)6
+#define PLC_SYS_STAT1_WD_TIM_CPLT    (uint8_t)7
+#define PLC_SYS_STAT1_APP_CRC_ERR    (uint8_t)8
+#define PLC_SYS_STAT1_RETAIN_WAIT    (uint8_t)9
+#define PLC_SYS_STAT1_RETAIN_OVF     (uint8_t)10
 
 
 /** @typedef RTE version (major minor) (packed)
@@ -107,6 +131,29 @@ typedef union {
 }  REG_RTE_DDMM_Pack_ut;
 
 
+#ifdef RTE_MOD_APP
+/** @def Max. number of registers in list
+ */
+#define REG_LIST_SZ                  64
+
+/** @typedef List of registers of tasks of Application
+ *           (registers copied by REG_CopyMbToApp or REG_CopyAppToMb, collected once)
+ */
+typedef struct REG_List_t_
+{
+    //@var Registers
+    REG_t *Reg[REG_LIST_SZ];
+
+    //@var Number of registers
+    uint16_t Sz;
+
+    //@var Overflow (list is incomplete, use REG_CopyMbToApp, REG_CopyAppToMb)
+    uint8_t Ovf;
+
+} REG_List_t;
+#endif // RTE_MOD_APP
+
+
 /** @var SYSTEM STATUS (1)
  *       packed
  */
@@ -121,16 +168,38 @@ uint16_t REG_Init(void);
 
 #ifdef RTE_MOD_APP
 /** @brief  Copy from ModBus (Data) Tables into Located variables.
- *  @param  None.
+ *  @param  TasksIn - mask of tasks of Application (PLC_APP_TASK_ALL - all registers).
  *  @return The number of copied registers.
  */
-uint16_t REG_CopyMbToApp(void);
+uint16_t REG_CopyMbToApp(uint8_t TasksIn);
 
 /** @brief  Copy from Located variables into ModBus (Data) Tables.
- *  @param  None.
+ *  @param  TasksIn - mask of tasks of Application (PLC_APP_TASK_ALL - all registers).
+ *  @return The number of copied registers.
+ */
+uint16_t REG_CopyAppToMb(uint8_t TasksIn);
+
+/** @brief  Collect registers copied by REG_CopyMbToApp(TasksIn) into list.
+ *  @param  TasksIn - mask of tasks of Application.
+ *  @param  ListOut - list.
+ *  @return The number of registers in list.
+ */
+uint16_t REG_ListMbToApp(uint8_t TasksIn, REG_List_t *ListOut);
+
+/** @brief  Collect registers copied by REG_CopyAppToMb(TasksIn) into list.
+ *  @param  TasksIn - mask of tasks of Application.
+ *  @param  ListOut - list.
+ *  @return The number of registers in list.
+ */
+uint16_t REG_ListAppToMb(uint8_t TasksIn, REG_List_t *ListOut);
+
+/** @brief  Copy registers of list.
+ *  @param  ListIn - list (collected by REG_ListMbToApp, REG_ListAppToMb).
+ *  @param  DstIn - destination (REG_COPY_MB_TO_APP, REG_COPY_APP_TO_MB).
+ *  @param  TasksIn - mask of tasks of Application (registers of other tasks are not copied).
  *  @return The number of copied registers.
  */
-uint16_t REG_CopyAppToMb(void);
+uint16_t REG_CopyList(const REG_List_t *ListIn, uint8_t DstIn, uint8_t TasksIn);
 #endif // RTE_MOD_APP
 
 /** @brief  Set values by default.
@@ -141,7 +210,7 @@ void REG_SetDef(void);
 
 /** @brief  Set register SYS_STAT1.
  *  @param  FieldIn - field number:
- *  @arg    = PLC_SYS_STAT1_APP_INITED ... PLC_SYS_STAT1_LED_USER
+ *  @arg    = PLC_SYS_STAT1_APP_INITED ... PLC_SYS_STAT1_RETAIN_OVF
  *  @param  ValueIn - field value:
  *  @arg    = BIT_FALSE
  *  @arg    = BIT_TRUE
@@ -504,6 +504,217 @@
 // STRING
 #define REG_DI_FILTER_DELAY__STR                 "DI%d: Filter delay"
 
+/** @def DI_CNTR_CMP_ALLOW
+ */
+#define REG_DI_CNTR_CMP_ALLOW__GID               (uint16_t)124         //Unique ID
+// located variable
+#define REG_DI_CNTR_CMP_ALLOW__ZONE              PLC_LT_M              //ID of memory
+#define REG_DI_CNTR_CMP_ALLOW__TYPESZ            PLC_LSZ_X             //ID of data type
+#define REG_DI_CNTR_CMP_ALLOW__GROUP             REG_DI__GROUP         //ID of group
+#define REG_DI_CNTR_CMP_ALLOW__A00               REG_AXX_ADDR
+#define REG_DI_CNTR_CMP_ALLOW__A01               (int32_t)3            //ID of subgroup by mode
+#define REG_DI_CNTR_CMP_ALLOW__A02               (int32_t)5            //ID of register
+#define REG_DI_CNTR_CMP_ALLOW__TYPE              TYPE_BOOL             //Data type
+#define REG_DI_CNTR_CMP_ALLOW__TYPE_SZ           TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DI_CNTR_CMP_ALLOW__TYPE_WSZ          TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DI_CNTR_CMP_ALLOW__SZ                (uint16_t)PLC_DI_SZ   //Number of registers
+#define REG_DI_CNTR_CMP_ALLOW__POS               (uint16_t)REG_CALC_POS(REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ)
+#define REG_DI_CNTR_CMP_ALLOW__SADDR             (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DI_CNTR_CMP_ALLOW__DPOS              (uint16_t)REG_CALC_MBPOS(REG_DI_RESET__DPOS, REG_DI_RESET__SZ, REG_DI_RESET__TYPE_WSZ, 0)
+#define REG_DI_CNTR_CMP_ALLOW__DPOS_END          (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_ALLOW__DPOS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_DI_CNTR_CMP_ALLOW__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_ALLOW__DTABLE            REG_DATA_BOOL_TABLE_ID  //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DI_CNTR_CMP_ALLOW__MBPOS             (uint16_t)REG_CALC_MBPOS(REG_DI_RESET__MBPOS, REG_DI_RESET__SZ, REG_DI_RESET__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_CNTR_CMP_ALLOW__MBPOS_END         (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_ALLOW__MBPOS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_DI_CNTR_CMP_ALLOW__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_ALLOW__MBTABLE           MBRTU_COIL_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DI_CNTR_CMP_ALLOW__RETAIN            REG_RETAIN_ALL
+//STRING
+#define REG_DI_CNTR_CMP_ALLOW__STR               "DI%d Cntr: Compare-match is allowed"
+
+/** @def DI_CNTR_CMP_DO_VAL
+ */
+#define REG_DI_CNTR_CMP_DO_VAL__GID              (uint16_t)125         //Unique ID
+// located variable
+#define REG_DI_CNTR_CMP_DO_VAL__ZONE             PLC_LT_M              //ID of memory
+#define REG_DI_CNTR_CMP_DO_VAL__TYPESZ           PLC_LSZ_X             //ID of data type
+#define REG_DI_CNTR_CMP_DO_VAL__GROUP            REG_DI__GROUP         //ID of group
+#define REG_DI_CNTR_CMP_DO_VAL__A00              REG_AXX_ADDR
+#define REG_DI_CNTR_CMP_DO_VAL__A01              (int32_t)3            //ID of subgroup by mode
+#define REG_DI_CNTR_CMP_DO_VAL__A02              (int32_t)6            //ID of register
+#define REG_DI_CNTR_CMP_DO_VAL__TYPE             TYPE_BOOL             //Data type
+#define REG_DI_CNTR_CMP_DO_VAL__TYPE_SZ          TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DI_CNTR_CMP_DO_VAL__TYPE_WSZ         TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DI_CNTR_CMP_DO_VAL__SZ               (uint16_t)PLC_DI_SZ   //Number of registers
+#define REG_DI_CNTR_CMP_DO_VAL__POS              (uint16_t)REG_CALC_POS(REG_DI_CNTR_CMP_ALLOW__POS, REG_DI_CNTR_CMP_ALLOW__SZ)
+#define REG_DI_CNTR_CMP_DO_VAL__SADDR            (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DI_CNTR_CMP_DO_VAL__DPOS             (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_ALLOW__DPOS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_DI_CNTR_CMP_ALLOW__TYPE_WSZ, 0)
+#define REG_DI_CNTR_CMP_DO_VAL__DPOS_END         (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO_VAL__DPOS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_DI_CNTR_CMP_DO_VAL__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_DO_VAL__DTABLE           REG_DATA_BOOL_TABLE_ID  //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DI_CNTR_CMP_DO_VAL__MBPOS            (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_ALLOW__MBPOS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_DI_CNTR_CMP_ALLOW__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_CNTR_CMP_DO_VAL__MBPOS_END        (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO_VAL__MBPOS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_DI_CNTR_CMP_DO_VAL__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_DO_VAL__MBTABLE          MBRTU_COIL_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DI_CNTR_CMP_DO_VAL__RETAIN           REG_RETAIN_ALL
+//STRING
+#define REG_DI_CNTR_CMP_DO_VAL__STR              "DI%d Cntr: Compare-match DO value"
+
+/** @def DI_CNTR_CMP_REACHED
+ */
+#define REG_DI_CNTR_CMP_REACHED__GID             (uint16_t)126         //Unique ID
+// located variable
+#define REG_DI_CNTR_CMP_REACHED__ZONE            PLC_LT_M              //ID of memory
+#define REG_DI_CNTR_CMP_REACHED__TYPESZ          PLC_LSZ_X             //ID of data type
+#define REG_DI_CNTR_CMP_REACHED__GROUP           REG_DI__GROUP         //ID of group
+#define REG_DI_CNTR_CMP_REACHED__A00             REG_AXX_ADDR
+#define REG_DI_CNTR_CMP_REACHED__A01             (int32_t)3            //ID of subgroup by mode
+#define REG_DI_CNTR_CMP_REACHED__A02             (int32_t)7            //ID of register
+#define REG_DI_CNTR_CMP_REACHED__TYPE            TYPE_BOOL             //Data type
+#define REG_DI_CNTR_CMP_REACHED__TYPE_SZ         TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DI_CNTR_CMP_REACHED__TYPE_WSZ        TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DI_CNTR_CMP_REACHED__SZ              (uint16_t)PLC_DI_SZ   //Number of registers
+#define REG_DI_CNTR_CMP_REACHED__POS             (uint16_t)REG_CALC_POS(REG_DI_CNTR_CMP_DO_VAL__POS, REG_DI_CNTR_CMP_DO_VAL__SZ)
+#define REG_DI_CNTR_CMP_REACHED__SADDR           (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DI_CNTR_CMP_REACHED__DPOS            (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO_VAL__DPOS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_DI_CNTR_CMP_DO_VAL__TYPE_WSZ, 0)
+#define REG_DI_CNTR_CMP_REACHED__DPOS_END        (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_REACHED__DPOS, REG_DI_CNTR_CMP_REACHED__SZ, REG_DI_CNTR_CMP_REACHED__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_REACHED__DTABLE          REG_DATA_BOOL_TABLE_ID  //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DI_CNTR_CMP_REACHED__MBPOS           (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_SETPOINT_REACHED__MBPOS, REG_DI_CNTR_SETPOINT_REACHED__SZ, REG_DI_CNTR_SETPOINT_REACHED__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_CNTR_CMP_REACHED__MBPOS_END       (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_REACHED__MBPOS, REG_DI_CNTR_CMP_REACHED__SZ, REG_DI_CNTR_CMP_REACHED__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_REACHED__MBTABLE         MBRTU_DISC_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DI_CNTR_CMP_REACHED__RETAIN          REG_RETAIN_NONE
+//STRING
+#define REG_DI_CNTR_CMP_REACHED__STR             "DI%d Cntr: Compare-match is reached"
+
+/** @def DI_CNTR_CMP_DO
+ */
+#define REG_DI_CNTR_CMP_DO__GID                  (uint16_t)127         //unique ID
+// located variable
+#define REG_DI_CNTR_CMP_DO__ZONE                 PLC_LT_M              //memory zone ID
+#define REG_DI_CNTR_CMP_DO__TYPESZ               PLC_LSZ_B             //data type ID
+#define REG_DI_CNTR_CMP_DO__GROUP                REG_DI__GROUP
+#define REG_DI_CNTR_CMP_DO__A00                  REG_AXX_ADDR          //arg0: ID of subgroup
+#define REG_DI_CNTR_CMP_DO__A01                  (int32_t)3            //arg1: ID of subgroup by mode
+#define REG_DI_CNTR_CMP_DO__A02                  (int32_t)8            //arg2: ID of register
+#define REG_DI_CNTR_CMP_DO__TYPE                 TYPE_BYTE             //data type
+#define REG_DI_CNTR_CMP_DO__TYPE_SZ              TYPE_BYTE_SZ          //size of data type (bytes)
+#define REG_DI_CNTR_CMP_DO__TYPE_WSZ             TYPE_BYTE_WSZ         //size of data type (words)
+// position (offset) in REGS
+#define REG_DI_CNTR_CMP_DO__SZ                   PLC_DI_SZ   		   //number of registers
+#define REG_DI_CNTR_CMP_DO__POS                  (uint16_t)REG_CALC_POS(REG_DI_CNTR_CMP_REACHED__POS, REG_DI_CNTR_CMP_REACHED__SZ)
+#define REG_DI_CNTR_CMP_DO__SADDR                (uint16_t)0           //start register address
+// position (offset) in Data Table
+#define REG_DI_CNTR_CMP_DO__DPOS                 (uint16_t)REG_CALC_MBPOS(REG_DI_FILTER_DELAY__DPOS, REG_DI_FILTER_DELAY__SZ, REG_DI_FILTER_DELAY__TYPE_WSZ, 0)
+#define REG_DI_CNTR_CMP_DO__DPOS_END             (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO__DPOS, REG_DI_CNTR_CMP_DO__SZ, REG_DI_CNTR_CMP_DO__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_DO__DTABLE               REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_DI_CNTR_CMP_DO__MBPOS                (uint16_t)REG_CALC_MBPOS(REG_DI_FILTER_DELAY__MBPOS, REG_DI_FILTER_DELAY__SZ, REG_DI_FILTER_DELAY__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_CNTR_CMP_DO__MBPOS_END            (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO__MBPOS, REG_DI_CNTR_CMP_DO__SZ, REG_DI_CNTR_CMP_DO__TYPE_WSZ, 0)-1
+#define REG_DI_CNTR_CMP_DO__MBTABLE              MBRTU_HOLD_TABLE_ID   //modbus table ID
+// EEPROM
+#define REG_DI_CNTR_CMP_DO__RETAIN               REG_RETAIN_ALL
+// STRING
+#define REG_DI_CNTR_CMP_DO__STR                  "DI%d Cntr: Compare-match DO channel"
+
+/** @def DI_EVT_HEAD
+ */
+#define REG_DI_EVT_HEAD__GID                     (uint16_t)17          //unique ID
+// located variable
+#define REG_DI_EVT_HEAD__ZONE                    PLC_LT_M              //memory zone ID
+#define REG_DI_EVT_HEAD__TYPESZ                  PLC_LSZ_D             //data type ID
+#define REG_DI_EVT_HEAD__GROUP                   REG_DI__GROUP
+#define REG_DI_EVT_HEAD__A00                     REG_AXX_ADDR          //arg0: ID of subgroup
+#define REG_DI_EVT_HEAD__A01                     (int32_t)8            //arg1: ID of subgroup
+#define REG_DI_EVT_HEAD__A02                     (int32_t)1            //arg2: ID of register
+#define REG_DI_EVT_HEAD__TYPE                    TYPE_DWORD            //data type
+#define REG_DI_EVT_HEAD__TYPE_SZ                 TYPE_DWORD_SZ         //size of data type (bytes)
+#define REG_DI_EVT_HEAD__TYPE_WSZ                TYPE_DWORD_WSZ        //size of data type (words)
+// position (offset) in REGS
+#define REG_DI_EVT_HEAD__SZ                      PLC_DI_SZ             //number of registers
+#define REG_DI_EVT_HEAD__POS                     (uint16_t)REG_CALC_POS(REG_DI_CNTR_CMP_DO__POS, REG_DI_CNTR_CMP_DO__SZ)
+#define REG_DI_EVT_HEAD__SADDR                   (uint16_t)0           //start register address
+// position (offset) in Data Table
+#define REG_DI_EVT_HEAD__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO__DPOS, REG_DI_CNTR_CMP_DO__SZ, REG_DI_CNTR_CMP_DO__TYPE_WSZ, 0)
+#define REG_DI_EVT_HEAD__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_HEAD__DPOS, REG_DI_EVT_HEAD__SZ, REG_DI_EVT_HEAD__TYPE_WSZ, 0)-1
+#define REG_DI_EVT_HEAD__DTABLE                  REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_DI_EVT_HEAD__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DI_STATUS__MBPOS, REG_DI_STATUS__SZ, REG_DI_STATUS__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_EVT_HEAD__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_HEAD__MBPOS, REG_DI_EVT_HEAD__SZ, REG_DI_EVT_HEAD__TYPE_WSZ, 0)-1
+#define REG_DI_EVT_HEAD__MBTABLE                 MBRTU_INPT_TABLE_ID   //modbus table ID
+// EEPROM
+#define REG_DI_EVT_HEAD__RETAIN                  REG_RETAIN_NONE
+// STRING
+#define REG_DI_EVT_HEAD__STR                     "DI%d Event log: Head"
+
+/** @def DI_EVT_CURSOR
+ */
+#define REG_DI_EVT_CURSOR__GID                   (uint16_t)18          //unique ID
+// located variable
+#define REG_DI_EVT_CURSOR__ZONE                  PLC_LT_M              //memory zone ID
+#define REG_DI_EVT_CURSOR__TYPESZ                PLC_LSZ_D             //data type ID
+#define REG_DI_EVT_CURSOR__GROUP                 REG_DI__GROUP
+#define REG_DI_EVT_CURSOR__A00                   REG_AXX_ADDR          //arg0: ID of subgroup
+#define REG_DI_EVT_CURSOR__A01                   (int32_t)8            //arg1: ID of subgroup
+#define REG_DI_EVT_CURSOR__A02                   (int32_t)2            //arg2: ID of register
+#define REG_DI_EVT_CURSOR__TYPE                  TYPE_DWORD            //data type
+#define REG_DI_EVT_CURSOR__TYPE_SZ               TYPE_DWORD_SZ         //size of data type (bytes)
+#define REG_DI_EVT_CURSOR__TYPE_WSZ              TYPE_DWORD_WSZ        //size of data type (words)
+// position (offset) in REGS
+#define REG_DI_EVT_CURSOR__SZ                    PLC_DI_SZ             //number of registers
+#define REG_DI_EVT_CURSOR__POS                   (uint16_t)REG_CALC_POS(REG_DI_EVT_HEAD__POS, REG_DI_EVT_HEAD__SZ)
+#define REG_DI_EVT_CURSOR__SADDR                 (uint16_t)0           //start register address
+// position (offset) in Data Table
+#define REG_DI_EVT_CURSOR__DPOS                  (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_HEAD__DPOS, REG_DI_EVT_HEAD__SZ, REG_DI_EVT_HEAD__TYPE_WSZ, 0)
+#define REG_DI_EVT_CURSOR__DPOS_END              (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_CURSOR__DPOS, REG_DI_EVT_CURSOR__SZ, REG_DI_EVT_CURSOR__TYPE_WSZ, 0)-1
+#define REG_DI_EVT_CURSOR__DTABLE                REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_DI_EVT_CURSOR__MBPOS                 (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO__MBPOS, REG_DI_CNTR_CMP_DO__SZ, REG_DI_CNTR_CMP_DO__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_EVT_CURSOR__MBPOS_END             (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_CURSOR__MBPOS, REG_DI_EVT_CURSOR__SZ, REG_DI_EVT_CURSOR__TYPE_WSZ, 0)-1
+#define REG_DI_EVT_CURSOR__MBTABLE               MBRTU_HOLD_TABLE_ID   //modbus table ID
+// EEPROM
+#define REG_DI_EVT_CURSOR__RETAIN                REG_RETAIN_NONE
+// STRING
+#define REG_DI_EVT_CURSOR__STR                   "DI%d Event log: Read cursor"
+
+/** @def DI_EVT_WIN
+ */
+#define REG_DI_EVT_WIN_SZ                        (uint16_t)(PLC_DI_SZ*PLC_DI_EVT_WIN_SZ)
+#define REG_DI_EVT_WIN__GID                      (uint16_t)19          //unique ID
+// located variable
+#define REG_DI_EVT_WIN__ZONE                     PLC_LT_M              //memory zone ID
+#define REG_DI_EVT_WIN__TYPESZ                   PLC_LSZ_D             //data type ID
+#define REG_DI_EVT_WIN__GROUP                    REG_DI__GROUP
+#define REG_DI_EVT_WIN__A00                      REG_AXX_ADDR          //arg0: ID of subgroup
+#define REG_DI_EVT_WIN__A01                      (int32_t)8            //arg1: ID of subgroup
+#define REG_DI_EVT_WIN__A02                      (int32_t)3            //arg2: ID of register
+#define REG_DI_EVT_WIN__TYPE                     TYPE_DWORD            //data type
+#define REG_DI_EVT_WIN__TYPE_SZ                  TYPE_DWORD_SZ         //size of data type (bytes)
+#define REG_DI_EVT_WIN__TYPE_WSZ                 TYPE_DWORD_WSZ        //size of data type (words)
+// position (offset) in REGS
+#define REG_DI_EVT_WIN__SZ                       REG_DI_EVT_WIN_SZ     //number of registers (channel-major)
+#define REG_DI_EVT_WIN__POS                      (uint16_t)REG_CALC_POS(REG_DI_EVT_CURSOR__POS, REG_DI_EVT_CURSOR__SZ)
+#define REG_DI_EVT_WIN__SADDR                    (uint16_t)0           //start register address
+// position (offset) in Data Table
+#define REG_DI_EVT_WIN__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_CURSOR__DPOS, REG_DI_EVT_CURSOR__SZ, REG_DI_EVT_CURSOR__TYPE_WSZ, 0)
+#define REG_DI_EVT_WIN__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_WIN__DPOS, REG_DI_EVT_WIN__SZ, REG_DI_EVT_WIN__TYPE_WSZ, 0)-1
+#define REG_DI_EVT_WIN__DTABLE                   REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_DI_EVT_WIN__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_HEAD__MBPOS, REG_DI_EVT_HEAD__SZ, REG_DI_EVT_HEAD__TYPE_WSZ, REG_RESERVE)
+#define REG_DI_EVT_WIN__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_WIN__MBPOS, REG_DI_EVT_WIN__SZ, REG_DI_EVT_WIN__TYPE_WSZ, 0)-1
+#define REG_DI_EVT_WIN__MBTABLE                  MBRTU_INPT_TABLE_ID   //modbus table ID
+// EEPROM
+#define REG_DI_EVT_WIN__RETAIN                   REG_RETAIN_NONE
+// STRING
+#define REG_DI_EVT_WIN__STR                      "DI Event log: Window %d"
+
 
 //DO
 
@@ -526,14 +737,14 @@
 #define REG_DO_NORM_VAL__TYPE_WSZ                TYPE_BOOL_WSZ         //Size of data type in words
 // position (offset) in REGS
 #define REG_DO_NORM_VAL__SZ                      PLC_DO_SZ
-#define REG_DO_NORM_VAL__POS                     (uint16_t)REG_CALC_POS(REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ)
+#define REG_DO_NORM_VAL__POS                     (uint16_t)REG_CALC_POS(REG_DI_EVT_WIN__POS, REG_DI_EVT_WIN__SZ)
 #define REG_DO_NORM_VAL__SADDR                   (uint16_t)0           //Start register address
 // position (offset) in Data Table
-#define REG_DO_NORM_VAL__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DI_RESET__DPOS, REG_DI_RESET__SZ, REG_DI_RESET__TYPE_WSZ, 0)
+#define REG_DO_NORM_VAL__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_REACHED__DPOS, REG_DI_CNTR_CMP_REACHED__SZ, REG_DI_CNTR_CMP_REACHED__TYPE_WSZ, 0)
 #define REG_DO_NORM_VAL__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_NORM_VAL__DPOS, REG_DO_NORM_VAL__SZ, REG_DO_NORM_VAL__TYPE_WSZ, 0)-1
 #define REG_DO_NORM_VAL__DTABLE                  REG_DATA_BOOL_TABLE_ID  //Data Table ID
 // position (offset) in ModBus Table
-#define REG_DO_NORM_VAL__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DI_RESET__MBPOS, REG_DI_RESET__SZ, REG_DI_RESET__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_NORM_VAL__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_DO_VAL__MBPOS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_DI_CNTR_CMP_DO_VAL__TYPE_WSZ, REG_RESERVE)
 #define REG_DO_NORM_VAL__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_NORM_VAL__MBPOS, REG_DO_NORM_VAL__SZ, REG_DO_NORM_VAL__TYPE_WSZ, 0)-1
 #define REG_DO_NORM_VAL__MBTABLE                 MBRTU_COIL_TABLE_ID   //ModBus Table ID
 // EEPROM
@@ -589,11 +800,11 @@
 #define REG_DO_PWM_VAL__POS                      (uint16_t)REG_CALC_POS(REG_DO_FAST_VAL__POS, REG_DO_FAST_VAL__SZ)
 #define REG_DO_PWM_VAL__SADDR                    (uint16_t)0           //Start register address
 // position (offset) in Data Table
-#define REG_DO_PWM_VAL__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_DI_FILTER_DELAY__DPOS, REG_DI_FILTER_DELAY__SZ, REG_DI_FILTER_DELAY__TYPE_WSZ, 0)
+#define REG_DO_PWM_VAL__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_WIN__DPOS, REG_DI_EVT_WIN__SZ, REG_DI_EVT_WIN__TYPE_WSZ, 0)
 #define REG_DO_PWM_VAL__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_VAL__DPOS, REG_DO_PWM_VAL__SZ, REG_DO_PWM_VAL__TYPE_WSZ, 0)-1
 #define REG_DO_PWM_VAL__DTABLE                   REG_DATA_NUMB_TABLE_ID  //Data Table ID
 // position (offset) in ModBus Table
-#define REG_DO_PWM_VAL__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_DI_FILTER_DELAY__MBPOS, REG_DI_FILTER_DELAY__SZ, REG_DI_FILTER_DELAY__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PWM_VAL__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_CURSOR__MBPOS, REG_DI_EVT_CURSOR__SZ, REG_DI_EVT_CURSOR__TYPE_WSZ, REG_RESERVE)
 #define REG_DO_PWM_VAL__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_VAL__MBPOS, REG_DO_PWM_VAL__SZ, REG_DO_PWM_VAL__TYPE_WSZ, 0)-1
 #define REG_DO_PWM_VAL__MBTABLE                  MBRTU_HOLD_TABLE_ID   //ModBus Table ID
 // EEPROM
@@ -713,7 +924,7 @@
 #define REG_DO_STATUS__DPOS_END                  (uint16_t)REG_CALC_MBPOS(REG_DO_STATUS__DPOS, REG_DO_STATUS__SZ, REG_DO_STATUS__TYPE_WSZ, 0)-1
 #define REG_DO_STATUS__DTABLE                    REG_DATA_NUMB_TABLE_ID //data table ID
 // position (offset) in ModBus Table
-#define REG_DO_STATUS__MBPOS                     (uint16_t)REG_CALC_MBPOS(REG_DI_STATUS__MBPOS, REG_DI_STATUS__SZ, REG_DI_STATUS__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_STATUS__MBPOS                     (uint16_t)REG_CALC_MBPOS(REG_DI_EVT_WIN__MBPOS, REG_DI_EVT_WIN__SZ, REG_DI_EVT_WIN__TYPE_WSZ, REG_RESERVE)
 #define REG_DO_STATUS__MBPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_DO_STATUS__MBPOS, REG_DO_STATUS__SZ, REG_DO_STATUS__TYPE_WSZ, 0)-1
 #define REG_DO_STATUS__MBTABLE                   MBRTU_INPT_TABLE_ID   //modbus table ID
 // EEPROM
@@ -721,6 +932,457 @@
 // STRING
 #define REG_DO_STATUS__STR                       "DO%d: Status"
 
+/** @def DO_PTO_PULSES
+ */
+#define REG_DO_PTO_PULSES__GID                   (uint16_t)27          //Unique ID
+// located variable
+#define REG_DO_PTO_PULSES__ZONE                  PLC_LT_M              //ID of memory
+#define REG_DO_PTO_PULSES__TYPESZ                PLC_LSZ_D             //ID of data type
+#define REG_DO_PTO_PULSES__GROUP                 REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_PULSES__A00                   REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_PULSES__A01                   (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_PULSES__A02                   (int32_t)1            //arg2: ID of register
+#define REG_DO_PTO_PULSES__TYPE                  TYPE_DWORD            //Data type
+#define REG_DO_PTO_PULSES__TYPE_SZ               TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PTO_PULSES__TYPE_WSZ              TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_PULSES__SZ                    (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_PULSES__POS                   (uint16_t)REG_CALC_POS(REG_DO_STATUS__POS, REG_DO_STATUS__SZ)
+#define REG_DO_PTO_PULSES__SADDR                 (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_PULSES__DPOS                  (uint16_t)REG_CALC_MBPOS(REG_DO_STATUS__DPOS, REG_DO_STATUS__SZ, REG_DO_STATUS__TYPE_WSZ, 0)
+#define REG_DO_PTO_PULSES__DPOS_END              (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PULSES__DPOS, REG_DO_PTO_PULSES__SZ, REG_DO_PTO_PULSES__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_PULSES__DTABLE                REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_PULSES__MBPOS                 (uint16_t)REG_CALC_MBPOS(REG_DO_MODE__MBPOS, REG_DO_MODE__SZ, REG_DO_MODE__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_PULSES__MBPOS_END             (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PULSES__MBPOS, REG_DO_PTO_PULSES__SZ, REG_DO_PTO_PULSES__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_PULSES__MBTABLE               MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_PULSES__RETAIN                REG_RETAIN_ALL
+//STRING
+#define REG_DO_PTO_PULSES__STR                   "DO%d PTO: Number of pulses"
+
+/** @def DO_PTO_FREQ_START (Hz)
+ */
+#define REG_DO_PTO_FREQ_START__GID               (uint16_t)201         //Unique ID
+// located variable
+#define REG_DO_PTO_FREQ_START__ZONE              PLC_LT_M              //ID of memory
+#define REG_DO_PTO_FREQ_START__TYPESZ            PLC_LSZ_D             //ID of data type
+#define REG_DO_PTO_FREQ_START__GROUP             REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_FREQ_START__A00               REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_FREQ_START__A01               (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_FREQ_START__A02               (int32_t)2            //arg2: ID of register
+#define REG_DO_PTO_FREQ_START__TYPE              TYPE_DWORD            //Data type
+#define REG_DO_PTO_FREQ_START__TYPE_SZ           TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PTO_FREQ_START__TYPE_WSZ          TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_FREQ_START__SZ                (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_FREQ_START__POS               (uint16_t)REG_CALC_POS(REG_DO_PTO_PULSES__POS, REG_DO_PTO_PULSES__SZ)
+#define REG_DO_PTO_FREQ_START__SADDR             (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_FREQ_START__DPOS              (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PULSES__DPOS, REG_DO_PTO_PULSES__SZ, REG_DO_PTO_PULSES__TYPE_WSZ, 0)
+#define REG_DO_PTO_FREQ_START__DPOS_END          (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_START__DPOS, REG_DO_PTO_FREQ_START__SZ, REG_DO_PTO_FREQ_START__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_FREQ_START__DTABLE            REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_FREQ_START__MBPOS             (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PULSES__MBPOS, REG_DO_PTO_PULSES__SZ, REG_DO_PTO_PULSES__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_FREQ_START__MBPOS_END         (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_START__MBPOS, REG_DO_PTO_FREQ_START__SZ, REG_DO_PTO_FREQ_START__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_FREQ_START__MBTABLE           MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_FREQ_START__RETAIN            REG_RETAIN_ALL
+//STRING
+#define REG_DO_PTO_FREQ_START__STR               "DO%d PTO: Start frequency, Hz"
+
+/** @def DO_PTO_FREQ_MAX (Hz)
+ */
+#define REG_DO_PTO_FREQ_MAX__GID                 (uint16_t)202         //Unique ID
+// located variable
+#define REG_DO_PTO_FREQ_MAX__ZONE                PLC_LT_M              //ID of memory
+#define REG_DO_PTO_FREQ_MAX__TYPESZ              PLC_LSZ_D             //ID of data type
+#define REG_DO_PTO_FREQ_MAX__GROUP               REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_FREQ_MAX__A00                 REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_FREQ_MAX__A01                 (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_FREQ_MAX__A02                 (int32_t)3            //arg2: ID of register
+#define REG_DO_PTO_FREQ_MAX__TYPE                TYPE_DWORD            //Data type
+#define REG_DO_PTO_FREQ_MAX__TYPE_SZ             TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PTO_FREQ_MAX__TYPE_WSZ            TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_FREQ_MAX__SZ                  (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_FREQ_MAX__POS                 (uint16_t)REG_CALC_POS(REG_DO_PTO_FREQ_START__POS, REG_DO_PTO_FREQ_START__SZ)
+#define REG_DO_PTO_FREQ_MAX__SADDR               (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_FREQ_MAX__DPOS                (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_START__DPOS, REG_DO_PTO_FREQ_START__SZ, REG_DO_PTO_FREQ_START__TYPE_WSZ, 0)
+#define REG_DO_PTO_FREQ_MAX__DPOS_END            (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_MAX__DPOS, REG_DO_PTO_FREQ_MAX__SZ, REG_DO_PTO_FREQ_MAX__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_FREQ_MAX__DTABLE              REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_FREQ_MAX__MBPOS               (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_START__MBPOS, REG_DO_PTO_FREQ_START__SZ, REG_DO_PTO_FREQ_START__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_FREQ_MAX__MBPOS_END           (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_MAX__MBPOS, REG_DO_PTO_FREQ_MAX__SZ, REG_DO_PTO_FREQ_MAX__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_FREQ_MAX__MBTABLE             MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_FREQ_MAX__RETAIN              REG_RETAIN_ALL
+//STRING
+#define REG_DO_PTO_FREQ_MAX__STR                 "DO%d PTO: Max. frequency, Hz"
+
+/** @def DO_PTO_ACCEL (Hz/s)
+ */
+#define REG_DO_PTO_ACCEL__GID                    (uint16_t)203         //Unique ID
+// located variable
+#define REG_DO_PTO_ACCEL__ZONE                   PLC_LT_M              //ID of memory
+#define REG_DO_PTO_ACCEL__TYPESZ                 PLC_LSZ_D             //ID of data type
+#define REG_DO_PTO_ACCEL__GROUP                  REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_ACCEL__A00                    REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_ACCEL__A01                    (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_ACCEL__A02                    (int32_t)4            //arg2: ID of register
+#define REG_DO_PTO_ACCEL__TYPE                   TYPE_DWORD            //Data type
+#define REG_DO_PTO_ACCEL__TYPE_SZ                TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PTO_ACCEL__TYPE_WSZ               TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_ACCEL__SZ                     (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_ACCEL__POS                    (uint16_t)REG_CALC_POS(REG_DO_PTO_FREQ_MAX__POS, REG_DO_PTO_FREQ_MAX__SZ)
+#define REG_DO_PTO_ACCEL__SADDR                  (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_ACCEL__DPOS                   (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_MAX__DPOS, REG_DO_PTO_FREQ_MAX__SZ, REG_DO_PTO_FREQ_MAX__TYPE_WSZ, 0)
+#define REG_DO_PTO_ACCEL__DPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_ACCEL__DPOS, REG_DO_PTO_ACCEL__SZ, REG_DO_PTO_ACCEL__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_ACCEL__DTABLE                 REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_ACCEL__MBPOS                  (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_FREQ_MAX__MBPOS, REG_DO_PTO_FREQ_MAX__SZ, REG_DO_PTO_FREQ_MAX__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_ACCEL__MBPOS_END              (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_ACCEL__MBPOS, REG_DO_PTO_ACCEL__SZ, REG_DO_PTO_ACCEL__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_ACCEL__MBTABLE                MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_ACCEL__RETAIN                 REG_RETAIN_ALL
+//STRING
+#define REG_DO_PTO_ACCEL__STR                    "DO%d PTO: Acceleration, Hz/s"
+
+/** @def DO_PTO_PROFILE
+ */
+#define REG_DO_PTO_PROFILE__GID                  (uint16_t)204         //Unique ID
+// located variable
+#define REG_DO_PTO_PROFILE__ZONE                 PLC_LT_M              //ID of memory
+#define REG_DO_PTO_PROFILE__TYPESZ               PLC_LSZ_B             //ID of data type
+#define REG_DO_PTO_PROFILE__GROUP                REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_PROFILE__A00                  REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_PROFILE__A01                  (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_PROFILE__A02                  (int32_t)5            //arg2: ID of register
+#define REG_DO_PTO_PROFILE__TYPE                 TYPE_BYTE             //Data type
+#define REG_DO_PTO_PROFILE__TYPE_SZ              TYPE_BYTE_SZ          //Size of data type in bytes
+#define REG_DO_PTO_PROFILE__TYPE_WSZ             TYPE_BYTE_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_PROFILE__SZ                   (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_PROFILE__POS                  (uint16_t)REG_CALC_POS(REG_DO_PTO_ACCEL__POS, REG_DO_PTO_ACCEL__SZ)
+#define REG_DO_PTO_PROFILE__SADDR                (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_PROFILE__DPOS                 (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_ACCEL__DPOS, REG_DO_PTO_ACCEL__SZ, REG_DO_PTO_ACCEL__TYPE_WSZ, 0)
+#define REG_DO_PTO_PROFILE__DPOS_END             (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PROFILE__DPOS, REG_DO_PTO_PROFILE__SZ, REG_DO_PTO_PROFILE__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_PROFILE__DTABLE               REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_PROFILE__MBPOS                (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_ACCEL__MBPOS, REG_DO_PTO_ACCEL__SZ, REG_DO_PTO_ACCEL__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_PROFILE__MBPOS_END            (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PROFILE__MBPOS, REG_DO_PTO_PROFILE__SZ, REG_DO_PTO_PROFILE__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_PROFILE__MBTABLE              MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_PROFILE__RETAIN               REG_RETAIN_ALL
+//STRING
+#define REG_DO_PTO_PROFILE__STR                  "DO%d PTO: Profile"
+
+/** @def DO_PTO_START
+ */
+#define REG_DO_PTO_START__GID                    (uint16_t)205         //Unique ID
+// located variable
+#define REG_DO_PTO_START__ZONE                   PLC_LT_M              //ID of memory
+#define REG_DO_PTO_START__TYPESZ                 PLC_LSZ_X             //ID of data type
+#define REG_DO_PTO_START__GROUP                  REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_START__A00                    REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_START__A01                    (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_START__A02                    (int32_t)6            //arg2: ID of register
+#define REG_DO_PTO_START__TYPE                   TYPE_BOOL             //Data type
+#define REG_DO_PTO_START__TYPE_SZ                TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DO_PTO_START__TYPE_WSZ               TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_START__SZ                     (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_START__POS                    (uint16_t)REG_CALC_POS(REG_DO_PTO_PROFILE__POS, REG_DO_PTO_PROFILE__SZ)
+#define REG_DO_PTO_START__SADDR                  (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_START__DPOS                   (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_ALLOW__DPOS, REG_DO_PWM_ALLOW__SZ, REG_DO_PWM_ALLOW__TYPE_WSZ, 0)
+#define REG_DO_PTO_START__DPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_START__DPOS, REG_DO_PTO_START__SZ, REG_DO_PTO_START__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_START__DTABLE                 REG_DATA_BOOL_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_START__MBPOS                  (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_ALLOW__MBPOS, REG_DO_PWM_ALLOW__SZ, REG_DO_PWM_ALLOW__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_START__MBPOS_END              (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_START__MBPOS, REG_DO_PTO_START__SZ, REG_DO_PTO_START__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_START__MBTABLE                MBRTU_COIL_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_START__RETAIN                 REG_RETAIN_NONE
+//STRING
+#define REG_DO_PTO_START__STR                    "DO%d PTO: Start"
+
+/** @def DO_PTO_DONE
+ */
+#define REG_DO_PTO_DONE__GID                     (uint16_t)206         //Unique ID
+// located variable
+#define REG_DO_PTO_DONE__ZONE                    PLC_LT_M              //ID of memory
+#define REG_DO_PTO_DONE__TYPESZ                  PLC_LSZ_X             //ID of data type
+#define REG_DO_PTO_DONE__GROUP                   REG_DO__GROUP         //ID of group
+#define REG_DO_PTO_DONE__A00                     REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PTO_DONE__A01                     (int32_t)6            //arg1: ID of subgroup by mode
+#define REG_DO_PTO_DONE__A02                     (int32_t)7            //arg2: ID of register
+#define REG_DO_PTO_DONE__TYPE                    TYPE_BOOL             //Data type
+#define REG_DO_PTO_DONE__TYPE_SZ                 TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DO_PTO_DONE__TYPE_WSZ                TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PTO_DONE__SZ                      (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PTO_DONE__POS                     (uint16_t)REG_CALC_POS(REG_DO_PTO_START__POS, REG_DO_PTO_START__SZ)
+#define REG_DO_PTO_DONE__SADDR                   (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PTO_DONE__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_START__DPOS, REG_DO_PTO_START__SZ, REG_DO_PTO_START__TYPE_WSZ, 0)
+#define REG_DO_PTO_DONE__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_DONE__DPOS, REG_DO_PTO_DONE__SZ, REG_DO_PTO_DONE__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_DONE__DTABLE                  REG_DATA_BOOL_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PTO_DONE__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DI_CNTR_CMP_REACHED__MBPOS, REG_DI_CNTR_CMP_REACHED__SZ, REG_DI_CNTR_CMP_REACHED__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PTO_DONE__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_DONE__MBPOS, REG_DO_PTO_DONE__SZ, REG_DO_PTO_DONE__TYPE_WSZ, 0)-1
+#define REG_DO_PTO_DONE__MBTABLE                 MBRTU_DISC_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PTO_DONE__RETAIN                  REG_RETAIN_NONE
+//STRING
+#define REG_DO_PTO_DONE__STR                     "DO%d PTO: Done"
+
+/** @def DO_SAFE_VAL
+ */
+#define REG_DO_SAFE_VAL__GID                     (uint16_t)207         //Unique ID
+// located variable
+#define REG_DO_SAFE_VAL__ZONE                    PLC_LT_M              //ID of memory
+#define REG_DO_SAFE_VAL__TYPESZ                  PLC_LSZ_X             //ID of data type
+#define REG_DO_SAFE_VAL__GROUP                   REG_DO__GROUP         //ID of group
+#define REG_DO_SAFE_VAL__A00                     REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_SAFE_VAL__A01                     (int32_t)7            //arg1: ID of subgroup by mode
+#define REG_DO_SAFE_VAL__A02                     (int32_t)1            //arg2: ID of register
+#define REG_DO_SAFE_VAL__TYPE                    TYPE_BOOL             //Data type
+#define REG_DO_SAFE_VAL__TYPE_SZ                 TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DO_SAFE_VAL__TYPE_WSZ                TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_SAFE_VAL__SZ                      (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_SAFE_VAL__POS                     (uint16_t)REG_CALC_POS(REG_DO_PTO_DONE__POS, REG_DO_PTO_DONE__SZ)
+#define REG_DO_SAFE_VAL__SADDR                   (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_SAFE_VAL__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_DONE__DPOS, REG_DO_PTO_DONE__SZ, REG_DO_PTO_DONE__TYPE_WSZ, 0)
+#define REG_DO_SAFE_VAL__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_VAL__DPOS, REG_DO_SAFE_VAL__SZ, REG_DO_SAFE_VAL__TYPE_WSZ, 0)-1
+#define REG_DO_SAFE_VAL__DTABLE                  REG_DATA_BOOL_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_SAFE_VAL__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_START__MBPOS, REG_DO_PTO_START__SZ, REG_DO_PTO_START__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_SAFE_VAL__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_VAL__MBPOS, REG_DO_SAFE_VAL__SZ, REG_DO_SAFE_VAL__TYPE_WSZ, 0)-1
+#define REG_DO_SAFE_VAL__MBTABLE                 MBRTU_COIL_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_SAFE_VAL__RETAIN                  REG_RETAIN_ALL
+//STRING
+#define REG_DO_SAFE_VAL__STR                     "DO%d Safe: Value"
+
+/** @def DO_SAFE_ALLOW
+ */
+#define REG_DO_SAFE_ALLOW__GID                   (uint16_t)208         //Unique ID
+// located variable
+#define REG_DO_SAFE_ALLOW__ZONE                  PLC_LT_M              //ID of memory
+#define REG_DO_SAFE_ALLOW__TYPESZ                PLC_LSZ_X             //ID of data type
+#define REG_DO_SAFE_ALLOW__GROUP                 REG_DO__GROUP         //ID of group
+#define REG_DO_SAFE_ALLOW__A00                   REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_SAFE_ALLOW__A01                   (int32_t)7            //arg1: ID of subgroup by mode
+#define REG_DO_SAFE_ALLOW__A02                   (int32_t)2            //arg2: ID of register
+#define REG_DO_SAFE_ALLOW__TYPE                  TYPE_BOOL             //Data type
+#define REG_DO_SAFE_ALLOW__TYPE_SZ               TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DO_SAFE_ALLOW__TYPE_WSZ              TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_SAFE_ALLOW__SZ                    (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_SAFE_ALLOW__POS                   (uint16_t)REG_CALC_POS(REG_DO_SAFE_VAL__POS, REG_DO_SAFE_VAL__SZ)
+#define REG_DO_SAFE_ALLOW__SADDR                 (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_SAFE_ALLOW__DPOS                  (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_VAL__DPOS, REG_DO_SAFE_VAL__SZ, REG_DO_SAFE_VAL__TYPE_WSZ, 0)
+#define REG_DO_SAFE_ALLOW__DPOS_END              (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_ALLOW__DPOS, REG_DO_SAFE_ALLOW__SZ, REG_DO_SAFE_ALLOW__TYPE_WSZ, 0)-1
+#define REG_DO_SAFE_ALLOW__DTABLE                REG_DATA_BOOL_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_SAFE_ALLOW__MBPOS                 (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_VAL__MBPOS, REG_DO_SAFE_VAL__SZ, REG_DO_SAFE_VAL__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_SAFE_ALLOW__MBPOS_END             (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_ALLOW__MBPOS, REG_DO_SAFE_ALLOW__SZ, REG_DO_SAFE_ALLOW__TYPE_WSZ, 0)-1
+#define REG_DO_SAFE_ALLOW__MBTABLE               MBRTU_COIL_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_SAFE_ALLOW__RETAIN                REG_RETAIN_ALL
+//STRING
+#define REG_DO_SAFE_ALLOW__STR                   "DO%d Safe: Allow"
+
+/** @def DO_PWM_FREQ (Hz)
+ */
+#define REG_DO_PWM_FREQ__GID                     (uint16_t)209         //Unique ID
+// located variable
+#define REG_DO_PWM_FREQ__ZONE                    PLC_LT_M              //ID of memory
+#define REG_DO_PWM_FREQ__TYPESZ                  PLC_LSZ_D             //ID of data type
+#define REG_DO_PWM_FREQ__GROUP                   REG_DO__GROUP         //ID of group
+#define REG_DO_PWM_FREQ__A00                     REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PWM_FREQ__A01                     (int32_t)3            //arg1: ID of subgroup by mode
+#define REG_DO_PWM_FREQ__A02                     (int32_t)4            //arg2: ID of register
+#define REG_DO_PWM_FREQ__TYPE                    TYPE_DWORD            //Data type
+#define REG_DO_PWM_FREQ__TYPE_SZ                 TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PWM_FREQ__TYPE_WSZ                TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PWM_FREQ__SZ                      (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PWM_FREQ__POS                     (uint16_t)REG_CALC_POS(REG_DO_SAFE_ALLOW__POS, REG_DO_SAFE_ALLOW__SZ)
+#define REG_DO_PWM_FREQ__SADDR                   (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PWM_FREQ__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PROFILE__DPOS, REG_DO_PTO_PROFILE__SZ, REG_DO_PTO_PROFILE__TYPE_WSZ, 0)
+#define REG_DO_PWM_FREQ__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ__DPOS, REG_DO_PWM_FREQ__SZ, REG_DO_PWM_FREQ__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_FREQ__DTABLE                  REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PWM_FREQ__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_PROFILE__MBPOS, REG_DO_PTO_PROFILE__SZ, REG_DO_PTO_PROFILE__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PWM_FREQ__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ__MBPOS, REG_DO_PWM_FREQ__SZ, REG_DO_PWM_FREQ__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_FREQ__MBTABLE                 MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PWM_FREQ__RETAIN                  REG_RETAIN_ALL
+//STRING
+#define REG_DO_PWM_FREQ__STR                     "DO%d PWM: Frequency, Hz"
+
+/** @def DO_PWM_PERIOD_NS (ns)
+ */
+#define REG_DO_PWM_PERIOD_NS__GID                (uint16_t)210         //Unique ID
+// located variable
+#define REG_DO_PWM_PERIOD_NS__ZONE               PLC_LT_M              //ID of memory
+#define REG_DO_PWM_PERIOD_NS__TYPESZ             PLC_LSZ_D             //ID of data type
+#define REG_DO_PWM_PERIOD_NS__GROUP              REG_DO__GROUP         //ID of group
+#define REG_DO_PWM_PERIOD_NS__A00                REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PWM_PERIOD_NS__A01                (int32_t)3            //arg1: ID of subgroup by mode
+#define REG_DO_PWM_PERIOD_NS__A02                (int32_t)5            //arg2: ID of register
+#define REG_DO_PWM_PERIOD_NS__TYPE               TYPE_DWORD            //Data type
+#define REG_DO_PWM_PERIOD_NS__TYPE_SZ            TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PWM_PERIOD_NS__TYPE_WSZ           TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PWM_PERIOD_NS__SZ                 (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PWM_PERIOD_NS__POS                (uint16_t)REG_CALC_POS(REG_DO_PWM_FREQ__POS, REG_DO_PWM_FREQ__SZ)
+#define REG_DO_PWM_PERIOD_NS__SADDR              (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PWM_PERIOD_NS__DPOS               (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ__DPOS, REG_DO_PWM_FREQ__SZ, REG_DO_PWM_FREQ__TYPE_WSZ, 0)
+#define REG_DO_PWM_PERIOD_NS__DPOS_END           (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_PERIOD_NS__DPOS, REG_DO_PWM_PERIOD_NS__SZ, REG_DO_PWM_PERIOD_NS__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_PERIOD_NS__DTABLE             REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PWM_PERIOD_NS__MBPOS              (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ__MBPOS, REG_DO_PWM_FREQ__SZ, REG_DO_PWM_FREQ__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PWM_PERIOD_NS__MBPOS_END          (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_PERIOD_NS__MBPOS, REG_DO_PWM_PERIOD_NS__SZ, REG_DO_PWM_PERIOD_NS__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_PERIOD_NS__MBTABLE            MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PWM_PERIOD_NS__RETAIN             REG_RETAIN_ALL
+//STRING
+#define REG_DO_PWM_PERIOD_NS__STR                "DO%d PWM: Period, ns"
+
+/** @def DO_PWM_RES (steps)
+ */
+#define REG_DO_PWM_RES__GID                      (uint16_t)211         //Unique ID
+// located variable
+#define REG_DO_PWM_RES__ZONE                     PLC_LT_M              //ID of memory
+#define REG_DO_PWM_RES__TYPESZ                   PLC_LSZ_D             //ID of data type
+#define REG_DO_PWM_RES__GROUP                    REG_DO__GROUP         //ID of group
+#define REG_DO_PWM_RES__A00                      REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PWM_RES__A01                      (int32_t)3            //arg1: ID of subgroup by mode
+#define REG_DO_PWM_RES__A02                      (int32_t)6            //arg2: ID of register
+#define REG_DO_PWM_RES__TYPE                     TYPE_DWORD            //Data type
+#define REG_DO_PWM_RES__TYPE_SZ                  TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PWM_RES__TYPE_WSZ                 TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PWM_RES__SZ                       (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PWM_RES__POS                      (uint16_t)REG_CALC_POS(REG_DO_PWM_PERIOD_NS__POS, REG_DO_PWM_PERIOD_NS__SZ)
+#define REG_DO_PWM_RES__SADDR                    (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PWM_RES__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_PERIOD_NS__DPOS, REG_DO_PWM_PERIOD_NS__SZ, REG_DO_PWM_PERIOD_NS__TYPE_WSZ, 0)
+#define REG_DO_PWM_RES__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES__DPOS, REG_DO_PWM_RES__SZ, REG_DO_PWM_RES__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_RES__DTABLE                   REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PWM_RES__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_PERIOD_NS__MBPOS, REG_DO_PWM_PERIOD_NS__SZ, REG_DO_PWM_PERIOD_NS__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PWM_RES__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES__MBPOS, REG_DO_PWM_RES__SZ, REG_DO_PWM_RES__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_RES__MBTABLE                  MBRTU_HOLD_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PWM_RES__RETAIN                   REG_RETAIN_ALL
+//STRING
+#define REG_DO_PWM_RES__STR                      "DO%d PWM: Resolution, steps"
+
+/** @def DO_PWM_FREQ_ACT (Hz)
+ */
+#define REG_DO_PWM_FREQ_ACT__GID                 (uint16_t)212         //Unique ID
+// located variable
+#define REG_DO_PWM_FREQ_ACT__ZONE                PLC_LT_M              //ID of memory
+#define REG_DO_PWM_FREQ_ACT__TYPESZ              PLC_LSZ_D             //ID of data type
+#define REG_DO_PWM_FREQ_ACT__GROUP               REG_DO__GROUP         //ID of group
+#define REG_DO_PWM_FREQ_ACT__A00                 REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PWM_FREQ_ACT__A01                 (int32_t)3            //arg1: ID of subgroup by mode
+#define REG_DO_PWM_FREQ_ACT__A02                 (int32_t)7            //arg2: ID of register
+#define REG_DO_PWM_FREQ_ACT__TYPE                TYPE_REAL             //Data type
+#define REG_DO_PWM_FREQ_ACT__TYPE_SZ             TYPE_REAL_SZ          //Size of data type in bytes
+#define REG_DO_PWM_FREQ_ACT__TYPE_WSZ            TYPE_REAL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PWM_FREQ_ACT__SZ                  (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PWM_FREQ_ACT__POS                 (uint16_t)REG_CALC_POS(REG_DO_PWM_RES__POS, REG_DO_PWM_RES__SZ)
+#define REG_DO_PWM_FREQ_ACT__SADDR               (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PWM_FREQ_ACT__DPOS                (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES__DPOS, REG_DO_PWM_RES__SZ, REG_DO_PWM_RES__TYPE_WSZ, 0)
+#define REG_DO_PWM_FREQ_ACT__DPOS_END            (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ_ACT__DPOS, REG_DO_PWM_FREQ_ACT__SZ, REG_DO_PWM_FREQ_ACT__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_FREQ_ACT__DTABLE              REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PWM_FREQ_ACT__MBPOS               (uint16_t)REG_CALC_MBPOS(REG_DO_STATUS__MBPOS, REG_DO_STATUS__SZ, REG_DO_STATUS__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PWM_FREQ_ACT__MBPOS_END           (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ_ACT__MBPOS, REG_DO_PWM_FREQ_ACT__SZ, REG_DO_PWM_FREQ_ACT__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_FREQ_ACT__MBTABLE             MBRTU_INPT_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PWM_FREQ_ACT__RETAIN              REG_RETAIN_NONE
+//STRING
+#define REG_DO_PWM_FREQ_ACT__STR                 "DO%d PWM: Achieved frequency, Hz"
+
+/** @def DO_PWM_RES_ACT (steps)
+ */
+#define REG_DO_PWM_RES_ACT__GID                  (uint16_t)213         //Unique ID
+// located variable
+#define REG_DO_PWM_RES_ACT__ZONE                 PLC_LT_M              //ID of memory
+#define REG_DO_PWM_RES_ACT__TYPESZ               PLC_LSZ_D             //ID of data type
+#define REG_DO_PWM_RES_ACT__GROUP                REG_DO__GROUP         //ID of group
+#define REG_DO_PWM_RES_ACT__A00                  REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_PWM_RES_ACT__A01                  (int32_t)3            //arg1: ID of subgroup by mode
+#define REG_DO_PWM_RES_ACT__A02                  (int32_t)8            //arg2: ID of register
+#define REG_DO_PWM_RES_ACT__TYPE                 TYPE_DWORD            //Data type
+#define REG_DO_PWM_RES_ACT__TYPE_SZ              TYPE_DWORD_SZ         //Size of data type in bytes
+#define REG_DO_PWM_RES_ACT__TYPE_WSZ             TYPE_DWORD_WSZ        //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_PWM_RES_ACT__SZ                   (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_PWM_RES_ACT__POS                  (uint16_t)REG_CALC_POS(REG_DO_PWM_FREQ_ACT__POS, REG_DO_PWM_FREQ_ACT__SZ)
+#define REG_DO_PWM_RES_ACT__SADDR                (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_PWM_RES_ACT__DPOS                 (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ_ACT__DPOS, REG_DO_PWM_FREQ_ACT__SZ, REG_DO_PWM_FREQ_ACT__TYPE_WSZ, 0)
+#define REG_DO_PWM_RES_ACT__DPOS_END             (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES_ACT__DPOS, REG_DO_PWM_RES_ACT__SZ, REG_DO_PWM_RES_ACT__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_RES_ACT__DTABLE               REG_DATA_NUMB_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_PWM_RES_ACT__MBPOS                (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_FREQ_ACT__MBPOS, REG_DO_PWM_FREQ_ACT__SZ, REG_DO_PWM_FREQ_ACT__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_PWM_RES_ACT__MBPOS_END            (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES_ACT__MBPOS, REG_DO_PWM_RES_ACT__SZ, REG_DO_PWM_RES_ACT__TYPE_WSZ, 0)-1
+#define REG_DO_PWM_RES_ACT__MBTABLE              MBRTU_INPT_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_PWM_RES_ACT__RETAIN               REG_RETAIN_NONE
+//STRING
+#define REG_DO_PWM_RES_ACT__STR                  "DO%d PWM: Achieved resolution, steps"
+
+
+/** @def DO_CMP_HELD
+ */
+#define REG_DO_CMP_HELD__GID                     (uint16_t)214         //Unique ID
+// located variable
+#define REG_DO_CMP_HELD__ZONE                    PLC_LT_M              //ID of memory
+#define REG_DO_CMP_HELD__TYPESZ                  PLC_LSZ_X             //ID of data type
+#define REG_DO_CMP_HELD__GROUP                   REG_DO__GROUP         //ID of group
+#define REG_DO_CMP_HELD__A00                     REG_AXX_ADDR          //arg0: channel number (auto)
+#define REG_DO_CMP_HELD__A01                     (int32_t)5            //arg1: ID of subgroup
+#define REG_DO_CMP_HELD__A02                     (int32_t)1            //arg2: ID of register
+#define REG_DO_CMP_HELD__TYPE                    TYPE_BOOL             //Data type
+#define REG_DO_CMP_HELD__TYPE_SZ                 TYPE_BOOL_SZ          //Size of data type in bytes
+#define REG_DO_CMP_HELD__TYPE_WSZ                TYPE_BOOL_WSZ         //Size of data type in words
+// position (offset) in REGS
+#define REG_DO_CMP_HELD__SZ                      (uint16_t)PLC_DO_SZ   //Number of registers
+#define REG_DO_CMP_HELD__POS                     (uint16_t)REG_CALC_POS(REG_DO_PWM_RES_ACT__POS, REG_DO_PWM_RES_ACT__SZ)
+#define REG_DO_CMP_HELD__SADDR                   (uint16_t)0           //Start register address
+// position (offset) in Data Table
+#define REG_DO_CMP_HELD__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_ALLOW__DPOS, REG_DO_SAFE_ALLOW__SZ, REG_DO_SAFE_ALLOW__TYPE_WSZ, 0)
+#define REG_DO_CMP_HELD__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_DO_CMP_HELD__DPOS, REG_DO_CMP_HELD__SZ, REG_DO_CMP_HELD__TYPE_WSZ, 0)-1
+#define REG_DO_CMP_HELD__DTABLE                  REG_DATA_BOOL_TABLE_ID //Data Table ID
+// position (offset) in ModBus Table
+#define REG_DO_CMP_HELD__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_DO_PTO_DONE__MBPOS, REG_DO_PTO_DONE__SZ, REG_DO_PTO_DONE__TYPE_WSZ, REG_RESERVE)
+#define REG_DO_CMP_HELD__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_DO_CMP_HELD__MBPOS, REG_DO_CMP_HELD__SZ, REG_DO_CMP_HELD__TYPE_WSZ, 0)-1
+#define REG_DO_CMP_HELD__MBTABLE                 MBRTU_DISC_TABLE_ID   //ModBus Table ID
+// EEPROM
+#define REG_DO_CMP_HELD__RETAIN                  REG_RETAIN_NONE
+//STRING
+#define REG_DO_CMP_HELD__STR                     "DO%d: Held by DI counter compare-match"
+
 
 //AI
 
@@ -744,14 +1406,14 @@
 #define REG_AI_VAL__TYPE_WSZ                     TYPE_REAL_WSZ         //size of data type (words)
 // position (offset) in REGS
 #define REG_AI_VAL__SZ                           PLC_AI_SZ   		   //number of registers
-#define REG_AI_VAL__POS                          (uint16_t)REG_CALC_POS(REG_DO_STATUS__POS, REG_DO_STATUS__SZ)
+#define REG_AI_VAL__POS                          (uint16_t)REG_CALC_POS(REG_DO_CMP_HELD__POS, REG_DO_CMP_HELD__SZ)
 #define REG_AI_VAL__SADDR                        (uint16_t)0           //start register address
 // position (offset) in Data Table
-#define REG_AI_VAL__DPOS                         (uint16_t)REG_CALC_MBPOS(REG_DO_STATUS__DPOS, REG_DO_STATUS__SZ, REG_DO_STATUS__TYPE_WSZ, 0)
+#define REG_AI_VAL__DPOS                         (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES_ACT__DPOS, REG_DO_PWM_RES_ACT__SZ, REG_DO_PWM_RES_ACT__TYPE_WSZ, 0)
 #define REG_AI_VAL__DPOS_END                     (uint16_t)REG_CALC_MBPOS(REG_AI_VAL__DPOS, REG_AI_VAL__SZ, REG_AI_VAL__TYPE_WSZ, 0)-1
 #define REG_AI_VAL__DTABLE                       REG_DATA_NUMB_TABLE_ID //data table ID
 // position (offset) in ModBus Table
-#define REG_AI_VAL__MBPOS                        (uint16_t)REG_CALC_MBPOS(REG_DO_STATUS__MBPOS, REG_DO_STATUS__SZ, REG_DO_STATUS__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_VAL__MBPOS                        (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES_ACT__MBPOS, REG_DO_PWM_RES_ACT__SZ, REG_DO_PWM_RES_ACT__TYPE_WSZ, REG_RESERVE)
 #define REG_AI_VAL__MBPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_AI_VAL__MBPOS, REG_AI_VAL__SZ, REG_AI_VAL__TYPE_WSZ, 0)-1
 #define REG_AI_VAL__MBTABLE                      MBRTU_INPT_TABLE_ID   //modbus table ID
 // EEPROM
@@ -781,7 +1443,7 @@
 #define REG_AI_MODE__DPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_AI_MODE__DPOS, REG_AI_MODE__SZ, REG_AI_MODE__TYPE_WSZ, 0)-1
 #define REG_AI_MODE__DTABLE                      REG_DATA_NUMB_TABLE_ID  //data table ID
 // position (offset) in ModBus Table
-#define REG_AI_MODE__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_DO_MODE__MBPOS, REG_DO_MODE__SZ, REG_DO_MODE__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_MODE__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_RES__MBPOS, REG_DO_PWM_RES__SZ, REG_DO_PWM_RES__TYPE_WSZ, REG_RESERVE)
 #define REG_AI_MODE__MBPOS_END                   (uint16_t)REG_CALC_MBPOS(REG_AI_MODE__MBPOS, REG_AI_MODE__SZ, REG_AI_MODE__TYPE_WSZ, 0)-1
 #define REG_AI_MODE__MBTABLE                     MBRTU_HOLD_TABLE_ID   //modbus table ID
 // EEPROM
@@ -879,15 +1541,612 @@
 // STRING
 #define REG_AI_KB__STR                           "AI%d: Custom scale factor Kb"
 
+/** @def AI_FLTR
+ */
+#define REG_AI_FLTR__GID                         (uint16_t)35           //unique ID
+// located variable
+#define REG_AI_FLTR__ZONE                        PLC_LT_M               //memory zone ID
+#define REG_AI_FLTR__TYPESZ                      PLC_LSZ_B              //data type ID
+#define REG_AI_FLTR__GROUP                       REG_AI__GROUP
+#define REG_AI_FLTR__A00                         REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_FLTR__A01                         (int32_t)6             //arg1: ID of subgroup
+#define REG_AI_FLTR__A02                         REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_FLTR__TYPE                        TYPE_BYTE              //data type
+#define REG_AI_FLTR__TYPE_SZ                     TYPE_BYTE_SZ           //size of data type (bytes)
+#define REG_AI_FLTR__TYPE_WSZ                    TYPE_BYTE_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_FLTR__SZ                          PLC_AI_SZ              //number of registers
+#define REG_AI_FLTR__POS                         (uint16_t)REG_CALC_POS(REG_AI_KB__POS, REG_AI_KB__SZ)
+#define REG_AI_FLTR__SADDR                       (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_FLTR__DPOS                        (uint16_t)REG_CALC_MBPOS(REG_AI_KB__DPOS, REG_AI_KB__SZ, REG_AI_KB__TYPE_WSZ, 0)
+#define REG_AI_FLTR__DPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR__DPOS, REG_AI_FLTR__SZ, REG_AI_FLTR__TYPE_WSZ, 0)-1
+#define REG_AI_FLTR__DTABLE                      REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_FLTR__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_AI_KB__MBPOS, REG_AI_KB__SZ, REG_AI_KB__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_FLTR__MBPOS_END                   (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR__MBPOS, REG_AI_FLTR__SZ, REG_AI_FLTR__TYPE_WSZ, 0)-1
+#define REG_AI_FLTR__MBTABLE                     MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_FLTR__RETAIN                      REG_RETAIN_ALL
+// STRING
+#define REG_AI_FLTR__STR                         "AI%d: Filter type"
+
+
+/** @def AI_FLTR_PRM
+ */
+#define REG_AI_FLTR_PRM__GID                     (uint16_t)36           //unique ID
+// located variable
+#define REG_AI_FLTR_PRM__ZONE                    PLC_LT_M               //memory zone ID
+#define REG_AI_FLTR_PRM__TYPESZ                  PLC_LSZ_W              //data type ID
+#define REG_AI_FLTR_PRM__GROUP                   REG_AI__GROUP
+#define REG_AI_FLTR_PRM__A00                     REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_FLTR_PRM__A01                     (int32_t)7             //arg1: ID of subgroup
+#define REG_AI_FLTR_PRM__A02                     REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_FLTR_PRM__TYPE                    TYPE_WORD              //data type
+#define REG_AI_FLTR_PRM__TYPE_SZ                 TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_FLTR_PRM__TYPE_WSZ                TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_FLTR_PRM__SZ                      PLC_AI_SZ              //number of registers
+#define REG_AI_FLTR_PRM__POS                     (uint16_t)REG_CALC_POS(REG_AI_FLTR__POS, REG_AI_FLTR__SZ)
+#define REG_AI_FLTR_PRM__SADDR                   (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_FLTR_PRM__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR__DPOS, REG_AI_FLTR__SZ, REG_AI_FLTR__TYPE_WSZ, 0)
+#define REG_AI_FLTR_PRM__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR_PRM__DPOS, REG_AI_FLTR_PRM__SZ, REG_AI_FLTR_PRM__TYPE_WSZ, 0)-1
+#define REG_AI_FLTR_PRM__DTABLE                  REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_FLTR_PRM__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR__MBPOS, REG_AI_FLTR__SZ, REG_AI_FLTR__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_FLTR_PRM__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR_PRM__MBPOS, REG_AI_FLTR_PRM__SZ, REG_AI_FLTR_PRM__TYPE_WSZ, 0)-1
+#define REG_AI_FLTR_PRM__MBTABLE                 MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_FLTR_PRM__RETAIN                  REG_RETAIN_ALL
+// STRING
+#define REG_AI_FLTR_PRM__STR                     "AI%d: Filter parameter"
+
+/** @def AI_OVS
+ */
+#define REG_AI_OVS__GID                          (uint16_t)37           //unique ID
+// located variable
+#define REG_AI_OVS__ZONE                         PLC_LT_M               //memory zone ID
+#define REG_AI_OVS__TYPESZ                       PLC_LSZ_B              //data type ID
+#define REG_AI_OVS__GROUP                        REG_AI__GROUP
+#define REG_AI_OVS__A00                          REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_OVS__A01                          (int32_t)8             //arg1: ID of subgroup
+#define REG_AI_OVS__A02                          REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_OVS__TYPE                         TYPE_BYTE              //data type
+#define REG_AI_OVS__TYPE_SZ                      TYPE_BYTE_SZ           //size of data type (bytes)
+#define REG_AI_OVS__TYPE_WSZ                     TYPE_BYTE_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_OVS__SZ                           PLC_AI_SZ              //number of registers
+#define REG_AI_OVS__POS                          (uint16_t)REG_CALC_POS(REG_AI_FLTR_PRM__POS, REG_AI_FLTR_PRM__SZ)
+#define REG_AI_OVS__SADDR                        (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_OVS__DPOS                         (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR_PRM__DPOS, REG_AI_FLTR_PRM__SZ, REG_AI_FLTR_PRM__TYPE_WSZ, 0)
+#define REG_AI_OVS__DPOS_END                     (uint16_t)REG_CALC_MBPOS(REG_AI_OVS__DPOS, REG_AI_OVS__SZ, REG_AI_OVS__TYPE_WSZ, 0)-1
+#define REG_AI_OVS__DTABLE                       REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_OVS__MBPOS                        (uint16_t)REG_CALC_MBPOS(REG_AI_FLTR_PRM__MBPOS, REG_AI_FLTR_PRM__SZ, REG_AI_FLTR_PRM__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_OVS__MBPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_AI_OVS__MBPOS, REG_AI_OVS__SZ, REG_AI_OVS__TYPE_WSZ, 0)-1
+#define REG_AI_OVS__MBTABLE                      MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_OVS__RETAIN                       REG_RETAIN_ALL
+// STRING
+#define REG_AI_OVS__STR                          "AI%d: Oversampling, extra bits"
+
+
+/** @def AI_RATE_ACT
+ */
+#define REG_AI_RATE_ACT__GID                     (uint16_t)38           //unique ID
+// located variable
+#define REG_AI_RATE_ACT__ZONE                    PLC_LT_M               //memory zone ID
+#define REG_AI_RATE_ACT__TYPESZ                  PLC_LSZ_D              //data type ID
+#define REG_AI_RATE_ACT__GROUP                   REG_AI__GROUP
+#define REG_AI_RATE_ACT__A00                     REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_RATE_ACT__A01                     (int32_t)9             //arg1: ID of subgroup
+#define REG_AI_RATE_ACT__A02                     REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_RATE_ACT__TYPE                    TYPE_REAL              //data type
+#define REG_AI_RATE_ACT__TYPE_SZ                 TYPE_REAL_SZ           //size of data type (bytes)
+#define REG_AI_RATE_ACT__TYPE_WSZ                TYPE_REAL_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_RATE_ACT__SZ                      PLC_AI_SZ              //number of registers
+#define REG_AI_RATE_ACT__POS                     (uint16_t)REG_CALC_POS(REG_AI_OVS__POS, REG_AI_OVS__SZ)
+#define REG_AI_RATE_ACT__SADDR                   (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_RATE_ACT__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_OVS__DPOS, REG_AI_OVS__SZ, REG_AI_OVS__TYPE_WSZ, 0)
+#define REG_AI_RATE_ACT__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_RATE_ACT__DPOS, REG_AI_RATE_ACT__SZ, REG_AI_RATE_ACT__TYPE_WSZ, 0)-1
+#define REG_AI_RATE_ACT__DTABLE                  REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_RATE_ACT__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_AI_STATUS__MBPOS, REG_AI_STATUS__SZ, REG_AI_STATUS__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_RATE_ACT__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_AI_RATE_ACT__MBPOS, REG_AI_RATE_ACT__SZ, REG_AI_RATE_ACT__TYPE_WSZ, 0)-1
+#define REG_AI_RATE_ACT__MBTABLE                 MBRTU_INPT_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_RATE_ACT__RETAIN                  REG_RETAIN_NONE
+// STRING
+#define REG_AI_RATE_ACT__STR                     "AI%d: Effective sample rate, Hz"
+
+
+/** @def AI_BITS_ACT
+ */
+#define REG_AI_BITS_ACT__GID                     (uint16_t)39           //unique ID
+// located variable
+#define REG_AI_BITS_ACT__ZONE                    PLC_LT_M               //memory zone ID
+#define REG_AI_BITS_ACT__TYPESZ                  PLC_LSZ_B              //data type ID
+#define REG_AI_BITS_ACT__GROUP                   REG_AI__GROUP
+#define REG_AI_BITS_ACT__A00                     REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_BITS_ACT__A01                     (int32_t)10            //arg1: ID of subgroup
+#define REG_AI_BITS_ACT__A02                     REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_BITS_ACT__TYPE                    TYPE_BYTE              //data type
+#define REG_AI_BITS_ACT__TYPE_SZ                 TYPE_BYTE_SZ           //size of data type (bytes)
+#define REG_AI_BITS_ACT__TYPE_WSZ                TYPE_BYTE_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_BITS_ACT__SZ                      PLC_AI_SZ              //number of registers
+#define REG_AI_BITS_ACT__POS                     (uint16_t)REG_CALC_POS(REG_AI_RATE_ACT__POS, REG_AI_RATE_ACT__SZ)
+#define REG_AI_BITS_ACT__SADDR                   (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_BITS_ACT__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_RATE_ACT__DPOS, REG_AI_RATE_ACT__SZ, REG_AI_RATE_ACT__TYPE_WSZ, 0)
+#define REG_AI_BITS_ACT__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_BITS_ACT__DPOS, REG_AI_BITS_ACT__SZ, REG_AI_BITS_ACT__TYPE_WSZ, 0)-1
+#define REG_AI_BITS_ACT__DTABLE                  REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_BITS_ACT__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_AI_RATE_ACT__MBPOS, REG_AI_RATE_ACT__SZ, REG_AI_RATE_ACT__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_BITS_ACT__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_AI_BITS_ACT__MBPOS, REG_AI_BITS_ACT__SZ, REG_AI_BITS_ACT__TYPE_WSZ, 0)-1
+#define REG_AI_BITS_ACT__MBTABLE                 MBRTU_INPT_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_BITS_ACT__RETAIN                  REG_RETAIN_NONE
+// STRING
+#define REG_AI_BITS_ACT__STR                     "AI%d: Effective resolution, bits"
+
+/** @def AI_DB
+ */
+#define REG_AI_DB__GID                           (uint16_t)40           //unique ID
+// located variable
+#define REG_AI_DB__ZONE                          PLC_LT_M               //memory zone ID
+#define REG_AI_DB__TYPESZ                        PLC_LSZ_D              //data type ID
+#define REG_AI_DB__GROUP                         REG_AI__GROUP
+#define REG_AI_DB__A00                           REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_DB__A01                           (int32_t)11            //arg1: ID of subgroup
+#define REG_AI_DB__A02                           REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_DB__TYPE                          TYPE_REAL              //data type
+#define REG_AI_DB__TYPE_SZ                       TYPE_REAL_SZ           //size of data type (bytes)
+#define REG_AI_DB__TYPE_WSZ                      TYPE_REAL_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_DB__SZ                            PLC_AI_SZ              //number of registers
+#define REG_AI_DB__POS                           (uint16_t)REG_CALC_POS(REG_AI_BITS_ACT__POS, REG_AI_BITS_ACT__SZ)
+#define REG_AI_DB__SADDR                         (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_DB__DPOS                          (uint16_t)REG_CALC_MBPOS(REG_AI_BITS_ACT__DPOS, REG_AI_BITS_ACT__SZ, REG_AI_BITS_ACT__TYPE_WSZ, 0)
+#define REG_AI_DB__DPOS_END                      (uint16_t)REG_CALC_MBPOS(REG_AI_DB__DPOS, REG_AI_DB__SZ, REG_AI_DB__TYPE_WSZ, 0)-1
+#define REG_AI_DB__DTABLE                        REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_DB__MBPOS                         (uint16_t)REG_CALC_MBPOS(REG_AI_OVS__MBPOS, REG_AI_OVS__SZ, REG_AI_OVS__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_DB__MBPOS_END                     (uint16_t)REG_CALC_MBPOS(REG_AI_DB__MBPOS, REG_AI_DB__SZ, REG_AI_DB__TYPE_WSZ, 0)-1
+#define REG_AI_DB__MBTABLE                       MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_DB__RETAIN                        REG_RETAIN_ALL
+// STRING
+#define REG_AI_DB__STR                           "AI%d: Deadband (absolute)"
+
+
+/** @def AI_DB_PCT
+ */
+#define REG_AI_DB_PCT__GID                       (uint16_t)41           //unique ID
+// located variable
+#define REG_AI_DB_PCT__ZONE                      PLC_LT_M               //memory zone ID
+#define REG_AI_DB_PCT__TYPESZ                    PLC_LSZ_D              //data type ID
+#define REG_AI_DB_PCT__GROUP                     REG_AI__GROUP
+#define REG_AI_DB_PCT__A00                       REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_DB_PCT__A01                       (int32_t)12            //arg1: ID of subgroup
+#define REG_AI_DB_PCT__A02                       REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_DB_PCT__TYPE                      TYPE_REAL              //data type
+#define REG_AI_DB_PCT__TYPE_SZ                   TYPE_REAL_SZ           //size of data type (bytes)
+#define REG_AI_DB_PCT__TYPE_WSZ                  TYPE_REAL_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_DB_PCT__SZ                        PLC_AI_SZ              //number of registers
+#define REG_AI_DB_PCT__POS                       (uint16_t)REG_CALC_POS(REG_AI_DB__POS, REG_AI_DB__SZ)
+#define REG_AI_DB_PCT__SADDR                     (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_DB_PCT__DPOS                      (uint16_t)REG_CALC_MBPOS(REG_AI_DB__DPOS, REG_AI_DB__SZ, REG_AI_DB__TYPE_WSZ, 0)
+#define REG_AI_DB_PCT__DPOS_END                  (uint16_t)REG_CALC_MBPOS(REG_AI_DB_PCT__DPOS, REG_AI_DB_PCT__SZ, REG_AI_DB_PCT__TYPE_WSZ, 0)-1
+#define REG_AI_DB_PCT__DTABLE                    REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_DB_PCT__MBPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_DB__MBPOS, REG_AI_DB__SZ, REG_AI_DB__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_DB_PCT__MBPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_DB_PCT__MBPOS, REG_AI_DB_PCT__SZ, REG_AI_DB_PCT__TYPE_WSZ, 0)-1
+#define REG_AI_DB_PCT__MBTABLE                   MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_DB_PCT__RETAIN                    REG_RETAIN_ALL
+// STRING
+#define REG_AI_DB_PCT__STR                       "AI%d: Deadband, % of value"
+
+
+/** @def AI_PUB_MIN
+ */
+#define REG_AI_PUB_MIN__GID                      (uint16_t)42           //unique ID
+// located variable
+#define REG_AI_PUB_MIN__ZONE                     PLC_LT_M               //memory zone ID
+#define REG_AI_PUB_MIN__TYPESZ                   PLC_LSZ_W              //data type ID
+#define REG_AI_PUB_MIN__GROUP                    REG_AI__GROUP
+#define REG_AI_PUB_MIN__A00                      REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_PUB_MIN__A01                      (int32_t)13            //arg1: ID of subgroup
+#define REG_AI_PUB_MIN__A02                      REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_PUB_MIN__TYPE                     TYPE_WORD              //data type
+#define REG_AI_PUB_MIN__TYPE_SZ                  TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_PUB_MIN__TYPE_WSZ                 TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_PUB_MIN__SZ                       PLC_AI_SZ              //number of registers
+#define REG_AI_PUB_MIN__POS                      (uint16_t)REG_CALC_POS(REG_AI_DB_PCT__POS, REG_AI_DB_PCT__SZ)
+#define REG_AI_PUB_MIN__SADDR                    (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_PUB_MIN__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_DB_PCT__DPOS, REG_AI_DB_PCT__SZ, REG_AI_DB_PCT__TYPE_WSZ, 0)
+#define REG_AI_PUB_MIN__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_MIN__DPOS, REG_AI_PUB_MIN__SZ, REG_AI_PUB_MIN__TYPE_WSZ, 0)-1
+#define REG_AI_PUB_MIN__DTABLE                   REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_PUB_MIN__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_DB_PCT__MBPOS, REG_AI_DB_PCT__SZ, REG_AI_DB_PCT__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_PUB_MIN__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_MIN__MBPOS, REG_AI_PUB_MIN__SZ, REG_AI_PUB_MIN__TYPE_WSZ, 0)-1
+#define REG_AI_PUB_MIN__MBTABLE                  MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_PUB_MIN__RETAIN                   REG_RETAIN_ALL
+// STRING
+#define REG_AI_PUB_MIN__STR                      "AI%d: Min. publish interval, ms"
+
+
+/** @def AI_PUB_HB
+ */
+#define REG_AI_PUB_HB__GID                       (uint16_t)43           //unique ID
+// located variable
+#define REG_AI_PUB_HB__ZONE                      PLC_LT_M               //memory zone ID
+#define REG_AI_PUB_HB__TYPESZ                    PLC_LSZ_W              //data type ID
+#define REG_AI_PUB_HB__GROUP                     REG_AI__GROUP
+#define REG_AI_PUB_HB__A00                       REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_PUB_HB__A01                       (int32_t)14            //arg1: ID of subgroup
+#define REG_AI_PUB_HB__A02                       REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_PUB_HB__TYPE                      TYPE_WORD              //data type
+#define REG_AI_PUB_HB__TYPE_SZ                   TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_PUB_HB__TYPE_WSZ                  TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_PUB_HB__SZ                        PLC_AI_SZ              //number of registers
+#define REG_AI_PUB_HB__POS                       (uint16_t)REG_CALC_POS(REG_AI_PUB_MIN__POS, REG_AI_PUB_MIN__SZ)
+#define REG_AI_PUB_HB__SADDR                     (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_PUB_HB__DPOS                      (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_MIN__DPOS, REG_AI_PUB_MIN__SZ, REG_AI_PUB_MIN__TYPE_WSZ, 0)
+#define REG_AI_PUB_HB__DPOS_END                  (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_HB__DPOS, REG_AI_PUB_HB__SZ, REG_AI_PUB_HB__TYPE_WSZ, 0)-1
+#define REG_AI_PUB_HB__DTABLE                    REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_PUB_HB__MBPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_MIN__MBPOS, REG_AI_PUB_MIN__SZ, REG_AI_PUB_MIN__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_PUB_HB__MBPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_HB__MBPOS, REG_AI_PUB_HB__SZ, REG_AI_PUB_HB__TYPE_WSZ, 0)-1
+#define REG_AI_PUB_HB__MBTABLE                   MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_PUB_HB__RETAIN                    REG_RETAIN_ALL
+// STRING
+#define REG_AI_PUB_HB__STR                       "AI%d: Forced publish (heartbeat), s"
+
+//quantity of registers (waveform capture)
+#define REG_AI_CAP_SET_SZ                        (uint16_t)5
+#define REG_AI_CAP_CMD_SZ                        (uint16_t)2
+#define REG_AI_CAP_STAT_SZ                       (uint16_t)6
+#define REG_AI_CAP_WIN_SZ                        PLC_AI_CAP_WIN_SZ
+
+/** @def AI_CAP_SET
+ */
+#define REG_AI_CAP_SET__GID                      (uint16_t)44           //unique ID
+// located variable
+#define REG_AI_CAP_SET__ZONE                     PLC_LT_M               //memory zone ID
+#define REG_AI_CAP_SET__TYPESZ                   PLC_LSZ_W              //data type ID
+#define REG_AI_CAP_SET__GROUP                    REG_AI__GROUP
+#define REG_AI_CAP_SET__A00                      REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_CAP_SET__A01                      (int32_t)15            //arg1: ID of subgroup
+#define REG_AI_CAP_SET__A02                      REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_CAP_SET__TYPE                     TYPE_WORD              //data type
+#define REG_AI_CAP_SET__TYPE_SZ                  TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_CAP_SET__TYPE_WSZ                 TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_CAP_SET__SZ                       REG_AI_CAP_SET_SZ      //number of registers
+#define REG_AI_CAP_SET__POS                      (uint16_t)REG_CALC_POS(REG_AI_PUB_HB__POS, REG_AI_PUB_HB__SZ)
+#define REG_AI_CAP_SET__SADDR                    (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_CAP_SET__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_HB__DPOS, REG_AI_PUB_HB__SZ, REG_AI_PUB_HB__TYPE_WSZ, 0)
+#define REG_AI_CAP_SET__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_SET__DPOS, REG_AI_CAP_SET__SZ, REG_AI_CAP_SET__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_SET__DTABLE                   REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_CAP_SET__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_PUB_HB__MBPOS, REG_AI_PUB_HB__SZ, REG_AI_PUB_HB__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_CAP_SET__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_SET__MBPOS, REG_AI_CAP_SET__SZ, REG_AI_CAP_SET__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_SET__MBTABLE                  MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_CAP_SET__RETAIN                   REG_RETAIN_ALL
+// STRING
+#define REG_AI_CAP_SET__STR                      "AI Capture: Setting %d"
+
+#define REG_AI_CAP_SET__POS_CH                   (REG_AI_CAP_SET__POS+0)      //trigger channel
+#define REG_AI_CAP_SET__POS_EDGE                 (REG_AI_CAP_SET__POS+1)      //trigger edge (PLC_AI_CAP_EDGE_...)
+#define REG_AI_CAP_SET__POS_LEVEL                (REG_AI_CAP_SET__POS+2)      //trigger level (ADC-code)
+#define REG_AI_CAP_SET__POS_PRE                  (REG_AI_CAP_SET__POS+3)      //scans before trigger
+#define REG_AI_CAP_SET__POS_POST                 (REG_AI_CAP_SET__POS+4)      //scans from trigger
+//
+#define REG_AI_CAP_SET__MBPOS_CH                 (REG_AI_CAP_SET__MBPOS+0)    //CH
+#define REG_AI_CAP_SET__MBPOS_EDGE               (REG_AI_CAP_SET__MBPOS+1)    //EDGE
+#define REG_AI_CAP_SET__MBPOS_LEVEL              (REG_AI_CAP_SET__MBPOS+2)    //LEVEL
+#define REG_AI_CAP_SET__MBPOS_PRE                (REG_AI_CAP_SET__MBPOS+3)    //PRE
+#define REG_AI_CAP_SET__MBPOS_POST               (REG_AI_CAP_SET__MBPOS+4)    //POST
+
+/** @def AI_CAP_CMD
+ */
+#define REG_AI_CAP_CMD__GID                      (uint16_t)45           //unique ID
+// located variable
+#define REG_AI_CAP_CMD__ZONE                     PLC_LT_M               //memory zone ID
+#define REG_AI_CAP_CMD__TYPESZ                   PLC_LSZ_W              //data type ID
+#define REG_AI_CAP_CMD__GROUP                    REG_AI__GROUP
+#define REG_AI_CAP_CMD__A00                      REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_CAP_CMD__A01                      (int32_t)16            //arg1: ID of subgroup
+#define REG_AI_CAP_CMD__A02                      REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_CAP_CMD__TYPE                     TYPE_WORD              //data type
+#define REG_AI_CAP_CMD__TYPE_SZ                  TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_CAP_CMD__TYPE_WSZ                 TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_CAP_CMD__SZ                       REG_AI_CAP_CMD_SZ      //number of registers
+#define REG_AI_CAP_CMD__POS                      (uint16_t)REG_CALC_POS(REG_AI_CAP_SET__POS, REG_AI_CAP_SET__SZ)
+#define REG_AI_CAP_CMD__SADDR                    (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_CAP_CMD__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_SET__DPOS, REG_AI_CAP_SET__SZ, REG_AI_CAP_SET__TYPE_WSZ, 0)
+#define REG_AI_CAP_CMD__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_CMD__DPOS, REG_AI_CAP_CMD__SZ, REG_AI_CAP_CMD__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_CMD__DTABLE                   REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_CAP_CMD__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_SET__MBPOS, REG_AI_CAP_SET__SZ, REG_AI_CAP_SET__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_CAP_CMD__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_CMD__MBPOS, REG_AI_CAP_CMD__SZ, REG_AI_CAP_CMD__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_CMD__MBTABLE                  MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_CAP_CMD__RETAIN                   REG_RETAIN_NONE
+// STRING
+#define REG_AI_CAP_CMD__STR                      "AI Capture: Command %d"
+
+#define REG_AI_CAP_CMD__POS_CMD                  (REG_AI_CAP_CMD__POS+0)      //command (PLC_AI_CAP_CMD_...), 0 - done
+#define REG_AI_CAP_CMD__POS_CURSOR               (REG_AI_CAP_CMD__POS+1)      //the first scan of window
+//
+#define REG_AI_CAP_CMD__MBPOS_CMD                (REG_AI_CAP_CMD__MBPOS+0)    //CMD
+#define REG_AI_CAP_CMD__MBPOS_CURSOR             (REG_AI_CAP_CMD__MBPOS+1)    //CURSOR
+
+/** @def AI_CAP_STAT
+ */
+#define REG_AI_CAP_STAT__GID                     (uint16_t)46           //unique ID
+// located variable
+#define REG_AI_CAP_STAT__ZONE                    PLC_LT_M               //memory zone ID
+#define REG_AI_CAP_STAT__TYPESZ                  PLC_LSZ_W              //data type ID
+#define REG_AI_CAP_STAT__GROUP                   REG_AI__GROUP
+#define REG_AI_CAP_STAT__A00                     REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_CAP_STAT__A01                     (int32_t)17            //arg1: ID of subgroup
+#define REG_AI_CAP_STAT__A02                     REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_CAP_STAT__TYPE                    TYPE_WORD              //data type
+#define REG_AI_CAP_STAT__TYPE_SZ                 TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_CAP_STAT__TYPE_WSZ                TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_CAP_STAT__SZ                      REG_AI_CAP_STAT_SZ     //number of registers
+#define REG_AI_CAP_STAT__POS                     (uint16_t)REG_CALC_POS(REG_AI_CAP_CMD__POS, REG_AI_CAP_CMD__SZ)
+#define REG_AI_CAP_STAT__SADDR                   (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_CAP_STAT__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_CMD__DPOS, REG_AI_CAP_CMD__SZ, REG_AI_CAP_CMD__TYPE_WSZ, 0)
+#define REG_AI_CAP_STAT__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_STAT__DPOS, REG_AI_CAP_STAT__SZ, REG_AI_CAP_STAT__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_STAT__DTABLE                  REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_CAP_STAT__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_AI_BITS_ACT__MBPOS, REG_AI_BITS_ACT__SZ, REG_AI_BITS_ACT__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_CAP_STAT__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_STAT__MBPOS, REG_AI_CAP_STAT__SZ, REG_AI_CAP_STAT__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_STAT__MBTABLE                 MBRTU_INPT_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_CAP_STAT__RETAIN                  REG_RETAIN_NONE
+// STRING
+#define REG_AI_CAP_STAT__STR                     "AI Capture: Status %d"
+
+#define REG_AI_CAP_STAT__POS_STATE               (REG_AI_CAP_STAT__POS+0)     //state (PLC_AI_CAP_...)
+#define REG_AI_CAP_STAT__POS_LEN                 (REG_AI_CAP_STAT__POS+1)     //captured scans
+#define REG_AI_CAP_STAT__POS_TRIG                (REG_AI_CAP_STAT__POS+2)     //trigger scan in capture (Pre)
+#define REG_AI_CAP_STAT__POS_RATE                (REG_AI_CAP_STAT__POS+3)     //sample rate (Hz)
+#define REG_AI_CAP_STAT__POS_CH_SZ               (REG_AI_CAP_STAT__POS+4)     //channels per scan
+#define REG_AI_CAP_STAT__POS_WIN                 (REG_AI_CAP_STAT__POS+5)     //the first scan of window (CAP_WIN)
+//
+#define REG_AI_CAP_STAT__MBPOS_STATE             (REG_AI_CAP_STAT__MBPOS+0)   //STATE
+#define REG_AI_CAP_STAT__MBPOS_LEN               (REG_AI_CAP_STAT__MBPOS+1)   //LEN
+#define REG_AI_CAP_STAT__MBPOS_TRIG              (REG_AI_CAP_STAT__MBPOS+2)   //TRIG
+#define REG_AI_CAP_STAT__MBPOS_RATE              (REG_AI_CAP_STAT__MBPOS+3)   //RATE
+#define REG_AI_CAP_STAT__MBPOS_CH_SZ             (REG_AI_CAP_STAT__MBPOS+4)   //CH_SZ
+#define REG_AI_CAP_STAT__MBPOS_WIN               (REG_AI_CAP_STAT__MBPOS+5)   //WIN
+
+/** @def AI_CAP_WIN
+ */
+#define REG_AI_CAP_WIN__GID                      (uint16_t)47           //unique ID
+// located variable
+#define REG_AI_CAP_WIN__ZONE                     PLC_LT_M               //memory zone ID
+#define REG_AI_CAP_WIN__TYPESZ                   PLC_LSZ_W              //data type ID
+#define REG_AI_CAP_WIN__GROUP                    REG_AI__GROUP
+#define REG_AI_CAP_WIN__A00                      REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_CAP_WIN__A01                      (int32_t)18            //arg1: ID of subgroup
+#define REG_AI_CAP_WIN__A02                      REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_CAP_WIN__TYPE                     TYPE_WORD              //data type
+#define REG_AI_CAP_WIN__TYPE_SZ                  TYPE_WORD_SZ           //size of data type (bytes)
+#define REG_AI_CAP_WIN__TYPE_WSZ                 TYPE_WORD_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_CAP_WIN__SZ                       REG_AI_CAP_WIN_SZ      //number of registers
+#define REG_AI_CAP_WIN__POS                      (uint16_t)REG_CALC_POS(REG_AI_CAP_STAT__POS, REG_AI_CAP_STAT__SZ)
+#define REG_AI_CAP_WIN__SADDR                    (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_CAP_WIN__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_STAT__DPOS, REG_AI_CAP_STAT__SZ, REG_AI_CAP_STAT__TYPE_WSZ, 0)
+#define REG_AI_CAP_WIN__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_WIN__DPOS, REG_AI_CAP_WIN__SZ, REG_AI_CAP_WIN__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_WIN__DTABLE                   REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_CAP_WIN__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_STAT__MBPOS, REG_AI_CAP_STAT__SZ, REG_AI_CAP_STAT__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_CAP_WIN__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_WIN__MBPOS, REG_AI_CAP_WIN__SZ, REG_AI_CAP_WIN__TYPE_WSZ, 0)-1
+#define REG_AI_CAP_WIN__MBTABLE                  MBRTU_INPT_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_CAP_WIN__RETAIN                   REG_RETAIN_NONE
+// STRING
+#define REG_AI_CAP_WIN__STR                      "AI Capture: Window %d"
+
+//quantity of registers (linearization table)
+#define REG_AI_LIN_TBL_SZ                        (uint16_t)(PLC_AI_SZ*PLC_AI_LIN_TBL_SZ)
+
+/** @def AI_LIN
+ */
+#define REG_AI_LIN__GID                          (uint16_t)48           //unique ID
+// located variable
+#define REG_AI_LIN__ZONE                         PLC_LT_M               //memory zone ID
+#define REG_AI_LIN__TYPESZ                       PLC_LSZ_B              //data type ID
+#define REG_AI_LIN__GROUP                        REG_AI__GROUP
+#define REG_AI_LIN__A00                          REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_LIN__A01                          (int32_t)19            //arg1: ID of subgroup
+#define REG_AI_LIN__A02                          REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_LIN__TYPE                         TYPE_BYTE              //data type
+#define REG_AI_LIN__TYPE_SZ                      TYPE_BYTE_SZ           //size of data type (bytes)
+#define REG_AI_LIN__TYPE_WSZ                     TYPE_BYTE_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_LIN__SZ                           PLC_AI_SZ              //number of registers
+#define REG_AI_LIN__POS                          (uint16_t)REG_CALC_POS(REG_AI_CAP_WIN__POS, REG_AI_CAP_WIN__SZ)
+#define REG_AI_LIN__SADDR                        (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_LIN__DPOS                         (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_WIN__DPOS, REG_AI_CAP_WIN__SZ, REG_AI_CAP_WIN__TYPE_WSZ, 0)
+#define REG_AI_LIN__DPOS_END                     (uint16_t)REG_CALC_MBPOS(REG_AI_LIN__DPOS, REG_AI_LIN__SZ, REG_AI_LIN__TYPE_WSZ, 0)-1
+#define REG_AI_LIN__DTABLE                       REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_LIN__MBPOS                        (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_CMD__MBPOS, REG_AI_CAP_CMD__SZ, REG_AI_CAP_CMD__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_LIN__MBPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_AI_LIN__MBPOS, REG_AI_LIN__SZ, REG_AI_LIN__TYPE_WSZ, 0)-1
+#define REG_AI_LIN__MBTABLE                      MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_LIN__RETAIN                       REG_RETAIN_ALL
+// STRING
+#define REG_AI_LIN__STR                          "AI%d: Linearization type"
+
+
+/** @def AI_LIN_SZ
+ */
+#define REG_AI_LIN_SZ__GID                       (uint16_t)49           //unique ID
+// located variable
+#define REG_AI_LIN_SZ__ZONE                      PLC_LT_M               //memory zone ID
+#define REG_AI_LIN_SZ__TYPESZ                    PLC_LSZ_B              //data type ID
+#define REG_AI_LIN_SZ__GROUP                     REG_AI__GROUP
+#define REG_AI_LIN_SZ__A00                       REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_LIN_SZ__A01                       (int32_t)20            //arg1: ID of subgroup
+#define REG_AI_LIN_SZ__A02                       REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_LIN_SZ__TYPE                      TYPE_BYTE              //data type
+#define REG_AI_LIN_SZ__TYPE_SZ                   TYPE_BYTE_SZ           //size of data type (bytes)
+#define REG_AI_LIN_SZ__TYPE_WSZ                  TYPE_BYTE_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_LIN_SZ__SZ                        PLC_AI_SZ              //number of registers
+#define REG_AI_LIN_SZ__POS                       (uint16_t)REG_CALC_POS(REG_AI_LIN__POS, REG_AI_LIN__SZ)
+#define REG_AI_LIN_SZ__SADDR                     (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_LIN_SZ__DPOS                      (uint16_t)REG_CALC_MBPOS(REG_AI_LIN__DPOS, REG_AI_LIN__SZ, REG_AI_LIN__TYPE_WSZ, 0)
+#define REG_AI_LIN_SZ__DPOS_END                  (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_SZ__DPOS, REG_AI_LIN_SZ__SZ, REG_AI_LIN_SZ__TYPE_WSZ, 0)-1
+#define REG_AI_LIN_SZ__DTABLE                    REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_LIN_SZ__MBPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_LIN__MBPOS, REG_AI_LIN__SZ, REG_AI_LIN__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_LIN_SZ__MBPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_SZ__MBPOS, REG_AI_LIN_SZ__SZ, REG_AI_LIN_SZ__TYPE_WSZ, 0)-1
+#define REG_AI_LIN_SZ__MBTABLE                   MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_LIN_SZ__RETAIN                    REG_RETAIN_ALL
+// STRING
+#define REG_AI_LIN_SZ__STR                       "AI%d: Linearization size"
+
+
+/** @def AI_LIN_TBL
+ */
+#define REG_AI_LIN_TBL__GID                      (uint16_t)50           //unique ID
+// located variable
+#define REG_AI_LIN_TBL__ZONE                     PLC_LT_M               //memory zone ID
+#define REG_AI_LIN_TBL__TYPESZ                   PLC_LSZ_D              //data type ID
+#define REG_AI_LIN_TBL__GROUP                    REG_AI__GROUP
+#define REG_AI_LIN_TBL__A00                      REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_LIN_TBL__A01                      (int32_t)21            //arg1: ID of subgroup
+#define REG_AI_LIN_TBL__A02                      REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_LIN_TBL__TYPE                     TYPE_REAL              //data type
+#define REG_AI_LIN_TBL__TYPE_SZ                  TYPE_REAL_SZ           //size of data type (bytes)
+#define REG_AI_LIN_TBL__TYPE_WSZ                 TYPE_REAL_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_LIN_TBL__SZ                       REG_AI_LIN_TBL_SZ      //number of registers
+#define REG_AI_LIN_TBL__POS                      (uint16_t)REG_CALC_POS(REG_AI_LIN_SZ__POS, REG_AI_LIN_SZ__SZ)
+#define REG_AI_LIN_TBL__SADDR                    (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_LIN_TBL__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_SZ__DPOS, REG_AI_LIN_SZ__SZ, REG_AI_LIN_SZ__TYPE_WSZ, 0)
+#define REG_AI_LIN_TBL__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_TBL__DPOS, REG_AI_LIN_TBL__SZ, REG_AI_LIN_TBL__TYPE_WSZ, 0)-1
+#define REG_AI_LIN_TBL__DTABLE                   REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_LIN_TBL__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_SZ__MBPOS, REG_AI_LIN_SZ__SZ, REG_AI_LIN_SZ__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_LIN_TBL__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_TBL__MBPOS, REG_AI_LIN_TBL__SZ, REG_AI_LIN_TBL__TYPE_WSZ, 0)-1
+#define REG_AI_LIN_TBL__MBTABLE                  MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_LIN_TBL__RETAIN                   REG_RETAIN_ALL
+// STRING
+#define REG_AI_LIN_TBL__STR                      "AI: Linearization table %d"
+
+
+/** @def AI_THR
+ */
+#define REG_AI_THR__GID                          (uint16_t)51           //unique ID
+// located variable
+#define REG_AI_THR__ZONE                         PLC_LT_M               //memory zone ID
+#define REG_AI_THR__TYPESZ                       PLC_LSZ_D              //data type ID
+#define REG_AI_THR__GROUP                        REG_AI__GROUP
+#define REG_AI_THR__A00                          REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_THR__A01                          (int32_t)22            //arg1: ID of subgroup
+#define REG_AI_THR__A02                          REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_THR__TYPE                         TYPE_REAL              //data type
+#define REG_AI_THR__TYPE_SZ                      TYPE_REAL_SZ           //size of data type (bytes)
+#define REG_AI_THR__TYPE_WSZ                     TYPE_REAL_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_THR__SZ                           PLC_AI_SZ              //number of registers
+#define REG_AI_THR__POS                          (uint16_t)REG_CALC_POS(REG_AI_LIN_TBL__POS, REG_AI_LIN_TBL__SZ)
+#define REG_AI_THR__SADDR                        (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_THR__DPOS                         (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_TBL__DPOS, REG_AI_LIN_TBL__SZ, REG_AI_LIN_TBL__TYPE_WSZ, 0)
+#define REG_AI_THR__DPOS_END                     (uint16_t)REG_CALC_MBPOS(REG_AI_THR__DPOS, REG_AI_THR__SZ, REG_AI_THR__TYPE_WSZ, 0)-1
+#define REG_AI_THR__DTABLE                       REG_DATA_NUMB_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_THR__MBPOS                        (uint16_t)REG_CALC_MBPOS(REG_AI_LIN_TBL__MBPOS, REG_AI_LIN_TBL__SZ, REG_AI_LIN_TBL__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_THR__MBPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_AI_THR__MBPOS, REG_AI_THR__SZ, REG_AI_THR__TYPE_WSZ, 0)-1
+#define REG_AI_THR__MBTABLE                      MBRTU_HOLD_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_THR__RETAIN                       REG_RETAIN_ALL
+// STRING
+#define REG_AI_THR__STR                          "AI%d: Threshold"
+
+
+/** @def AI_THR_REACHED
+ */
+#define REG_AI_THR_REACHED__GID                  (uint16_t)52           //unique ID
+// located variable
+#define REG_AI_THR_REACHED__ZONE                 PLC_LT_M               //memory zone ID
+#define REG_AI_THR_REACHED__TYPESZ               PLC_LSZ_X              //data type ID
+#define REG_AI_THR_REACHED__GROUP                REG_AI__GROUP
+#define REG_AI_THR_REACHED__A00                  REG_AXX_ADDR           //arg0: ID of subgroup
+#define REG_AI_THR_REACHED__A01                  (int32_t)23            //arg1: ID of subgroup
+#define REG_AI_THR_REACHED__A02                  REG_AXX_NONE           //arg2: ID of subgroup
+#define REG_AI_THR_REACHED__TYPE                 TYPE_BOOL              //data type
+#define REG_AI_THR_REACHED__TYPE_SZ              TYPE_BOOL_SZ           //size of data type (bytes)
+#define REG_AI_THR_REACHED__TYPE_WSZ             TYPE_BOOL_WSZ          //size of data type (words)
+// position (offset) in REGS
+#define REG_AI_THR_REACHED__SZ                   PLC_AI_SZ              //number of registers
+#define REG_AI_THR_REACHED__POS                  (uint16_t)REG_CALC_POS(REG_AI_THR__POS, REG_AI_THR__SZ)
+#define REG_AI_THR_REACHED__SADDR                (uint16_t)0            //start register address
+// position (offset) in Data Table
+#define REG_AI_THR_REACHED__DPOS                 (uint16_t)REG_CALC_MBPOS(REG_DO_CMP_HELD__DPOS, REG_DO_CMP_HELD__SZ, REG_DO_CMP_HELD__TYPE_WSZ, 0)
+#define REG_AI_THR_REACHED__DPOS_END             (uint16_t)REG_CALC_MBPOS(REG_AI_THR_REACHED__DPOS, REG_AI_THR_REACHED__SZ, REG_AI_THR_REACHED__TYPE_WSZ, 0)-1
+#define REG_AI_THR_REACHED__DTABLE               REG_DATA_BOOL_TABLE_ID //data table ID
+// position (offset) in ModBus Table
+#define REG_AI_THR_REACHED__MBPOS                (uint16_t)REG_CALC_MBPOS(REG_DO_CMP_HELD__MBPOS, REG_DO_CMP_HELD__SZ, REG_DO_CMP_HELD__TYPE_WSZ, REG_RESERVE)
+#define REG_AI_THR_REACHED__MBPOS_END            (uint16_t)REG_CALC_MBPOS(REG_AI_THR_REACHED__MBPOS, REG_AI_THR_REACHED__SZ, REG_AI_THR_REACHED__TYPE_WSZ, 0)-1
+#define REG_AI_THR_REACHED__MBTABLE              MBRTU_DISC_TABLE_ID    //modbus table ID
+// EEPROM
+#define REG_AI_THR_REACHED__RETAIN               REG_RETAIN_NONE
+// STRING
+#define REG_AI_THR_REACHED__STR                  "AI%d: Threshold is reached"
+
+
+
+
+
+
 
 //SYSTEM
 
 //group ID
 #define REG_SYS__GROUP                           (uint16_t)7
 //quantity of registers
-#define REG_SYS_STAT_SZ                          (uint16_t)7
+#define REG_SYS_STAT_SZ                          (uint16_t)41
 #define REG_SYS_SET_SZ                           (uint16_t)2
-#define REG_SYS_CMD_SZ                           (uint16_t)3
+#define REG_SYS_RTC_SET_SZ                       (uint16_t)6
+#define REG_SYS_CMD_SZ                           (uint16_t)5
 
 /** @def SYSTEM STATUSES
  */
@@ -904,14 +2163,14 @@
 #define REG_SYS_STAT__TYPE_WSZ                   TYPE_WORD_WSZ              //size of data type (words)
 // position (offset) in REGS
 #define REG_SYS_STAT__SZ                         REG_SYS_STAT_SZ            //number of registers
-#define REG_SYS_STAT__POS                        (uint16_t)REG_CALC_POS(REG_AI_KB__POS, REG_AI_KB__SZ)
+#define REG_SYS_STAT__POS                        (uint16_t)REG_CALC_POS(REG_AI_THR_REACHED__POS, REG_AI_THR_REACHED__SZ)
 #define REG_SYS_STAT__SADDR                      (uint16_t)0                //start register address
 // position (offset) in Data Table
-#define REG_SYS_STAT__DPOS                       (uint16_t)REG_CALC_MBPOS(REG_AI_KB__DPOS, REG_AI_KB__SZ, REG_AI_KB__TYPE_WSZ, 0)
+#define REG_SYS_STAT__DPOS                       (uint16_t)REG_CALC_MBPOS(REG_AI_THR__DPOS, REG_AI_THR__SZ, REG_AI_THR__TYPE_WSZ, 0)
 #define REG_SYS_STAT__DPOS_END                   (uint16_t)REG_CALC_MBPOS(REG_SYS_STAT__DPOS, REG_SYS_STAT__SZ, REG_SYS_STAT__TYPE_WSZ, 0)-1
 #define REG_SYS_STAT__DTABLE                     REG_DATA_NUMB_TABLE_ID     //data table ID
 // position (offset) in ModBus Table
-#define REG_SYS_STAT__MBPOS                      (uint16_t)REG_CALC_MBPOS(REG_AI_STATUS__MBPOS, REG_AI_STATUS__SZ, REG_AI_STATUS__TYPE_WSZ, REG_RESERVE)
+#define REG_SYS_STAT__MBPOS                      (uint16_t)REG_CALC_MBPOS(REG_AI_CAP_WIN__MBPOS, REG_AI_CAP_WIN__SZ, REG_AI_CAP_WIN__TYPE_WSZ, REG_RESERVE)
 #define REG_SYS_STAT__MBPOS_END                  (uint16_t)REG_CALC_MBPOS(REG_SYS_STAT__MBPOS, REG_SYS_STAT__SZ, REG_SYS_STAT__TYPE_WSZ, 0)-1
 #define REG_SYS_STAT__MBTABLE                    MBRTU_INPT_TABLE_ID        //modbus table ID
 // EEPROM
@@ -925,6 +2184,40 @@
 #define REG_SYS_STAT__POS_RTE_DDMM               (REG_SYS_STAT__POS+4)      //RTE DDMM (day month)
 #define REG_SYS_STAT__POS_STAT1                  (REG_SYS_STAT__POS+5)      //System statuses (1), (packed)
 #define REG_SYS_STAT__POS_STAT2                  (REG_SYS_STAT__POS+6)      //System statuses (2), (packed)
+#define REG_SYS_STAT__POS_DO_LAT                 (REG_SYS_STAT__POS+7)      //DO output image latency (us)
+#define REG_SYS_STAT__POS_DO_LAT_MAX             (REG_SYS_STAT__POS+8)      //DO output image latency max. (us)
+#define REG_SYS_STAT__POS_APP_OVR                (REG_SYS_STAT__POS+9)      //APP scan overruns (missed releases)
+#define REG_SYS_STAT__POS_APP_JIT                (REG_SYS_STAT__POS+10)     //APP scan release jitter (us)
+#define REG_SYS_STAT__POS_APP_JIT_MAX            (REG_SYS_STAT__POS+11)     //APP scan release jitter max. (us)
+#define REG_SYS_STAT__POS_PROF_LOCK_MIN          (REG_SYS_STAT__POS+12)     //APP waiting for Modbus tables min. (us)
+#define REG_SYS_STAT__POS_PROF_LOCK_MAX          (REG_SYS_STAT__POS+13)     //APP waiting for Modbus tables max. (us)
+#define REG_SYS_STAT__POS_PROF_LOCK_AVG          (REG_SYS_STAT__POS+14)     //APP waiting for Modbus tables avg. (us)
+#define REG_SYS_STAT__POS_PROF_IN_MIN            (REG_SYS_STAT__POS+15)     //APP inputs (latch, MB > APP) min. (us)
+#define REG_SYS_STAT__POS_PROF_IN_MAX            (REG_SYS_STAT__POS+16)     //APP inputs (latch, MB > APP) max. (us)
+#define REG_SYS_STAT__POS_PROF_IN_AVG            (REG_SYS_STAT__POS+17)     //APP inputs (latch, MB > APP) avg. (us)
+#define REG_SYS_STAT__POS_PROF_RUN_MIN           (REG_SYS_STAT__POS+18)     //APP PlcApp_Run min. (us)
+#define REG_SYS_STAT__POS_PROF_RUN_MAX           (REG_SYS_STAT__POS+19)     //APP PlcApp_Run max. (us)
+#define REG_SYS_STAT__POS_PROF_RUN_AVG           (REG_SYS_STAT__POS+20)     //APP PlcApp_Run avg. (us)
+#define REG_SYS_STAT__POS_PROF_OUT_MIN           (REG_SYS_STAT__POS+21)     //APP outputs (APP > MB) min. (us)
+#define REG_SYS_STAT__POS_PROF_OUT_MAX           (REG_SYS_STAT__POS+22)     //APP outputs (APP > MB) max. (us)
+#define REG_SYS_STAT__POS_PROF_OUT_AVG           (REG_SYS_STAT__POS+23)     //APP outputs (APP > MB) avg. (us)
+#define REG_SYS_STAT__POS_PROF_SCAN_MIN          (REG_SYS_STAT__POS+24)     //APP whole scan min. (us)
+#define REG_SYS_STAT__POS_PROF_SCAN_MAX          (REG_SYS_STAT__POS+25)     //APP whole scan max. (us)
+#define REG_SYS_STAT__POS_PROF_SCAN_AVG          (REG_SYS_STAT__POS+26)     //APP whole scan avg. (us)
+#define REG_SYS_STAT__POS_PROF_HIST0             (REG_SYS_STAT__POS+27)     //APP scans 0/8 ... 1/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST1             (REG_SYS_STAT__POS+28)     //APP scans 1/8 ... 2/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST2             (REG_SYS_STAT__POS+29)     //APP scans 2/8 ... 3/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST3             (REG_SYS_STAT__POS+30)     //APP scans 3/8 ... 4/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST4             (REG_SYS_STAT__POS+31)     //APP scans 4/8 ... 5/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST5             (REG_SYS_STAT__POS+32)     //APP scans 5/8 ... 6/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST6             (REG_SYS_STAT__POS+33)     //APP scans 6/8 ... 7/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_PROF_HIST7             (REG_SYS_STAT__POS+34)     //APP scans >= 7/8 of period (0.01 %)
+#define REG_SYS_STAT__POS_RTC_YEAR               (REG_SYS_STAT__POS+35)     //RTC year
+#define REG_SYS_STAT__POS_RTC_MON                (REG_SYS_STAT__POS+36)     //RTC month
+#define REG_SYS_STAT__POS_RTC_DAY                (REG_SYS_STAT__POS+37)     //RTC day
+#define REG_SYS_STAT__POS_RTC_HOUR               (REG_SYS_STAT__POS+38)     //RTC hours
+#define REG_SYS_STAT__POS_RTC_MIN                (REG_SYS_STAT__POS+39)     //RTC minutes
+#define REG_SYS_STAT__POS_RTC_SEC                (REG_SYS_STAT__POS+40)     //RTC seconds
 // ModBus Addresses
 #define REG_SYS_STAT__MBPOS_HW_CODE              (REG_SYS_STAT__MBPOS+0)    //Hardware code
 #define REG_SYS_STAT__MBPOS_HW_VAR               (REG_SYS_STAT__MBPOS+1)    //Hardware variant
@@ -933,6 +2226,40 @@
 #define REG_SYS_STAT__MBPOS_RTE_DDMM             (REG_SYS_STAT__MBPOS+4)    //RTE DDMM (day month)
 #define REG_SYS_STAT__MBPOS_STAT1                (REG_SYS_STAT__MBPOS+5)    //System statuses (1), (packed)
 #define REG_SYS_STAT__MBPOS_STAT2                (REG_SYS_STAT__MBPOS+6)    //System statuses (2), (packed)
+#define REG_SYS_STAT__MBPOS_DO_LAT               (REG_SYS_STAT__MBPOS+7)    //DO output image latency (us)
+#define REG_SYS_STAT__MBPOS_DO_LAT_MAX           (REG_SYS_STAT__MBPOS+8)    //DO output image latency max. (us)
+#define REG_SYS_STAT__MBPOS_APP_OVR              (REG_SYS_STAT__MBPOS+9)    //APP scan overruns (missed releases)
+#define REG_SYS_STAT__MBPOS_APP_JIT              (REG_SYS_STAT__MBPOS+10)   //APP scan release jitter (us)
+#define REG_SYS_STAT__MBPOS_APP_JIT_MAX          (REG_SYS_STAT__MBPOS+11)   //APP scan release jitter max. (us)
+#define REG_SYS_STAT__MBPOS_PROF_LOCK_MIN        (REG_SYS_STAT__MBPOS+12)   //APP waiting for Modbus tables min. (us)
+#define REG_SYS_STAT__MBPOS_PROF_LOCK_MAX        (REG_SYS_STAT__MBPOS+13)   //APP waiting for Modbus tables max. (us)
+#define REG_SYS_STAT__MBPOS_PROF_LOCK_AVG        (REG_SYS_STAT__MBPOS+14)   //APP waiting for Modbus tables avg. (us)
+#define REG_SYS_STAT__MBPOS_PROF_IN_MIN          (REG_SYS_STAT__MBPOS+15)   //APP inputs (latch, MB > APP) min. (us)
+#define REG_SYS_STAT__MBPOS_PROF_IN_MAX          (REG_SYS_STAT__MBPOS+16)   //APP inputs (latch, MB > APP) max. (us)
+#define REG_SYS_STAT__MBPOS_PROF_IN_AVG          (REG_SYS_STAT__MBPOS+17)   //APP inputs (latch, MB > APP) avg. (us)
+#define REG_SYS_STAT__MBPOS_PROF_RUN_MIN         (REG_SYS_STAT__MBPOS+18)   //APP PlcApp_Run min. (us)
+#define REG_SYS_STAT__MBPOS_PROF_RUN_MAX         (REG_SYS_STAT__MBPOS+19)   //APP PlcApp_Run max. (us)
+#define REG_SYS_STAT__MBPOS_PROF_RUN_AVG         (REG_SYS_STAT__MBPOS+20)   //APP PlcApp_Run avg. (us)
+#define REG_SYS_STAT__MBPOS_PROF_OUT_MIN         (REG_SYS_STAT__MBPOS+21)   //APP outputs (APP > MB) min. (us)
+#define REG_SYS_STAT__MBPOS_PROF_OUT_MAX         (REG_SYS_STAT__MBPOS+22)   //APP outputs (APP > MB) max. (us)
+#define REG_SYS_STAT__MBPOS_PROF_OUT_AVG         (REG_SYS_STAT__MBPOS+23)   //APP outputs (APP > MB) avg. (us)
+#define REG_SYS_STAT__MBPOS_PROF_SCAN_MIN        (REG_SYS_STAT__MBPOS+24)   //APP whole scan min. (us)
+#define REG_SYS_STAT__MBPOS_PROF_SCAN_MAX        (REG_SYS_STAT__MBPOS+25)   //APP whole scan max. (us)
+#define REG_SYS_STAT__MBPOS_PROF_SCAN_AVG        (REG_SYS_STAT__MBPOS+26)   //APP whole scan avg. (us)
+#define REG_SYS_STAT__MBPOS_PROF_HIST0           (REG_SYS_STAT__MBPOS+27)   //APP scans 0/8 ... 1/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST1           (REG_SYS_STAT__MBPOS+28)   //APP scans 1/8 ... 2/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST2           (REG_SYS_STAT__MBPOS+29)   //APP scans 2/8 ... 3/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST3           (REG_SYS_STAT__MBPOS+30)   //APP scans 3/8 ... 4/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST4           (REG_SYS_STAT__MBPOS+31)   //APP scans 4/8 ... 5/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST5           (REG_SYS_STAT__MBPOS+32)   //APP scans 5/8 ... 6/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST6           (REG_SYS_STAT__MBPOS+33)   //APP scans 6/8 ... 7/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_PROF_HIST7           (REG_SYS_STAT__MBPOS+34)   //APP scans >= 7/8 of period (0.01 %)
+#define REG_SYS_STAT__MBPOS_RTC_YEAR             (REG_SYS_STAT__MBPOS+35)   //RTC year
+#define REG_SYS_STAT__MBPOS_RTC_MON              (REG_SYS_STAT__MBPOS+36)   //RTC month
+#define REG_SYS_STAT__MBPOS_RTC_DAY              (REG_SYS_STAT__MBPOS+37)   //RTC day
+#define REG_SYS_STAT__MBPOS_RTC_HOUR             (REG_SYS_STAT__MBPOS+38)   //RTC hours
+#define REG_SYS_STAT__MBPOS_RTC_MIN              (REG_SYS_STAT__MBPOS+39)   //RTC minutes
+#define REG_SYS_STAT__MBPOS_RTC_SEC              (REG_SYS_STAT__MBPOS+40)   //RTC seconds
 // STRING
 #define REG_SYS_STAT__STR_HW_CODE                "PLC Hardware code"
 #define REG_SYS_STAT__STR_HW_VAR                 "PLC Hardware variant"
@@ -941,6 +2268,40 @@
 #define REG_SYS_STAT__STR_RTE_DDMM               "RTE version (day month)"
 #define REG_SYS_STAT__STR_STAT1                  "System statuses (1), packed"
 #define REG_SYS_STAT__STR_STAT2                  "System statuses (2), packed"
+#define REG_SYS_STAT__STR_DO_LAT                 "DO output image latency (us)"
+#define REG_SYS_STAT__STR_DO_LAT_MAX             "DO output image latency max. (us)"
+#define REG_SYS_STAT__STR_APP_OVR                "APP scan overruns"
+#define REG_SYS_STAT__STR_APP_JIT                "APP scan release jitter (us)"
+#define REG_SYS_STAT__STR_APP_JIT_MAX            "APP scan release jitter max. (us)"
+#define REG_SYS_STAT__STR_PROF_LOCK_MIN          "APP waiting for Modbus tables min. (us)"
+#define REG_SYS_STAT__STR_PROF_LOCK_MAX          "APP waiting for Modbus tables max. (us)"
+#define REG_SYS_STAT__STR_PROF_LOCK_AVG          "APP waiting for Modbus tables avg. (us)"
+#define REG_SYS_STAT__STR_PROF_IN_MIN            "APP inputs (latch, MB > APP) min. (us)"
+#define REG_SYS_STAT__STR_PROF_IN_MAX            "APP inputs (latch, MB > APP) max. (us)"
+#define REG_SYS_STAT__STR_PROF_IN_AVG            "APP inputs (latch, MB > APP) avg. (us)"
+#define REG_SYS_STAT__STR_PROF_RUN_MIN           "APP PlcApp_Run min. (us)"
+#define REG_SYS_STAT__STR_PROF_RUN_MAX           "APP PlcApp_Run max. (us)"
+#define REG_SYS_STAT__STR_PROF_RUN_AVG           "APP PlcApp_Run avg. (us)"
+#define REG_SYS_STAT__STR_PROF_OUT_MIN           "APP outputs (APP > MB) min. (us)"
+#define REG_SYS_STAT__STR_PROF_OUT_MAX           "APP outputs (APP > MB) max. (us)"
+#define REG_SYS_STAT__STR_PROF_OUT_AVG           "APP outputs (APP > MB) avg. (us)"
+#define REG_SYS_STAT__STR_PROF_SCAN_MIN          "APP whole scan min. (us)"
+#define REG_SYS_STAT__STR_PROF_SCAN_MAX          "APP whole scan max. (us)"
+#define REG_SYS_STAT__STR_PROF_SCAN_AVG          "APP whole scan avg. (us)"
+#define REG_SYS_STAT__STR_PROF_HIST0             "APP scans 0/8 ... 1/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST1             "APP scans 1/8 ... 2/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST2             "APP scans 2/8 ... 3/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST3             "APP scans 3/8 ... 4/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST4             "APP scans 4/8 ... 5/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST5             "APP scans 5/8 ... 6/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST6             "APP scans 6/8 ... 7/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_PROF_HIST7             "APP scans >= 7/8 of period (0.01 %)"
+#define REG_SYS_STAT__STR_RTC_YEAR               "RTC year"
+#define REG_SYS_STAT__STR_RTC_MON                "RTC month"
+#define REG_SYS_STAT__STR_RTC_DAY                "RTC day"
+#define REG_SYS_STAT__STR_RTC_HOUR               "RTC hours"
+#define REG_SYS_STAT__STR_RTC_MIN                "RTC minutes"
+#define REG_SYS_STAT__STR_RTC_SEC                "RTC seconds"
 
 /** @def SYSTEM SETTINGS
  */
@@ -964,22 +2325,72 @@
 #define REG_SYS_SET__DPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_SYS_SET__DPOS, REG_SYS_SET__SZ, REG_SYS_SET__TYPE_WSZ, 0)-1
 #define REG_SYS_SET__DTABLE                      REG_DATA_NUMB_TABLE_ID      //data table ID
 // position (offset) in ModBus Table
-#define REG_SYS_SET__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_AI_KB__MBPOS, REG_AI_KB__SZ, REG_AI_KB__TYPE_WSZ, REG_RESERVE)
+#define REG_SYS_SET__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_AI_THR__MBPOS, REG_AI_THR__SZ, REG_AI_THR__TYPE_WSZ, REG_RESERVE)
 #define REG_SYS_SET__MBPOS_END                   (uint16_t)REG_CALC_MBPOS(REG_SYS_SET__MBPOS, REG_SYS_SET__SZ, REG_SYS_SET__TYPE_WSZ, 0)-1
 #define REG_SYS_SET__MBTABLE                     MBRTU_HOLD_TABLE_ID         //modbus table ID
 // EEPROM
 #define REG_SYS_SET__RETAIN                      REG_RETAIN_ALL
 //
 // REGS Positions
-#define REG_SYS_SET__POS_SFTY_TIM_TM             (REG_SYS_SET__POS+0)         //SFTY_TIM_TM
-#define REG_SYS_SET__POS_WD_TIM_TM               (REG_SYS_SET__POS+1)         //WD_TIM_TM
+#define REG_SYS_SET__POS_SFTY_TIM_TM             (REG_SYS_SET__POS+0)         //SFTY_TIM_TM: scan watchdog time (ms), 0 - off
+#define REG_SYS_SET__POS_WD_TIM_TM               (REG_SYS_SET__POS+1)         //WD_TIM_TM: comms watchdog time (ms), 0 - off
 // ModBus Addresses
-#define REG_SYS_SET__MBPOS_SFTY_TIM_TM           (REG_SYS_SET__MBPOS+0)       //WD_TIM_TM
+#define REG_SYS_SET__MBPOS_SFTY_TIM_TM           (REG_SYS_SET__MBPOS+0)       //SFTY_TIM_TM
 #define REG_SYS_SET__MBPOS_WD_TIM_TM             (REG_SYS_SET__MBPOS+1)       //WD_TIM_TM
 // STRING
 #define REG_SYS_SET__STR_SFTY_TIM_TM             "SFTY_TIM_TM"
 #define REG_SYS_SET__STR_WD_TIM_TM               "WD_TIM_TM"
 
+/** @def SYSTEM CLOCK SETTING
+ */
+#define REG_SYS_RTC_SET__GID                     (uint16_t)73                //unique ID
+// located variable
+#define REG_SYS_RTC_SET__ZONE                    PLC_LT_M                    //memory ID
+#define REG_SYS_RTC_SET__TYPESZ                  PLC_LSZ_W                   //data type ID
+#define REG_SYS_RTC_SET__GROUP                   REG_SYS__GROUP
+#define REG_SYS_RTC_SET__A00                     (int32_t)4                  //arg0: ID of subgroup
+#define REG_SYS_RTC_SET__A01                     REG_AXX_ADDR                //arg1: ID of subgroup
+#define REG_SYS_RTC_SET__A02                     REG_AXX_NONE                //arg2: ID of subgroup
+#define REG_SYS_RTC_SET__TYPE                    TYPE_WORD                   //data type
+#define REG_SYS_RTC_SET__TYPE_SZ                 TYPE_WORD_SZ                //size of data type (bytes)
+#define REG_SYS_RTC_SET__TYPE_WSZ                TYPE_WORD_WSZ               //size of data type (words)
+// position (offset) in REGS
+#define REG_SYS_RTC_SET__SZ                      REG_SYS_RTC_SET_SZ          //number of registers
+#define REG_SYS_RTC_SET__POS                     (uint16_t)REG_CALC_POS(REG_SYS_SET__POS, REG_SYS_SET__SZ)
+#define REG_SYS_RTC_SET__SADDR                   (uint16_t)0                 //start register address
+// position (offset) in Data Table
+#define REG_SYS_RTC_SET__DPOS                    (uint16_t)REG_CALC_MBPOS(REG_SYS_SET__DPOS, REG_SYS_SET__SZ, REG_SYS_SET__TYPE_WSZ, 0)
+#define REG_SYS_RTC_SET__DPOS_END                (uint16_t)REG_CALC_MBPOS(REG_SYS_RTC_SET__DPOS, REG_SYS_RTC_SET__SZ, REG_SYS_RTC_SET__TYPE_WSZ, 0)-1
+#define REG_SYS_RTC_SET__DTABLE                  REG_DATA_NUMB_TABLE_ID      //data table ID
+// position (offset) in ModBus Table
+#define REG_SYS_RTC_SET__MBPOS                   (uint16_t)REG_CALC_MBPOS(REG_SYS_SET__MBPOS, REG_SYS_SET__SZ, REG_SYS_SET__TYPE_WSZ, 0)
+#define REG_SYS_RTC_SET__MBPOS_END               (uint16_t)REG_CALC_MBPOS(REG_SYS_RTC_SET__MBPOS, REG_SYS_RTC_SET__SZ, REG_SYS_RTC_SET__TYPE_WSZ, 0)-1
+#define REG_SYS_RTC_SET__MBTABLE                 MBRTU_HOLD_TABLE_ID         //modbus table ID
+// EEPROM
+#define REG_SYS_RTC_SET__RETAIN                  REG_RETAIN_NONE
+//
+// REGS Positions
+#define REG_SYS_RTC_SET__POS_YEAR                (REG_SYS_RTC_SET__POS+0)     //YEAR: year (2000 ... 2099)
+#define REG_SYS_RTC_SET__POS_MON                 (REG_SYS_RTC_SET__POS+1)     //MON: month (1 ... 12)
+#define REG_SYS_RTC_SET__POS_DAY                 (REG_SYS_RTC_SET__POS+2)     //DAY: day (1 ... 31)
+#define REG_SYS_RTC_SET__POS_HOUR                (REG_SYS_RTC_SET__POS+3)     //HOUR: hours (0 ... 23)
+#define REG_SYS_RTC_SET__POS_MIN                 (REG_SYS_RTC_SET__POS+4)     //MIN: minutes (0 ... 59)
+#define REG_SYS_RTC_SET__POS_SEC                 (REG_SYS_RTC_SET__POS+5)     //SEC: seconds (0 ... 59)
+// ModBus Addresses
+#define REG_SYS_RTC_SET__MBPOS_YEAR              (REG_SYS_RTC_SET__MBPOS+0)   //YEAR
+#define REG_SYS_RTC_SET__MBPOS_MON               (REG_SYS_RTC_SET__MBPOS+1)   //MON
+#define REG_SYS_RTC_SET__MBPOS_DAY               (REG_SYS_RTC_SET__MBPOS+2)   //DAY
+#define REG_SYS_RTC_SET__MBPOS_HOUR              (REG_SYS_RTC_SET__MBPOS+3)   //HOUR
+#define REG_SYS_RTC_SET__MBPOS_MIN               (REG_SYS_RTC_SET__MBPOS+4)   //MIN
+#define REG_SYS_RTC_SET__MBPOS_SEC               (REG_SYS_RTC_SET__MBPOS+5)   //SEC
+// STRING
+#define REG_SYS_RTC_SET__STR_YEAR                "RTC_YEAR"
+#define REG_SYS_RTC_SET__STR_MON                 "RTC_MON"
+#define REG_SYS_RTC_SET__STR_DAY                 "RTC_DAY"
+#define REG_SYS_RTC_SET__STR_HOUR                "RTC_HOUR"
+#define REG_SYS_RTC_SET__STR_MIN                 "RTC_MIN"
+#define REG_SYS_RTC_SET__STR_SEC                 "RTC_SEC"
+
 /** @def SYSTEM COMMANDS
  */
 #define REG_SYS_CMD__GID                         (uint16_t)72                //unique ID
@@ -995,14 +2406,14 @@
 #define REG_SYS_CMD__TYPE_WSZ                    TYPE_BOOL_WSZ               //size of data type (words)
 // position (offset) in REGS
 #define REG_SYS_CMD__SZ                          REG_SYS_CMD_SZ              //number of registers
-#define REG_SYS_CMD__POS                         (uint16_t)REG_CALC_POS(REG_SYS_STAT__POS, REG_SYS_STAT__SZ)
+#define REG_SYS_CMD__POS                         (uint16_t)REG_CALC_POS(REG_SYS_RTC_SET__POS, REG_SYS_RTC_SET__SZ)
 #define REG_SYS_CMD__SADDR                       (uint16_t)0                 //start register address
 // position (offset) in Data Table
-#define REG_SYS_CMD__DPOS                        (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_ALLOW__DPOS, REG_DO_PWM_ALLOW__SZ, REG_DO_PWM_ALLOW__TYPE_WSZ, 0)
+#define REG_SYS_CMD__DPOS                        (uint16_t)REG_CALC_MBPOS(REG_AI_THR_REACHED__DPOS, REG_AI_THR_REACHED__SZ, REG_AI_THR_REACHED__TYPE_WSZ, 0)
 #define REG_SYS_CMD__DPOS_END                    (uint16_t)REG_CALC_MBPOS(REG_SYS_CMD__DPOS, REG_SYS_CMD__SZ, REG_SYS_CMD__TYPE_WSZ, 0)-1
 #define REG_SYS_CMD__DTABLE                      REG_DATA_BOOL_TABLE_ID      //data table ID
 // position (offset) in ModBus Table
-#define REG_SYS_CMD__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_DO_PWM_ALLOW__MBPOS, REG_DO_PWM_ALLOW__SZ, REG_DO_PWM_ALLOW__TYPE_WSZ, REG_RESERVE)
+#define REG_SYS_CMD__MBPOS                       (uint16_t)REG_CALC_MBPOS(REG_DO_SAFE_ALLOW__MBPOS, REG_DO_SAFE_ALLOW__SZ, REG_DO_SAFE_ALLOW__TYPE_WSZ, REG_RESERVE)
 #define REG_SYS_CMD__MBPOS_END                   (uint16_t)REG_CALC_MBPOS(REG_SYS_CMD__MBPOS, REG_SYS_CMD__SZ, REG_SYS_CMD__TYPE_WSZ, 0)-1
 #define REG_SYS_CMD__MBTABLE                     MBRTU_COIL_TABLE_ID         //modbus table ID
 // EEPROM
@@ -1010,16 +2421,22 @@
 //
 // REGS Positions
 #define REG_SYS_CMD__POS_LED_USER                (REG_SYS_CMD__POS+0)         //LED_USER
-#define REG_SYS_CMD__POS_SFTY_TIM_RST            (REG_SYS_CMD__POS+1)         //SFTY_TIM_RST
-#define REG_SYS_CMD__POS_WD_TIM_RST              (REG_SYS_CMD__POS+2)         //WD_TIM_RST
+#define REG_SYS_CMD__POS_SFTY_TIM_RST            (REG_SYS_CMD__POS+1)         //SFTY_TIM_RST: reset expired scan watchdog
+#define REG_SYS_CMD__POS_WD_TIM_RST              (REG_SYS_CMD__POS+2)         //WD_TIM_RST: reset expired comms watchdog
+#define REG_SYS_CMD__POS_PROF_RST                (REG_SYS_CMD__POS+3)         //PROF_RST: reset APP scan statistics
+#define REG_SYS_CMD__POS_RTC_SET                 (REG_SYS_CMD__POS+4)         //RTC_SET: set RTC by SYS_RTC_SET
 // ModBus Addresses
 #define REG_SYS_CMD__MBPOS_LED_USER              (REG_SYS_CMD__MBPOS+0)       //LED_USER
 #define REG_SYS_CMD__MBPOS_SFTY_TIM_RST          (REG_SYS_CMD__MBPOS+1)       //SFTY_TIM_RST
 #define REG_SYS_CMD__MBPOS_WD_TIM_RST            (REG_SYS_CMD__MBPOS+2)       //WD_TIM_RST
+#define REG_SYS_CMD__MBPOS_PROF_RST              (REG_SYS_CMD__MBPOS+3)       //PROF_RST
+#define REG_SYS_CMD__MBPOS_RTC_SET               (REG_SYS_CMD__MBPOS+4)       //RTC_SET
 // STRING
 #define REG_SYS_CMD__STR_LED_USER                "LED_USER"
 #define REG_SYS_CMD__STR_SFTY_TIM_RST            "SFTY_TIM_RST"
 #define REG_SYS_CMD__STR_WD_TIM_RST              "WD_TIM_RST"
+#define REG_SYS_CMD__STR_PROF_RST                "PROF_RST"
+#define REG_SYS_CMD__STR_RTC_SET                 "RTC_SET"
 
 
 //USER DATA
@@ -1078,11 +2495,11 @@
 #define REG_USER_DATA2__POS                      (uint16_t)REG_CALC_POS(REG_USER_DATA1__POS, REG_USER_DATA1__SZ)
 #define REG_USER_DATA2__SADDR                    (uint16_t)0                //start register address
 // position (offset) in Data Table
-#define REG_USER_DATA2__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_SYS_SET__DPOS, REG_SYS_SET__SZ, REG_SYS_SET__TYPE_WSZ, 0)
+#define REG_USER_DATA2__DPOS                     (uint16_t)REG_CALC_MBPOS(REG_SYS_RTC_SET__DPOS, REG_SYS_RTC_SET__SZ, REG_SYS_RTC_SET__TYPE_WSZ, 0)
 #define REG_USER_DATA2__DPOS_END                 (uint16_t)REG_CALC_MBPOS(REG_USER_DATA2__DPOS, REG_USER_DATA2__SZ, REG_USER_DATA2__TYPE_WSZ, 0)-1
 #define REG_USER_DATA2__DTABLE                   REG_DATA_NUMB_TABLE_ID     //data table ID
 // position (offset) in ModBus Table
-#define REG_USER_DATA2__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_SYS_SET__MBPOS, REG_SYS_SET__SZ, REG_SYS_SET__TYPE_WSZ, 0)
+#define REG_USER_DATA2__MBPOS                    (uint16_t)REG_CALC_MBPOS(REG_SYS_RTC_SET__MBPOS, REG_SYS_RTC_SET__SZ, REG_SYS_RTC_SET__TYPE_WSZ, 0)
 #define REG_USER_DATA2__MBPOS_END                (uint16_t)REG_CALC_MBPOS(REG_USER_DATA2__MBPOS, REG_USER_DATA2__SZ, REG_USER_DATA2__TYPE_WSZ, 0)-1
 #define REG_USER_DATA2__MBTABLE                  MBRTU_HOLD_TABLE_ID        //modus table ID
 // EEPROM
@@ -1105,7 +2522,7 @@
  */
 #define REG_LAST_COIL_POS                        (uint16_t)(REG_USER_DATA1__MBPOS_END+1)
 #define REG_LAST_HOLD_POS                        (uint16_t)(REG_USER_DATA2__MBPOS_END+1)
-#define REG_LAST_DISC_POS                        (uint16_t)(REG_DI_CNTR_SETPOINT_REACHED__MBPOS_END+1)
+#define REG_LAST_DISC_POS                        (uint16_t)(REG_AI_THR_REACHED__MBPOS_END+1)
 #define REG_LAST_INPT_POS                        (uint16_t)(REG_SYS_STAT__MBPOS_END+1)
 
 //=============================================================================
@@ -66,6 +66,11 @@ typedef struct REG_t_
     //@var Use Change-monitoring (0 - off, 1 - on)
     uint8_t Monitor;
 
+#ifdef RTE_MOD_APP
+    //@var Tasks of Application using the located variable (bit i - task i)
+    uint8_t AppTasks;
+#endif //RTE_MOD_APP
+
 } REG_t;
 
 
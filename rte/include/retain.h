@@ -0,0 +1,151 @@
+/* @page retain.h
+ *       Retain-data journal (double-sector, flash-like storage)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Retain-data of application is an image of PLC_RETAIN_SZ bytes
+ *        divided into PLC_RETAIN_BLK_NUM blocks of PLC_RETAIN_BLK_SZ bytes.
+ *        The image is kept in a journal on two sectors of storage
+ *        (erased state is 0xFF, a word is programmed only once after erase):
+ *
+ *        - sector: header (Magic, Gen, Id, Crc) + records
+ *          Gen - generation of sector (the valid sector with the greater Gen is active)
+ *          Id  - id of application (see PlcRetain_GetId)
+ *
+ *        - record: Tag, Seq, Data[PLC_RETAIN_BLK_SZ], Crc
+ *          Tag = PLC_RETAIN_TAG | number of block, or PLC_RETAIN_TAG_END
+ *          Seq - number of commit
+ *
+ *        Commit appends records of changed blocks only and the END-record,
+ *        records of a commit without END-record (power loss) are ignored,
+ *        so the image is restored as of the last complete commit.
+ *
+ *        If the active sector is full (or Id is changed) the whole image is
+ *        written into the other sector, its header is written at the end,
+ *        so the old sector remains active until the new one is complete.
+ *
+ *        A commit never erases: compaction is done only into the other sector
+ *        erased before by PlcRetain_Init or PlcRetain_Prepare, otherwise
+ *        the commit is deferred (PLC_RETAIN_WAIT) until PlcRetain_Prepare.
+ *        After a compaction the old sector is to be erased by PlcRetain_Prepare
+ *        before the journal is full again (one sector per call, see RTOS_DATA_RETAIN_PREP_TM),
+ *        so PLC_RETAIN_WAIT is returned only if the erase fails or is not called.
+ *
+ *        Every header and record is protected by CRC-32.
+ *
+ *        Wear: record is 11 words (44 bytes), 372 records per sector,
+ *        compaction takes 33 of them, commit of N blocks takes N+1.
+ *        So a sector is erased once per 2*339/(N+1) commits, e.g. for N=1:
+ *        - commit every 1 s  - erase every ~6 min, 10k cycles in ~40 days
+ *        - commit every 60 s - erase every ~5.6 h, 10k cycles in ~6 years
+ *        Every erase stalls the CPU (flash, ~0.25 ... 0.5 s), while application is started
+ *        it is done once per compaction (e.g. once per ~5.6 h for N=1 and commit every 60 s).
+ */
+
+#ifndef RETAIN_H_
+#define RETAIN_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "bit.h"
+
+
+/** @def Image
+ */
+#define PLC_RETAIN_BLK_SZ                        (uint32_t)32    //bytes
+#define PLC_RETAIN_BLK_NUM                       (uint32_t)32    //blocks (bits of mask)
+#define PLC_RETAIN_SZ                            (uint32_t)(PLC_RETAIN_BLK_SZ*PLC_RETAIN_BLK_NUM)
+//mask of all blocks
+#define PLC_RETAIN_BLK_ALL                       (uint32_t)0xFFFFFFFF
+
+/** @def Storage
+ */
+#define PLC_RETAIN_SECT_NUM                      (uint8_t)2
+#define PLC_RETAIN_SECT_SZ                       (uint32_t)16384 //bytes
+#define PLC_RETAIN_SECT_NONE                     (uint8_t)0xFF
+
+/** @def Result of commit: deferred (the other sector is not erased)
+ */
+#define PLC_RETAIN_WAIT                          (uint8_t)2
+
+/** @def Header of sector (words)
+ */
+#define PLC_RETAIN_HDR_MAGIC                     (uint32_t)0x524E5431  //"RNT1"
+#define PLC_RETAIN_HDR_WSZ                       (uint32_t)4
+
+/** @def Record (words)
+ */
+#define PLC_RETAIN_TAG                           (uint32_t)0x52430000
+#define PLC_RETAIN_TAG_END                       (uint32_t)(PLC_RETAIN_TAG | 0xFFFF)
+#define PLC_RETAIN_REC_WSZ                       (uint32_t)(3 + PLC_RETAIN_BLK_SZ/4)
+//records per sector
+#define PLC_RETAIN_REC_NUM                       (uint32_t)((PLC_RETAIN_SECT_SZ/4 - PLC_RETAIN_HDR_WSZ)/PLC_RETAIN_REC_WSZ)
+
+
+/** @typedef Storage (port)
+ */
+typedef struct PlcRetain_Port_t_
+{
+	//@var Sectors (PLC_RETAIN_SECT_SZ bytes, aligned to word)
+	const uint32_t *Sect[PLC_RETAIN_SECT_NUM];
+
+	//@var Erase sector
+	//@arg SectIn - number of sector (0 ... PLC_RETAIN_SECT_NUM-1)
+	//@return 0 - error, 1 - OK
+	uint8_t (*Erase)(uint8_t SectIn);
+
+	//@var Program words (erased before)
+	//@arg AddrIn - pointer to the first word in sector
+	//@arg DataIn - pointer to words
+	//@arg WordsIn - number of words
+	//@return 0 - error, 1 - OK
+	uint8_t (*Write)(const uint32_t *AddrIn, const uint32_t *DataIn, uint32_t WordsIn);
+
+} PlcRetain_Port_t;
+
+
+/** @brief  Get id of application.
+ *  @param  StrIn - id (string, e.g. md5 of application).
+ *  @return Id (CRC-32 of string).
+ */
+uint32_t PlcRetain_GetId(const char *StrIn);
+
+/** @brief  Init. journal and restore image.
+ *  @param  PortIn - pointer to storage.
+ *  @param  ImgOut - pointer to image (PLC_RETAIN_SZ bytes).
+ *  @param  TmpIn - pointer to buffer (PLC_RETAIN_SZ bytes) for records of an unfinished commit.
+ *  @param  IdOut - pointer to id of application stored in journal.
+ *  @return Result:
+ *  @arg    = 0 - nothing is stored (image is zeroed)
+ *  @arg    = 1 - image is restored
+ *  @note   Called before start of scheduler (an invalid or obsolete sector is erased).
+ */
+uint8_t PlcRetain_Init(const PlcRetain_Port_t *PortIn, uint8_t *ImgOut, uint8_t *TmpIn, uint32_t *IdOut);
+
+/** @brief  Commit blocks of image.
+ *  @param  ImgIn - pointer to image (PLC_RETAIN_SZ bytes, not changed during the call).
+ *  @param  MaskIn - changed blocks (bit i - block i).
+ *  @param  IdIn - id of application.
+ *  @return Result:
+ *  @arg    = 0 - error of storage (blocks must be committed again)
+ *  @arg    = 1 - OK
+ *  @arg    = PLC_RETAIN_WAIT - journal is full (blocks must be committed again after PlcRetain_Prepare)
+ *  @note   Storage is not available until PlcRetain_Init.
+ *          Sector is never erased by commit.
+ */
+uint8_t PlcRetain_Write(const uint8_t *ImgIn, uint32_t MaskIn, uint32_t IdIn);
+
+/** @brief  Erase the other sector (prepare the next compaction).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - error of storage
+ *  @arg    = 1 - OK (the other sector is erased)
+ *  @note   Flash: CPU is stalled while sector is erased (one sector per call),
+ *          so it is called while application is stopped or once between commits.
+ *          Nothing is done if the other sector is erased already.
+ */
+uint8_t PlcRetain_Prepare(void);
+
+#endif /* RETAIN_H_ */
@@ -7,6 +7,25 @@
 #define SCALE_H_
 
 #include <stdint.h>
+#include "bit.h"
+
+
+/** @def Fixed point (Q16)
+ */
+#define SCALE_Q                                  16
+#define SCALE_Q_ONE                              ((int32_t)1 << SCALE_Q)
+
+
+/** @typedef Fixed-point scale factors
+ *  @note    Ka = KaMant*2^-KaSh (mantissa is normalized to 31 bits), Kb is Q16
+ */
+typedef struct ScaleQ_t_
+{
+	int32_t KaMant;
+	uint8_t KaSh;
+	int32_t Kb;
+
+} ScaleQ_t;
 
 
 /** @brief  Scaling an input-value.
@@ -38,4 +57,28 @@ float ScaleA_Ka(float Y1In, float Y2In, float In1, float In2);
  */
 float ScaleA_Kb(float Y1In, float Y2In, float In1, float In2);
 
+/** @brief  Set fixed-point scale factors.
+ *  @param  ScaleOut - pointer to factors.
+ *  @param  KaIn - scale Ka-factor (|Ka| < 2^31).
+ *  @param  KbIn - scale Kb-factor (|Kb| < 2^15).
+ *  @return Result:
+ *  @arg    = 0 - factors are out of range of fixed point (or NaN)
+ *  @arg    = 1 - OK
+ */
+uint8_t ScaleQ_Set(ScaleQ_t *ScaleOut, float KaIn, float KbIn);
+
+/** @brief  Scaling an input-value (fixed point).
+ *  @param  In - input-value (Q16).
+ *  @param  ScaleIn - pointer to factors.
+ *  @return Real-value (Y, Q16, saturated).
+ *  @note   Y = Ka*In + Kb
+ */
+int32_t ScaleQ(int32_t In, const ScaleQ_t *ScaleIn);
+
+/** @brief  Convert fixed-point value into real-value.
+ *  @param  In - value (Q16).
+ *  @return Real-value.
+ */
+float ScaleQ_ToReal(int32_t In);
+
 #endif /* SCALE_H_ */
@@ -50,6 +50,15 @@
 #define TMP_MCU_AVG_SLOPE                   (float)2.5
 #define TMP_MCU_AVG_SLOPE2                  (float)0.4         // 1/TMP_MCU_AVG_SLOPE
 
+/** @def Temperature (C*) for V25
+ */
+#define TMP_MCU_T25                         (float)25.0
+
+/** @def Scale factors (Temp = Ka*Vsense + Kb)
+ */
+#define TMP_MCU_KA                          TMP_MCU_AVG_SLOPE2
+#define TMP_MCU_KB                          (TMP_MCU_T25-(TMP_MCU_V25*TMP_MCU_AVG_SLOPE2))
+
 
 /** @def Analog levels (C*)
  */
@@ -14,11 +14,74 @@
  *        + 12 bit
  *        + 0 ... 4095 (0 ... 3.3 V)
  *
- *        ADC conversion is started by software timer (RTOS)
- *        + survey period = PLC_AI_SURVEY_PERIOD_MS (100 ms)
+ *        ADC conversion is continuous (DMA2.STR0 in double-buffer mode)
+ *        + TIM3.TRGO -> ADC1.EXT_TRIG: one scan of all channels per TIM3 update
+ *          sample rate = PLC_AI_ADC_SAMPLE_HZ (5 kHz per channel)
+ *          (PLC_AI_ADC_TRIG_TIM is not defined: ADC is free-running in continuous mode)
+ *        + buffer = ring of blocks of PLC_AI_ADC_CHANNEL_MEASURES scans (1 ms per block),
+ *          DMA.M0 and DMA.M1 point to the next two blocks of the ring
+ *        + DMA.TC(M0), DMA.TC(M1) -> the completed block is summed into per-channel accumulators
+ *          and its memory pointer is moved to the next block of the ring
+ *          (while DMA fills the other one)
  *
- *        ADC-code of a channel is a average of all its measurements
- *        + measurements = PLC_AI_ADC_CHANNEL_MEASURES (25)
+ *        ADC-code of a channel is a average of all its measurements since the last read
+ *        or the latest output of its filter (AI.FLTR, AI.FLTR_PRM; ai-fltr.h),
+ *        the filter is fed by every measurement
+ *        + values are published by software timer (RTOS)
+ *          publish period = PLC_AI_SURVEY_PERIOD_MS (1 ... 1000 ms)
+ *
+ *        Oversampling (AI.OVS = n, 0 ... PLC_AI_OVS__MAX)
+ *        + 4^n measurements are summed and shifted right by n per output
+ *          (decimation), resolution is 12+n bits, output rate is sample rate/4^n
+ *        + if n > 0 on any channel, ADC is switched into oversampling mode:
+ *          shorter sample time of AI.00, AI.01 and sample rate = PLC_AI_ADC_SAMPLE_HZ_OVS (20 kHz)
+ *        + effective rate and resolution are reported by AI.RATE_ACT, AI.BITS_ACT
+ *        + ADC-code of the channel is 0 ... 4095*2^n
+ *
+ *        Linearization (per channel, AI.LIN, AI.LIN_SZ, AI.LIN_TBL; ai-lin.h)
+ *        + survey mode: Val = Lin(Ka*V+Kb), piecewise-linear table or polynomial
+ *        + table is uploaded into AI.LIN_TBL (PLC_AI_LIN_TBL_SZ REAL values per channel)
+ *          and applied by writing AI.LIN (type), invalid table sets AI.LIN = 0 (off)
+ *
+ *        Survey is in fixed point (V, scaled and linearized values are Q16; scale.h)
+ *        + ADC-code > V > Ka*V+Kb (or TMP36, MCU_TEMP) > Lin, value is converted into REAL
+ *          only when it is published
+ *        + if |Ka|*PLC_AI_ANA_MAX+|Kb| >= PLC_AI_FIX_VAL__MAX, the channel is surveyed in float
+ *
+ *        Publication of a value (per channel, AI.DB, AI.DB_PCT, AI.PUB_MIN, AI.PUB_HB)
+ *        + value is published if |Val-Last| > max(DB, DB_PCT*|Last|/100)
+ *          (any change if both are 0), Last is the latest published value
+ *        + no publication within PUB_MIN ms after the latest one
+ *        + value is published every PUB_HB s regardless of deadband (0 - off)
+ *        + input image of application is not limited by deadband
+ *
+ *        Threshold (per channel, AI.THR, AI.THR_REACHED)
+ *        + THR_REACHED = (Val >= THR), evaluated every survey period
+ *        + rising edge of THR_REACHED releases event tasks of application (rtos-app.h)
+ *
+ *        Waveform capture (AI.CAP_SET, AI.CAP_CMD, AI.CAP_STAT, AI.CAP_WIN)
+ *        + the ring of ADC buffer is the capture buffer (no copy),
+ *          raw ADC-codes (12 bit) of all channels are kept at sample rate of ADC
+ *        + ARM: trigger is searched on channel CAP_SET.CH (level CAP_SET.LEVEL, ADC-code,
+ *          edge CAP_SET.EDGE) after CAP_SET.PRE scans are recorded
+ *        + the capture is frozen CAP_SET.POST scans after trigger (trigger scan is the first one),
+ *          DMA is switched to spare blocks while it is frozen (values of AI are not interrupted)
+ *        + RELEASE: ring is returned to DMA
+ *        + capture is read out by CAP_WIN (PLC_AI_CAP_WIN_SCANS scans from CAP_CMD.CURSOR),
+ *          window is ready when CAP_STAT.WIN = CAP_CMD.CURSOR
+ *        + PRE+POST <= PLC_AI_CAP_SCANS - 2 blocks (blocks being written when capture is frozen)
+ *
+ *        TIM3 settings
+ *        - .FREQ.BUS = 100 MHz
+ *        - .PSC      = 99  (1 TIM-tick is 1 us)
+ *        - .ARR      = (1000000/PLC_AI_ADC_SAMPLE_HZ)-1
+ *        - .TRGO     = update
+ *
+ *        Scan of 3 channels takes 3*(480+12) ADC-cycles at 16.7 MHz (~89 us),
+ *        so PLC_AI_ADC_SAMPLE_HZ must be below 11 kHz.
+ *        In oversampling mode a scan takes 2*(84+12)+(480+12) ADC-cycles (~41 us),
+ *        so PLC_AI_ADC_SAMPLE_HZ_OVS must be below 24 kHz.
+ *        MCU_TEMP keeps 480 cycles (sample time of temperature sensor >= 10 us).
  */
 
 #ifndef PLC_AI_H
@@ -28,6 +91,8 @@
 #include "config.h"
 #include "error.h"
 #include "scale.h"
+#include "ai-fltr.h"
+#include "ai-lin.h"
 
 #ifdef DEBUG_LOG_ADC
 #include "debug-log.h"
@@ -58,20 +123,132 @@
 #define PLC_AI_MCU_TEMP__ADC_CH                  ADC_CHANNEL_TEMPSENSOR
 
 
-/** @def Quantity of measurements per a ADC-channel
- *  @note ADC-code of a channel is a average of all its measurements
+/** @def ADC is triggered by TIM3.TRGO
+ *  @note comment the line to run ADC in continuous mode (max. sample rate)
+ */
+#define PLC_AI_ADC_TRIG_TIM
+
+/** @def ADC clock (Hz)
+ */
+#define PLC_AI_ADC_CLK_HZ                        (uint32_t)(PLC_APB2_PCLK_FREQ/6)
+
+/** @def Sample time (ADC-cycles)
+ */
+#define PLC_AI_ADC_SMPL                          ADC_SAMPLETIME_480CYCLES  //normal mode
+#define PLC_AI_ADC_SMPL_OVS                      ADC_SAMPLETIME_84CYCLES   //oversampling mode (AI.00, AI.01)
+#define PLC_AI_ADC_SMPL_TEMP                     ADC_SAMPLETIME_480CYCLES  //MCU_TEMP (both modes)
+
+/** @def Scan time (ADC-cycles: sample time + 12 cycles of conversion per channel)
+ */
+#define PLC_AI_ADC_SCAN_CYCLES                   (uint32_t)(3*(480+12))
+#define PLC_AI_ADC_SCAN_CYCLES_OVS               (uint32_t)(2*(84+12)+(480+12))
+
+/** @def Sample rate per a ADC-channel (Hz)
+ */
+#ifdef PLC_AI_ADC_TRIG_TIM
+#define PLC_AI_ADC_SAMPLE_HZ                     (uint32_t)5000
+#define PLC_AI_ADC_SAMPLE_HZ_OVS                 (uint32_t)20000
+#else
+#define PLC_AI_ADC_SAMPLE_HZ                     (uint32_t)(PLC_AI_ADC_CLK_HZ/PLC_AI_ADC_SCAN_CYCLES)
+#define PLC_AI_ADC_SAMPLE_HZ_OVS                 (uint32_t)(PLC_AI_ADC_CLK_HZ/PLC_AI_ADC_SCAN_CYCLES_OVS)
+#endif //PLC_AI_ADC_TRIG_TIM
+
+/** @def TIM3 settings (trigger)
+ */
+#define PLC_AI_TRIG_TIM_HZ                       (uint32_t)1000000  //Hz
+#define PLC_AI_TRIG_TIM_PRESCALER                (uint32_t)((PLC_APB1_TCLK_FREQ/PLC_AI_TRIG_TIM_HZ)-1)
+#define PLC_AI_TRIG_TIM_PERIOD                   (uint32_t)((PLC_AI_TRIG_TIM_HZ/PLC_AI_ADC_SAMPLE_HZ)-1)
+#define PLC_AI_TRIG_TIM_PERIOD_OVS               (uint32_t)((PLC_AI_TRIG_TIM_HZ/PLC_AI_ADC_SAMPLE_HZ_OVS)-1)
+
+/** @def Quantity of measurements per a ADC-channel in a block of ADC buffer
+ *  @note a block is processed by DMA.TC (1 ms)
+ */
+#define PLC_AI_ADC_CHANNEL_MEASURES              (uint16_t)(PLC_AI_ADC_SAMPLE_HZ/1000)
+#define PLC_AI_ADC_CHANNEL_MEASURES_OVS          (uint16_t)(PLC_AI_ADC_SAMPLE_HZ_OVS/1000)
+
+/** @var Size of a block of ADC buffer by channels
+ */
+#define PLC_AI_ADC_BLK_SZ                        (uint16_t)(PLC_AI_SZ*PLC_AI_ADC_CHANNEL_MEASURES)
+#define PLC_AI_ADC_BLK_SZ_OVS                    (uint16_t)(PLC_AI_SZ*PLC_AI_ADC_CHANNEL_MEASURES_OVS)
+
+/** @def Waveform capture
+ */
+#define PLC_AI_CAP_SCANS                         (uint16_t)1280    //scans in the ring of ADC buffer (>> 2 blocks)
+#define PLC_AI_CAP_WIN_SCANS                     (uint16_t)32      //scans in read-out window
+#define PLC_AI_CAP_WIN_SZ                        (uint16_t)(PLC_AI_SZ*PLC_AI_CAP_WIN_SCANS)
+#define PLC_AI_CAP_CODE_NONE                     (uint16_t)0xFFFF  //no measurement (out of capture)
+
+/** @var Size of ADC buffer by channels (ring of blocks)
+ */
+#define PLC_AI_ADC_BUFF_SZ                       (uint16_t)(PLC_AI_SZ*PLC_AI_CAP_SCANS)
+
+/** @def Oversampling (extra bits of resolution)
+ *  @note 4^n measurements per output
+ */
+#define PLC_AI_OVS__MAX                          (uint8_t)4
+#define PLC_AI_OVS_DEF                           (uint8_t)0
+
+/** @def Publication
  */
-#define PLC_AI_ADC_CHANNEL_MEASURES              100
+#define PLC_AI_DB_DEF                            (float)0.0       //deadband (absolute)
+#define PLC_AI_DB_PCT_DEF                        (float)0.0       //deadband (% of value)
+#define PLC_AI_PUB_MIN_DEF                       (uint16_t)0      //min. interval (ms)
+#define PLC_AI_PUB_HB_DEF                        (uint16_t)0      //heartbeat (s, 0 - off)
 
-/** @var Size of ADC buffer by channels
+/** @def Threshold
  */
-#define PLC_AI_ADC_BUFF_SZ                       (uint16_t)(PLC_AI_SZ*PLC_AI_ADC_CHANNEL_MEASURES)
+#define PLC_AI_THR_DEF                           (float)0.0
+
+/** @def Waveform capture: states
+ */
+#define PLC_AI_CAP_IDLE                          (uint8_t)0  //ring is not used
+#define PLC_AI_CAP_ARMED                         (uint8_t)1  //search of trigger
+#define PLC_AI_CAP_TRIG                          (uint8_t)2  //triggered, post-trigger scans
+#define PLC_AI_CAP_FROZEN                        (uint8_t)3  //capture is ready to read
+
+/** @def Waveform capture: trigger edges
+ */
+#define PLC_AI_CAP_EDGE_NONE                     (uint8_t)0  //immediately after pre-trigger scans
+#define PLC_AI_CAP_EDGE_RISE                     (uint8_t)1  //rising through level
+#define PLC_AI_CAP_EDGE_FALL                     (uint8_t)2  //falling through level
+#define PLC_AI_CAP_EDGE_ANY                      (uint8_t)3  //rising or falling
+
+/** @def Waveform capture: commands
+ */
+#define PLC_AI_CAP_CMD_NONE                      (uint8_t)0
+#define PLC_AI_CAP_CMD_ARM                       (uint8_t)1
+#define PLC_AI_CAP_CMD_RELEASE                   (uint8_t)2
+
+/** @def Waveform capture: items of settings and commands (Ch of queue item)
+ */
+#define PLC_AI_CAP_SET_CH                        (uint8_t)0  //trigger channel
+#define PLC_AI_CAP_SET_EDGE                      (uint8_t)1  //trigger edge
+#define PLC_AI_CAP_SET_LEVEL                     (uint8_t)2  //trigger level (ADC-code)
+#define PLC_AI_CAP_SET_PRE                       (uint8_t)3  //pre-trigger scans
+#define PLC_AI_CAP_SET_POST                      (uint8_t)4  //post-trigger scans
+//
+#define PLC_AI_CAP_ITEM_CMD                      (uint8_t)0  //command
+#define PLC_AI_CAP_ITEM_CURSOR                   (uint8_t)1  //the first scan of window
+
+/** @def Waveform capture: settings by default
+ */
+#define PLC_AI_CAP_CH_DEF                        PLC_AI_00
+#define PLC_AI_CAP_EDGE_DEF                      PLC_AI_CAP_EDGE_RISE
+#define PLC_AI_CAP_LEVEL_DEF                     (uint16_t)2048
+#define PLC_AI_CAP_PRE_DEF                       (uint16_t)256
+#define PLC_AI_CAP_POST_DEF                      (uint16_t)768
+
+/** @def Max. quantity of measurements in accumulator
+ *  @note accumulator restarts from the latest block if it is not read for a long time
+ */
+#define PLC_AI_ADC_ACC_CNT__MAX                  (uint32_t)65535
 
 /** @def Digital levels (ADC-code)
  *       0 .. 12bit
  */
 #define PLC_AI_DIG_MIN                           (uint16_t)0     //minumum
 #define PLC_AI_DIG_MAX                           (uint16_t)4095  //maximum
+#define PLC_AI_DIG_BITS                          (uint8_t)12     //resolution (bits)
 
 /** @def Analog levels (V)
  */
@@ -84,16 +261,31 @@
 // 0...4095 (ADCcode) > 0...3,3 (V)
 #define PLC_AI_KA_3V3                            (float)0.000805861
 #define PLC_AI_KB_3V3                            (float)0.0
+// 0...4095 (ADCcode) > 0...3,3 (V, Q16): Ka in Q32 (round(3.3*2^32/4095))
+#define PLC_AI_KA_3V3_Q32                        (uint32_t)3461146
+
+/** @def ADC-code > V (Q16, rounded)
+ *  @param CodeIn - ADC-code (4095*2^BitsIn is full scale).
+ *  @param BitsIn - bits of oversampling (0 ... PLC_AI_OVS__MAX).
+ */
+#define PLC_AI_CODE_TO_ANA_Q(CodeIn, BitsIn)     (int32_t)((((uint64_t)(CodeIn)*PLC_AI_KA_3V3_Q32) + ((uint64_t)1 << (15+(BitsIn)))) >> (16+(BitsIn)))
+
+/** @def Fixed-point survey (V, scaled and linearized values are Q16)
+ *  @note Survey is in float if |Ka|*PLC_AI_ANA_MAX+|Kb| >= PLC_AI_FIX_VAL__MAX
+ */
+#define PLC_AI_FIX_VAL__MAX                      PLC_AI_LIN_VAL__MAX
 // UserScale
 #define PLC_AI_KA_DEF                            (float)1.0
 #define PLC_AI_KB_DEF                            (float)0.0
 
-/** @def Survey period (ms)
+/** @def Survey (publish) period (ms)
+ *  @note 1 ... 1000 ms, acquisition does not depend on it
  */
-#define PLC_AI_SURVEY_PERIOD_MS                  100
+#define PLC_AI_SURVEY_PERIOD_MS                  10
 
 
 /** @typedef ADC Callback user-functions
+ *  @note ConvCplt is called from ISR after every processed block of ADC buffer
  */
 typedef struct
 {
@@ -101,6 +293,85 @@ typedef struct
 
 } PLC_ADC_UserFunc_t;
 
+/** @typedef ADC accumulator of a channel
+ */
+typedef struct PlcAI_Acc_t_
+{
+	//@var Sum of measurements
+	uint32_t Sum;
+	//@var Quantity of measurements
+	uint32_t Cnt;
+	//@var The latest average ADC-code
+	uint16_t Code;
+
+} PlcAI_Acc_t;
+
+/** @typedef Oversampling of a channel
+ */
+typedef struct PlcAI_Ovs_t_
+{
+	//@var Extra bits (n)
+	uint8_t Bits;
+	//@var Sum of measurements
+	uint32_t Sum;
+	//@var Quantity of measurements (up to 4^n)
+	uint16_t Cnt;
+
+} PlcAI_Ovs_t;
+
+/** @typedef Publication of a channel
+ */
+typedef struct PlcAI_Pub_t_
+{
+	//@var The latest published value
+	float Val;
+	//@var Time of the latest publication (RTOS-ticks)
+	uint32_t Tm;
+	//@var Published at least once
+	uint8_t Done;
+
+} PlcAI_Pub_t;
+
+/** @typedef Waveform capture
+ */
+typedef struct PlcAI_Cap_t_
+{
+	//SETTINGS
+
+	//@var Trigger channel
+	uint8_t Ch;
+	//@var Trigger edge (PLC_AI_CAP_EDGE_...)
+	uint8_t Edge;
+	//@var Trigger level (ADC-code)
+	uint16_t Level;
+	//@var Scans before trigger
+	uint16_t Pre;
+	//@var Scans from trigger
+	uint16_t Post;
+
+	//STATE
+
+	//@var State (PLC_AI_CAP_...)
+	uint8_t State;
+	//@var Previous ADC-code of trigger channel
+	uint16_t Prev;
+	//@var Scans since arm
+	uint32_t Cnt;
+	//@var Scans left to freeze
+	uint16_t Left;
+	//@var Trigger scan (in ring)
+	uint16_t Trig;
+	//@var The first scan of capture (in ring)
+	uint16_t Start;
+	//@var Captured scans
+	uint16_t Len;
+	//@var Scans in ring
+	uint16_t Ring;
+	//@var Sample rate (Hz)
+	uint32_t Hz;
+
+} PlcAI_Cap_t;
+
 
 /** @typedef AI-channel settings
  *           main type
@@ -123,6 +394,34 @@ typedef struct PlcAI_t_
     float Ka;
     float Kb;
 
+    //@var Filter type (PLC_AI_FLTR_...)
+    uint8_t Fltr;
+
+    //@var Filter parameter
+    uint16_t FltrPrm;
+
+    //@var Oversampling (extra bits)
+    uint8_t Ovs;
+
+    //@var Deadband (absolute, % of value)
+    float Db;
+    float DbPct;
+
+    //@var Min. publish interval (ms)
+    uint16_t PubMin;
+
+    //@var Heartbeat (s)
+    uint16_t PubHb;
+
+    //@var Linearization type (PLC_AI_LIN_...)
+    uint8_t Lin;
+
+    //@var Quantity of points or coefficients of linearization
+    uint8_t LinSz;
+
+    //@var Threshold
+    float Thr;
+
 	//VALUES
 
     //@var Channel value (V)
@@ -134,6 +433,15 @@ typedef struct PlcAI_t_
     //@arg = 0..255
 	uint8_t Status;
 
+	//@var Effective sample rate (Hz)
+	float RateAct;
+
+	//@var Effective resolution (bits)
+	uint8_t BitsAct;
+
+	//@var Threshold is reached (Val >= Thr)
+	uint8_t ThrReached;
+
 } PlcAI_t;
 
 /** @def Modes
@@ -175,6 +483,24 @@ typedef struct PlcAI_Q_t_
 #define PLC_AI_Q_ID_KA        					 (uint8_t)3   //Ka
 #define PLC_AI_Q_ID_KB        					 (uint8_t)4   //Kb
 #define PLC_AI_Q_ID_STATUS     					 (uint8_t)5   //status
+#define PLC_AI_Q_ID_FLTR     					 (uint8_t)6   //filter type
+#define PLC_AI_Q_ID_FLTR_PRM   					 (uint8_t)7   //filter parameter
+#define PLC_AI_Q_ID_OVS    					     (uint8_t)8   //oversampling
+#define PLC_AI_Q_ID_RATE_ACT   					 (uint8_t)9   //effective sample rate
+#define PLC_AI_Q_ID_BITS_ACT   					 (uint8_t)10  //effective resolution
+#define PLC_AI_Q_ID_DB         					 (uint8_t)11  //deadband (absolute)
+#define PLC_AI_Q_ID_DB_PCT     					 (uint8_t)12  //deadband (% of value)
+#define PLC_AI_Q_ID_PUB_MIN    					 (uint8_t)13  //min. publish interval
+#define PLC_AI_Q_ID_PUB_HB     					 (uint8_t)14  //heartbeat
+#define PLC_AI_Q_ID_CAP_SET    					 (uint8_t)15  //capture: setting (Ch - item)
+#define PLC_AI_Q_ID_CAP_CMD    					 (uint8_t)16  //capture: command, cursor (Ch - item)
+#define PLC_AI_Q_ID_CAP_STAT   					 (uint8_t)17  //capture: status
+#define PLC_AI_Q_ID_CAP_WIN    					 (uint8_t)18  //capture: window (Val - cursor)
+#define PLC_AI_Q_ID_LIN        					 (uint8_t)19  //linearization type
+#define PLC_AI_Q_ID_LIN_SZ     					 (uint8_t)20  //linearization size
+#define PLC_AI_Q_ID_LIN_TBL    					 (uint8_t)21  //linearization table (Ch - item of table)
+#define PLC_AI_Q_ID_THR        					 (uint8_t)22  //threshold
+#define PLC_AI_Q_ID_THR_REACHED					 (uint8_t)23  //threshold is reached
 
 
 /** @var ADC Handler
@@ -211,14 +537,88 @@ void PlcAI_Start(void);
 void PlcAI_Stop(void);
 
 
+/** @brief  Set filter of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @param  TypeIn - filter type (PLC_AI_FLTR_...).
+ *  @param  PrmIn - filter parameter.
+ *  @return Result:
+ *  @arg    = 0 - not set (filter is off)
+ *  @arg    = 1 - set
+ */
+uint8_t PlcAI_SetFltr(uint8_t ChIn, uint8_t TypeIn, uint16_t PrmIn);
+
+
+/** @brief  Set oversampling of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @param  BitsIn - extra bits (n):
+ *  @arg    = 0 ... PLC_AI_OVS__MAX (4^n measurements per output)
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   ADC is restarted if mode of ADC is changed.
+ */
+uint8_t PlcAI_SetOvs(uint8_t ChIn, uint8_t BitsIn);
+
+/** @brief  Get effective sample rate of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @return Sample rate (Hz).
+ */
+float PlcAI_GetRate(uint8_t ChIn);
+
+/** @brief  Get effective resolution of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @return Resolution (bits).
+ */
+uint8_t PlcAI_GetBits(uint8_t ChIn);
+
+
+/** @brief  Arm waveform capture.
+ *  @param  CapIn - pointer to settings (Ch, Edge, Level, Pre, Post).
+ *  @return Result:
+ *  @arg    = 0 - not armed (invalid settings)
+ *  @arg    = 1 - armed
+ *  @note   Pre and Post are limited by PlcAI_CapLenMax(), Post >= 1.
+ *          A frozen capture is dropped.
+ */
+uint8_t PlcAI_CapArm(const PlcAI_Cap_t *CapIn);
+
+/** @brief  Release waveform capture (ring is returned to DMA).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcAI_CapRelease(void);
+
+/** @brief  Get state of waveform capture.
+ *  @param  CapOut - pointer to copy of capture (settings and state).
+ *  @return State (PLC_AI_CAP_...).
+ */
+uint8_t PlcAI_CapGet(PlcAI_Cap_t *CapOut);
+
+/** @brief  Get max. length of waveform capture (by mode of ADC).
+ *  @param  None.
+ *  @return Pre+Post (scans).
+ */
+uint16_t PlcAI_CapLenMax(void);
+
+/** @brief  Read measurement of frozen waveform capture.
+ *  @param  ScanIn - scan number (0 ... Len-1, trigger scan is Pre).
+ *  @param  ChIn - channel number.
+ *  @return ADC-code or PLC_AI_CAP_CODE_NONE (not frozen or out of capture).
+ *  @note   Measurement is read from the ring in place.
+ */
+uint16_t PlcAI_CapRead(uint16_t ScanIn, uint8_t ChIn);
+
+
 /** @brief  Get ADC-code of AI-channel.
  *  @param  ChIn - channel number:
  *  @arg    = PLC_AI_00
  *  @arg    = PLC_AI_01
  *  @arg    = PLC_AI_MCU_TEMP
  *  @return Digital level:
- *  @arg    = PLC_AI_DIG_MIN ... PLC_AI_DIG_MAX
- *  @note   Current ADC-code
+ *  @arg    = PLC_AI_DIG_MIN ... PLC_AI_DIG_MAX*2^n (n - oversampling)
+ *  @note   Average ADC-code since the last call
+ *          (the latest one if there are no new measurements)
+ *          or the latest output of filter
  */
 uint16_t PlcAI_GetCode(uint8_t ChIn);
 
@@ -232,5 +632,12 @@ uint16_t PlcAI_GetCode(uint8_t ChIn);
  */
 float PlcAI_GetAna(uint8_t ChIn);
 
+/** @brief  Get analog value of AI-channel (fixed point).
+ *  @param  ChIn - channel number.
+ *  @return Analog value (V, Q16):
+ *  @arg    = PLC_AI_ANA_MIN ... PLC_AI_ANA_MAX
+ */
+int32_t PlcAI_GetAnaQ(uint8_t ChIn);
+
 
 #endif //PLC_AI_H
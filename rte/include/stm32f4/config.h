@@ -58,7 +58,7 @@
 /** @def RTE-version
  */
 #define PLC_RTE_VERSION_MAJOR                    1
-#define PLC_RTE_VERSION_MINOR                    0
+#define PLC_RTE_VERSION_MINOR                    7
 #define PLC_RTE_VERSION_PATCH                    0
 
 /** @def RTE-version (packed)
@@ -90,9 +90,12 @@
 #define RTE_MOD_COM2		          		 	 //COM2
 #define RTE_MOD_APP				             	 //Application
 #define RTE_MOD_APP_TIM			             	 //Application Timer
+//#define RTE_MOD_APP_SERIAL		             //Runs of periodic tasks of application are serialized (see RTOS_APP_RUN_MTX)
 #define RTE_MOD_APP_DEBUG_HANDLER			     //Application Debug-handler
 //#define RTE_MOD_FACTORY			             //Factory values
 #define RTE_MOD_SYS_REG			           	 	 //System registers
+#define RTE_MOD_RTC				             	 //RTC (wall clock)
+#define RTE_MOD_RETAIN			             	 //Retain-data of application (flash, requires RTE_MOD_DATA)
 
 
 /** DEBUG MODE
@@ -212,7 +215,7 @@
 #define PLC_NVIC_PRIO_RTOS_SYSCALL               8
 
 // SYSTEM-DEPENDENT ISR
-// - PPRIO > PLC_NVIC_PRIO_RTOS_SYSCALL
+// - PPRIO >= PLC_NVIC_PRIO_RTOS_SYSCALL
 // - that using RTOS API (*FromISR)
 // - without interrupt the procedures of KERNEL or CRITICAL-SECTIONS (ISR is waiting for complete the procedures)
 
@@ -238,6 +241,11 @@
 #define PLC_NVIC_PPRIO_COM2_UART           		 9
 #define PLC_NVIC_SPRIO_COM2_UART          		 0
 
+//APP
+// .TIM4.UP (scan release)
+#define PLC_NVIC_PPRIO_APP_TIM           	 	 9
+#define PLC_NVIC_SPRIO_APP_TIM           	 	 0
+
 //DO
 // .DMA.Tc
 #define PLC_NVIC_PPRIO_DO_DMA           	 	 10
@@ -252,8 +260,11 @@
 #define PLC_NVIC_SPRIO_AI_ADC           	 	 0
 
 //DI
-// .EXTI
-#define PLC_NVIC_PPRIO_DI_EXTI           	 	 12
+// .EXTI (the highest of system-dependent ISR: counter compare-match, edge capture)
+//  worst-case latency = the longest critical section (kernel, taskENTER_CRITICAL, PRIMASK)
+//                     + ISR of the same priority in progress (EXTI of other channel),
+//  COM2, TIM4, DO.DMA and AI do not delay it
+#define PLC_NVIC_PPRIO_DI_EXTI           	 	 PLC_NVIC_PRIO_RTOS_SYSCALL
 #define PLC_NVIC_SPRIO_DI_EXTI           	 	 0
 
 //SysTick
@@ -261,7 +272,7 @@
 #define PLC_NVIC_SPRIO_SYSTICK                   0
 
 // SYSTEM-INDEPENDENT ISR
-// - PPRIO <= PLC_NVIC_PRIO_RTOS_SYSCALL
+// - PPRIO < PLC_NVIC_PRIO_RTOS_SYSCALL
 // - that NOT using RTOS API (*FromISR)
 // - with interrupt the procedures of KERNEL or CRITICAL-SECTIONS (ISR is not waiting for complete the procedures)
 
@@ -303,6 +314,7 @@
 #define PLC_RTOS_PRIO_T_AI						5
 #define PLC_RTOS_PRIO_T_DO						6
 #define PLC_RTOS_PRIO_T_LED						4
+#define PLC_RTOS_PRIO_T_APP_EVT					4   //tasks of application released by events (above APP_T)
 
 // NON-BLOCKING TASKS
 // - lower priorities (1,2,3)
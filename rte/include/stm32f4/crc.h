@@ -0,0 +1,52 @@
+/* @page crc.h
+ *       PLC411::RTE
+ *       CRC calculation unit driver
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        CRC-32 of the hardware unit:
+ *        - polynomial 0x04C11DB7, initial value 0xFFFFFFFF,
+ *          no reflection, no final XOR (CRC-32/MPEG-2 of 32-bit words)
+ *        - every 32-bit word (read from memory, little-endian) is processed MSB first
+ *        - one word per ~4 core clock cycles
+ *        - the unit keeps the value between calls, so calculation may be split into parts
+ *          (PlcCrc_Reset(), PlcCrc_Put() ...), the unit serves one calculation at a time
+ *
+ *        the same CRC is stamped into application image by Beremiz YAPLC (plc_crc.py)
+ */
+
+#ifndef PLC_CRC_H
+#define PLC_CRC_H
+
+#include "config.h"
+
+
+/** @brief  Init. (enable clock of CRC unit).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcCrc_Init(void);
+
+/** @brief  Reset CRC (start of calculation).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcCrc_Reset(void);
+
+/** @brief  Put data into calculation.
+ *  @param  DataIn - pointer to data (32-bit words).
+ *  @param  SzIn   - size of data (number of words).
+ *  @return CRC of data put since PlcCrc_Reset().
+ */
+uint32_t PlcCrc_Put(const uint32_t *DataIn, uint32_t SzIn);
+
+/** @brief  Calculate CRC.
+ *  @param  DataIn - pointer to data (32-bit words).
+ *  @param  SzIn   - size of data (number of words).
+ *  @return CRC of data.
+ */
+uint32_t PlcCrc_Calc(const uint32_t *DataIn, uint32_t SzIn);
+
+#endif //PLC_CRC_H
@@ -8,6 +8,19 @@
 /** @note
   *		  PA8  -> EXTI8  -> DI.0
  *		  PB15 -> EXTI15 -> DI.1
+ *
+ *        Channels are mapped to GPIO by the table PLC_DI_PINS (di.c):
+ *        to add a channel define PLC_DI_xx, its GPIO reference,
+ *        move PLC_DI_LAST, add the row into the table and the pin into PLC_DI_PINS_OR/SUM.
+ *        Every channel needs its own EXTI line (pin number 0..15):
+ *        a shared line fails the build (PLC_DI_PINS_OR/SUM) and PlcDI_Init.
+ *        Channels are paired for encoders (0-1, 2-3, ...).
+ *
+ *        Counter compare-match (counter mode, DI_CNTR_CMP_ALLOW = 1, DI_CNTR_CMP_DO is linked):
+ *        EXTI forces DI_CNTR_CMP_DO_VAL to the linked DO at the edge that reaches DI_CNTR_SETPOINT,
+ *        from that moment the DO-channel is owned by compare-match (DO_CMP_HELD = 1) and
+ *        values written to it are not output until compare-match is re-armed
+ *        (write of DI_CNTR_CMP_..., DI_CNTR_SETPOINT or reset of counter).
  */
 
 #ifndef PLC_DI_H
@@ -23,9 +36,17 @@
 #define PLC_DI_00                                0
 #define PLC_DI_01                                1
 
+/** @def Last channel number
+ */
+#define PLC_DI_LAST                              PLC_DI_01
+
 /** @def Quantity of channels
  */
-#define PLC_DI_SZ                                (uint8_t)(PLC_DI_01+1)
+#define PLC_DI_SZ                                (uint8_t)(PLC_DI_LAST+1)
+
+#if (((PLC_DI_LAST+1) & 1) || (PLC_DI_LAST+1) > 16)
+#error "Quantity of DI-channels must be even and not more than 16 (number of EXTI lines)"
+#endif
 
 /** @def DI-channel
  *       GPIO reference
@@ -36,6 +57,28 @@
 #define PLC_DI_01__PORT                          GPIOB
 #define PLC_DI_01__PIN                           GPIO_PIN_15
 
+/** @def EXTI lines of channels (OR and sum of pins)
+ *       are equal if every channel has its own EXTI line (checked by di.c)
+ */
+#define PLC_DI_PINS_OR                           (PLC_DI_00__PIN | PLC_DI_01__PIN)
+#define PLC_DI_PINS_SUM                          (PLC_DI_00__PIN + PLC_DI_01__PIN)
+
+/** @typedef DI-channel GPIO reference
+ */
+typedef struct PlcDI_Pin_t_
+{
+    //@var GPIO port
+    GPIO_TypeDef *Port;
+
+    //@var GPIO pin
+    uint16_t Pin;
+
+} PlcDI_Pin_t;
+
+/** @var DI-channel GPIO references (index = channel number)
+ */
+extern const PlcDI_Pin_t PLC_DI_PINS[PLC_DI_SZ];
+
 /** @def Tachometer survey period (ms)
  */
 #define PLC_DI_TACH_SURVEY_PERIOD_MS             1000
@@ -44,6 +87,22 @@
  */
 #define PLC_DI_FLTR_DELAY_MS             		 20
 
+/** @def Event log: number of records per channel (must be a power of 2)
+ */
+#define PLC_DI_EVT_LOG_SZ                        32
+
+/** @def Event log: number of records per channel in Modbus-window
+ */
+#define PLC_DI_EVT_WIN_SZ                        8
+
+/** @def Event log: survey period of new records (ms)
+ */
+#define PLC_DI_EVT_SURVEY_PERIOD_MS              100
+
+#if ((PLC_DI_EVT_LOG_SZ & (PLC_DI_EVT_LOG_SZ-1)) || PLC_DI_EVT_WIN_SZ > PLC_DI_EVT_LOG_SZ)
+#error "PLC_DI_EVT_LOG_SZ must be a power of 2 and not less than PLC_DI_EVT_WIN_SZ"
+#endif
+
 
 /** @typedef DI-channel settings
  *           packed data
@@ -75,6 +134,21 @@ typedef struct PlcDI_Pack_t_
     //@arg = 1 - yes
     uint8_t Reset:1;
 
+    //@var Command to Allow Counter compare-match
+    //@arg = 0 - no
+    //@arg = 1 - yes
+    uint8_t CntrCmpAllow:1;
+
+    //@var DO-value that is set on Counter compare-match
+    //@arg = 0 - low output level
+    //@arg = 1 - high output level
+    uint8_t CntrCmpDOVal:1;
+
+    //@var Сounter compare-match is reached (latched)
+    //@arg = 0 - no
+    //@arg = 1 - yes
+    uint8_t CntrCmpReached:1;
+
 } PlcDI_Pack_t;
 
 /** @typedef DI-channel settings
@@ -107,6 +181,11 @@ typedef struct PlcDI_t_
     //@var Tachometer setpoint
     uint16_t TachSetpoint;
 
+    //@var DO-channel number that is linked to Counter compare-match
+    //@arg = 0..15
+    //@arg = PLC_DI_CNTR_CMP_DO_NONE - not linked
+    uint8_t CntrCmpDO;
+
     //@var Filter timeout (ms)
    	//@arg = 0  - off
     //@arg = >0 - on
@@ -161,6 +240,55 @@ typedef struct PlcDI_Fltr_t_
 
 } PlcDI_Fltr_t;
 
+/** @typedef DI-channel settings
+ *           counter compare-match (shared with EXTI)
+ */
+typedef struct PlcDI_Cmp_t_
+{
+	//SETTINGS
+
+    //@var Compare-match is armed (counter mode, allowed, DO is linked)
+    uint8_t Armed;
+
+    //@var DO-channel number
+    uint8_t DO;
+
+    //@var DO-value
+    uint8_t DOVal;
+
+    //@var Counter setpoint
+    uint32_t Setpoint;
+
+	//VALUES
+
+    //@var Counter value (counted by EXTI)
+    uint32_t CntrVal;
+
+    //@var Previous normal value
+    uint8_t PrevVal;
+
+	//STATUSES
+
+    //@var Compare-match is reached (latched)
+    uint8_t Reached;
+
+} PlcDI_Cmp_t;
+
+/** @typedef DI-channel event log (written by EXTI)
+ *  @note    Record: bit 31 - new level, bit 30 - valid (always 1), bits 0..29 - timestamp (us, wraps every ~1074 s)
+ */
+typedef struct PlcDI_Evt_t_
+{
+	//VALUES
+
+    //@var Records (ring buffer)
+    uint32_t Buff[PLC_DI_EVT_LOG_SZ];
+
+    //@var Number of captured records (free running)
+    uint32_t Head;
+
+} PlcDI_Evt_t;
+
 
 /** @def Modes
  */
@@ -179,6 +307,27 @@ typedef struct PlcDI_Fltr_t_
 #define PLC_DI_TACH_SETPOINT_DEF                 (uint16_t)0
 #define PLC_DI_TACH_SETPOINT_ALLOW_DEF           BIT_FALSE
 #define PLC_DI_FLTR_DELAY_DEF           		 PLC_DI_FLTR_DELAY_MS
+#define PLC_DI_CNTR_CMP_ALLOW_DEF           	 BIT_FALSE
+#define PLC_DI_CNTR_CMP_DO_DEF           	     PLC_DI_CNTR_CMP_DO_NONE
+#define PLC_DI_CNTR_CMP_DO_VAL_DEF           	 BIT_TRUE
+
+/** @def Counter compare-match: DO-channel is not linked
+ */
+#define PLC_DI_CNTR_CMP_DO_NONE                  (uint8_t)0xFF
+
+/** @def Event log: record
+ */
+#define PLC_DI_EVT_REC_VAL                       (uint32_t)0x80000000  //new level
+#define PLC_DI_EVT_REC_VALID                     (uint32_t)0x40000000  //record is captured (set in every record)
+#define PLC_DI_EVT_REC_TS                        (uint32_t)0x3FFFFFFF  //timestamp (us)
+#define PLC_DI_EVT_REC_NONE                      (uint32_t)0           //no record (VALID = 0)
+
+/** @def    Build event log record.
+ *  @param  TsIn  - timestamp (us).
+ *  @param  ValIn - new level.
+ *  @return Record.
+ */
+#define PLC_DI_EVT_REC(TsIn, ValIn)              (uint32_t)(((TsIn) & PLC_DI_EVT_REC_TS) | PLC_DI_EVT_REC_VALID | ((ValIn) ? PLC_DI_EVT_REC_VAL : 0))
 
 /** @def Status codes
  */
@@ -196,7 +345,7 @@ typedef struct PlcDI_Fltr_t_
  *  @arg    = 0 - the channel is not phase A of pair
  *  @arg    = 1 - the channel is phase A of pair
  */
-#define PLC_DI_IS_PHASE_A(ChIn)                  (uint8_t)((ChIn == PLC_DI_00) ? BIT_TRUE : BIT_FALSE)
+#define PLC_DI_IS_PHASE_A(ChIn)                  (uint8_t)((((ChIn) & 1) == 0) ? BIT_TRUE : BIT_FALSE)
 
 /** @def    Test phase B of pair.
  *  @param  ChIn - channel number.
@@ -242,6 +391,10 @@ typedef struct PlcDI_Q_t_
 #define PLC_DI_Q_ID_CNTR_SETPOINT     			 (uint8_t)31  //counter setpoint
 #define PLC_DI_Q_ID_CNTR_SETPOINT_ALLOW			 (uint8_t)32  //allow counter setpoint
 #define PLC_DI_Q_ID_CNTR_SETPOINT_REACHED		 (uint8_t)33  //counter has reached the setpoint
+#define PLC_DI_Q_ID_CNTR_CMP_ALLOW				 (uint8_t)34  //allow counter compare-match
+#define PLC_DI_Q_ID_CNTR_CMP_DO				 	 (uint8_t)35  //DO-channel linked to counter compare-match
+#define PLC_DI_Q_ID_CNTR_CMP_DO_VAL				 (uint8_t)36  //DO-value set on counter compare-match
+#define PLC_DI_Q_ID_CNTR_CMP_REACHED			 (uint8_t)37  //counter compare-match is reached
 #define PLC_DI_Q_ID_TACH_VAL   				     (uint8_t)4   //tachometer value
 #define PLC_DI_Q_ID_TACH_SETPOINT     			 (uint8_t)41  //tachometer setpoint
 #define PLC_DI_Q_ID_TACH_SETPOINT_ALLOW			 (uint8_t)42  //allow tachometer setpoint
@@ -249,6 +402,9 @@ typedef struct PlcDI_Q_t_
 #define PLC_DI_Q_ID_STATUS     					 (uint8_t)5   //status
 #define PLC_DI_Q_ID_RESET     					 (uint8_t)6   //command to reset all counters
 #define PLC_DI_Q_ID_FILTER_DELAY				 (uint8_t)7   //filter delay
+#define PLC_DI_Q_ID_EVT_HEAD				     (uint8_t)8   //event log: number of captured records
+#define PLC_DI_Q_ID_EVT_CURSOR				     (uint8_t)81  //event log: read cursor
+#define PLC_DI_Q_ID_EVT_WIN				     	 (uint8_t)82  //event log: window from read cursor
 
 
 /** @typedef DI Callback user-functions
@@ -260,17 +416,18 @@ typedef struct
 } PLC_DI_UserFunc_t;
 
 
-/** @var DI Callback user-functions
+/** @var DI Callback user-functions (common for all channels)
  */
-extern PLC_DI_UserFunc_t PLC_DI00_USER_FUNC;
-extern PLC_DI_UserFunc_t PLC_DI01_USER_FUNC;
+extern PLC_DI_UserFunc_t PLC_DI_USER_FUNC;
 
 
 /** @brief  Init. DI.
  *  @param  None.
- *  @return None.
+ *  @return Result:
+ *  @arg    = 0 - PLC_DI_PINS is invalid (pin is not single or EXTI line is shared by channels), nothing is initialized
+ *  @arg    = 1 - OK
  */
-void PlcDI_Init(void);
+uint8_t PlcDI_Init(void);
 
 /** @brief  DeInit. DI.
  *  @param  None.
@@ -285,5 +442,12 @@ void PlcDI_DeInit(void);
  */
 uint8_t PlcDI_ReadNormVal(uint8_t ChIn);
 
+/** @brief  Read normal values of all channels at once.
+ *  @param  None.
+ *  @return Normal values (bit per channel).
+ *  @note   Every GPIO port is read once (IDR), all ports are read back-to-back.
+ */
+uint32_t PlcDI_ReadAll(void);
+
 
 #endif //PLC_DI_H
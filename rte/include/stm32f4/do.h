@@ -18,6 +18,29 @@
  *          TIMx.T=PLC_DO_PWM_T_CODE__MAX, TIMx.D=PLC_DO_PWM_T__MIN -> 0 (FALSE) -> DOx
  *          or
  *          TIMx.T=PLC_DO_PWM_T_CODE__MAX, TIMx.D=PLC_DO_PWM_T__MAX -> 1 (TRUE)  -> DOx
+ *
+ *        - mode 3 (PWM):
+ *          TIMx.PSC, TIMx.ARR are planned by requested frequency (Hz) or period (ns, ms)
+ *          and min. resolution (see pwm-plan.h), achieved values are reported back
+ *
+ *        - mode 5 (PTO):
+ *          TIMx.UP -> DMA-burst [ARR, RCR, CCR1, CCR2] -> next pulse (see pto.h)
+ *          CPU is used only between profile segments
+ *
+ *        Forced outputs (TIMx.CCMRx.OCxM = forced level, CCR is ignored):
+ *          owners of channel (compare-match, fail-safe outputs) are kept by do.c,
+ *          the owner of the highest priority decides the level (see PLC_DO_FORCE_...)
+ *          while compare-match holds the channel (DO_CMP_HELD = 1) values written by
+ *          application or ModBus (Norm, Fast, PWM, PTO) are stored but do not reach the output,
+ *          the channel is given back by re-arm of compare-match (write of DI_CNTR_CMP_ALLOW,
+ *          DI_CNTR_CMP_DO, DI_CNTR_CMP_DO_VAL, DI_CNTR_SETPOINT or reset of counter)
+ *
+ *        Output image (scan-synchronous outputs):
+ *          scan of application -> PlcDO_ImgSet..() -> build image
+ *          end of scan         -> PlcDO_ImgCommit() -> ready image (stamped, changed values only)
+ *          DO_T                -> PlcDO_ImgTake() -> PlcDO_Write() -> CCR of all channels at once
+ *          Norm-values are applied by generated update event,
+ *          PWM-values are applied by the next update event of channel (preload)
  */
 
 #ifndef PLC_DO_H
@@ -30,6 +53,14 @@
 #include "tim5.h"
 
 #include "scale.h"
+#include "pto.h"
+#include "pwm-plan.h"
+
+#ifdef RTE_MOD_DO
+#if !defined(PLC_TIM2_DMA) || !defined(PLC_TIM5_DMA)
+#error "DO.PTO requires PLC_TIM2_DMA and PLC_TIM5_DMA"
+#endif
+#endif // RTE_MOD_DO
 
 
 /** @def Channel number
@@ -55,9 +86,20 @@
 /** @def PWM Period
  */
 // limites (ms)
-#define PLC_DO_PWM_T__MIN                        (float)0.01        //100.0   kHz
+#define PLC_DO_PWM_T__MIN                        (float)0.001       //1.0     MHz
 #define PLC_DO_PWM_T__1HZ                        (float)1000.0      //1.0     Hz
 #define PLC_DO_PWM_T__MAX                        (float)1000000.0   //0.001   Hz
+// limites (Hz)
+#define PLC_DO_PWM_FREQ__MIN                     (uint32_t)1
+#define PLC_DO_PWM_FREQ__MAX                     (uint32_t)1000000
+// limites (ns)
+#define PLC_DO_PWM_T_NS__MIN                     (uint32_t)1000         //1.0     MHz
+#define PLC_DO_PWM_T_NS__MAX                     (uint32_t)4294967295   //0.23    Hz
+
+/** @def PWM Resolution (quantity of steps per period, ARR+1)
+ */
+#define PLC_DO_PWM_ARR__MIN                      (uint32_t)(100-1)   //1 % per step at PLC_DO_PWM_FREQ__MAX
+#define PLC_DO_PWM_RES__MIN                      (uint32_t)(PLC_DO_PWM_ARR__MIN+1)
 
 /** @def PWM Pulse (fill factor)
  */
@@ -65,6 +107,20 @@
 #define PLC_DO_PWM_D__MIN              		     (float)0.0
 #define PLC_DO_PWM_D__50               		     (float)50.0
 #define PLC_DO_PWM_D__MAX              		     (float)100.0
+// fixed-point (0.01 %)
+#define PLC_DO_PWM_D__SCALE                      (uint32_t)100
+#define PLC_DO_PWM_D__FULL                       (uint32_t)10000
+
+/** @def PWM planner
+ *       TIM2 and TIM5 have the same clock and limits
+ */
+#define PLC_DO_PWM_PLAN_TIM                      { PLC_TIM2_CLK_HZ, PLC_TIM2_PRESCALER__MAX, PLC_DO_PWM_ARR__MIN, PLC_TIM2_PERIOD__MAX }
+
+/** @def PTO
+ */
+// limites
+#define PLC_DO_PTO_PULSES__MAX                   (uint32_t)16777216  //exact in float (queue value)
+#define PLC_DO_PTO_FREQ__MAX                     (uint32_t)(PLC_TIM2_HZ/(PLC_TIM2_PERIOD__MIN+1))  //Hz
 
 
 /** @typedef DO-channel settings
@@ -82,11 +138,20 @@ typedef struct PlcDO_Pack_t_
     //@arg = 1 - yes
     uint8_t SafeAllow:1;
 
-    //@var Postponed normal value is ready
-    //@note it's normal value from Beremiz
+    //@var PTO: command to Start
+    //@arg = 0 - stop (abort)
+    //@arg = 1 - start (reset by the end of pulse train)
+    uint8_t PtoStart:1;
+
+    //@var PTO: pulse train is done
     //@arg = 0 - no
     //@arg = 1 - yes
-    uint8_t PostponReady:1;
+    uint8_t PtoDone:1;
+
+    //@var Output is held by DI counter compare-match (see di.h)
+    //@arg = 0 - no
+    //@arg = 1 - yes (until compare-match is re-armed)
+    uint8_t CmpHeld:1;
 
 } PlcDO_Pack_t;
 
@@ -107,8 +172,21 @@ typedef struct PlcDO_t_
    	uint8_t Mode;
 
     //@var PWM period (ms)
+    //@note achieved period is written back after planning
     float PwmT;
 
+    //@var PWM frequency (Hz)
+    //@arg = 0 - not used (PwmTns or PwmT is used)
+    uint32_t PwmFreq;
+
+    //@var PWM period (ns)
+    //@arg = 0 - not used (PwmT is used)
+    uint32_t PwmTns;
+
+    //@var PWM resolution requested (min. quantity of steps per period)
+    //@arg = 0 - the best resolution only
+    uint32_t PwmRes;
+
     //@var Pack
     PlcDO_Pack_t Pack;
 
@@ -126,9 +204,20 @@ typedef struct PlcDO_t_
     //@var Safety value
     uint8_t SafeVal;
 
-    //@var Postponed normal value
-    //@note it's normal value from Beremiz
-    uint8_t PostponedVal;
+    //@var PTO: quantity of pulses
+    uint32_t PtoPulses;
+
+    //@var PTO: start frequency (Hz)
+    uint32_t PtoFreqStart;
+
+    //@var PTO: max. frequency (Hz)
+    uint32_t PtoFreqMax;
+
+    //@var PTO: acceleration (Hz/s)
+    uint32_t PtoAccel;
+
+    //@var PTO: profile type (PLC_PTO_PROFILE_...)
+    uint8_t PtoProfile;
 
 	//STATUSES
 
@@ -136,6 +225,15 @@ typedef struct PlcDO_t_
 	//@arg = 0..255
 	uint8_t Status;
 
+	//@var PWM achieved frequency (mHz)
+	uint32_t PwmFreqAct;
+
+	//@var PWM achieved resolution (quantity of steps per period, ARR+1)
+	uint32_t PwmResAct;
+
+	//@var PWM planner result (PLC_PWM_PLAN_...)
+	uint8_t PwmPlan;
+
 	//GPIO
 
 	//@var PORT
@@ -152,6 +250,10 @@ typedef struct PlcDO_t_
 
 	//OTHER
 
+	//@var PWM prescaler (16-bit register value, PSC)
+	//@note planned together with ARR
+	uint32_t Psc;
+
 	//@var PWM period (32-bit register value, ARR)
 	//@note must be recalculated after change PwmT
 	uint32_t Arr;
@@ -160,10 +262,16 @@ typedef struct PlcDO_t_
 	//@note must be recalculated after change PwmD
 	uint32_t Ccr;
 
-	//@var  Scale factors to convert PwmD (%) into 32-bit register value (CCR)
-	//@note must be recalculated after change PwmT
-	float Ka;
-	float Kb;
+	//@var PWM pulse (0.01 %, 0 ... PLC_DO_PWM_D__FULL)
+	//@note CCR is recalculated from it after change PwmT
+	uint32_t Duty;
+
+	//@var  Scale factors to convert Duty (0.01 %) into 32-bit register value (CCR)
+	//@note CCR = Duty*Ka + ((Duty*Kb) >> 16)
+	//      Ka - integer part, Kb - fraction (Q16) of (ARR+1)/PLC_DO_PWM_D__FULL
+	//      must be recalculated after change PwmT
+	uint32_t Ka;
+	uint32_t Kb;
 
 } PlcDO_t;
 
@@ -174,17 +282,26 @@ typedef struct PlcDO_t_
 #define PLC_DO_MODE_NORM                         (uint8_t)1  //normal
 #define PLC_DO_MODE_FAST                         (uint8_t)2  //fast
 #define PLC_DO_MODE_PWM                          (uint8_t)3  //PWM
+#define PLC_DO_MODE_PTO                          (uint8_t)5  //pulse train (4 is used by status SAFE)
 
 /** @def Settings by default
  */
 #define PLC_DO_MODE_DEF      	                 PLC_DI_MODE_OFF
 #define PLC_DO_PWM_T_DEF                         PLC_DO_PWM_T__1HZ
+#define PLC_DO_PWM_FREQ_DEF                      (uint32_t)0
+#define PLC_DO_PWM_T_NS_DEF                      (uint32_t)0
+#define PLC_DO_PWM_RES_DEF                       PLC_DO_PWM_D__FULL
 #define PLC_DO_PWM_D_DEF    		             PLC_DO_PWM_D__MIN
 #define PLC_DO_PWM_ALLOW_DEF           			 BIT_FALSE
 #define PLC_DO_NORM_VAL_DEF                 	 BIT_FALSE
 #define PLC_DO_FAST_VAL_DEF                 	 BIT_FALSE
 #define PLC_DO_SAFE_VAL_DEF                 	 BIT_FALSE
 #define PLC_DO_SAFE_ALLOW_DEF           		 BIT_FALSE
+#define PLC_DO_PTO_PULSES_DEF                    (uint32_t)1000
+#define PLC_DO_PTO_FREQ_START_DEF                (uint32_t)1000
+#define PLC_DO_PTO_FREQ_MAX_DEF                  (uint32_t)10000
+#define PLC_DO_PTO_ACCEL_DEF                     (uint32_t)10000
+#define PLC_DO_PTO_PROFILE_DEF                   PLC_PTO_PROFILE_TRAP
 
 /** @def Status codes
  */
@@ -194,6 +311,19 @@ typedef struct PlcDO_t_
 #define PLC_DO_STATUS_PWM_ON                     PLC_DO_MODE_PWM
 #define PLC_DO_STATUS_PWM_OFF                    (uint8_t)(PLC_DO_MODE_PWM*10)
 #define PLC_DO_STATUS_SAFE                       (uint8_t)4
+#define PLC_DO_STATUS_PTO_RUN                    PLC_DO_MODE_PTO
+#define PLC_DO_STATUS_PTO_OFF                    (uint8_t)(PLC_DO_MODE_PTO*10)
+#define PLC_DO_STATUS_PTO_ERR                    (uint8_t)(PLC_DO_MODE_PTO*10+1)  //invalid PTO settings
+
+
+/** @def Owners of forced output level (bit per owner)
+ *  @note Every owner keeps its own level, the output has the level of the owner
+ *        of the highest priority (the highest bit), so fail-safe outputs always win
+ *        and a level forced by compare-match is restored after reset of watchdogs.
+ */
+#define PLC_DO_FORCE_CMP                         (uint8_t)0x01  //DI counter compare-match (rtos-di.c)
+#define PLC_DO_FORCE_SFTY                        (uint8_t)0x02  //fail-safe outputs (sfty.c)
+#define PLC_DO_FORCE_TOP                         PLC_DO_FORCE_SFTY
 
 
 /** @def Queue item
@@ -219,17 +349,60 @@ typedef struct PlcDO_Q_t_
 #define PLC_DO_Q_ID_PWM_T        				(uint8_t)4   //PWM period (ms)
 #define PLC_DO_Q_ID_PWM_D       				(uint8_t)41  //PWM fill factor (%)
 #define PLC_DO_Q_ID_PWM_ALLOW       			(uint8_t)43  //PWM allow
+#define PLC_DO_Q_ID_PWM_FREQ       				(uint8_t)44  //PWM frequency (Hz)
+#define PLC_DO_Q_ID_PWM_T_NS       				(uint8_t)45  //PWM period (ns)
+#define PLC_DO_Q_ID_PWM_RES       				(uint8_t)46  //PWM resolution requested (steps)
+#define PLC_DO_Q_ID_PWM_FREQ_ACT       			(uint8_t)47  //PWM achieved frequency (Hz)
+#define PLC_DO_Q_ID_PWM_RES_ACT       			(uint8_t)48  //PWM achieved resolution (steps)
 #define PLC_DO_Q_ID_SAFE_VAL     				(uint8_t)5   //safety value
 #define PLC_DO_Q_ID_SAFE_ALLOW       			(uint8_t)51  //safety value allow
 #define PLC_DO_Q_ID_STATUS     					(uint8_t)6   //status
-#define PLC_DO_Q_ID_POSTPONED_VAL     			(uint8_t)7   //postponed normal value
-#define PLC_DO_Q_ID_POSTPONED_APPLY    			(uint8_t)71  //apply postponed normal value
+#define PLC_DO_Q_ID_CMP_HELD     				(uint8_t)9   //held by DI counter compare-match
+#define PLC_DO_Q_ID_IMG_APPLY    				(uint8_t)71  //apply output image of scan
+#define PLC_DO_Q_ID_IMG_LAT    					(uint8_t)72  //output image latency (us)
+#define PLC_DO_Q_ID_IMG_LAT_MAX    				(uint8_t)73  //output image latency max. (us)
+#define PLC_DO_Q_ID_PTO_PULSES     				(uint8_t)8   //PTO quantity of pulses
+#define PLC_DO_Q_ID_PTO_FREQ_START     			(uint8_t)81  //PTO start frequency (Hz)
+#define PLC_DO_Q_ID_PTO_FREQ_MAX     			(uint8_t)82  //PTO max. frequency (Hz)
+#define PLC_DO_Q_ID_PTO_ACCEL     				(uint8_t)83  //PTO acceleration (Hz/s)
+#define PLC_DO_Q_ID_PTO_PROFILE     			(uint8_t)84  //PTO profile type
+#define PLC_DO_Q_ID_PTO_START     				(uint8_t)85  //PTO start/stop
+#define PLC_DO_Q_ID_PTO_DONE     				(uint8_t)86  //PTO pulse train is done
+
+/** @typedef DO Callback user-functions
+ */
+typedef struct
+{
+    //@var PTO pulse train is done (called from ISR)
+    void (*PtoDone)(uint8_t ChIn);
 
-/** @var Postponed normal values (flag)
- *  @arg   = 0 - does not have postponed values
- *  @arg   = 1 - have postponed values
+} PLC_DO_UserFunc_t;
+
+/** @var DO Callback user-functions
+ */
+extern PLC_DO_UserFunc_t PLC_DO_USER_FUNC;
+
+/** @typedef Output image
+ *           (built by scan of application, applied by DO_T at once)
  */
-extern uint8_t PLC_DO_POSTPONED;
+typedef struct PlcDO_Img_t_
+{
+	//@var Normal values (bit per channel)
+	uint32_t Norm;
+
+	//@var Normal value is set (bit per channel)
+	uint32_t NormMask;
+
+	//@var PWM fill factor (%)
+	float Pwm[PLC_DO_SZ];
+
+	//@var PWM fill factor is set (bit per channel)
+	uint32_t PwmMask;
+
+	//@var End of scan (DWT.CYCCNT)
+	uint32_t Stamp;
+
+} PlcDO_Img_t;
 
 
 /** @brief  Init. DO.
@@ -244,6 +417,73 @@ void PlcDO_Init(PlcDO_t *DOIn);
  */
 void PlcDO_DeInit(PlcDO_t *DOIn);
 
+/** @brief  Init. output image.
+ *  @param  None.
+ *  @return None.
+ *  @note   DWT cycle counter is enabled (latency of output image).
+ */
+void PlcDO_ImgInit(void);
+
+/** @brief  Set normal value into output image (scan).
+ *  @param  ChIn - channel number.
+ *  @param  ValIn - normal value.
+ *  @return None.
+ */
+void PlcDO_ImgSetNorm(uint8_t ChIn, uint8_t ValIn);
+
+/** @brief  Set PWM fill factor into output image (scan).
+ *  @param  ChIn - channel number.
+ *  @param  PulseIn - fill factor (%).
+ *  @return None.
+ *  @note   Fill factor is limited as by PlcDO_CalcPulse().
+ */
+void PlcDO_ImgSetPwm(uint8_t ChIn, float PulseIn);
+
+/** @brief  Commit output image (end of scan).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - image is empty (no changes)
+ *  @arg    = 1 - image is ready to apply
+ *  @note   Only values that differ from the expected ones (PLC_DO_IMG_LAST) are committed,
+ *          image is merged with the previous one if it is not applied yet.
+ */
+uint8_t PlcDO_ImgCommit(void);
+
+/** @brief  Take committed output image.
+ *  @param  ImgOut - pointer to image (result).
+ *  @return Result:
+ *  @arg    = 0 - no image
+ *  @arg    = 1 - image is taken
+ */
+uint8_t PlcDO_ImgTake(PlcDO_Img_t *ImgOut);
+
+/** @brief  Synchronize values expected at output with the values applied by DO_T.
+ *  @param  ChIn - channel number.
+ *  @param  NormIn - normal value of channel.
+ *  @param  PwmIn - PWM fill factor of channel (%).
+ *  @return None.
+ *  @note   Values written not by scan (ModBus, mode change) are taken into account,
+ *          so the next value of scan that differs from them is committed.
+ *          Values of a committed image that is not taken yet are kept.
+ */
+void PlcDO_ImgSync(uint8_t ChIn, uint8_t NormIn, float PwmIn);
+
+/** @brief  Get latency of output image.
+ *  @param  ImgIn - pointer to image.
+ *  @return Time from the end of scan (us).
+ */
+uint32_t PlcDO_ImgLatency(const PlcDO_Img_t *ImgIn);
+
+/** @brief  Write pulses (CCR) of channels at once.
+ *  @param  DOIn - channels.
+ *  @param  MaskIn - channels to write (bit per channel).
+ *  @param  ImmMaskIn - channels to apply immediately (normal values).
+ *  @return None.
+ *  @note   CCR are prepared by PlcDO_CalcPulse().
+ *          Other channels (PWM) are applied by their update events.
+ */
+void PlcDO_Write(PlcDO_t *DOIn, uint32_t MaskIn, uint32_t ImmMaskIn);
+
 /** @brief  Start DO.
  *  @param  DOIn - channel.
  *  @return None.
@@ -260,10 +500,21 @@ void PlcDO_Stop(PlcDO_t *DOIn);
  *  @param  DOIn - channel.
  *  @param  PeriodIn - new period value (ms):
  *  @arg    = PLC_DO_PWM_T__MIN ... PLC_DO_PWM_T__MAX
- *  @return New period value (ms).
+ *  @return Achieved period value (ms).
  */
 float PlcDO_SetPeriod(PlcDO_t *DOIn, float PeriodIn);
 
+/** @brief  Plan prescaler and period of TIM.PWM by frequency or period.
+ *  @param  DOIn - channel (PwmRes - requested resolution).
+ *  @param  UnitIn - unit of request:
+ *  @arg    = PLC_PWM_PLAN_UNIT_HZ - frequency (Hz)
+ *  @arg    = PLC_PWM_PLAN_UNIT_NS - period (ns)
+ *  @param  ValIn - frequency (Hz) or period (ns).
+ *  @return Result code (PLC_PWM_PLAN_...).
+ *  @note   Achieved values: PwmT, PwmFreqAct, PwmResAct.
+ */
+uint8_t PlcDO_SetPlan(PlcDO_t *DOIn, uint8_t UnitIn, uint64_t ValIn);
+
 /** @brief  Set new pulse value (fill factor) into TIM.PWM.
  *  @param  DOIn - channel.
  *  @param  PulseIn - new pulse value (%):
@@ -272,6 +523,15 @@ float PlcDO_SetPeriod(PlcDO_t *DOIn, float PeriodIn);
  */
 float PlcDO_SetPulse(PlcDO_t *DOIn, float PulseIn);
 
+/** @brief  Calculate pulse value (CCR) without writing into TIM.PWM.
+ *  @param  DOIn - channel.
+ *  @param  PulseIn - new pulse value (%):
+ *  @arg    = PLC_DO_PWM_D__MIN ... PLC_DO_PWM_D__MAX
+ *  @return New pulse value (%).
+ *  @note   The value is written by PlcDO_Write().
+ */
+float PlcDO_CalcPulse(PlcDO_t *DOIn, float PulseIn);
+
 /** @brief  Set new normal value into TIM.PWM.
  *  @param  DOIn - channel.
  *  @param  ValIn - new normal value:
@@ -281,4 +541,46 @@ float PlcDO_SetPulse(PlcDO_t *DOIn, float PulseIn);
  */
 void PlcDO_SetNormVal(PlcDO_t *DOIn, uint8_t ValIn);
 
+/** @brief  Force output level of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @param  OwnerIn - source of forcing (PLC_DO_FORCE_...).
+ *  @param  ValIn - output level:
+ *  @arg    = 0 - low output level
+ *  @arg    = 1 - high output level
+ *  @return Result:
+ *  @arg    = 0 - level is held by an owner of higher priority (applied after its release)
+ *  @arg    = 1 - level is applied
+ */
+uint8_t PlcDO_ForceVal(uint8_t ChIn, uint8_t OwnerIn, uint8_t ValIn);
+
+/** @brief  Release forced output level of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @param  OwnerIn - source of forcing (PLC_DO_FORCE_...).
+ *  @return None.
+ *  @note   Level of the next owner is applied (or Norm/Fast/PWM value if no owner is left).
+ */
+void PlcDO_ReleaseVal(uint8_t ChIn, uint8_t OwnerIn);
+
+/** @brief  Get owners of forced output level of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @return Owners (bit per owner, PLC_DO_FORCE_...), 0 - output is not forced.
+ */
+uint8_t PlcDO_GetForce(uint8_t ChIn);
+
+/** @brief  Start pulse train (PTO).
+ *  @param  DOIn - channel (PTO settings).
+ *  @return Result code:
+ *  @arg    = PLC_PTO_OK
+ *  @arg    = PLC_PTO_ERR_...
+ *  @note   First pulse is delayed by 2 periods of PLC_TIM2_PERIOD__MIN.
+ *          PLC_DO_USER_FUNC.PtoDone() is called when the last pulse is queued.
+ */
+uint8_t PlcDO_PtoStart(PlcDO_t *DOIn);
+
+/** @brief  Stop pulse train (PTO) and return TIM to PWM settings of channel.
+ *  @param  DOIn - channel.
+ *  @return None.
+ */
+void PlcDO_PtoStop(PlcDO_t *DOIn);
+
 #endif //PLC_DO_H
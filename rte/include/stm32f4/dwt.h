@@ -0,0 +1,72 @@
+/* @page dwt.h
+ *       PLC411::RTE
+ *       DWT cycle counter driver
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        DWT.CYCCNT counts core clock cycles (SystemCoreClock = 100 MHz, 10 ns),
+ *        32-bit counter wraps every ~42.9 s,
+ *        difference of two readings is valid for intervals shorter than that.
+ *
+ *        64-bit clock (monotonic time base of application)
+ *        - CYCCNT is extended by a count of wraps (upper 32 bits),
+ *          a wrap is detected by any reading (CYCCNT < the previous one)
+ *        - PlcDwt_Tick() is called every SysTick (1 ms), so no wrap is missed
+ *        - nanoseconds wrap after ~584 years
+ */
+
+#ifndef PLC_DWT_H
+#define PLC_DWT_H
+
+#include "config.h"
+
+
+/** @brief  Init. (enable cycle counter).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcDwt_Init(void);
+
+/** @brief  Get cycle counter.
+ *  @param  None.
+ *  @return Value of DWT.CYCCNT (core clock cycles).
+ *  @note   May be called from ISR.
+ */
+uint32_t PlcDwt_GetCyc(void);
+
+/** @brief  Get 64-bit cycle counter.
+ *  @param  None.
+ *  @return Cycles since start.
+ *  @note   May be called from ISR.
+ */
+uint64_t PlcDwt_GetCyc64(void);
+
+/** @brief  Get 64-bit clock.
+ *  @param  None.
+ *  @return Nanoseconds since start (resolution is one cycle).
+ *  @note   May be called from ISR.
+ */
+uint64_t PlcDwt_GetNs(void);
+
+/** @brief  Tick of 64-bit clock (extension of counter).
+ *  @param  None.
+ *  @return None.
+ *  @note   Called by SysTick ISR.
+ */
+void PlcDwt_Tick(void);
+
+/** @brief  Convert cycles into microseconds.
+ *  @param  CycIn - cycles.
+ *  @return Microseconds.
+ */
+uint32_t PlcDwt_CycToUs(uint32_t CycIn);
+
+/** @brief  Convert microseconds into cycles.
+ *  @param  UsIn - microseconds.
+ *  @return Cycles (limited by 0xFFFFFFFF).
+ */
+uint32_t PlcDwt_UsToCyc(uint32_t UsIn);
+
+#endif //PLC_DWT_H
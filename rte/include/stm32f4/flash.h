@@ -0,0 +1,67 @@
+/* @page flash.h
+ *       PLC411::RTE
+ *       Flash driver (storage of retain-data journal)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Retain-data journal (see retain.h) takes sectors 1 and 2 (16K each),
+ *        they are excluded from RTE image in linker script (FLASH_RETAIN):
+ *        - sector 0      0x08000000 - vectors
+ *        - sectors 1, 2  0x08004000 - retain-data journal
+ *        - sectors 3 ... 0x0800C000 - RTE
+ *        - sectors 6, 7  0x08040000 - application
+ *
+ *        Flash has one bank, so CPU is stalled while a word is programmed
+ *        (~16 us) or a sector is erased (~0.25 ... 0.5 s).
+ *        Erasing is done before start of scheduler, while application is stopped
+ *        and once after a compaction between commits (PlcRetain_Prepare),
+ *        never by a commit (see retain.h).
+ *
+ *        Voltage range 2.7 ... 3.6 V (programming by words).
+ */
+
+#ifndef PLC_FLASH_H
+#define PLC_FLASH_H
+
+#include "config.h"
+#include "retain.h"
+
+
+#ifdef RTE_MOD_RETAIN
+
+/** @def Sectors of retain-data journal
+ */
+#define PLC_FLASH_RETAIN_SECT0                   FLASH_SECTOR_1
+#define PLC_FLASH_RETAIN_SECT1                   FLASH_SECTOR_2
+#define PLC_FLASH_RETAIN_ADDR0                   (uint32_t)0x08004000
+#define PLC_FLASH_RETAIN_ADDR1                   (uint32_t)0x08008000
+
+
+/** @var Storage of retain-data journal
+ */
+extern const PlcRetain_Port_t PlcFlash_RetainPort;
+
+
+/** @brief  Erase sector.
+ *  @param  SectorIn - sector (FLASH_SECTOR_...).
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcFlash_Erase(uint32_t SectorIn);
+
+/** @brief  Program words.
+ *  @param  AddrIn - address (aligned to word, erased before).
+ *  @param  DataIn - pointer to words.
+ *  @param  WordsIn - number of words.
+ *  @return Result:
+ *  @arg    = 0 - error (or words are not read back)
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcFlash_Write(uint32_t AddrIn, const uint32_t *DataIn, uint32_t WordsIn);
+
+#endif //RTE_MOD_RETAIN
+
+#endif //PLC_FLASH_H
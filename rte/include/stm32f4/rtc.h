@@ -0,0 +1,80 @@
+/* @page rtc.h
+ *       PLC411::RTE
+ *       RTC driver (calendar of wall clock)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        RTC is clocked by LSE (32.768 kHz),
+ *        LSI (~32 kHz, low accuracy) is used if LSE does not start.
+ *        - .PREDIV_A = 127
+ *        - .PREDIV_S = 255 (LSE), 249 (LSI); resolution of subseconds is 1/(PREDIV_S+1) s
+ *
+ *        RTC is in backup domain and keeps running over reset of MCU
+ *        (and power loss with VBAT), it is inited only once:
+ *        backup register PLC_RTC_BKP holds PLC_RTC_MAGIC after init.
+ *
+ *        Registers of RTC are accessed directly (without HAL_RTC),
+ *        calendar is read via shadow registers (SSR locks TR and DR until DR is read).
+ *        Reading takes a few microseconds, so RTC is not read by every scan
+ *        (see plc_rtc.h).
+ */
+
+#ifndef PLC_RTC_H
+#define PLC_RTC_H
+
+#include "config.h"
+#include "dt.h"
+#include "dwt.h"
+
+
+#ifdef RTE_MOD_RTC
+
+/** @def Backup register of RTC status
+ */
+#define PLC_RTC_BKP                              (RTC->BKP0R)
+#define PLC_RTC_MAGIC                            (uint32_t)0x52544330  //"RTC0"
+
+/** @def Prescalers
+ */
+#define PLC_RTC_PREDIV_A                         (uint32_t)127
+#define PLC_RTC_PREDIV_S_LSE                     (uint32_t)255
+#define PLC_RTC_PREDIV_S_LSI                     (uint32_t)249
+
+/** @def Timeouts (us)
+ */
+#define PLC_RTC_LSE_TM                           (uint32_t)2000000  //start of LSE
+#define PLC_RTC_TM                               (uint32_t)10000    //init. mode, synchronization
+
+
+/** @brief  Init. RTC.
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - RTC is not running
+ *  @arg    = 1 - OK
+ *  @note   Called before start of scheduler (start of LSE is waited by DWT).
+ */
+uint8_t PlcRtc_Init(void);
+
+/** @brief  Set date and time.
+ *  @param  DtIn - pointer to date and time (valid, see PlcDt_IsValid).
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ *  @note   Subseconds are reset (the new second starts now).
+ */
+uint8_t PlcRtc_Set(const PlcDt_t *DtIn);
+
+/** @brief  Get date and time.
+ *  @param  DtOut - pointer to date and time.
+ *  @param  NsOut - pointer to nanoseconds of the current second (or NULL).
+ *  @return Result:
+ *  @arg    = 0 - RTC is not running (or not set)
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcRtc_Get(PlcDt_t *DtOut, uint32_t *NsOut);
+
+#endif //RTE_MOD_RTC
+
+#endif //PLC_RTC_H
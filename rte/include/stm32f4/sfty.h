@@ -0,0 +1,135 @@
+/* @page sfty.h
+ *       PLC411::RTE
+ *       Fail-safe outputs (scan and comms watchdogs)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Watchdogs are counted by SysTick ISR (1 ms), so they do not depend
+ *        on scheduling of APP_T, DO_T or DATA_T:
+ *
+ *        - PLC_SFTY_WD_SCAN (SYS_SET.SFTY_TIM_TM):
+ *          kicked by APP_T at the end of every scan
+ *          (expires if the scan stalls or the application is stopped)
+ *
+ *        - PLC_SFTY_WD_COMM (SYS_SET.WD_TIM_TM):
+ *          kicked by COM2_T on every valid ModBus request
+ *          (expires if the master is lost)
+ *
+ *        On expiry every DO with Safe.Allow is forced to Safe.Value
+ *        (TIMx.CCMRx.OCxM = forced level) directly from ISR.
+ *        Safe value is the owner of the highest priority (PLC_DO_FORCE_SFTY),
+ *        so other sources of forcing (counter compare-match) can not change the output
+ *        while a watchdog is expired.
+ *        Expiry is latched until reset (SYS_CMD.SFTY_TIM_RST, SYS_CMD.WD_TIM_RST),
+ *        forced outputs are released when no watchdog is expired
+ *        (level of compare-match is restored if it is still latched).
+ *
+ *        Time = 0 - watchdog is off.
+ *
+ *        Fault of application (corrupted image) forces safe outputs at once
+ *        by PlcSfty_Trip regardless of watchdogs, it is latched until restart
+ *        (not released by reset of watchdogs).
+ */
+
+#ifndef PLC_SFTY_H
+#define PLC_SFTY_H
+
+#include "config.h"
+#include "do.h"
+
+
+#ifdef RTE_MOD_DO
+
+/** @def Watchdogs
+ */
+#define PLC_SFTY_WD_SCAN                         (uint8_t)0  //scan
+#define PLC_SFTY_WD_COMM                         (uint8_t)1  //comms (ModBus)
+//quantity
+#define PLC_SFTY_WD_SZ                           (uint8_t)(PLC_SFTY_WD_COMM+1)
+
+/** @def Max. time of watchdog (ms)
+ */
+#define PLC_SFTY_TM_MAX                          (uint32_t)65535
+
+
+/** @typedef Watchdog
+ */
+typedef struct PlcSfty_Wd_t_
+{
+	//@var Time (ms)
+	//@arg = 0 - off
+	volatile uint32_t Tm;
+
+	//@var Time left (ms)
+	volatile uint32_t Left;
+
+	//@var Expired (latched)
+	volatile uint8_t Cplt;
+
+} PlcSfty_Wd_t;
+
+
+/** @brief  Init. fail-safe outputs.
+ *  @param  None.
+ *  @return None.
+ */
+void PlcSfty_Init(void);
+
+/** @brief  Set time of watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @param  TmIn - time (ms):
+ *  @arg    = 0 - off
+ *  @arg    = 1 ... PLC_SFTY_TM_MAX
+ *  @return None.
+ */
+void PlcSfty_SetTm(uint8_t WdIn, uint32_t TmIn);
+
+/** @brief  Kick watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @return None.
+ */
+void PlcSfty_Kick(uint8_t WdIn);
+
+/** @brief  Reset expired watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @return None.
+ *  @note   Forced outputs are released if no watchdog is expired.
+ */
+void PlcSfty_Reset(uint8_t WdIn);
+
+/** @brief  Force safe outputs by fault of application.
+ *  @param  None.
+ *  @return None.
+ *  @note   Latched until PlcSfty_Init (restart), watchdogs are not changed.
+ */
+void PlcSfty_Trip(void);
+
+/** @brief  Get status of watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @return Result:
+ *  @arg    = 0 - not expired (or off)
+ *  @arg    = 1 - expired
+ */
+uint8_t PlcSfty_IsCplt(uint8_t WdIn);
+
+/** @brief  Set safe output of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @param  AllowIn - Safe.Allow.
+ *  @param  ValIn - Safe.Value.
+ *  @return None.
+ *  @note   Applied immediately if a watchdog is expired.
+ */
+void PlcSfty_SetOut(uint8_t ChIn, uint8_t AllowIn, uint8_t ValIn);
+
+/** @brief  Count watchdogs.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called from SysTick ISR (1 ms).
+ */
+void PlcSfty_Tick(void);
+
+#endif //RTE_MOD_DO
+
+#endif //PLC_SFTY_H
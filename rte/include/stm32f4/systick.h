@@ -11,6 +11,8 @@
  *
  *        HAL.Tick
  *        RTOS.Tick
+ *        Fail-safe outputs (watchdogs)
+ *        64-bit clock (extension of DWT.CYCCNT)
  */
 
 #ifndef PLC_SYSTICK_H
@@ -18,6 +20,17 @@
 
 #include "config.h"
 #include "rtos.h"
+#include "sfty.h"
+#include "dwt.h"
+
+
+/** @brief  Get timestamp (us).
+ *  @param  None.
+ *  @return Timestamp (us), wraps every 2^32 us.
+ *  @note   HAL.Tick + fraction of the current SysTick period,
+ *          may be called from ISR.
+ */
+uint32_t PlcSysTick_GetUs(void);
 
 
 #endif //PLC_SYSTICK_H
@@ -25,11 +25,13 @@ typedef struct
  */
 extern TIM_HandleTypeDef PLC_TIM2;
 extern TIM_HandleTypeDef PLC_TIM5;
+extern TIM_HandleTypeDef PLC_TIM4;
 
 /** @var TIM Callback user-functions
  */
 extern PLC_TIM_UserFunc_t PLC_TIM2_USER_FUNC;
 extern PLC_TIM_UserFunc_t PLC_TIM5_USER_FUNC;
+extern PLC_TIM_UserFunc_t PLC_TIM4_USER_FUNC;
 
 
 /** @brief  Start TIM.Channel.
@@ -65,6 +67,39 @@ void PlcTim_SetChannelPeriod(TIM_HandleTypeDef *TimIn, uint32_t PeriodIn);
  */
 void PlcTim_SetChannelPulse(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint32_t PulseIn);
 
+/** @brief  Set prescaler, period and pulse together.
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  PrescalerIn - new value of prescaler (PSC, 16 bit).
+ *  @param  PeriodIn - new value of period (ARR).
+ *  @param  PulseIn - new value of pulse (CCR).
+ *  @return None.
+ *  @note   Update event is held off while the registers are written,
+ *          so with preload on (PlcTim_SetPreload) the set is applied by the same update event
+ *          (PSC is always preloaded).
+ */
+void PlcTim_SetChannelPwm(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint32_t PrescalerIn, uint32_t PeriodIn, uint32_t PulseIn);
+
+/** @brief  Force output level of TIM.Channel.
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  LevelIn - output level:
+ *  @arg    = 0 - low (forced inactive)
+ *  @arg    = 1 - high (forced active)
+ *  @return None.
+ */
+void PlcTim_ForceChannelOutput(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint8_t LevelIn);
+
+/** @brief  Release forced output level of TIM.Channel (return to PWM mode).
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @return None.
+ */
+void PlcTim_ReleaseChannelOutput(TIM_HandleTypeDef *TimIn, uint32_t TimChIn);
+
 /** @brief  Start TIM.
  *  @param  TimIn - pointer to handle.
  *  @return None.
@@ -90,4 +125,31 @@ void PlcTim_SetCnt(TIM_HandleTypeDef *TimIn, uint32_t CntIn);
  */
 void PlcTim_RstCnt(TIM_HandleTypeDef *TimIn);
 
+/** @brief  Enable/disable preload of period (ARR) and pulse (CCR).
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  EnIn - preload:
+ *  @arg    = 0 - off (new values are applied immediately)
+ *  @arg    = 1 - on  (new values are applied on update event)
+ *  @return None.
+ */
+void PlcTim_SetPreload(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint8_t EnIn);
+
+/** @brief  Generate update event (reload ARR, CCR and reset counter).
+ *  @param  TimIn - pointer to handle.
+ *  @return None.
+ */
+void PlcTim_GenUpdate(TIM_HandleTypeDef *TimIn);
+
+/** @brief  Set DMA-burst on update event.
+ *  @param  TimIn - pointer to handle.
+ *  @param  LenIn - quantity of registers from ARR:
+ *  @arg    = 0    - DMA-request is off
+ *  @arg    = 1..4 - ARR, RCR, CCR1, CCR2
+ *  @return None.
+ *  @note   Safe to call from ISR.
+ */
+void PlcTim_SetUpdateBurst(TIM_HandleTypeDef *TimIn, uint8_t LenIn);
+
 #endif //PLC_TIM_H
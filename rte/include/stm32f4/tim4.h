@@ -0,0 +1,91 @@
+/* @page tim4.h
+ *       PLC411::RTE
+ *       TIM4 driver (scan timer of application)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *
+ *        TIM4.UP -> TIM4_IRQ -> PLC_TIM4_USER_FUNC.Elapsed (scan release of APP_T)
+ *
+ *        TIM settings
+ *        - .FREQ.BUS = 100 MHz (1 bus-tick is 10 ns)
+ *        - .PSC      = P       (16 bit)
+ *        - .ARR      = T       (16 bit)
+ *           P and T are planned by requested period (ns, pwm-plan.h),
+ *           period = PLC_TIM4_PERIOD_NS__MIN ... ~42.9 s
+ *
+ *        Counter is free-running (auto-reload), so the release of every scan
+ *        is an absolute deadline (period does not drift by execution time of scan).
+ *        The first update event may be set earlier than one period after start
+ *        (counter is preloaded).
+ */
+
+#ifndef PLC_TIM4_H
+#define PLC_TIM4_H
+
+#include "tim.h"
+#include "pwm-plan.h"
+
+
+#ifdef RTE_MOD_APP_TIM
+
+/** @def TIM clock (before prescaler)
+ */
+#define PLC_TIM4_CLK_HZ                          (uint32_t)PLC_APB1_TCLK_FREQ
+
+/** #def TIM prescaler
+ */
+// (.PSC)
+#define PLC_TIM4_PRESCALER__MAX                  (uint32_t)0xFFFF
+
+/** @def TIM period (quantity of ticks to reload)
+ */
+// (.ARR)
+#define PLC_TIM4_PERIOD__MIN                     (uint32_t)(100-1)
+#define PLC_TIM4_PERIOD__MAX                     (uint32_t)0xFFFF
+
+/** @def Limits of period (ns)
+ */
+#define PLC_TIM4_PERIOD_NS__MIN                  (uint64_t)100000  //100 us
+
+/** @def Timer limits of planner
+ */
+#define PLC_TIM4_PLAN_TIM                        { PLC_TIM4_CLK_HZ, PLC_TIM4_PRESCALER__MAX, PLC_TIM4_PERIOD__MIN, PLC_TIM4_PERIOD__MAX }
+
+
+/** @brief  Init. TIM4
+ *  @param  None.
+ *  @return None.
+ */
+void PlcTim4_Init(void);
+
+/** @brief  DeInit. TIM4
+ *  @param  None.
+ *  @return None.
+ */
+void PlcTim4_DeInit(void);
+
+/** @brief  Start TIM4.
+ *  @param  PeriodNsIn - period (ns, limited by PLC_TIM4_PERIOD_NS__MIN).
+ *  @param  FirstNsIn - delay of the first update event (ns, 0 or >= period - one period).
+ *  @return Period of plan (ns) or 0 (invalid period).
+ */
+uint64_t PlcTim4_Start(uint64_t PeriodNsIn, uint64_t FirstNsIn);
+
+/** @brief  Stop TIM4.
+ *  @param  None.
+ *  @return None.
+ */
+void PlcTim4_Stop(void);
+
+/** @brief  Get time since the latest update event.
+ *  @param  None.
+ *  @return Time (us).
+ */
+uint32_t PlcTim4_GetElapsedUs(void);
+
+#endif //RTE_MOD_APP_TIM
+
+#endif //PLC_TIM4_H
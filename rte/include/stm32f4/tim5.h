@@ -7,11 +7,13 @@
 
 /** @note
  *
- *        PA1 <- TIM5.CH2.PWM <- DO.1 <- DMA1.STR4.CH6 (MemToPeriph) <- [.PSC, .ARR]
+ *        PA1 <- TIM5.CH2.PWM <- DO.1 <- DMA1.STR0.CH6 (TIM5.UP, MemToPeriph) <- [.ARR, .RCR, .CCR1, .CCR2] (PTO)
  *
  *        TIM settings
  *        - .FREQ.BUS = 100 MHz (1 bus-tick is 10 ns)
- *        - .PSC      = 100     (16 bit, 1 TIM-tick is 1000000 Hz)
+ *        - .PSC      = P       (16 bit)
+ *           PWM: P is planned with T by requested frequency/period (pwm-plan.h)
+ *           PTO: P = 100 (1 TIM-tick is 1000000 Hz)
  *        - .RCR      = 0       (8  bit)
  *        - .ARR      = T       (32 bit)
  *           where T is period  (10 ... 1000000000)
@@ -37,9 +39,14 @@
 #define PLC_TIM5_HZ                              (uint32_t)1000000  //Hz
 #define PLC_TIM5_MS                              (float)0.001       //ms
 
+/** @def TIM clock (before prescaler)
+ */
+#define PLC_TIM5_CLK_HZ                          (uint32_t)PLC_APB1_TCLK_FREQ
+
 /** #def TIM prescaler
  */
 // (.PSC)
+#define PLC_TIM5_PRESCALER__MAX                  (uint32_t)0xFFFF
 #define PLC_TIM5_PRESCALER                       (uint32_t)((PLC_APB1_TCLK_FREQ/PLC_TIM5_HZ)-1)	 //100 counts for 1 TIM-tick
 
 /** @def TIM period (quantity of ticks to reload)
@@ -51,8 +58,17 @@
 #define PLC_TIM5_PERIOD__MAX                     (uint32_t)(1000000000-1)
 
 /** @def Use DMA
+ *       update event -> DMA-burst (PTO)
+ */
+#define PLC_TIM5_DMA
+
+#ifdef PLC_TIM5_DMA
+
+/** @var TIM5.UP.DMA Handler
  */
-//#define PLC_TIM5_DMA
+extern DMA_HandleTypeDef PLC_TIM5_UP_DMA;
+
+#endif //PLC_TIM5_DMA
 
 
 /** @brief  Init. TIM5
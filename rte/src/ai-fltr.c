@@ -0,0 +1,167 @@
+/* @page ai-fltr.c
+ *       AI streaming filters (moving average, IIR, median)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "ai-fltr.h"
+
+
+/** @def Microseconds per millisecond
+ */
+#define PLC_AI_FLTR_US_PER_MS                    (uint32_t)1000
+
+
+/** @brief  Median of ring buffer.
+ *  @param  FltrIn - pointer to filter.
+ *  @return Median (ADC-code).
+ *  @note   Insertion sort of a copy (window is small).
+ */
+static uint16_t PlcAI_Fltr_Median(const PlcAI_Fltr_t *FltrIn)
+{
+	uint16_t Sort[PLC_AI_FLTR_MED_SZ__MAX];
+	uint16_t i, j, V;
+
+	for(i=0; i<FltrIn->Cnt; i++)
+	{
+		V = FltrIn->Buff[i];
+		for(j=i; j>0 && Sort[j-1] > V; j--) Sort[j] = Sort[j-1];
+		Sort[j] = V;
+	}
+
+	//even quantity (window is not full): average of two middle values
+	if(!(FltrIn->Cnt & 1)) return ((uint16_t)(((uint32_t)Sort[FltrIn->Cnt/2-1] + Sort[FltrIn->Cnt/2] + 1)/2));
+	return (Sort[FltrIn->Cnt/2]);
+}
+
+
+/** @brief  Set filter.
+ *  @param  FltrIn - pointer to filter.
+ *  @param  TypeIn - type (PLC_AI_FLTR_...).
+ *  @param  PrmIn - parameter (limited by type).
+ *  @param  TsIn - sample period (us).
+ *  @return Result:
+ *  @arg    = 0 - unknown type (filter is off)
+ *  @arg    = 1 - OK
+ *  @note   Filter is reset.
+ */
+uint8_t PlcAI_Fltr_Set(PlcAI_Fltr_t *FltrIn, uint8_t TypeIn, uint16_t PrmIn, uint32_t TsIn)
+{
+	uint64_t Tau;
+	uint8_t  Res = BIT_TRUE;
+
+	if(!FltrIn) return (BIT_FALSE);
+
+	FltrIn->Type = TypeIn;
+	FltrIn->Sz   = 1;
+	FltrIn->K    = ((uint32_t)1 << PLC_AI_FLTR_K_Q);
+
+	switch(TypeIn)
+	{
+		case PLC_AI_FLTR_OFF:
+			break;
+
+		case PLC_AI_FLTR_MA:
+			if(PrmIn < 1)                      PrmIn = 1;
+			if(PrmIn > PLC_AI_FLTR_MA_SZ__MAX) PrmIn = PLC_AI_FLTR_MA_SZ__MAX;
+			FltrIn->Sz = PrmIn;
+			break;
+
+		case PLC_AI_FLTR_IIR:
+			if(PrmIn < 1)                        PrmIn = 1;
+			if(PrmIn > PLC_AI_FLTR_IIR_TAU__MAX) PrmIn = PLC_AI_FLTR_IIR_TAU__MAX;
+			if(!TsIn)                            TsIn  = 1;
+			//K = Ts/(Tau+Ts)
+			Tau = (uint64_t)PrmIn*PLC_AI_FLTR_US_PER_MS + TsIn;
+			FltrIn->K = (uint32_t)((((uint64_t)TsIn << PLC_AI_FLTR_K_Q) + Tau/2)/Tau);
+			if(!FltrIn->K) FltrIn->K = 1;
+			break;
+
+		case PLC_AI_FLTR_MED:
+			if(PrmIn < PLC_AI_FLTR_MED_SZ__MIN) PrmIn = PLC_AI_FLTR_MED_SZ__MIN;
+			if(PrmIn > PLC_AI_FLTR_MED_SZ__MAX) PrmIn = PLC_AI_FLTR_MED_SZ__MAX;
+			FltrIn->Sz = (PrmIn | 1);
+			break;
+
+		default:
+			FltrIn->Type = PLC_AI_FLTR_OFF;
+			Res = BIT_FALSE;
+			break;
+	}
+
+	PlcAI_Fltr_Reset(FltrIn);
+	return (Res);
+}
+
+/** @brief  Reset state of filter.
+ *  @param  FltrIn - pointer to filter.
+ *  @return None.
+ */
+void PlcAI_Fltr_Reset(PlcAI_Fltr_t *FltrIn)
+{
+	if(FltrIn)
+	{
+		FltrIn->iBuff = 0;
+		FltrIn->Cnt   = 0;
+		FltrIn->Sum   = 0;
+		FltrIn->Y     = 0;
+		FltrIn->Out   = 0;
+	}
+}
+
+/** @brief  Feed filter by a value.
+ *  @param  FltrIn - pointer to filter.
+ *  @param  ValIn - value (ADC-code).
+ *  @return Output (ADC-code).
+ */
+uint16_t PlcAI_Fltr_Put(PlcAI_Fltr_t *FltrIn, uint16_t ValIn)
+{
+	int64_t X;
+
+	if(!FltrIn) return (ValIn);
+
+	switch(FltrIn->Type)
+	{
+		case PLC_AI_FLTR_MA:
+			//drop the oldest value if window is full
+			if(FltrIn->Cnt < FltrIn->Sz) FltrIn->Cnt++;
+			else                         FltrIn->Sum -= FltrIn->Buff[FltrIn->iBuff];
+
+			FltrIn->Buff[FltrIn->iBuff] = ValIn;
+			FltrIn->Sum += ValIn;
+			if(++FltrIn->iBuff >= FltrIn->Sz) FltrIn->iBuff = 0;
+
+			FltrIn->Out = (uint16_t)((FltrIn->Sum + FltrIn->Cnt/2)/FltrIn->Cnt);
+			break;
+
+		case PLC_AI_FLTR_IIR:
+			X = ((int64_t)ValIn << PLC_AI_FLTR_Y_Q);
+			if(!FltrIn->Cnt)
+			{
+				FltrIn->Y   = X;
+				FltrIn->Cnt = 1;
+			}
+			else
+			{
+				FltrIn->Y += (((X - FltrIn->Y)*FltrIn->K + ((int64_t)1 << (PLC_AI_FLTR_K_Q-1))) >> PLC_AI_FLTR_K_Q);
+			}
+
+			FltrIn->Out = (uint16_t)((FltrIn->Y + ((int64_t)1 << (PLC_AI_FLTR_Y_Q-1))) >> PLC_AI_FLTR_Y_Q);
+			break;
+
+		case PLC_AI_FLTR_MED:
+			if(FltrIn->Cnt < FltrIn->Sz) FltrIn->Cnt++;
+
+			FltrIn->Buff[FltrIn->iBuff] = ValIn;
+			if(++FltrIn->iBuff >= FltrIn->Sz) FltrIn->iBuff = 0;
+
+			FltrIn->Out = PlcAI_Fltr_Median(FltrIn);
+			break;
+
+		default:
+			FltrIn->Out = ValIn;
+			break;
+	}
+
+	return (FltrIn->Out);
+}
@@ -0,0 +1,200 @@
+/* @page ai-lin.c
+ *       AI linearization (piecewise-linear table, polynomial)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "ai-lin.h"
+#include <math.h>
+
+
+/** @def One in fixed point
+ */
+#define PLC_AI_LIN_ONE                           ((int32_t)1 << PLC_AI_LIN_Q)
+#define PLC_AI_LIN_U_ONE                         ((int64_t)1 << PLC_AI_LIN_U_Q)
+
+
+/** @brief  Convert value into fixed point.
+ *  @param  ValIn - value.
+ *  @param  ResOut - pointer to value (Q16).
+ *  @return Result:
+ *  @arg    = 0 - out of range (or NaN)
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcAI_Lin_ToQ(float ValIn, int32_t *ResOut)
+{
+	//NaN fails both comparisons
+	if(!(ValIn > -PLC_AI_LIN_VAL__MAX && ValIn < PLC_AI_LIN_VAL__MAX)) return (BIT_FALSE);
+
+	//scaling by 2^16 is exact, +/-0.5 is not (float step of |Val| >= 128 is 1 LSB of Q16 or more)
+	*ResOut = (int32_t)lroundf(ValIn*(float)PLC_AI_LIN_ONE);
+	return (BIT_TRUE);
+}
+
+/** @brief  Calculate output by table.
+ *  @param  LinIn - pointer to linearization.
+ *  @param  XIn - input (Q16).
+ *  @return Output (Q16).
+ */
+static int32_t PlcAI_Lin_CalcTbl(const PlcAI_Lin_t *LinIn, int32_t XIn)
+{
+	uint8_t Lo, Hi, Mid;
+	int32_t Dx;
+
+	if(XIn <= LinIn->X[0])           return (LinIn->Y[0]);
+	if(XIn >= LinIn->X[LinIn->Sz-1]) return (LinIn->Y[LinIn->Sz-1]);
+
+	if(LinIn->Step)
+	{
+		//uniform step: direct index
+		Lo = (uint8_t)(((int64_t)XIn - LinIn->X[0])/LinIn->Step);
+		if(Lo > LinIn->Sz-2) Lo = LinIn->Sz-2;
+
+		//rounding of points
+		if(XIn < LinIn->X[Lo])                                  Lo--;
+		else if(Lo < LinIn->Sz-2 && XIn >= LinIn->X[Lo+1]) Lo++;
+	}
+	else
+	{
+		//X[Lo] <= XIn < X[Hi]
+		Lo = 0;
+		Hi = LinIn->Sz-1;
+		while(Hi-Lo > 1)
+		{
+			Mid = (uint8_t)((Lo+Hi)/2);
+			if(XIn < LinIn->X[Mid]) Hi = Mid;
+			else                    Lo = Mid;
+		}
+	}
+
+	Dx = LinIn->X[Lo+1] - LinIn->X[Lo];
+	return ((int32_t)(LinIn->Y[Lo] + (((int64_t)LinIn->Y[Lo+1] - LinIn->Y[Lo])*((int64_t)XIn - LinIn->X[Lo]))/Dx));
+}
+
+/** @brief  Calculate output by polynomial.
+ *  @param  LinIn - pointer to linearization.
+ *  @param  XIn - input (Q16).
+ *  @return Output (Q16).
+ *  @note   Horner scheme, U is Q30 (0 ... 1).
+ */
+static int32_t PlcAI_Lin_CalcPoly(const PlcAI_Lin_t *LinIn, int32_t XIn)
+{
+	int64_t U, Y;
+
+	if(XIn < LinIn->X[0]) XIn = LinIn->X[0];
+	if(XIn > LinIn->X[1]) XIn = LinIn->X[1];
+
+	//U = (X-Xmin)/(Xmax-Xmin)
+	U = ((((int64_t)XIn - LinIn->X[0]) << PLC_AI_LIN_U_Q) + ((int64_t)LinIn->X[1] - LinIn->X[0])/2)/((int64_t)LinIn->X[1] - LinIn->X[0]);
+
+	Y = LinIn->Y[LinIn->Sz-1];
+	for(int8_t i=(int8_t)LinIn->Sz-2; i>=0; i--)
+	{
+		Y = ((Y*U + (PLC_AI_LIN_U_ONE >> 1)) >> PLC_AI_LIN_U_Q) + LinIn->Y[i];
+
+		//|Y*U| < 2^62
+		if(Y > INT32_MAX) Y = INT32_MAX;
+		if(Y < INT32_MIN) Y = INT32_MIN;
+	}
+	return ((int32_t)Y);
+}
+
+
+/** @brief  Set linearization.
+ *  @param  LinIn - pointer to linearization.
+ *  @param  TypeIn - type (PLC_AI_LIN_...).
+ *  @param  SzIn - quantity of points (TBL) or coefficients (POLY).
+ *  @param  TblIn - table [PLC_AI_LIN_TBL_SZ].
+ *  @return Result:
+ *  @arg    = 0 - invalid type or table (linearization is off)
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcAI_Lin_Set(PlcAI_Lin_t *LinIn, uint8_t TypeIn, uint8_t SzIn, const float *TblIn)
+{
+	uint8_t Res = BIT_TRUE;
+	uint8_t i;
+
+	if(!LinIn) return (BIT_FALSE);
+
+	LinIn->Type = PLC_AI_LIN_OFF;
+	LinIn->Sz   = 0;
+	LinIn->Step = 0;
+
+	switch(TypeIn)
+	{
+		case PLC_AI_LIN_OFF:
+			break;
+
+		case PLC_AI_LIN_TBL:
+			if(!TblIn || SzIn < 2 || SzIn > PLC_AI_LIN_PTS__MAX) return (BIT_FALSE);
+
+			for(i=0; i<SzIn && Res; i++)
+			{
+				Res = (PlcAI_Lin_ToQ(TblIn[2*i], &LinIn->X[i]) && PlcAI_Lin_ToQ(TblIn[2*i+1], &LinIn->Y[i]));
+				if(Res && i && LinIn->X[i] <= LinIn->X[i-1]) Res = BIT_FALSE;
+			}
+			if(!Res) return (BIT_FALSE);
+
+			//uniform step (1 LSB tolerance of rounding)
+			LinIn->Step = LinIn->X[1] - LinIn->X[0];
+			for(i=2; i<SzIn; i++)
+			{
+				int32_t D = (LinIn->X[i] - LinIn->X[i-1]) - LinIn->Step;
+				if(D > 1 || D < -1)
+				{
+					LinIn->Step = 0;
+					break;
+				}
+			}
+			break;
+
+		case PLC_AI_LIN_POLY:
+			if(!TblIn || SzIn < 1 || SzIn > PLC_AI_LIN_POLY__MAX) return (BIT_FALSE);
+
+			if(!PlcAI_Lin_ToQ(TblIn[0], &LinIn->X[0]) || !PlcAI_Lin_ToQ(TblIn[1], &LinIn->X[1]) || LinIn->X[1] <= LinIn->X[0]) return (BIT_FALSE);
+			for(i=0; i<SzIn; i++)
+			{
+				if(!PlcAI_Lin_ToQ(TblIn[2+i], &LinIn->Y[i])) return (BIT_FALSE);
+			}
+			break;
+
+		default:
+			return (BIT_FALSE);
+	}
+
+	LinIn->Sz   = SzIn;
+	LinIn->Type = TypeIn;
+	return (BIT_TRUE);
+}
+
+/** @brief  Calculate output (fixed point).
+ *  @param  LinIn - pointer to linearization.
+ *  @param  XIn - input (Q16).
+ *  @return Output (Q16).
+ */
+int32_t PlcAI_Lin_Calc(const PlcAI_Lin_t *LinIn, int32_t XIn)
+{
+	if(LinIn)
+	{
+		if(LinIn->Type == PLC_AI_LIN_TBL)  return (PlcAI_Lin_CalcTbl(LinIn, XIn));
+		if(LinIn->Type == PLC_AI_LIN_POLY) return (PlcAI_Lin_CalcPoly(LinIn, XIn));
+	}
+	return (XIn);
+}
+
+/** @brief  Calculate output.
+ *  @param  LinIn - pointer to linearization.
+ *  @param  XIn - input.
+ *  @return Output.
+ */
+float PlcAI_Lin_Put(const PlcAI_Lin_t *LinIn, float XIn)
+{
+	int32_t X;
+
+	if(!LinIn || LinIn->Type == PLC_AI_LIN_OFF) return (XIn);
+
+	//input is limited by range of fixed point
+	if(!PlcAI_Lin_ToQ(XIn, &X)) X = ((XIn < 0.0f) ? -(int32_t)(PLC_AI_LIN_VAL__MAX*PLC_AI_LIN_ONE) : (int32_t)(PLC_AI_LIN_VAL__MAX*PLC_AI_LIN_ONE));
+
+	return ((float)PlcAI_Lin_Calc(LinIn, X)/(float)PLC_AI_LIN_ONE);
+}
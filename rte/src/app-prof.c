@@ -0,0 +1,132 @@
+/* @page app-prof.c
+ *       Scan-time profiler of application (min/max/avg, histogram)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "app-prof.h"
+
+
+/** @def No scans (min.)
+ */
+#define PLC_APP_PROF_MIN_NONE                    (uint32_t)0xFFFFFFFF
+
+
+/** @brief  Reset profiler.
+ *  @param  ProfIn - pointer to profiler.
+ *  @return None.
+ */
+void PlcAppProf_Reset(PlcAppProf_t *ProfIn)
+{
+	uint8_t i;
+
+	if(ProfIn)
+	{
+		for(i=0; i<PLC_APP_PROF_SZ; i++)
+		{
+			ProfIn->Ph[i].Min = PLC_APP_PROF_MIN_NONE;
+			ProfIn->Ph[i].Max = 0;
+			ProfIn->Ph[i].Avg = 0;
+		}
+
+		for(i=0; i<PLC_APP_PROF_HIST_SZ; i++) ProfIn->Hist[i] = 0;
+		ProfIn->Cnt = 0;
+	}
+}
+
+/** @brief  Put duration of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_LOCK ... PLC_APP_PROF_OUT).
+ *  @param  ValIn - duration.
+ *  @return None.
+ */
+void PlcAppProf_Put(PlcAppProf_t *ProfIn, uint8_t PhIn, uint32_t ValIn)
+{
+	PlcAppProf_Ph_t *Ph;
+
+	if(!ProfIn || PhIn >= PLC_APP_PROF_SZ) return;
+
+	Ph = &ProfIn->Ph[PhIn];
+
+	//the first scan starts average
+	if(Ph->Min == PLC_APP_PROF_MIN_NONE) Ph->Avg  = ((uint64_t)ValIn << PLC_APP_PROF_AVG_SH);
+	else                                 Ph->Avg += (uint64_t)ValIn - (Ph->Avg >> PLC_APP_PROF_AVG_SH);
+
+	if(ValIn < Ph->Min) Ph->Min = ValIn;
+	if(ValIn > Ph->Max) Ph->Max = ValIn;
+}
+
+/** @brief  Put duration of scan (the last phase of scan).
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  ValIn - duration.
+ *  @param  PeriodIn - scan period (the same unit, 0 - unknown).
+ *  @return None.
+ */
+void PlcAppProf_PutScan(PlcAppProf_t *ProfIn, uint32_t ValIn, uint32_t PeriodIn)
+{
+	uint64_t Bin = PLC_APP_PROF_HIST_SZ-1;
+
+	if(!ProfIn) return;
+
+	PlcAppProf_Put(ProfIn, PLC_APP_PROF_SCAN, ValIn);
+
+	if(PeriodIn)
+	{
+		Bin = ((uint64_t)ValIn*PLC_APP_PROF_HIST_SZ)/PeriodIn;
+		if(Bin > PLC_APP_PROF_HIST_SZ-1) Bin = PLC_APP_PROF_HIST_SZ-1;
+	}
+
+	//shares of bins are kept if counters would wrap
+	if(ProfIn->Cnt == 0xFFFFFFFF)
+	{
+		for(uint8_t i=0; i<PLC_APP_PROF_HIST_SZ; i++) ProfIn->Hist[i] >>= 1;
+		ProfIn->Cnt >>= 1;
+	}
+
+	ProfIn->Hist[Bin]++;
+	ProfIn->Cnt++;
+}
+
+/** @brief  Get min. of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_...).
+ *  @return Min. (0 - no scans).
+ */
+uint32_t PlcAppProf_GetMin(const PlcAppProf_t *ProfIn, uint8_t PhIn)
+{
+	if(!ProfIn || PhIn >= PLC_APP_PROF_SZ || ProfIn->Ph[PhIn].Min == PLC_APP_PROF_MIN_NONE) return (0);
+	return (ProfIn->Ph[PhIn].Min);
+}
+
+/** @brief  Get max. of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_...).
+ *  @return Max.
+ */
+uint32_t PlcAppProf_GetMax(const PlcAppProf_t *ProfIn, uint8_t PhIn)
+{
+	if(!ProfIn || PhIn >= PLC_APP_PROF_SZ) return (0);
+	return (ProfIn->Ph[PhIn].Max);
+}
+
+/** @brief  Get rolling average of phase.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  PhIn - phase (PLC_APP_PROF_...).
+ *  @return Average.
+ */
+uint32_t PlcAppProf_GetAvg(const PlcAppProf_t *ProfIn, uint8_t PhIn)
+{
+	if(!ProfIn || PhIn >= PLC_APP_PROF_SZ) return (0);
+	return ((uint32_t)((ProfIn->Ph[PhIn].Avg + ((uint64_t)1 << (PLC_APP_PROF_AVG_SH-1))) >> PLC_APP_PROF_AVG_SH));
+}
+
+/** @brief  Get bin of histogram.
+ *  @param  ProfIn - pointer to profiler.
+ *  @param  BinIn - bin (0 ... PLC_APP_PROF_HIST_SZ-1).
+ *  @return Share of scans (0 ... PLC_APP_PROF_HIST_FULL).
+ */
+uint16_t PlcAppProf_GetHist(const PlcAppProf_t *ProfIn, uint8_t BinIn)
+{
+	if(!ProfIn || BinIn >= PLC_APP_PROF_HIST_SZ || !ProfIn->Cnt) return (0);
+	return ((uint16_t)(((uint64_t)ProfIn->Hist[BinIn]*PLC_APP_PROF_HIST_FULL + ProfIn->Cnt/2)/ProfIn->Cnt));
+}
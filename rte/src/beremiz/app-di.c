@@ -154,6 +154,50 @@ void PlcApp_DICntr(BYTE *DIn, DWORD *Ref, BOOL *RefEn, DWORD *Ov, BOOL *Oref, BY
     }
 }
 
+void PlcApp_DICntrCmp(BYTE *DIn, DWORD *Ref, BOOL *CmpEn, BYTE *DOn, BOOL *DOv, DWORD *Ov, BOOL *Ocmp, BYTE *Ok)
+{
+    if(DIn && Ref && CmpEn && DOn && DOv && Ov && Ocmp && Ok)
+    {
+        if(*DIn < PLC_DI_SZ)
+        {
+        	if(*DOn < PLC_DO_SZ)
+        	{
+        		//LOCK
+        		xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+
+        		uint8_t M_Current;
+        		REG_CopyRegByPos((REG_DI_MODE__POS+(*DIn)), REG_COPY_MB_TO_VAR, &M_Current);
+
+        		if(M_Current == PLC_DI_MODE_CNTR)
+        		{
+        			REG_CopyRegByPos((REG_DI_CNTR_SETPOINT__POS+(*DIn)), REG_COPY_VAR_TO_MB, Ref);
+        			REG_CopyRegByPos((REG_DI_CNTR_CMP_DO__POS+(*DIn)), REG_COPY_VAR_TO_MB, DOn);
+        			REG_CopyRegByPos((REG_DI_CNTR_CMP_DO_VAL__POS+(*DIn)), REG_COPY_VAR_TO_MB, DOv);
+        			REG_CopyRegByPos((REG_DI_CNTR_CMP_ALLOW__POS+(*DIn)), REG_COPY_VAR_TO_MB, CmpEn);
+        			REG_CopyRegByPos((REG_DI_CNTR_VAL__POS+(*DIn)), REG_COPY_MB_TO_VAR, Ov);
+        			REG_CopyRegByPos((REG_DI_CNTR_CMP_REACHED__POS+(*DIn)), REG_COPY_MB_TO_VAR, Ocmp);
+        			*Ok = PLC_APP_DI_OK;
+        		}
+        		else
+        		{
+        			*Ok = PLC_APP_DI_ERR_NOT_CNTR;
+        		}
+
+        		xSemaphoreGive(RTOS_MBTABLES_MTX);
+        		//UNLOCK
+        	}
+        	else
+        	{
+        		*Ok = PLC_APP_DI_ERR_DON;
+        	}
+        }
+        else
+        {
+            *Ok = PLC_APP_DI_ERR_DIN;
+        }
+    }
+}
+
 void PlcApp_DICntrRst(BYTE *DIn, BOOL *Rst, BYTE *Ok)
 {
     if(DIn && Rst && Ok)
@@ -7,6 +7,11 @@
 #include "app-do.h"
 
 
+/** @var Previous state of DOPto.En (start/stop by edges)
+ */
+static BOOL PLC_APP_DO_PTO_EN[PLC_DO_SZ];
+
+
 void PlcApp_DOMode(BYTE *DOn, BYTE *M, BYTE *Om, BYTE *Ok)
 {
     if(DOn && M && Om && Ok)
@@ -21,7 +26,7 @@ void PlcApp_DOMode(BYTE *DOn, BYTE *M, BYTE *Om, BYTE *Ok)
 
             if(*M != M_Current)
             {
-                if(*M == PLC_DO_MODE_OFF || *M == PLC_DO_MODE_NORM || *M == PLC_DO_MODE_FAST || *M == PLC_DO_MODE_PWM)
+                if(*M == PLC_DO_MODE_OFF || *M == PLC_DO_MODE_NORM || *M == PLC_DO_MODE_FAST || *M == PLC_DO_MODE_PWM || *M == PLC_DO_MODE_PTO)
                 {
                     if(REG_CopyRegByPos((REG_DO_MODE__POS+(*DOn)), REG_COPY_VAR_TO_MB, M))
                     {
@@ -59,13 +64,8 @@ void PlcApp_DONorm(BYTE *DOn, BOOL *V, BOOL *Ov, BYTE *Ok)
 
             if(M_Current == PLC_DO_MODE_NORM)
             {
-            	//set postponed normal value
-            	PlcDO_Q_t DO_Q_Data;
-            	DO_Q_Data.Ch  = (*DOn);
-            	DO_Q_Data.ID  = PLC_DO_Q_ID_POSTPONED_VAL;
-            	DO_Q_Data.Val = (float)(float)(*V);
-            	xQueueSendToBack(RTOS_DO_Q, &DO_Q_Data, 0);
-            	PLC_DO_POSTPONED = BIT_TRUE;
+            	//set normal value into output image (applied at the end of scan)
+            	PlcDO_ImgSetNorm((*DOn), (*V));
 
                 REG_CopyRegByPos((REG_DO_NORM_VAL__POS+(*DOn)), REG_COPY_VAR_TO_MB__NO_MON, V);
 
@@ -141,7 +141,9 @@ void PlcApp_DOPwm(BOOL *En, BYTE *DOn, REAL *Tm, REAL *D, BOOL *Ow, BYTE *Ok)
                 }
 
                 REG_CopyRegByPos((REG_DO_PWM_PERIOD__POS+(*DOn)), REG_COPY_VAR_TO_MB, Tm);
-                REG_CopyRegByPos((REG_DO_PWM_VAL__POS+(*DOn)), REG_COPY_VAR_TO_MB, D);
+                //fill factor is set into output image (applied at the end of scan)
+                REG_CopyRegByPos((REG_DO_PWM_VAL__POS+(*DOn)), REG_COPY_VAR_TO_MB__NO_MON, D);
+                PlcDO_ImgSetPwm((*DOn), (*D));
 
                 *Ok = PLC_APP_DO_OK;
             }
@@ -159,3 +161,56 @@ void PlcApp_DOPwm(BOOL *En, BYTE *DOn, REAL *Tm, REAL *D, BOOL *Ow, BYTE *Ok)
         }
     }
 }
+
+void PlcApp_DOPto(BOOL *En, BYTE *DOn, DWORD *N, DWORD *F0, DWORD *F1, DWORD *Acc, BYTE *Prof, BOOL *Ob, BOOL *Od, BYTE *Ok)
+{
+    if(En && DOn && N && F0 && F1 && Acc && Prof && Ob && Od && Ok)
+    {
+        if(*DOn < PLC_DO_SZ)
+        {
+            //LOCK
+            xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+
+            uint8_t M_Current;
+            uint8_t S_Current;
+            REG_CopyRegByPos((REG_DO_MODE__POS+(*DOn)), REG_COPY_MB_TO_VAR, &M_Current);
+
+            if(M_Current == PLC_DO_MODE_PTO)
+            {
+                //settings are applied by the next start
+                REG_CopyRegByPos((REG_DO_PTO_PULSES__POS+(*DOn)), REG_COPY_VAR_TO_MB, N);
+                REG_CopyRegByPos((REG_DO_PTO_FREQ_START__POS+(*DOn)), REG_COPY_VAR_TO_MB, F0);
+                REG_CopyRegByPos((REG_DO_PTO_FREQ_MAX__POS+(*DOn)), REG_COPY_VAR_TO_MB, F1);
+                REG_CopyRegByPos((REG_DO_PTO_ACCEL__POS+(*DOn)), REG_COPY_VAR_TO_MB, Acc);
+                REG_CopyRegByPos((REG_DO_PTO_PROFILE__POS+(*DOn)), REG_COPY_VAR_TO_MB, Prof);
+
+                //start by rising edge, abort by falling edge
+                if(*En != PLC_APP_DO_PTO_EN[*DOn])
+                {
+                    REG_CopyRegByPos((REG_DO_PTO_START__POS+(*DOn)), REG_COPY_VAR_TO_MB, En);
+                    PLC_APP_DO_PTO_EN[*DOn] = *En;
+                }
+
+                REG_CopyRegByPos((REG_DO_PTO_START__POS+(*DOn)), REG_COPY_MB_TO_VAR, Ob);
+                REG_CopyRegByPos((REG_DO_PTO_DONE__POS+(*DOn)), REG_COPY_MB_TO_VAR, Od);
+                REG_CopyRegByPos((REG_DO_STATUS__POS+(*DOn)), REG_COPY_MB_TO_VAR, &S_Current);
+
+                *Ok = ((S_Current == PLC_DO_STATUS_PTO_ERR) ? PLC_APP_DO_ERR_PTO : PLC_APP_DO_OK);
+            }
+            else
+            {
+                PLC_APP_DO_PTO_EN[*DOn] = 0;
+                *Ob = 0;
+                *Od = 0;
+                *Ok = PLC_APP_DO_ERR_NOT_PTO;
+            }
+
+            xSemaphoreGive(RTOS_MBTABLES_MTX);
+            //UNLOCK
+        }
+        else
+        {
+            *Ok = PLC_APP_DO_ERR_DON;
+        }
+    }
+}
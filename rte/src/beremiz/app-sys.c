@@ -14,16 +14,13 @@ void PlcApp_SoftwareReset(BOOL Ex)
 
 void PlcApp_GetTime(IEC_TIME *CurrentTimeIn)
 {
-    if(CurrentTimeIn)
-    {
-        //1 tick of plc_sys_timer == 1 msec
-    	uint32_t plc_sys_timer = HAL_GetTick();
+    //time is latched at the start of scan
+    plc_rtc_time_get(CurrentTimeIn);
+}
 
-        //part of seconds from plc_sys_timer
-        CurrentTimeIn->tv_sec  = (long int)(plc_sys_timer/1000);
-        //part of nanoseconds from plc_sys_timer
-        CurrentTimeIn->tv_nsec = (long int)((plc_sys_timer-(CurrentTimeIn->tv_sec*1000))*1000000);
-    }
+void PlcApp_SetTimer(unsigned long long NextIn, unsigned long long PeriodIn)
+{
+    plc_tick_setup((uint64_t)NextIn, (uint64_t)PeriodIn);
 }
 
 void PlcApp_LedUser(BOOL *V, BOOL *Ov)
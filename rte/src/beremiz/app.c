@@ -41,6 +41,34 @@ void PlcApp_InitSysFunc(void)
             PLC_APP_CURR->funcs->SoftReset = PlcApp_SoftwareReset;
             PLC_APP_CURR->funcs->GetTime   = PlcApp_GetTime;
             PLC_APP_CURR->funcs->LedUser   = PlcApp_LedUser;
+
+            if(PLC_APP_CURR->rte_ver_minor >= PLC_APP_VER_MINOR_SET_TIMER)
+            {
+                PLC_APP_CURR->funcs->SetTimer = PlcApp_SetTimer;
+            }
+
+            if(PLC_APP_CURR->rte_ver_minor >= PLC_APP_VER_MINOR_RETAIN)
+            {
+                PLC_APP_CURR->funcs->RetainCheck      = plc_backup_check;
+                PLC_APP_CURR->funcs->RetainInvalidate = plc_backup_invalidate;
+                PLC_APP_CURR->funcs->RetainValidate   = plc_backup_validate;
+                PLC_APP_CURR->funcs->Retain           = plc_backup_retain;
+                PLC_APP_CURR->funcs->Remind           = plc_backup_remind;
+            }
+
+#ifdef RTE_MOD_DI
+            if(PLC_APP_CURR->rte_ver_minor >= PLC_APP_VER_MINOR_CNTR_CMP)
+            {
+                PLC_APP_CURR->funcs->DICntrCmp = PlcApp_DICntrCmp;
+            }
+#endif //RTE_MOD_DI
+
+#ifdef RTE_MOD_DO
+            if(PLC_APP_CURR->rte_ver_minor >= PLC_APP_VER_MINOR_PTO)
+            {
+                PLC_APP_CURR->funcs->DOPto = PlcApp_DOPto;
+            }
+#endif //RTE_MOD_DO
         }
     }
 }
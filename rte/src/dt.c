@@ -0,0 +1,113 @@
+/* @page dt.c
+ *       Date and time (calendar <-> seconds)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "dt.h"
+
+
+/** @def Days from 0000-03-01 to 1970-01-01 (proleptic Gregorian calendar)
+ */
+#define PLC_DT_DAYS_TO_EPOCH                     (uint32_t)719468
+
+/** @def Days per 400 years
+ */
+#define PLC_DT_DAYS_PER_ERA                      (uint32_t)146097
+
+
+/** @brief  Check leap year.
+ *  @param  YearIn - year.
+ *  @return Result:
+ *  @arg    = 0 - common year
+ *  @arg    = 1 - leap year
+ */
+static uint8_t PlcDt_IsLeap(uint16_t YearIn)
+{
+	return ((((YearIn%4) == 0 && (YearIn%100) != 0) || (YearIn%400) == 0) ? BIT_TRUE : BIT_FALSE);
+}
+
+/** @brief  Get days since 1970-01-01.
+ *  @param  DtIn - pointer to date and time (valid).
+ *  @return Days.
+ *  @note   Year begins in March (leap day is the last day of year).
+ */
+static uint32_t PlcDt_ToDays(const PlcDt_t *DtIn)
+{
+	uint32_t Y   = (uint32_t)DtIn->Year - ((DtIn->Mon <= 2) ? 1 : 0);
+	uint32_t Era = Y/400;
+	uint32_t Yoe = Y - Era*400;
+	uint32_t Doy = (153*((DtIn->Mon > 2) ? (uint32_t)DtIn->Mon-3 : (uint32_t)DtIn->Mon+9) + 2)/5 + DtIn->Day - 1;
+	uint32_t Doe = Yoe*365 + Yoe/4 - Yoe/100 + Doy;
+
+	return (Era*PLC_DT_DAYS_PER_ERA + Doe - PLC_DT_DAYS_TO_EPOCH);
+}
+
+
+/** @brief  Check date and time.
+ *  @param  DtIn - pointer to date and time.
+ *  @return Result:
+ *  @arg    = 0 - invalid
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcDt_IsValid(const PlcDt_t *DtIn)
+{
+	static const uint8_t MonDays[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	uint8_t Days;
+
+	if(!DtIn) return (BIT_FALSE);
+	if(DtIn->Year < PLC_DT_YEAR__MIN || DtIn->Year > PLC_DT_YEAR__MAX) return (BIT_FALSE);
+	if(DtIn->Mon < 1 || DtIn->Mon > 12) return (BIT_FALSE);
+
+	Days = MonDays[DtIn->Mon-1];
+	if(DtIn->Mon == 2 && PlcDt_IsLeap(DtIn->Year)) Days++;
+
+	if(DtIn->Day < 1 || DtIn->Day > Days) return (BIT_FALSE);
+	if(DtIn->Hour > 23 || DtIn->Min > 59 || DtIn->Sec > 59) return (BIT_FALSE);
+
+	return (BIT_TRUE);
+}
+
+/** @brief  Convert date and time into seconds.
+ *  @param  DtIn - pointer to date and time (valid).
+ *  @return Seconds since 1970-01-01.
+ */
+uint32_t PlcDt_ToSec(const PlcDt_t *DtIn)
+{
+	return (PlcDt_ToDays(DtIn)*PLC_DT_SEC_PER_DAY + (uint32_t)DtIn->Hour*3600 + (uint32_t)DtIn->Min*60 + DtIn->Sec);
+}
+
+/** @brief  Convert seconds into date and time.
+ *  @param  SecIn - seconds since 1970-01-01.
+ *  @param  DtOut - pointer to date and time.
+ *  @return None.
+ */
+void PlcDt_FromSec(uint32_t SecIn, PlcDt_t *DtOut)
+{
+	uint32_t Rem = SecIn%PLC_DT_SEC_PER_DAY;
+	uint32_t Z   = SecIn/PLC_DT_SEC_PER_DAY + PLC_DT_DAYS_TO_EPOCH;
+	uint32_t Era = Z/PLC_DT_DAYS_PER_ERA;
+	uint32_t Doe = Z - Era*PLC_DT_DAYS_PER_ERA;
+	uint32_t Yoe = (Doe - Doe/1460 + Doe/36524 - Doe/146096)/365;
+	uint32_t Doy = Doe - (365*Yoe + Yoe/4 - Yoe/100);
+	uint32_t Mp  = (5*Doy + 2)/153;
+
+	if(!DtOut) return;
+
+	DtOut->Day  = (uint8_t)(Doy - (153*Mp + 2)/5 + 1);
+	DtOut->Mon  = (uint8_t)((Mp < 10) ? Mp+3 : Mp-9);
+	DtOut->Year = (uint16_t)(Yoe + Era*400 + ((DtOut->Mon <= 2) ? 1 : 0));
+	DtOut->Hour = (uint8_t)(Rem/3600);
+	DtOut->Min  = (uint8_t)((Rem%3600)/60);
+	DtOut->Sec  = (uint8_t)(Rem%60);
+}
+
+/** @brief  Get day of week.
+ *  @param  DtIn - pointer to date and time (valid).
+ *  @return Day of week (1 - Monday ... 7 - Sunday).
+ */
+uint8_t PlcDt_GetWday(const PlcDt_t *DtIn)
+{
+	//1970-01-01 is Thursday
+	return ((uint8_t)((PlcDt_ToDays(DtIn) + 3)%7 + 1));
+}
@@ -17,6 +17,35 @@ static PlcAI_t PLC_AI[PLC_AI_SZ];
  */
 static uint8_t PLC_AI_TIM_STATUS = BIT_FALSE;
 
+/** @var Publication (used by AI_TIM only)
+ */
+static PlcAI_Pub_t PLC_AI_PUB[PLC_AI_SZ];
+
+/** @var The latest values (input image, not limited by deadband)
+ */
+static volatile float PLC_AI_LAST[PLC_AI_SZ];
+
+/** @var Linearization: tables (as written), compiled (used by AI_TIM only)
+ */
+static float       PLC_AI_LIN_RAW[PLC_AI_SZ][PLC_AI_LIN_TBL_SZ];
+static PlcAI_Lin_t PLC_AI_LIN[PLC_AI_SZ];
+
+/** @var Fixed-point scaling (used by AI_TIM only)
+ *       PLC_AI_FIX = 0 - range of scaled value exceeds fixed point (survey in float)
+ */
+static ScaleQ_t PLC_AI_SCALE[PLC_AI_SZ];
+static uint8_t  PLC_AI_FIX[PLC_AI_SZ];
+
+/** @var Threshold is reached (the latest state evaluated by AI_TIM, used by AI_TIM only)
+ */
+static uint8_t PLC_AI_THR_REACHED[PLC_AI_SZ];
+
+/** @var Waveform capture: settings, the first scan of window, the latest reported state
+ */
+static PlcAI_Cap_t      PLC_AI_CAP_SET;
+static uint16_t         PLC_AI_CAP_CURSOR = 0;
+static volatile uint8_t PLC_AI_CAP_STATE  = PLC_AI_CAP_IDLE;
+
 
 /** @brief  Copy data into RTOS_AI_DATA_Q.
  *  @param  ChIn - channel number.
@@ -60,6 +89,71 @@ static uint8_t RTOS_AI_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 				QueueData.ID  = IDIn;
 				QueueData.Val = (float)PLC_AI[ChIn].Status;
 				break;
+
+			case PLC_AI_Q_ID_FLTR:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].Fltr;
+				break;
+
+			case PLC_AI_Q_ID_FLTR_PRM:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].FltrPrm;
+				break;
+
+			case PLC_AI_Q_ID_OVS:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].Ovs;
+				break;
+
+			case PLC_AI_Q_ID_RATE_ACT:
+				QueueData.ID  = IDIn;
+				QueueData.Val = PLC_AI[ChIn].RateAct;
+				break;
+
+			case PLC_AI_Q_ID_BITS_ACT:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].BitsAct;
+				break;
+
+			case PLC_AI_Q_ID_DB:
+				QueueData.ID  = IDIn;
+				QueueData.Val = PLC_AI[ChIn].Db;
+				break;
+
+			case PLC_AI_Q_ID_DB_PCT:
+				QueueData.ID  = IDIn;
+				QueueData.Val = PLC_AI[ChIn].DbPct;
+				break;
+
+			case PLC_AI_Q_ID_PUB_MIN:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].PubMin;
+				break;
+
+			case PLC_AI_Q_ID_PUB_HB:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].PubHb;
+				break;
+
+			case PLC_AI_Q_ID_LIN:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].Lin;
+				break;
+
+			case PLC_AI_Q_ID_LIN_SZ:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].LinSz;
+				break;
+
+			case PLC_AI_Q_ID_THR:
+				QueueData.ID  = IDIn;
+				QueueData.Val = PLC_AI[ChIn].Thr;
+				break;
+
+			case PLC_AI_Q_ID_THR_REACHED:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_AI[ChIn].ThrReached;
+				break;
 		}
 
 		if(QueueData.ID != PLC_AI_Q_ID_NONE)
@@ -72,6 +166,24 @@ static uint8_t RTOS_AI_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 	return (BIT_FALSE);
 }
 
+/** @brief  Copy data of waveform capture into RTOS_AI_DATA_Q.
+ *  @param  ItemIn - item (PLC_AI_CAP_SET_..., PLC_AI_CAP_ITEM_...).
+ *  @param  IDIn - queue ID (PLC_AI_Q_ID_CAP_...).
+ *  @param  ValIn - value.
+ *  @return None.
+ */
+static void RTOS_AI_DATA_Q_SendCap(uint8_t ItemIn, uint8_t IDIn, uint16_t ValIn)
+{
+	PlcAI_Q_t QueueData;
+
+	QueueData.Ch  = ItemIn;
+	QueueData.ID  = IDIn;
+	QueueData.Val = (float)ValIn;
+
+	//Send data into RTOS_AI_DATA_Q (not-blocking)
+	xQueueSendToBack(RTOS_AI_DATA_Q, &QueueData, 0);
+}
+
 
 /** @brief  Start TIM_AI.
  *  @param  FromIsrIn:
@@ -118,6 +230,52 @@ static void RTOS_AI_TIM_Stop(void)
 }
 
 
+/** @brief  Update fixed-point scaling by mode and scale factors.
+ *  @param  ChIn - channel number.
+ *  @return Result:
+ *  @arg    = 0 - survey in float
+ *  @arg    = 1 - survey in fixed point
+ *  @note   Scaled value is limited by PLC_AI_FIX_VAL__MAX for any input (0 ... PLC_AI_ANA_MAX),
+ *          factors are swapped atomically.
+ */
+static uint8_t RTOS_AI_UpdScale(uint8_t ChIn)
+{
+	ScaleQ_t Scale;
+	uint8_t  Fix = BIT_FALSE;
+	float    Ka, Kb;
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		switch(PLC_AI[ChIn].Mode)
+		{
+			case PLC_AI_MODE_SURVEY_TMP36:
+				Ka = TMP36_KA;
+				Kb = TMP36_KB;
+				break;
+
+			case PLC_AI_MODE_SURVEY_TMP_MCU:
+				Ka = TMP_MCU_KA;
+				Kb = TMP_MCU_KB;
+				break;
+
+			default:
+				Ka = PLC_AI[ChIn].Ka;
+				Kb = PLC_AI[ChIn].Kb;
+				break;
+		}
+
+		//NaN fails comparison
+		if((fabsf(Ka)*PLC_AI_ANA_MAX + fabsf(Kb)) < PLC_AI_FIX_VAL__MAX) Fix = ScaleQ_Set(&Scale, Ka, Kb);
+
+		vTaskSuspendAll();
+		if(Fix) PLC_AI_SCALE[ChIn] = Scale;
+		PLC_AI_FIX[ChIn] = Fix;
+		xTaskResumeAll();
+	}
+	return (Fix);
+}
+
+
 /** @brief  Set Mode OFF.
  *  @param  ChIn - channel number.
  *  @return Result:
@@ -253,6 +411,7 @@ static uint8_t RTOS_AI_SetMode(uint8_t ChIn, uint8_t ModeIn)
 					RTOS_AI_SetModeTmp36(ChIn);
 					break;
 			}
+			RTOS_AI_UpdScale(ChIn);
 
 			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_MODE);
 			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_STATUS);
@@ -260,6 +419,7 @@ static uint8_t RTOS_AI_SetMode(uint8_t ChIn, uint8_t ModeIn)
 			if(PLC_AI[ChIn].Mode == PLC_AI_MODE_SURVEY || PLC_AI[ChIn].Mode == PLC_AI_MODE_SURVEY_TMP36 || PLC_AI[ChIn].Mode == PLC_AI_MODE_SURVEY_TMP_MCU)
 			{
 				PlcAI_Start();
+				RTOS_AI_TIM_Start(BIT_FALSE);
 			}
 
 			return (BIT_TRUE);
@@ -315,6 +475,7 @@ static uint8_t RTOS_AI_SetKa(uint8_t ChIn, float KaIn)
 		if(PLC_AI[ChIn].Ka != KaIn)
 		{
 			PLC_AI[ChIn].Ka = KaIn;
+			RTOS_AI_UpdScale(ChIn);
 			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_KA);
 
 #ifdef DEBUG_LOG_AI_Q
@@ -344,6 +505,7 @@ static uint8_t RTOS_AI_SetKb(uint8_t ChIn, float KbIn)
 		if(PLC_AI[ChIn].Kb != KbIn)
 		{
 			PLC_AI[ChIn].Kb = KbIn;
+			RTOS_AI_UpdScale(ChIn);
 			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_KB);
 
 #ifdef DEBUG_LOG_AI_Q
@@ -355,6 +517,539 @@ static uint8_t RTOS_AI_SetKb(uint8_t ChIn, float KbIn)
 	return (BIT_FALSE);
 }
 
+/** @brief  Set filter type.
+ *  @param  ChIn   - channel number.
+ *  @param  FltrIn - filter type (PLC_AI_FLTR_...).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetFltr(uint8_t ChIn, uint8_t FltrIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetFltr\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(PLC_AI[ChIn].Fltr != FltrIn)
+		{
+			//unknown type: filter is off
+			PLC_AI[ChIn].Fltr = ((PlcAI_SetFltr(ChIn, FltrIn, PLC_AI[ChIn].FltrPrm)) ? FltrIn : PLC_AI_FLTR_OFF);
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_FLTR);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].Fltr=%d\n\n", ChIn, PLC_AI[ChIn].Fltr);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set filter parameter.
+ *  @param  ChIn  - channel number.
+ *  @param  PrmIn - filter parameter.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetFltrPrm(uint8_t ChIn, uint16_t PrmIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetFltrPrm\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(PLC_AI[ChIn].FltrPrm != PrmIn)
+		{
+			PLC_AI[ChIn].FltrPrm = PrmIn;
+			PlcAI_SetFltr(ChIn, PLC_AI[ChIn].Fltr, PLC_AI[ChIn].FltrPrm);
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_FLTR_PRM);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].FltrPrm=%d\n\n", ChIn, PLC_AI[ChIn].FltrPrm);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Update effective sample rate and resolution of all channels.
+ *  @param  None.
+ *  @return None.
+ *  @note   Mode of ADC is common for all channels.
+ */
+static void RTOS_AI_UpdAct(void)
+{
+	float   Rate;
+	uint8_t Bits;
+
+	for(uint8_t i=0; i<PLC_AI_SZ; i++)
+	{
+		Rate = PlcAI_GetRate(i);
+		Bits = PlcAI_GetBits(i);
+
+		if(PLC_AI[i].RateAct != Rate)
+		{
+			PLC_AI[i].RateAct = Rate;
+			RTOS_AI_DATA_Q_Send(i, PLC_AI_Q_ID_RATE_ACT);
+		}
+		if(PLC_AI[i].BitsAct != Bits)
+		{
+			PLC_AI[i].BitsAct = Bits;
+			RTOS_AI_DATA_Q_Send(i, PLC_AI_Q_ID_BITS_ACT);
+		}
+	}
+}
+
+/** @brief  Set oversampling.
+ *  @param  ChIn  - channel number.
+ *  @param  OvsIn - extra bits (0 ... PLC_AI_OVS__MAX).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetOvs(uint8_t ChIn, uint8_t OvsIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetOvs\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(OvsIn > PLC_AI_OVS__MAX) OvsIn = PLC_AI_OVS__MAX;
+
+		if(PLC_AI[ChIn].Ovs != OvsIn)
+		{
+			if(PlcAI_SetOvs(ChIn, OvsIn)) PLC_AI[ChIn].Ovs = OvsIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_OVS);
+			RTOS_AI_UpdAct();
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].Ovs=%d .RateAct=%f .BitsAct=%d\n\n", ChIn, PLC_AI[ChIn].Ovs, PLC_AI[ChIn].RateAct, PLC_AI[ChIn].BitsAct);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set threshold.
+ *  @param  ChIn - channel number.
+ *  @param  ThrIn - threshold.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   THR_REACHED is re-evaluated by AI_TIM in the next survey period.
+ */
+static uint8_t RTOS_AI_SetThr(uint8_t ChIn, float ThrIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetThr\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(PLC_AI[ChIn].Thr != ThrIn)
+		{
+			PLC_AI[ChIn].Thr = ThrIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_THR);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].Thr=%f\n\n", ChIn, PLC_AI[ChIn].Thr);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set state of threshold (evaluated by AI_TIM).
+ *  @param  ChIn - channel number.
+ *  @param  ReachedIn - threshold is reached.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetThrReached(uint8_t ChIn, uint8_t ReachedIn)
+{
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(PLC_AI[ChIn].ThrReached != ReachedIn)
+		{
+			PLC_AI[ChIn].ThrReached = ReachedIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_THR_REACHED);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].ThrReached=%d\n\n", ChIn, PLC_AI[ChIn].ThrReached);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set deadband (absolute).
+ *  @param  ChIn - channel number.
+ *  @param  DbIn - deadband (>= 0).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetDb(uint8_t ChIn, float DbIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetDb\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(!(DbIn > 0.0f)) DbIn = 0.0f;
+
+		if(PLC_AI[ChIn].Db != DbIn)
+		{
+			PLC_AI[ChIn].Db = DbIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_DB);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].Db=%f\n\n", ChIn, PLC_AI[ChIn].Db);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set deadband (% of value).
+ *  @param  ChIn - channel number.
+ *  @param  DbIn - deadband (%, >= 0).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetDbPct(uint8_t ChIn, float DbIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetDbPct\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(!(DbIn > 0.0f)) DbIn = 0.0f;
+
+		if(PLC_AI[ChIn].DbPct != DbIn)
+		{
+			PLC_AI[ChIn].DbPct = DbIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_DB_PCT);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].DbPct=%f\n\n", ChIn, PLC_AI[ChIn].DbPct);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set min. publish interval.
+ *  @param  ChIn - channel number.
+ *  @param  TmIn - interval (ms).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetPubMin(uint8_t ChIn, uint16_t TmIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetPubMin\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(PLC_AI[ChIn].PubMin != TmIn)
+		{
+			PLC_AI[ChIn].PubMin = TmIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_PUB_MIN);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].PubMin=%d\n\n", ChIn, PLC_AI[ChIn].PubMin);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set heartbeat.
+ *  @param  ChIn - channel number.
+ *  @param  TmIn - heartbeat (s, 0 - off).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_AI_SetPubHb(uint8_t ChIn, uint16_t TmIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetPubHb\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(PLC_AI[ChIn].PubHb != TmIn)
+		{
+			PLC_AI[ChIn].PubHb = TmIn;
+			RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_PUB_HB);
+
+#ifdef DEBUG_LOG_AI_Q
+			DebugLog("AI[%d].PubHb=%d\n\n", ChIn, PLC_AI[ChIn].PubHb);
+#endif // DEBUG_LOG_AI_Q
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set linearization (table is applied).
+ *  @param  ChIn - channel number.
+ *  @param  LinIn - type (PLC_AI_LIN_...).
+ *  @return Result:
+ *  @arg    = 0 - invalid type or table (linearization is off)
+ *  @arg    = 1 - set
+ *  @note   Linearization is compiled outside of AI_TIM and swapped atomically,
+ *          table is applied by every write (even if type is not changed).
+ */
+static uint8_t RTOS_AI_SetLin(uint8_t ChIn, uint8_t LinIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetLin\n");
+#endif // DEBUG_LOG_AI_Q
+
+	PlcAI_Lin_t Lin;
+	uint8_t     Res = BIT_FALSE;
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		Res = PlcAI_Lin_Set(&Lin, LinIn, PLC_AI[ChIn].LinSz, PLC_AI_LIN_RAW[ChIn]);
+
+		vTaskSuspendAll();
+		PLC_AI_LIN[ChIn] = Lin;
+		xTaskResumeAll();
+
+		PLC_AI[ChIn].Lin = Lin.Type;
+		RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_LIN);
+
+#ifdef DEBUG_LOG_AI_Q
+		DebugLog("AI[%d].Lin=%d (%d)\n\n", ChIn, PLC_AI[ChIn].Lin, Res);
+#endif // DEBUG_LOG_AI_Q
+	}
+	return (Res);
+}
+
+/** @brief  Set size of linearization table.
+ *  @param  ChIn - channel number.
+ *  @param  SzIn - quantity of points (TBL) or coefficients (POLY).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Size is applied by the next write of type.
+ */
+static uint8_t RTOS_AI_SetLinSz(uint8_t ChIn, uint8_t SzIn)
+{
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetLinSz\n");
+#endif // DEBUG_LOG_AI_Q
+
+	if(ChIn < PLC_AI_SZ)
+	{
+		if(SzIn > PLC_AI_LIN_PTS__MAX) SzIn = PLC_AI_LIN_PTS__MAX;
+
+		PLC_AI[ChIn].LinSz = SzIn;
+		RTOS_AI_DATA_Q_Send(ChIn, PLC_AI_Q_ID_LIN_SZ);
+
+#ifdef DEBUG_LOG_AI_Q
+		DebugLog("AI[%d].LinSz=%d\n\n", ChIn, PLC_AI[ChIn].LinSz);
+#endif // DEBUG_LOG_AI_Q
+		return (BIT_TRUE);
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set item of linearization table.
+ *  @param  ItemIn - item (0 ... PLC_AI_SZ*PLC_AI_LIN_TBL_SZ-1).
+ *  @param  ValIn - value.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Table is applied by the next write of type.
+ */
+static uint8_t RTOS_AI_SetLinTbl(uint16_t ItemIn, float ValIn)
+{
+	if(ItemIn < (PLC_AI_SZ*PLC_AI_LIN_TBL_SZ))
+	{
+		PLC_AI_LIN_RAW[ItemIn/PLC_AI_LIN_TBL_SZ][ItemIn%PLC_AI_LIN_TBL_SZ] = ValIn;
+		return (BIT_TRUE);
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set cursor of waveform capture window.
+ *  @param  CursorIn - the first scan of window (limited by length of capture).
+ *  @return None.
+ *  @note   Window is always refreshed.
+ */
+static void RTOS_AI_SetCapCursor(uint16_t CursorIn)
+{
+	PlcAI_Cap_t Cap;
+
+	PlcAI_CapGet(&Cap);
+	if(CursorIn >= Cap.Len) CursorIn = ((Cap.Len) ? Cap.Len-1 : 0);
+
+	PLC_AI_CAP_CURSOR = CursorIn;
+	RTOS_AI_DATA_Q_SendCap(PLC_AI_CAP_ITEM_CURSOR, PLC_AI_Q_ID_CAP_CMD, PLC_AI_CAP_CURSOR);
+	RTOS_AI_DATA_Q_SendCap(0, PLC_AI_Q_ID_CAP_WIN, PLC_AI_CAP_CURSOR);
+
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("AI.CAP.Cursor=%d\n\n", PLC_AI_CAP_CURSOR);
+#endif // DEBUG_LOG_AI_Q
+}
+
+/** @brief  Update state of waveform capture.
+ *  @param  None.
+ *  @return None.
+ *  @note   Window is moved to the start of capture when it is frozen or released.
+ */
+static void RTOS_AI_UpdCap(void)
+{
+	uint8_t Prev  = PLC_AI_CAP_STATE;
+	uint8_t State = PlcAI_CapGet(NULL);
+
+	if(State != Prev)
+	{
+		PLC_AI_CAP_STATE = State;
+		RTOS_AI_DATA_Q_SendCap(0, PLC_AI_Q_ID_CAP_STAT, State);
+
+		if(State == PLC_AI_CAP_FROZEN || Prev == PLC_AI_CAP_FROZEN) RTOS_AI_SetCapCursor(0);
+
+#ifdef DEBUG_LOG_AI_Q
+		DebugLog("AI.CAP.State=%d\n\n", State);
+#endif // DEBUG_LOG_AI_Q
+	}
+}
+
+/** @brief  Set setting of waveform capture.
+ *  @param  ItemIn - item (PLC_AI_CAP_SET_...).
+ *  @param  ValIn - value.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Settings are applied by the next ARM.
+ */
+static uint8_t RTOS_AI_SetCapSet(uint8_t ItemIn, uint16_t ValIn)
+{
+	uint16_t Max = PlcAI_CapLenMax();
+	uint16_t Val;
+
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetCapSet\n");
+#endif // DEBUG_LOG_AI_Q
+
+	switch(ItemIn)
+	{
+		case PLC_AI_CAP_SET_CH:
+			if(ValIn < PLC_AI_SZ) PLC_AI_CAP_SET.Ch = (uint8_t)ValIn;
+			Val = PLC_AI_CAP_SET.Ch;
+			break;
+
+		case PLC_AI_CAP_SET_EDGE:
+			if(ValIn <= PLC_AI_CAP_EDGE_ANY) PLC_AI_CAP_SET.Edge = (uint8_t)ValIn;
+			Val = PLC_AI_CAP_SET.Edge;
+			break;
+
+		case PLC_AI_CAP_SET_LEVEL:
+			PLC_AI_CAP_SET.Level = ((ValIn <= PLC_AI_DIG_MAX) ? ValIn : PLC_AI_DIG_MAX);
+			Val = PLC_AI_CAP_SET.Level;
+			break;
+
+		case PLC_AI_CAP_SET_PRE:
+			PLC_AI_CAP_SET.Pre = ((ValIn < Max) ? ValIn : Max-1);
+			Val = PLC_AI_CAP_SET.Pre;
+			break;
+
+		case PLC_AI_CAP_SET_POST:
+			PLC_AI_CAP_SET.Post = ((ValIn < 1) ? 1 : ((ValIn <= Max) ? ValIn : Max));
+			Val = PLC_AI_CAP_SET.Post;
+			break;
+
+		default:
+			return (BIT_FALSE);
+	}
+
+	//the limited value is written back
+	RTOS_AI_DATA_Q_SendCap(ItemIn, PLC_AI_Q_ID_CAP_SET, Val);
+
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("AI.CAP.Set[%d]=%d\n\n", ItemIn, Val);
+#endif // DEBUG_LOG_AI_Q
+	return (BIT_TRUE);
+}
+
+/** @brief  Run command of waveform capture.
+ *  @param  CmdIn - command (PLC_AI_CAP_CMD_...).
+ *  @return Result:
+ *  @arg    = 0 - unknown command
+ *  @arg    = 1 - OK
+ *  @note   Command register is cleared when done.
+ */
+static uint8_t RTOS_AI_SetCapCmd(uint8_t CmdIn)
+{
+	PlcAI_Cap_t Cap;
+	uint8_t     Res = BIT_TRUE;
+
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("RTOS_AI_SetCapCmd\n");
+#endif // DEBUG_LOG_AI_Q
+
+	switch(CmdIn)
+	{
+		case PLC_AI_CAP_CMD_ARM:
+			if(PlcAI_CapArm(&PLC_AI_CAP_SET))
+			{
+				//Pre+Post is limited by buffer
+				PlcAI_CapGet(&Cap);
+				if(PLC_AI_CAP_SET.Pre != Cap.Pre)
+				{
+					PLC_AI_CAP_SET.Pre = Cap.Pre;
+					RTOS_AI_DATA_Q_SendCap(PLC_AI_CAP_SET_PRE, PLC_AI_Q_ID_CAP_SET, PLC_AI_CAP_SET.Pre);
+				}
+				if(PLC_AI_CAP_SET.Post != Cap.Post)
+				{
+					PLC_AI_CAP_SET.Post = Cap.Post;
+					RTOS_AI_DATA_Q_SendCap(PLC_AI_CAP_SET_POST, PLC_AI_Q_ID_CAP_SET, PLC_AI_CAP_SET.Post);
+				}
+			}
+			break;
+
+		case PLC_AI_CAP_CMD_RELEASE:
+			PlcAI_CapRelease();
+			break;
+
+		default:
+			Res = BIT_FALSE;
+			break;
+	}
+
+	RTOS_AI_DATA_Q_SendCap(PLC_AI_CAP_ITEM_CMD, PLC_AI_Q_ID_CAP_CMD, PLC_AI_CAP_CMD_NONE);
+	RTOS_AI_UpdCap();
+
+#ifdef DEBUG_LOG_AI_Q
+	DebugLog("AI.CAP.Cmd=%d .State=%d\n\n", CmdIn, PLC_AI_CAP_STATE);
+#endif // DEBUG_LOG_AI_Q
+	return (Res);
+}
+
 /** @brief  Set settings.
  *  @param  DataIn - pointer to data.
  *  @return None.
@@ -380,23 +1075,75 @@ static void RTOS_AI_Set(const PlcAI_Q_t *DataIn)
             case PLC_AI_Q_ID_KB:
             	RTOS_AI_SetKb(DataIn->Ch, DataIn->Val);
             	break;
-        }
-    }
-}
 
+            case PLC_AI_Q_ID_FLTR:
+            	RTOS_AI_SetFltr(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
 
-/** @brief  Callback for IRQ.AI.ConvCplt.
- *  @param  None.
- *  @return None.
- */
-static void PlcAI_ConvCplt(void)
-{
-#ifdef DEBUG_LOG_ADC
-    DebugLog("PlcAI_ConvCplt\n");
-#endif // DEBUG_LOG_ADC
+            case PLC_AI_Q_ID_FLTR_PRM:
+            	RTOS_AI_SetFltrPrm(DataIn->Ch, (uint16_t)DataIn->Val);
+            	break;
 
-    PlcAI_Stop();
-    RTOS_AI_TIM_Start(BIT_TRUE);
+            case PLC_AI_Q_ID_OVS:
+            	RTOS_AI_SetOvs(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_DB:
+            	RTOS_AI_SetDb(DataIn->Ch, DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_DB_PCT:
+            	RTOS_AI_SetDbPct(DataIn->Ch, DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_PUB_MIN:
+            	RTOS_AI_SetPubMin(DataIn->Ch, (uint16_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_PUB_HB:
+            	RTOS_AI_SetPubHb(DataIn->Ch, (uint16_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_LIN:
+            	RTOS_AI_SetLin(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_LIN_SZ:
+            	RTOS_AI_SetLinSz(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_LIN_TBL:
+            	RTOS_AI_SetLinTbl(DataIn->Ch, DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_THR:
+            	RTOS_AI_SetThr(DataIn->Ch, DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_THR_REACHED:
+            	RTOS_AI_SetThrReached(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_CAP_SET:
+            	RTOS_AI_SetCapSet(DataIn->Ch, (uint16_t)DataIn->Val);
+            	break;
+
+            case PLC_AI_Q_ID_CAP_CMD:
+            	if(DataIn->Ch == PLC_AI_CAP_ITEM_CMD)
+            	{
+            		if((uint8_t)DataIn->Val != PLC_AI_CAP_CMD_NONE) RTOS_AI_SetCapCmd((uint8_t)DataIn->Val);
+            	}
+            	else if(DataIn->Ch == PLC_AI_CAP_ITEM_CURSOR)
+            	{
+            		RTOS_AI_SetCapCursor((uint16_t)DataIn->Val);
+            	}
+            	break;
+
+            case PLC_AI_Q_ID_CAP_STAT:
+            	RTOS_AI_UpdCap();
+            	break;
+        }
+    }
 }
 
 
@@ -410,9 +1157,10 @@ static void RTOS_AI_Init(void)
     DebugLog("RTOS_AI_Init\n");
 #endif // DEBUG_LOG_MAIN
 
-    uint8_t cSurv = 0;
-	uint8_t BuffBy;
-	float   BuffFlo;
+    uint8_t  cSurv = 0;
+	uint8_t  BuffBy;
+	uint16_t BuffWo;
+	float    BuffFlo;
 
 	for(uint8_t i=0; i<PLC_AI_SZ; i++)
 	{
@@ -433,20 +1181,117 @@ static void RTOS_AI_Init(void)
 	    REG_CopyRegByPos(REG_AI_KB__POS+i, REG_COPY_MB_TO_VAR, &BuffFlo);
 	    PLC_AI[i].Kb = BuffFlo;
 
+	    BuffBy = PLC_AI_FLTR_DEF;
+	    REG_CopyRegByPos(REG_AI_FLTR__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+	    PLC_AI[i].Fltr = BuffBy;
+
+	    BuffWo = PLC_AI_FLTR_PRM_DEF;
+	    REG_CopyRegByPos(REG_AI_FLTR_PRM__POS+i, REG_COPY_MB_TO_VAR, &BuffWo);
+	    PLC_AI[i].FltrPrm = BuffWo;
+
+	    BuffBy = PLC_AI_OVS_DEF;
+	    REG_CopyRegByPos(REG_AI_OVS__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+	    PLC_AI[i].Ovs = ((BuffBy <= PLC_AI_OVS__MAX) ? BuffBy : PLC_AI_OVS_DEF);
+
+	    BuffFlo = PLC_AI_DB_DEF;
+	    REG_CopyRegByPos(REG_AI_DB__POS+i, REG_COPY_MB_TO_VAR, &BuffFlo);
+	    PLC_AI[i].Db = ((BuffFlo > 0.0f) ? BuffFlo : PLC_AI_DB_DEF);
+
+	    BuffFlo = PLC_AI_DB_PCT_DEF;
+	    REG_CopyRegByPos(REG_AI_DB_PCT__POS+i, REG_COPY_MB_TO_VAR, &BuffFlo);
+	    PLC_AI[i].DbPct = ((BuffFlo > 0.0f) ? BuffFlo : PLC_AI_DB_PCT_DEF);
+
+	    BuffWo = PLC_AI_PUB_MIN_DEF;
+	    REG_CopyRegByPos(REG_AI_PUB_MIN__POS+i, REG_COPY_MB_TO_VAR, &BuffWo);
+	    PLC_AI[i].PubMin = BuffWo;
+
+	    BuffWo = PLC_AI_PUB_HB_DEF;
+	    REG_CopyRegByPos(REG_AI_PUB_HB__POS+i, REG_COPY_MB_TO_VAR, &BuffWo);
+	    PLC_AI[i].PubHb = BuffWo;
+
+	    BuffBy = PLC_AI_LIN_SZ_DEF;
+	    REG_CopyRegByPos(REG_AI_LIN_SZ__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+	    PLC_AI[i].LinSz = ((BuffBy <= PLC_AI_LIN_PTS__MAX) ? BuffBy : PLC_AI_LIN_SZ_DEF);
+
+	    for(uint16_t j=0; j<PLC_AI_LIN_TBL_SZ; j++)
+	    {
+	    	BuffFlo = PLC_AI_LIN_TBL_DEF;
+	    	REG_CopyRegByPos(REG_AI_LIN_TBL__POS+(i*PLC_AI_LIN_TBL_SZ)+j, REG_COPY_MB_TO_VAR, &BuffFlo);
+	    	PLC_AI_LIN_RAW[i][j] = BuffFlo;
+	    }
+
+	    BuffBy = PLC_AI_LIN_DEF;
+	    REG_CopyRegByPos(REG_AI_LIN__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+	    PlcAI_Lin_Set(&PLC_AI_LIN[i], BuffBy, PLC_AI[i].LinSz, PLC_AI_LIN_RAW[i]);
+	    PLC_AI[i].Lin = PLC_AI_LIN[i].Type;
+
+	    RTOS_AI_UpdScale(i);
+
+	    PLC_AI[i].RateAct = 0.0f;
+	    PLC_AI[i].BitsAct = 0;
+
+	    BuffFlo = PLC_AI_THR_DEF;
+	    REG_CopyRegByPos(REG_AI_THR__POS+i, REG_COPY_MB_TO_VAR, &BuffFlo);
+	    PLC_AI[i].Thr        = BuffFlo;
+	    PLC_AI[i].ThrReached = BIT_FALSE;
+	    PLC_AI_THR_REACHED[i] = BIT_FALSE;
+
+	    PLC_AI_PUB[i].Done = BIT_FALSE;
+	    PLC_AI_LAST[i]     = PLC_AI[i].Val;
+
 		if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY || PLC_AI[i].Mode == PLC_AI_MODE_SURVEY_TMP36 || PLC_AI[i].Mode == PLC_AI_MODE_SURVEY_TMP_MCU)
 		{
 			cSurv++;
 		}
 
 #ifdef DEBUG_LOG_AI
-        DebugLog("AI[%d].Mode=%d .Val=%f .Ka=%f .Kb=%f\n", i, PLC_AI[i].Mode, PLC_AI[i].Val, PLC_AI[i].Ka, PLC_AI[i].Kb);
+        DebugLog("AI[%d].Mode=%d .Val=%f .Ka=%f .Kb=%f .Fltr=%d .FltrPrm=%d\n", i, PLC_AI[i].Mode, PLC_AI[i].Val, PLC_AI[i].Ka, PLC_AI[i].Kb, PLC_AI[i].Fltr, PLC_AI[i].FltrPrm);
 #endif // DEBUG_LOG_AI
 	}
 
-	PLC_ADC1_USER_FUNC.ConvCplt = PlcAI_ConvCplt;
+	//waveform capture (idle until ARM)
+	PLC_AI_CAP_SET.Ch = PLC_AI_CAP_CH_DEF;
+	BuffWo = PLC_AI_CAP_CH_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_CH, REG_COPY_MB_TO_VAR, &BuffWo);
+	if(BuffWo < PLC_AI_SZ) PLC_AI_CAP_SET.Ch = (uint8_t)BuffWo;
+
+	PLC_AI_CAP_SET.Edge = PLC_AI_CAP_EDGE_DEF;
+	BuffWo = PLC_AI_CAP_EDGE_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_EDGE, REG_COPY_MB_TO_VAR, &BuffWo);
+	if(BuffWo <= PLC_AI_CAP_EDGE_ANY) PLC_AI_CAP_SET.Edge = (uint8_t)BuffWo;
+
+	BuffWo = PLC_AI_CAP_LEVEL_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_LEVEL, REG_COPY_MB_TO_VAR, &BuffWo);
+	PLC_AI_CAP_SET.Level = ((BuffWo <= PLC_AI_DIG_MAX) ? BuffWo : PLC_AI_CAP_LEVEL_DEF);
+
+	BuffWo = PLC_AI_CAP_PRE_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_PRE, REG_COPY_MB_TO_VAR, &BuffWo);
+	PLC_AI_CAP_SET.Pre = BuffWo;
+
+	BuffWo = PLC_AI_CAP_POST_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_POST, REG_COPY_MB_TO_VAR, &BuffWo);
+	PLC_AI_CAP_SET.Post = BuffWo;
+
+	PLC_AI_CAP_CURSOR = 0;
+	PLC_AI_CAP_STATE  = PLC_AI_CAP_IDLE;
+
+	//acquisition is continuous, values are published by AI_TIM
+	PLC_ADC1_USER_FUNC.ConvCplt = NULL;
 
 	PlcAI_Init();
-	if(cSurv) PlcAI_Start();
+	for(uint8_t i=0; i<PLC_AI_SZ; i++)
+	{
+		PlcAI_SetOvs(i, PLC_AI[i].Ovs);
+		if(!PlcAI_SetFltr(i, PLC_AI[i].Fltr, PLC_AI[i].FltrPrm)) PLC_AI[i].Fltr = PLC_AI_FLTR_OFF;
+	}
+	RTOS_AI_UpdAct();
+	RTOS_AI_DATA_Q_SendCap(0, PLC_AI_Q_ID_CAP_STAT, PLC_AI_CAP_STATE);
+
+	if(cSurv)
+	{
+		PlcAI_Start();
+		RTOS_AI_TIM_Start(BIT_FALSE);
+	}
 }
 
 /** @brief  DeInit AI_T
@@ -459,6 +1304,7 @@ static void RTOS_AI_DeInit(void)
     DebugLog("RtosAI_Task_DeInit\n");
 #endif // DEBUG_LOG_MAIN
 
+	RTOS_AI_TIM_Stop();
 	PlcAI_Stop();
 	PlcAI_DeInit();
 }
@@ -497,10 +1343,63 @@ void RTOS_AI_Task(void *ParamsIn)
 }
 
 
-/** @brief  TIM_AI Handler (one-shot).
+/** @brief  Latch values of all channels (input image).
+ *  @param  ValOut - values [PLC_AI_SZ].
+ *  @return None.
+ *  @note   Called by APP_T at the start of scan (scheduler is suspended).
+ *          Values of the latest survey period are returned (not limited by deadband).
+ */
+void RTOS_AI_Latch(float *ValOut)
+{
+	if(ValOut)
+	{
+		for(uint8_t i=0; i<PLC_AI_SZ; i++)
+		{
+			ValOut[i] = PLC_AI_LAST[i];
+		}
+	}
+}
+
+
+/** @brief  Test publication of a value.
+ *  @param  ChIn - channel number.
+ *  @param  ValIn - value.
+ *  @param  NowIn - current time (ticks).
+ *  @return Result:
+ *  @arg    = 0 - hold
+ *  @arg    = 1 - publish
+ */
+static uint8_t RTOS_AI_IsPub(uint8_t ChIn, float ValIn, TickType_t NowIn)
+{
+	PlcAI_Pub_t *Pub = &PLC_AI_PUB[ChIn];
+	TickType_t   Elapsed;
+	float        Db, DbPct;
+
+	if(!Pub->Done) return (BIT_TRUE);
+
+	Elapsed = NowIn - (TickType_t)Pub->Tm;
+	if(Elapsed < pdMS_TO_TICKS(PLC_AI[ChIn].PubMin)) return (BIT_FALSE);
+
+	//heartbeat
+	if(PLC_AI[ChIn].PubHb && Elapsed >= pdMS_TO_TICKS((uint32_t)PLC_AI[ChIn].PubHb*1000)) return (BIT_TRUE);
+
+	//deadband
+	Db    = PLC_AI[ChIn].Db;
+	DbPct = fabsf(Pub->Val)*PLC_AI[ChIn].DbPct/100.0f;
+	if(DbPct > Db) Db = DbPct;
+
+	if(Db > 0.0f) return ((fabsf(ValIn - Pub->Val) > Db) ? BIT_TRUE : BIT_FALSE);
+	return ((ValIn != Pub->Val) ? BIT_TRUE : BIT_FALSE);
+}
+
+/** @brief  TIM_AI Handler (auto-reload).
  *  @param  TimerIn - timer.
  *  @return None.
- *  @note   Delay of ADC conversion.
+ *  @note   Publish of values accumulated by ADC since the last period
+ *          (limited by deadband, min. interval and heartbeat),
+ *          state of waveform capture is passed to AI_T when it is changed,
+ *          state of threshold is passed to AI_T when it is changed
+ *          (rising edge releases event tasks of application).
  */
 void RTOS_AI_TIM_Handler(TimerHandle_t TimerIn)
 {
@@ -508,39 +1407,74 @@ void RTOS_AI_TIM_Handler(TimerHandle_t TimerIn)
 	DebugLog("RTOS_AI_TimHandler\n");
 #endif // DEBUG_LOG_AI_TIM
 
-	uint8_t cSurv = 0;
-	PlcAI_Q_t QueueData;
+	uint8_t    cSurv = 0;
+	uint8_t    Reached;
+	int32_t    ValQ;
+	PlcAI_Q_t  QueueData;
+	TickType_t Now = xTaskGetTickCount();
 
 	//fix unused
 	(void)TimerIn;
 
-	RTOS_AI_TIM_Stop();
-
 	for(uint8_t i=0; i<PLC_AI_SZ; i++)
     {
         if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY || PLC_AI[i].Mode == PLC_AI_MODE_SURVEY_TMP36 || PLC_AI[i].Mode == PLC_AI_MODE_SURVEY_TMP_MCU)
         {
-        	QueueData.Val = PlcAI_GetAna(i);
         	cSurv++;
 
-        	if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY)
+        	if(PLC_AI_FIX[i])
+        	{
+        		//fixed point: V > scale (Ka and Kb, TMP36, MCU_TEMP) > linearization > REAL
+        		ValQ = ScaleQ(PlcAI_GetAnaQ(i), &PLC_AI_SCALE[i]);
+        		if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY) ValQ = PlcAI_Lin_Calc(&PLC_AI_LIN[i], ValQ);
+        		QueueData.Val = ScaleQ_ToReal(ValQ);
+        	}
+        	else if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY)
         	{
-        		//auto scale by custom Ka and Kb
-        		QueueData.Val = ScaleA(QueueData.Val, PLC_AI[i].Ka, PLC_AI[i].Kb);
+        		//auto scale by custom Ka and Kb (float: scaled value is out of range of fixed point)
+        		QueueData.Val = ScaleA(PlcAI_GetAna(i), PLC_AI[i].Ka, PLC_AI[i].Kb);
+        		//linearization of sensor (table or polynomial)
+        		QueueData.Val = PlcAI_Lin_Put(&PLC_AI_LIN[i], QueueData.Val);
         	}
             else if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY_TMP36)
             {
             	//auto scale by algorithm TMP36 (Analog Devices)
-            	QueueData.Val = Tmp36_GetTemp(QueueData.Val);
+            	QueueData.Val = Tmp36_GetTemp(PlcAI_GetAna(i));
             }
             else if(PLC_AI[i].Mode == PLC_AI_MODE_SURVEY_TMP_MCU)
             {
             	//auto scale by algorithm MCU_TEMP (STM32F411)
-            	QueueData.Val = TmpMcu_GetTemp(QueueData.Val);
+            	QueueData.Val = TmpMcu_GetTemp(PlcAI_GetAna(i));
             }
 
-        	if(PLC_AI[i].Val != QueueData.Val)
+        	PLC_AI_LAST[i] = QueueData.Val;
+
+        	Reached = ((QueueData.Val >= PLC_AI[i].Thr) ? BIT_TRUE : BIT_FALSE);
+        	if(Reached != PLC_AI_THR_REACHED[i])
         	{
+        		PLC_AI_THR_REACHED[i] = Reached;
+
+#ifdef RTE_MOD_APP
+        		if(Reached && (RTOS_APP_TRIG.Ch[RTOS_APP_TRIG_AI_THR] & (1UL << i)))
+        		{
+        			RTOS_APP_TRIG.Func(RTOS_APP_TRIG_AI_THR, i, NULL);
+        		}
+#endif // RTE_MOD_APP
+
+        		PlcAI_Q_t ThrData;
+        		ThrData.Ch  = i;
+        		ThrData.ID  = PLC_AI_Q_ID_THR_REACHED;
+        		ThrData.Val = (float)Reached;
+        		//Send data into RTOS_AI_Q (not-blocking)
+        		xQueueSendToBack(RTOS_AI_Q, &ThrData, 0);
+        	}
+
+        	if(RTOS_AI_IsPub(i, QueueData.Val, Now))
+        	{
+        		PLC_AI_PUB[i].Val  = QueueData.Val;
+        		PLC_AI_PUB[i].Tm   = (uint32_t)Now;
+        		PLC_AI_PUB[i].Done = BIT_TRUE;
+
         		QueueData.Ch = i;
         		QueueData.ID = PLC_AI_Q_ID_VAL;
         		//Send data into RTOS_AI_Q (not-blocking)
@@ -549,8 +1483,20 @@ void RTOS_AI_TIM_Handler(TimerHandle_t TimerIn)
         }
     }
 
-	//If a AI-channel is configured to survey-mode, then restart ADC conversion
-	if(cSurv) PlcAI_Start();
+	if(PlcAI_CapGet(NULL) != PLC_AI_CAP_STATE)
+	{
+		QueueData.Ch = 0;
+		QueueData.ID = PLC_AI_Q_ID_CAP_STAT;
+		//Send data into RTOS_AI_Q (not-blocking)
+		xQueueSendToBack(RTOS_AI_Q, &QueueData, 0);
+	}
+
+	//If no AI-channel is configured to survey-mode, then stop ADC conversion
+	if(!cSurv)
+	{
+		RTOS_AI_TIM_Stop();
+		PlcAI_Stop();
+	}
 }
 
 #endif //RTE_MOD_AI
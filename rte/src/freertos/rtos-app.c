@@ -7,54 +7,294 @@
 #include "rtos-app.h"
 
 
+#ifdef RTE_MOD_APP_TIM
 /** @var Timer statuses
  */
 static uint8_t PLC_APP_TIM_STATUS = BIT_FALSE;
 
+/** @var Counter of setups of scan timer taken by APP_TIM (plc_tick_get)
+ */
+static uint32_t PLC_APP_TIM_SETUP = 0;
 
-/** @brief  Set APP_TIM Period.
- *  @param  None.
+/** @var Groups of tasks of application (group 0 - APP_T), number of groups
+ */
+static RTOS_APP_Grp_t RTOS_APP_GRP[RTOS_APP_GRP_SZ];
+static uint8_t        RTOS_APP_GRP_NUM = 1;
+
+/** @var Tasks of application: group, interval and countdown (ticks of scan timer)
+ */
+static uint8_t  RTOS_APP_TASK_GRP[PLC_APP_TASK_MAX];
+static uint32_t RTOS_APP_TASK_TICKS[PLC_APP_TASK_MAX];
+static uint32_t RTOS_APP_TASK_CNT[PLC_APP_TASK_MAX];
+static uint8_t  RTOS_APP_TASK_NUM = 0;
+
+/** @var Group of tasks released by events (APPE_T, T = NULL - no event tasks)
+ */
+static RTOS_APP_Grp_t RTOS_APP_EVT_GRP;
+
+/** @var Events of tasks: SINGLE, polled SINGLE (not bound to source) and its previous value
+ */
+static const plc_loc_dsc_t *RTOS_APP_EVT_VAR[PLC_APP_TASK_MAX];
+static const plc_loc_dsc_t *RTOS_APP_EVT_POLL[PLC_APP_TASK_MAX];
+static uint8_t              RTOS_APP_EVT_PREV[PLC_APP_TASK_MAX];
+
+/** @var Tasks bound to channels of sources (RTOS_APP_TRIG_...), tasks released by sources since the last run
+ */
+static uint8_t          RTOS_APP_EVT_TASKS[RTOS_APP_TRIG_SZ][RTOS_APP_TRIG_CH_SZ];
+static volatile uint8_t RTOS_APP_EVT_HW = 0;
+
+/** @var Registers of event tasks (collected once, REG_CopyMbToApp, REG_CopyAppToMb are used on overflow)
+ */
+static REG_List_t RTOS_APP_EVT_IN;
+static REG_List_t RTOS_APP_EVT_OUT;
+#endif // RTE_MOD_APP_TIM
+
+/** @var Scan is released and not completed (set by TIM4 ISR, reset by APP_T)
+ */
+static volatile uint8_t RTOS_APP_BUSY = BIT_FALSE;
+
+/** @var Scan statistics: overruns (missed releases), release jitter (us)
+ */
+static volatile uint32_t RTOS_APP_OVR = 0;
+static uint32_t          RTOS_APP_JIT_MAX = 0;
+
+/** @var Scan profiler (DWT cycles), scan period (cycles)
+ */
+static PlcAppProf_t      RTOS_APP_PROF;
+static uint32_t          RTOS_APP_PERIOD_CYC = 0;
+
+/** @var Reset of scan statistics is requested (SYS_CMD.PROF_RST), time of the last publishing (ms)
+ */
+static volatile uint8_t  RTOS_APP_PROF_RST = BIT_FALSE;
+static uint32_t          RTOS_APP_PROF_PUB_TS = 0;
+
+/** @var Input image
+ */
+static RTOS_APP_InImg_t RTOS_APP_IN_IMG;
+
+/** @var Registers of input image bound to located variables (NULL - not located)
+ */
+#ifdef RTE_MOD_DI
+static REG_t *RTOS_APP_IN_DI_NORM[PLC_DI_SZ];
+static REG_t *RTOS_APP_IN_DI_CNTR[PLC_DI_SZ];
+static REG_t *RTOS_APP_IN_DI_TACH[PLC_DI_SZ];
+#endif //RTE_MOD_DI
+
+#ifdef RTE_MOD_AI
+static REG_t *RTOS_APP_IN_AI_VAL[PLC_AI_SZ];
+#endif //RTE_MOD_AI
+
+
+#ifdef RTE_MOD_APP_TIM
+
+/** @brief  Release tasks of APPE_T.
+ *  @param  TasksIn - tasks (bit i - task i, 0 - only pending tasks).
+ *  @return Result:
+ *  @arg    = 0 - APPE_T is busy or nothing is released
+ *  @arg    = 1 - APPE_T is to be notified
+ *  @note   Called from ISR or in critical section,
+ *          tasks released while APPE_T is busy are pending (run after the current run),
+ *          release of a pending task is missed (overrun).
+ */
+static uint8_t RTOS_APP_EvtRelease(uint8_t TasksIn)
+{
+	RTOS_APP_Grp_t *Grp = &RTOS_APP_EVT_GRP;
+
+	if(Grp->Rel & TasksIn) RTOS_APP_OVR++;
+	Grp->Rel |= TasksIn;
+
+	if(Grp->Busy || !Grp->Rel) return (BIT_FALSE);
+
+	Grp->Due  = Grp->Rel;
+	Grp->Rel  = 0;
+	Grp->Busy = BIT_TRUE;
+	return (BIT_TRUE);
+}
+
+/** @brief  Release tasks bound to event of source (RTOS_APP_TRIG.Func).
+ *  @param  SrcIn - source (RTOS_APP_TRIG_...).
+ *  @param  ChIn - channel of source.
+ *  @param  TaskWokenOut - called from ISR (portYIELD_FROM_ISR is up to caller), NULL - from RTOS-task.
  *  @return None.
  */
-static void RTOS_APP_TIM_Set(void)
+static void RTOS_APP_TrigFunc(uint8_t SrcIn, uint8_t ChIn, BaseType_t *TaskWokenOut)
 {
-	if(!PLC_APP_TIM_STATUS)
+	UBaseType_t Mask;
+	uint8_t     Tasks, Notify;
+
+	if(SrcIn >= RTOS_APP_TRIG_SZ || ChIn >= RTOS_APP_TRIG_CH_SZ || !RTOS_APP_EVT_GRP.T) return;
+
+	Tasks = RTOS_APP_EVT_TASKS[SrcIn][ChIn];
+	if(!Tasks) return;
+
+	if(TaskWokenOut)
+	{
+		Mask = taskENTER_CRITICAL_FROM_ISR();
+		RTOS_APP_EVT_HW |= Tasks;
+		Notify = RTOS_APP_EvtRelease(Tasks);
+		taskEXIT_CRITICAL_FROM_ISR(Mask);
+
+		if(Notify) vTaskNotifyGiveFromISR(RTOS_APP_EVT_GRP.T, TaskWokenOut);
+	}
+	else
 	{
-	    if(PLC_APP_CURR)
-	    {
-	        if(PLC_APP_CURR->common_ticktime)
-	        {
-	            uint32_t TimerPeriod = (uint32_t)(*PLC_APP_CURR->common_ticktime/RTOS_TICK_NS);
-	            if(!TimerPeriod) TimerPeriod = RTOS_APP_TIM_TM;
+		taskENTER_CRITICAL();
+		RTOS_APP_EVT_HW |= Tasks;
+		Notify = RTOS_APP_EvtRelease(Tasks);
+		taskEXIT_CRITICAL();
 
-	            xTimerChangePeriod(RTOS_APP_TIM, (TickType_t)TimerPeriod, (TickType_t)0);
+		if(Notify) xTaskNotifyGive(RTOS_APP_EVT_GRP.T);
+	}
+}
 
-#ifdef DEBUG_LOG_MAIN
-	            DebugLog("APP_TIM [SET] (%d ms)\n", TimerPeriod);
-#endif //DEBUG_LOG_MAIN
-	            return;
-	        }
-	    }
-    }
-#ifdef DEBUG_LOG_MAIN
-	            DebugLog("APP_TIM [NOT SET]\n");
-#endif //DEBUG_LOG_MAIN
+/** @brief  Release scans by tick of APP_TIM.
+ *  @param  None.
+ *  @return Groups to be notified (bit g - group g, bit RTOS_APP_GRP_EVT - APPE_T).
+ *  @note   Called from TIM4 ISR (or in critical section),
+ *          APP_T is released every tick (main run of application) with tasks of group 0 due by the tick,
+ *          APPG_T is released if any task of its group is due,
+ *          release is missed (overrun) if the previous run of group is not completed,
+ *          polled events (SINGLE not bound to source) are taken by rising edge every tick.
+ */
+static uint8_t RTOS_APP_Release(void)
+{
+	RTOS_APP_Grp_t *Grp;
+	UBaseType_t Mask;
+	uint8_t i, g, Val, Rel, Evt = 0, Res = 0;
+
+	for(i=0; i<RTOS_APP_TASK_NUM; i++)
+	{
+		Rel = 0;
+
+		//interval (0 - task is released by event only)
+		if(RTOS_APP_TASK_TICKS[i] && --RTOS_APP_TASK_CNT[i] == 0)
+		{
+			RTOS_APP_TASK_CNT[i] = RTOS_APP_TASK_TICKS[i];
+			Rel = (uint8_t)(1 << i);
+		}
+
+		//polled event
+		if(RTOS_APP_EVT_POLL[i])
+		{
+			Val = ((*(IEC_BOOL *)RTOS_APP_EVT_POLL[i]->v_buf) ? BIT_TRUE : BIT_FALSE);
+			if(Val && !RTOS_APP_EVT_PREV[i]) Rel = (uint8_t)(1 << i);
+			RTOS_APP_EVT_PREV[i] = Val;
+		}
+
+		if(RTOS_APP_TASK_GRP[i] == RTOS_APP_GRP_EVT) Evt |= Rel;
+		else RTOS_APP_GRP[RTOS_APP_TASK_GRP[i]].Rel |= Rel;
+	}
+
+	//APP_T
+	Grp = &RTOS_APP_GRP[0];
+	if(RTOS_APP_BUSY)
+	{
+		RTOS_APP_OVR++;
+	}
+	else
+	{
+		Grp->Due      = Grp->Rel;
+		RTOS_APP_BUSY = BIT_TRUE;
+		Res |= 1;
+	}
+	Grp->Rel = 0;
+
+	//APPG_T
+	for(g=1; g<RTOS_APP_GRP_NUM; g++)
+	{
+		Grp = &RTOS_APP_GRP[g];
+		if(!Grp->Rel) continue;
+
+		if(Grp->Busy)
+		{
+			RTOS_APP_OVR++;
+		}
+		else
+		{
+			Grp->Due  = Grp->Rel;
+			Grp->Busy = BIT_TRUE;
+			Res |= (uint8_t)(1 << g);
+		}
+		Grp->Rel = 0;
+	}
+
+	//APPE_T (sources of events may interrupt TIM4 ISR)
+	if(Evt)
+	{
+		Mask = taskENTER_CRITICAL_FROM_ISR();
+		if(RTOS_APP_EvtRelease(Evt)) Res |= (uint8_t)(1 << RTOS_APP_GRP_EVT);
+		taskEXIT_CRITICAL_FROM_ISR(Mask);
+	}
+
+	return (Res);
 }
 
-/** @brief  Start APP_TIM.
+/** @brief  Start APP_TIM (scan timer TIM4).
  *  @param  None.
  *  @return None.
+ *  @note   Period and delay of the first scan are set by application (PLC_SetTimer > plc_tick_setup),
+ *          otherwise period is common_ticktime of application (ns).
  */
 static void RTOS_APP_TIM_Start(void)
 {
+	uint64_t NextNs   = 0;
+	uint64_t PeriodNs = 0;
+	uint8_t  Rel;
+
 	if(!PLC_APP_TIM_STATUS)
 	{
-		xTimerReset(RTOS_APP_TIM, 0);
+		PLC_APP_TIM_SETUP = plc_tick_get(&NextNs, &PeriodNs);
+		if(!PLC_APP_TIM_SETUP)
+		{
+			PeriodNs = RTOS_APP_TIM_TM_NS;
+			if(PLC_APP_CURR && PLC_APP_CURR->common_ticktime && *PLC_APP_CURR->common_ticktime)
+			{
+				PeriodNs = (uint64_t)*PLC_APP_CURR->common_ticktime;
+			}
+			NextNs = PeriodNs;
+		}
+
+		//drop release of the previous run
+		ulTaskNotifyTake(pdTRUE, 0);
+		RTOS_APP_BUSY = BIT_FALSE;
 		PLC_APP_TIM_STATUS = BIT_TRUE;
 
-#ifdef DEBUG_LOG_APP_TIM
-		DebugLog("APP_TIM [STARTED]\n\n");
-#endif //DEBUG_LOG_APP_TIM
+		//the first tick releases all tasks
+		for(uint8_t i=0; i<RTOS_APP_TASK_NUM; i++)
+		{
+			RTOS_APP_TASK_CNT[i] = 1;
+		}
+
+		//scans are not released (stopped by application)
+		if(!PeriodNs)
+		{
+			RTOS_APP_PERIOD_CYC = 0;
+#ifdef DEBUG_LOG_MAIN
+			DebugLog("APP_TIM [STARTED] (no period)\n\n");
+#endif //DEBUG_LOG_MAIN
+			return;
+		}
+
+		PeriodNs = PlcTim4_Start(PeriodNs, NextNs);
+		RTOS_APP_PERIOD_CYC = PlcDwt_UsToCyc((uint32_t)(PeriodNs/1000));
+
+		//the first scan at once
+		if(!NextNs)
+		{
+			taskENTER_CRITICAL();
+			Rel = RTOS_APP_Release();
+			taskEXIT_CRITICAL();
+
+			for(uint8_t g=0; g<RTOS_APP_GRP_NUM; g++)
+			{
+				if(Rel & (1 << g)) xTaskNotifyGive(RTOS_APP_GRP[g].T);
+			}
+			if(Rel & (1 << RTOS_APP_GRP_EVT)) xTaskNotifyGive(RTOS_APP_EVT_GRP.T);
+		}
+
+#ifdef DEBUG_LOG_MAIN
+		DebugLog("APP_TIM [STARTED] (%d us)\n\n", (uint32_t)(PeriodNs/1000));
+#endif //DEBUG_LOG_MAIN
 	}
 }
 
@@ -66,39 +306,630 @@ static void RTOS_APP_TIM_Stop(void)
 {
 	if(PLC_APP_TIM_STATUS)
 	{
-		xTimerStop(RTOS_APP_TIM, 0);
+		PlcTim4_Stop();
 		PLC_APP_TIM_STATUS = BIT_FALSE;
+		RTOS_APP_BUSY      = BIT_FALSE;
 
-#ifdef DEBUG_LOG_APP_TIM
+#ifdef DEBUG_LOG_MAIN
 		DebugLog("APP_TIM [STOPPED]\n\n");
-#endif //DEBUG_LOG_APP_TIM
+#endif //DEBUG_LOG_MAIN
     }
 }
 
+/** @brief  APP_TIM Handler (TIM4 update, ISR).
+ *  @param  None.
+ *  @return None.
+ *  @note   Scans are released by absolute deadline (see RTOS_APP_Release).
+ */
+static void RTOS_APP_TIM_Elapsed(void)
+{
+	BaseType_t TaskWoken = pdFALSE;
+	uint8_t    Rel = RTOS_APP_Release();
+	uint8_t    g;
+
+	for(g=0; g<RTOS_APP_GRP_NUM; g++)
+	{
+		if(Rel & (1 << g)) vTaskNotifyGiveFromISR(RTOS_APP_GRP[g].T, &TaskWoken);
+	}
+	if(Rel & (1 << RTOS_APP_GRP_EVT)) vTaskNotifyGiveFromISR(RTOS_APP_EVT_GRP.T, &TaskWoken);
+	portYIELD_FROM_ISR(TaskWoken);
+}
+
+#endif // RTE_MOD_APP_TIM
+
+
+/** @brief  Convert cycles into register value.
+ *  @param  CycIn - cycles.
+ *  @return Microseconds (limited by 0xFFFF).
+ */
+static uint16_t RTOS_APP_ProfUs(uint32_t CycIn)
+{
+	uint32_t Us = PlcDwt_CycToUs(CycIn);
+
+	return ((Us < 0xFFFF) ? (uint16_t)Us : 0xFFFF);
+}
+
+/** @brief  Publish scan profiler (SYS_STAT.PROF_...).
+ *  @param  None.
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX,
+ *          registers follow the order of phases (MIN, MAX, AVG of every phase), then histogram.
+ */
+static void RTOS_APP_ProfPub(void)
+{
+	uint16_t BuffWo;
+	uint16_t Pos = REG_SYS_STAT__POS_PROF_LOCK_MIN;
+	uint8_t  i;
+
+	for(i=0; i<PLC_APP_PROF_SZ; i++)
+	{
+		BuffWo = RTOS_APP_ProfUs(PlcAppProf_GetMin(&RTOS_APP_PROF, i));
+		REG_CopyRegByPos(Pos++, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+		BuffWo = RTOS_APP_ProfUs(PlcAppProf_GetMax(&RTOS_APP_PROF, i));
+		REG_CopyRegByPos(Pos++, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+		BuffWo = RTOS_APP_ProfUs(PlcAppProf_GetAvg(&RTOS_APP_PROF, i));
+		REG_CopyRegByPos(Pos++, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+	}
+
+	for(i=0; i<PLC_APP_PROF_HIST_SZ; i++)
+	{
+		BuffWo = PlcAppProf_GetHist(&RTOS_APP_PROF, i);
+		REG_CopyRegByPos(Pos++, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+	}
+}
+
+/** @brief  Request reset of scan statistics (SYS_CMD.PROF_RST).
+ *  @param  None.
+ *  @return None.
+ *  @note   Statistics are reset by APP_T before the next scan
+ *          (profiler, overruns, max. of release jitter).
+ */
+void RTOS_APP_ProfReset(void)
+{
+	RTOS_APP_PROF_RST = BIT_TRUE;
+}
+
+/** @brief  Update scan statistics.
+ *  @param  JitIn - release jitter of the current scan (us).
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX,
+ *          profiler is published every RTOS_APP_PROF_PUB_TM (and after reset).
+ */
+static void RTOS_APP_UpdStat(uint32_t JitIn)
+{
+	uint16_t BuffWo;
+	uint32_t Ovr;
+	uint32_t Ts = HAL_GetTick();
+	uint8_t  Pub = BIT_FALSE;
+
+	if(RTOS_APP_PROF_RST)
+	{
+		RTOS_APP_PROF_RST = BIT_FALSE;
+		PlcAppProf_Reset(&RTOS_APP_PROF);
+		RTOS_APP_OVR     = 0;
+		RTOS_APP_JIT_MAX = 0;
+		Pub = BIT_TRUE;
+	}
+
+	Ovr = RTOS_APP_OVR;
+	if(JitIn > RTOS_APP_JIT_MAX) RTOS_APP_JIT_MAX = JitIn;
 
-/** @brief  Task APP_T (non-blocking)
+	BuffWo = ((Ovr < 0xFFFF) ? (uint16_t)Ovr : 0xFFFF);
+	REG_CopyRegByPos(REG_SYS_STAT__POS_APP_OVR, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	BuffWo = ((JitIn < 0xFFFF) ? (uint16_t)JitIn : 0xFFFF);
+	REG_CopyRegByPos(REG_SYS_STAT__POS_APP_JIT, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	BuffWo = ((RTOS_APP_JIT_MAX < 0xFFFF) ? (uint16_t)RTOS_APP_JIT_MAX : 0xFFFF);
+	REG_CopyRegByPos(REG_SYS_STAT__POS_APP_JIT_MAX, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	if(Pub || (Ts-RTOS_APP_PROF_PUB_TS) >= RTOS_APP_PROF_PUB_TM)
+	{
+		RTOS_APP_PROF_PUB_TS = Ts;
+		RTOS_APP_ProfPub();
+	}
+}
+
+
+/** @brief  Get register bound to located variable.
+ *  @param  SPosIn - start position of register group.
+ *  @param  iGroupIn - position of register in the group.
+ *  @return Pointer to register or NULL.
+ */
+static REG_t *RTOS_APP_InLoc(uint16_t SPosIn, int32_t iGroupIn)
+{
+	REG_t *Reg = REG_GetByPos(SPosIn, iGroupIn);
+
+	return ((Reg && Reg->pAppVar) ? Reg : NULL);
+}
+
+/** @brief  Get located variable of register used by tasks.
+ *  @param  RegIn - pointer to register (RTOS_APP_InLoc).
+ *  @param  TasksIn - mask of tasks.
+ *  @return Pointer to variable value or NULL.
+ */
+static void *RTOS_APP_InVar(const REG_t *RegIn, uint8_t TasksIn)
+{
+	return ((RegIn && (RegIn->AppTasks & TasksIn)) ? RegIn->pAppVar->v_buf : NULL);
+}
+
+/** @brief  Bind input image to located variables.
+ *  @param  None.
+ *  @return None.
+ */
+static void RTOS_APP_InBind(void)
+{
+#ifdef RTE_MOD_DI
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		RTOS_APP_IN_DI_NORM[i] = RTOS_APP_InLoc(REG_DI_NORM_VAL__POS, i);
+		RTOS_APP_IN_DI_CNTR[i] = RTOS_APP_InLoc(REG_DI_CNTR_VAL__POS, i);
+		RTOS_APP_IN_DI_TACH[i] = RTOS_APP_InLoc(REG_DI_TACH_VAL__POS, i);
+	}
+#endif //RTE_MOD_DI
+
+#ifdef RTE_MOD_AI
+	for(uint8_t i=0; i<PLC_AI_SZ; i++)
+	{
+		RTOS_APP_IN_AI_VAL[i] = RTOS_APP_InLoc(REG_AI_VAL__POS, i);
+	}
+#endif //RTE_MOD_AI
+}
+
+/** @brief  Latch input image and copy it into located variables.
+ *  @param  TasksIn - mask of tasks (located variables of other tasks are not changed).
+ *  @param  MainIn - main run of application (time of scan is latched).
+ *  @return None.
+ *  @note   All inputs are taken at the same instant (scheduler is suspended),
+ *          so the scan does not see values sampled at different times,
+ *          called with locked RTOS_MBTABLES_MTX.
+ */
+static void RTOS_APP_InLatch(uint8_t TasksIn, uint8_t MainIn)
+{
+	void *Var;
+
+	vTaskSuspendAll();
+
+	RTOS_APP_IN_IMG.Ts = HAL_GetTick();
+	if(MainIn) plc_rtc_time_latch();
+#ifdef RTE_MOD_DI
+	RTOS_DI_Latch(RTOS_APP_IN_IMG.DiNorm, RTOS_APP_IN_IMG.DiCntr, RTOS_APP_IN_IMG.DiTach);
+#endif //RTE_MOD_DI
+#ifdef RTE_MOD_AI
+	RTOS_AI_Latch(RTOS_APP_IN_IMG.AiVal);
+#endif //RTE_MOD_AI
+
+	xTaskResumeAll();
+
+#ifdef RTE_MOD_DI
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		Var = RTOS_APP_InVar(RTOS_APP_IN_DI_NORM[i], TasksIn);
+		if(Var) *(IEC_BOOL *)Var = RTOS_APP_IN_IMG.DiNorm[i];
+
+		Var = RTOS_APP_InVar(RTOS_APP_IN_DI_CNTR[i], TasksIn);
+		if(Var) *(IEC_UDINT *)Var = RTOS_APP_IN_IMG.DiCntr[i];
+
+		Var = RTOS_APP_InVar(RTOS_APP_IN_DI_TACH[i], TasksIn);
+		if(Var) *(IEC_UINT *)Var = RTOS_APP_IN_IMG.DiTach[i];
+	}
+#endif //RTE_MOD_DI
+
+#ifdef RTE_MOD_AI
+	for(uint8_t i=0; i<PLC_AI_SZ; i++)
+	{
+		Var = RTOS_APP_InVar(RTOS_APP_IN_AI_VAL[i], TasksIn);
+		if(Var) *(IEC_REAL *)Var = RTOS_APP_IN_IMG.AiVal[i];
+	}
+#endif //RTE_MOD_AI
+}
+
+
+#ifdef RTE_MOD_DO
+/** @brief  Apply output image of scan (DO_T).
+ *  @param  None.
+ *  @return None.
+ */
+static void RTOS_APP_DoApply(void)
+{
+	PlcDO_Q_t DO_Q_Data;
+
+	if(PlcDO_ImgCommit())
+	{
+		DO_Q_Data.Ch  = PLC_DO_00;
+		DO_Q_Data.ID  = PLC_DO_Q_ID_IMG_APPLY;
+		DO_Q_Data.Val = (float)BIT_TRUE;
+		xQueueSendToFront(RTOS_DO_Q, &DO_Q_Data, 0);
+	}
+}
+#endif //RTE_MOD_DO
+
+
+#ifdef RTE_MOD_APP_TIM
+
+#ifdef RTE_MOD_APP_SERIAL
+/** @brief  Lock run of periodic tasks of application (see RTOS_APP_RUN_MTX).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - run of other group is not completed in RTOS_APP_RUN_MTX_TM, the run is missed (overrun)
+ *  @arg    = 1 - OK (RTOS_APP_RUN_MTX is to be given after the run)
+ */
+static uint8_t RTOS_APP_RunLock(void)
+{
+	if(xSemaphoreTake(RTOS_APP_RUN_MTX, RTOS_APP_RUN_MTX_TM) == pdTRUE) return (BIT_TRUE);
+
+	taskENTER_CRITICAL();
+	RTOS_APP_OVR++;
+	taskEXIT_CRITICAL();
+	return (BIT_FALSE);
+}
+#endif //RTE_MOD_APP_SERIAL
+
+/** @brief  Task APPG_T (group of tasks of application).
+ *  @param  ParamsIn - pointer to group (RTOS_APP_Grp_t).
+ *  @return none.
+ *  @note   Run of group syncs located variables of its due tasks only,
+ *          scan profiler and statistics are of APP_T.
+ */
+static void RTOS_APP_GrpTask(void *ParamsIn)
+{
+	RTOS_APP_Grp_t *Grp = (RTOS_APP_Grp_t *)ParamsIn;
+	uint8_t Tasks;
+
+	for(;;)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		Tasks = Grp->Due;
+
+		if(PLC_APP_STATE == PLC_APP_STATE_STARTED && Tasks)
+		{
+			//Sync Relation Data (MODBUS.Data > APP.Data)
+			xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+			RTOS_APP_InLatch(Tasks, BIT_FALSE);
+			REG_CopyMbToApp(Tasks);
+			xSemaphoreGive(RTOS_MBTABLES_MTX);
+
+			//APP.Tasks (see RTOS_APP_RUN_MTX)
+#ifdef RTE_MOD_APP_SERIAL
+			if(RTOS_APP_RunLock())
+			{
+				PlcApp_RunTasks(Tasks);
+				xSemaphoreGive(RTOS_APP_RUN_MTX);
+			}
+#else
+			PlcApp_RunTasks(Tasks);
+#endif //RTE_MOD_APP_SERIAL
+
+			//Sync Relation Data (APP.Data > MODBUS.Data)
+			xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+			REG_CopyAppToMb(Tasks);
+			xSemaphoreGive(RTOS_MBTABLES_MTX);
+
+#ifdef RTE_MOD_DO
+			RTOS_APP_DoApply();
+#endif //RTE_MOD_DO
+		}
+
+		Grp->Busy = BIT_FALSE;
+	}
+}
+
+/** @brief  Init. groups of tasks of application.
+ *  @param  None.
+ *  @return None.
+ *  @note   Tasks are grouped by priority (0 - the highest, group 0 is run by APP_T),
+ *          tasks of lower priorities than RTOS_APP_GRP_SZ-1 levels are run by the last group,
+ *          application without tasks is run by APP_T every tick of scan timer.
+ */
+static void RTOS_APP_InitGrps(void)
+{
+	const plc_app_task_t *Task;
+	uint16_t Lvl = 0, Min;
+	uint8_t  i, g;
+
+	RTOS_APP_TASK_NUM = PlcApp_GetTasksSz();
+	RTOS_APP_GRP_NUM  = 1;
+	RTOS_APP_GRP[0].T = RTOS_APP_T;
+
+	//tasks with events are run by APPE_T (RTOS_APP_InitEvt)
+	for(i=0; i<RTOS_APP_TASK_NUM; i++)
+	{
+		RTOS_APP_TASK_GRP[i]   = RTOS_APP_GRP_EVT;
+		RTOS_APP_TASK_TICKS[i] = PlcApp_GetTask(i)->ticks;
+	}
+
+	for(g=0; g<RTOS_APP_GRP_SZ; g++)
+	{
+		//the next level of priority
+		Min = 0x100;
+		for(i=0; i<RTOS_APP_TASK_NUM; i++)
+		{
+			Task = PlcApp_GetTask(i);
+			if(PlcApp_GetTaskEvt(i)) continue;
+			if((!g || Task->priority > Lvl) && Task->priority < Min) Min = Task->priority;
+		}
+		if(Min > 0xFF) break;
+
+		for(i=0; i<RTOS_APP_TASK_NUM; i++)
+		{
+			Task = PlcApp_GetTask(i);
+			if(PlcApp_GetTaskEvt(i)) continue;
+			if(Task->priority == Min || (g == RTOS_APP_GRP_SZ-1 && Task->priority > Min))
+			{
+				RTOS_APP_TASK_GRP[i]   = g;
+				RTOS_APP_GRP[g].Tasks |= (uint8_t)(1 << i);
+			}
+		}
+
+		Lvl = Min;
+		RTOS_APP_GRP_NUM = g+1;
+	}
+
+	for(g=1; g<RTOS_APP_GRP_NUM; g++)
+	{
+		if(xTaskCreate(RTOS_APP_GrpTask, RTOS_APPG_T_NAME, RTOS_APPG_T_STACK_SZ, &RTOS_APP_GRP[g], RTOS_APP_T_PRIORITY-g, &RTOS_APP_GRP[g].T) != pdTRUE)
+		{
+			//the rest of tasks are run by the previous group
+			for(i=0; i<RTOS_APP_TASK_NUM; i++)
+			{
+				if(RTOS_APP_TASK_GRP[i] >= g && RTOS_APP_TASK_GRP[i] != RTOS_APP_GRP_EVT) RTOS_APP_TASK_GRP[i] = g-1;
+			}
+			RTOS_APP_GRP_NUM = g;
+
+#ifdef DEBUG_LOG_MAIN
+			DebugLog("APPG_T [NOT CREATED]\n");
+#endif //DEBUG_LOG_MAIN
+			break;
+		}
+	}
+
+#ifdef DEBUG_LOG_MAIN
+	DebugLog("APP [TASKS] %d (groups %d)\n\n", RTOS_APP_TASK_NUM, RTOS_APP_GRP_NUM);
+#endif //DEBUG_LOG_MAIN
+}
+
+#ifdef RTE_MOD_DO
+/** @brief  Set output image by DO of event tasks.
+ *  @param  TasksIn - tasks of the run.
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX,
+ *          DO.NORM_VAL, DO.PWM_VAL of tasks are applied by DO_T at once (not by DATA_T),
+ *          mode of channel is checked as by PlcApp_DONorm, PlcApp_DOPwm.
+ */
+static void RTOS_APP_EvtDo(uint8_t TasksIn)
+{
+	REG_t  *Reg;
+	uint8_t Mode;
+
+	for(uint16_t i=0; i<RTOS_APP_EVT_OUT.Sz; i++)
+	{
+		Reg = RTOS_APP_EVT_OUT.Reg[i];
+		if(!(Reg->AppTasks & TasksIn) || Reg->iGroup >= PLC_DO_SZ) continue;
+
+		if(Reg->GID == REG_DO_NORM_VAL__GID)
+		{
+			REG_CopyRegByPos((REG_DO_MODE__POS+Reg->iGroup), REG_COPY_MB_TO_VAR, &Mode);
+			if(Mode == PLC_DO_MODE_NORM) PlcDO_ImgSetNorm(Reg->iGroup, *(IEC_BOOL *)Reg->pAppVar->v_buf);
+		}
+		else if(Reg->GID == REG_DO_PWM_VAL__GID)
+		{
+			REG_CopyRegByPos((REG_DO_MODE__POS+Reg->iGroup), REG_COPY_MB_TO_VAR, &Mode);
+			if(Mode == PLC_DO_MODE_PWM) PlcDO_ImgSetPwm(Reg->iGroup, *(IEC_REAL *)Reg->pAppVar->v_buf);
+		}
+	}
+}
+#endif //RTE_MOD_DO
+
+/** @brief  Task APPE_T (tasks of application released by events).
+ *  @param  ParamsIn - pointer to group (RTOS_APP_EVT_GRP).
+ *  @return none.
+ *  @note   Run syncs registers of its due tasks only (list collected by RTOS_APP_InitEvt),
+ *          SINGLE of task released by source is TRUE in the run
+ *          (register of source may be not updated by DATA_T yet),
+ *          pending tasks are run at once after the current run.
+ */
+static void RTOS_APP_EvtTask(void *ParamsIn)
+{
+	RTOS_APP_Grp_t *Grp = (RTOS_APP_Grp_t *)ParamsIn;
+	uint8_t Tasks, Hw, i;
+	uint8_t Again = BIT_FALSE;
+
+	for(;;)
+	{
+		if(!Again) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		taskENTER_CRITICAL();
+		Tasks = Grp->Due;
+		Hw    = RTOS_APP_EVT_HW & Tasks;
+		RTOS_APP_EVT_HW &= (uint8_t)~Hw;
+		taskEXIT_CRITICAL();
+
+		if(PLC_APP_STATE == PLC_APP_STATE_STARTED && Tasks)
+		{
+			//Sync Relation Data (MODBUS.Data > APP.Data)
+			xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+			RTOS_APP_InLatch(Tasks, BIT_FALSE);
+			if(RTOS_APP_EVT_IN.Ovf) REG_CopyMbToApp(Tasks);
+			else REG_CopyList(&RTOS_APP_EVT_IN, REG_COPY_MB_TO_APP, Tasks);
+			xSemaphoreGive(RTOS_MBTABLES_MTX);
+
+			for(i=0; i<RTOS_APP_TASK_NUM; i++)
+			{
+				if((Hw & (1 << i)) && RTOS_APP_EVT_VAR[i]) *(IEC_BOOL *)RTOS_APP_EVT_VAR[i]->v_buf = 1;
+			}
+
+			//APP.Tasks (never waits for runs of periodic tasks, see RTOS_APP_RUN_MTX)
+			PlcApp_RunTasks(Tasks);
+
+			//Sync Relation Data (APP.Data > MODBUS.Data)
+			xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+#ifdef RTE_MOD_DO
+			RTOS_APP_EvtDo(Tasks);
+#endif //RTE_MOD_DO
+			if(RTOS_APP_EVT_OUT.Ovf) REG_CopyAppToMb(Tasks);
+			else REG_CopyList(&RTOS_APP_EVT_OUT, REG_COPY_APP_TO_MB, Tasks);
+			xSemaphoreGive(RTOS_MBTABLES_MTX);
+
+#ifdef RTE_MOD_DO
+			RTOS_APP_DoApply();
+#endif //RTE_MOD_DO
+		}
+
+		taskENTER_CRITICAL();
+		Grp->Busy = BIT_FALSE;
+		Again = RTOS_APP_EvtRelease(0);
+		taskEXIT_CRITICAL();
+	}
+}
+
+/** @brief  Get register bound to located variable.
+ *  @param  VarIn - located variable.
+ *  @return Pointer to register or NULL.
+ */
+static REG_t *RTOS_APP_EvtReg(const plc_loc_dsc_t *VarIn)
+{
+	REG_t *Reg;
+
+	for(uint16_t i=0; i<REG_SZ; i++)
+	{
+		Reg = REG_GetByIDx(i);
+		if(Reg && Reg->pAppVar == VarIn) return (Reg);
+	}
+	return (NULL);
+}
+
+/** @brief  Init. events of tasks of application.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called after RTOS_APP_InitGrps,
+ *          SINGLE bound to DI.NORM_VAL, DI.CNTR_SETPOINT_REACHED, AI.THR_REACHED is released by source,
+ *          other SINGLE is polled by tick of scan timer,
+ *          if APPE_T is not created, tasks are run by APP_T (all events are polled).
+ */
+static void RTOS_APP_InitEvt(void)
+{
+	REG_t  *Reg;
+	uint8_t i, Src, Ch, Tasks = 0;
+
+	for(i=0; i<RTOS_APP_TASK_NUM; i++)
+	{
+		RTOS_APP_EVT_VAR[i]  = PlcApp_GetTaskEvt(i);
+		RTOS_APP_EVT_POLL[i] = NULL;
+		RTOS_APP_EVT_PREV[i] = BIT_FALSE;
+		if(RTOS_APP_EVT_VAR[i]) Tasks |= (uint8_t)(1 << i);
+	}
+	if(!Tasks) return;
+
+	RTOS_APP_EVT_GRP.Tasks = Tasks;
+
+	xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+	for(i=0; i<RTOS_APP_TASK_NUM; i++)
+	{
+		if(!RTOS_APP_EVT_VAR[i]) continue;
+
+		Src = RTOS_APP_TRIG_SZ;
+		Reg = RTOS_APP_EvtReg(RTOS_APP_EVT_VAR[i]);
+		if(Reg && Reg->iGroup < RTOS_APP_TRIG_CH_SZ)
+		{
+			switch(Reg->GID)
+			{
+#ifdef RTE_MOD_DI
+				case REG_DI_NORM_VAL__GID:
+					Src = RTOS_APP_TRIG_DI_EDGE;
+					break;
+
+				case REG_DI_CNTR_SETPOINT_REACHED__GID:
+					Src = RTOS_APP_TRIG_DI_CNTR;
+					break;
+#endif //RTE_MOD_DI
+
+#ifdef RTE_MOD_AI
+				case REG_AI_THR_REACHED__GID:
+					Src = RTOS_APP_TRIG_AI_THR;
+					break;
+#endif //RTE_MOD_AI
+			}
+		}
+
+		if(Src < RTOS_APP_TRIG_SZ) RTOS_APP_EVT_TASKS[Src][Reg->iGroup] |= (uint8_t)(1 << i);
+		else RTOS_APP_EVT_POLL[i] = RTOS_APP_EVT_VAR[i];
+	}
+
+	REG_ListMbToApp(Tasks, &RTOS_APP_EVT_IN);
+	REG_ListAppToMb(Tasks, &RTOS_APP_EVT_OUT);
+	xSemaphoreGive(RTOS_MBTABLES_MTX);
+
+	if(xTaskCreate(RTOS_APP_EvtTask, RTOS_APPE_T_NAME, RTOS_APPE_T_STACK_SZ, &RTOS_APP_EVT_GRP, RTOS_APPE_T_PRIORITY, &RTOS_APP_EVT_GRP.T) != pdTRUE)
+	{
+		RTOS_APP_EVT_GRP.T = NULL;
+		for(i=0; i<RTOS_APP_TASK_NUM; i++)
+		{
+			if(!(Tasks & (1 << i))) continue;
+
+			RTOS_APP_TASK_GRP[i]    = 0;
+			RTOS_APP_GRP[0].Tasks  |= (uint8_t)(1 << i);
+			RTOS_APP_EVT_POLL[i]    = RTOS_APP_EVT_VAR[i];
+		}
+
+#ifdef DEBUG_LOG_MAIN
+		DebugLog("APPE_T [NOT CREATED]\n");
+#endif //DEBUG_LOG_MAIN
+		return;
+	}
+
+	//sources call RTOS_APP_TRIG.Func of bound channels only
+	RTOS_APP_TRIG.Func = RTOS_APP_TrigFunc;
+	for(Src=0; Src<RTOS_APP_TRIG_SZ; Src++)
+	{
+		for(Ch=0; Ch<RTOS_APP_TRIG_CH_SZ; Ch++)
+		{
+			if(RTOS_APP_EVT_TASKS[Src][Ch]) RTOS_APP_TRIG.Ch[Src] |= (1UL << Ch);
+		}
+	}
+
+#ifdef DEBUG_LOG_MAIN
+	DebugLog("APP [EVENTS] %d (in %d, out %d)\n\n", Tasks, RTOS_APP_EVT_IN.Sz, RTOS_APP_EVT_OUT.Sz);
+#endif //DEBUG_LOG_MAIN
+}
+
+#endif // RTE_MOD_APP_TIM
+
+
+/** @brief  Task APP_T
  *  @param  ParamsIn - pointer to additional task parameters.
  *  @return none.
  */
 void RTOS_APP_Task(void *ParamsIn)
 {
     //VARIABLES
-    BaseType_t APP_SEMA_Status;
+    uint32_t   Release;
+    uint32_t   Jit = 0;
+    uint32_t   CycRel = 0;
+    uint32_t   Cyc, Cyc1, Lock;
     uint8_t    AppRun1 = BIT_FALSE;
-
-#ifdef RTE_MOD_DO
-    PlcDO_Q_t  DO_Q_Data;
-#endif //RTE_MOD_DO
+    uint8_t    AppCrcErr = BIT_FALSE;
+    uint8_t    Tasks = (uint8_t)PLC_APP_TASK_ALL;
 
     //INIT
     (void)ParamsIn;
 
+    PlcAppProf_Reset(&RTOS_APP_PROF);
+
 #ifdef RTE_MOD_APP_TIM
-    RTOS_APP_TIM_Set();
+    PlcTim4_Init();
+    PLC_TIM4_USER_FUNC.Elapsed = RTOS_APP_TIM_Elapsed;
+#else
+    RTOS_APP_PERIOD_CYC = PlcDwt_UsToCyc((uint32_t)RTOS_APP_T_POLL_TM*portTICK_PERIOD_MS*1000);
 #endif // RTE_MOD_APP_TIM
 
-    xSemaphoreGive(RTOS_APP_SEMA);
     PlcApp_Start();
+    RTOS_APP_InBind();
+#ifdef RTE_MOD_APP_TIM
+    RTOS_APP_InitGrps();
+    RTOS_APP_InitEvt();
+#endif // RTE_MOD_APP_TIM
 
     if(PLC_APP_STATE == PLC_APP_STATE_STARTED)
     {
@@ -122,25 +953,57 @@ void RTOS_APP_Task(void *ParamsIn)
     //START
     for(;;)
     {
-#ifdef RTE_MOD_APP_DEBUG_HANDLER
-        dbg_handler();
-#endif //RTE_MOD_APP_DEBUG_HANDLER
+#ifdef RTE_MOD_APP_TIM
+    	//Waiting for release of scan (blocked, woken to serve debug-handler)
+    	Release = ulTaskNotifyTake(pdTRUE, RTOS_APP_T_POLL_TM);
+    	if(Release)
+    	{
+    		Jit    = PlcTim4_GetElapsedUs();
+    		CycRel = PlcDwt_GetCyc();
+    		//tasks of group 0 due by the tick (application without tasks - all located variables)
+    		Tasks  = ((RTOS_APP_TASK_NUM) ? RTOS_APP_GRP[0].Due : (uint8_t)PLC_APP_TASK_ALL);
+    	}
+#else
+    	//free-running scan (one per tick)
+    	vTaskDelay(RTOS_APP_T_POLL_TM);
+    	Release = 1;
+    	CycRel  = PlcDwt_GetCyc();
+#endif // RTE_MOD_APP_TIM
 
         if(PLC_APP_STATE == PLC_APP_STATE_STARTED)
         {
-            //Waiting for Application cycle (non-blocked)
-        	APP_SEMA_Status = xSemaphoreTake(RTOS_APP_SEMA, (TickType_t)0);
-            if(APP_SEMA_Status == pdPASS)
+            if(Release)
             {
                 //Sync Relation Data (MODBUS.Data > APP.Data)
+                Cyc  = PlcDwt_GetCyc();
                 xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
-                REG_CopyMbToApp();
+                Cyc1 = PlcDwt_GetCyc();
+                Lock = Cyc1-Cyc;
+                RTOS_APP_InLatch(Tasks, BIT_TRUE);
+                REG_CopyMbToApp(Tasks);
+                PlcAppProf_Put(&RTOS_APP_PROF, PLC_APP_PROF_IN, (PlcDwt_GetCyc()-Cyc1));
+                RTOS_APP_UpdStat(Jit);
                	REG_SYS_STAT1_Set(PLC_SYS_STAT1_APP_RUN, BIT_TRUE);
                	RTOS_LED_Q_SendMode(PLC_LED_RUN, PLC_LED_MODE_ON);
                 xSemaphoreGive(RTOS_MBTABLES_MTX);
 
                 //APP.Run
+                Cyc = PlcDwt_GetCyc();
+#ifdef RTE_MOD_APP_TIM
+                //see RTOS_APP_RUN_MTX
+#ifdef RTE_MOD_APP_SERIAL
+                if(RTOS_APP_RunLock())
+                {
+                    PlcApp_RunTasks(PLC_APP_TASK_MAIN | Tasks);
+                    xSemaphoreGive(RTOS_APP_RUN_MTX);
+                }
+#else
+                PlcApp_RunTasks(PLC_APP_TASK_MAIN | Tasks);
+#endif //RTE_MOD_APP_SERIAL
+#else
                 PlcApp_Run();
+#endif // RTE_MOD_APP_TIM
+                PlcAppProf_Put(&RTOS_APP_PROF, PLC_APP_PROF_RUN, (PlcDwt_GetCyc()-Cyc));
 
 #ifdef DEBUG_LOG_APP_VAR
                 PlcApp_DebugPrint();
@@ -148,8 +1011,13 @@ void RTOS_APP_Task(void *ParamsIn)
 
                 //Sync Relation Data (APP.Data > MODBUS.Data)
                 //LOCK
+                Cyc  = PlcDwt_GetCyc();
                 xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
-                REG_CopyAppToMb();
+                Cyc1 = PlcDwt_GetCyc();
+                Lock += Cyc1-Cyc;
+                REG_CopyAppToMb(Tasks);
+                PlcAppProf_Put(&RTOS_APP_PROF, PLC_APP_PROF_OUT, (PlcDwt_GetCyc()-Cyc1));
+                PlcAppProf_Put(&RTOS_APP_PROF, PLC_APP_PROF_LOCK, Lock);
                 REG_SYS_STAT1_Set(PLC_SYS_STAT1_APP_RUN, BIT_FALSE);
                 RTOS_LED_Q_SendMode(PLC_LED_RUN, PLC_LED_MODE_OFF);
                 if(!AppRun1)
@@ -161,18 +1029,16 @@ void RTOS_APP_Task(void *ParamsIn)
                 //UNLOCK
 
 #ifdef RTE_MOD_DO
-                //Update DO (apply postponed normal)
-                if(PLC_DO_POSTPONED)
-                {
-                	DO_Q_Data.ID  = PLC_DO_Q_ID_POSTPONED_APPLY;
-                	DO_Q_Data.Val = (float)BIT_TRUE;
-                    xQueueSendToBack(RTOS_DO_Q, &DO_Q_Data, 0);
-                    PLC_DO_POSTPONED = BIT_FALSE;
-                }
+                //Scan is completed
+                PlcSfty_Kick(PLC_SFTY_WD_SCAN);
+
+                //Update DO (apply output image of scan at once)
+                RTOS_APP_DoApply();
 #endif //RTE_MOD_DO
 
-                //APP_TIM.Reset
-                RTOS_APP_TIM_Start();
+                //Scan is completed (the next release is allowed)
+                PlcAppProf_PutScan(&RTOS_APP_PROF, (PlcDwt_GetCyc()-CycRel), RTOS_APP_PERIOD_CYC);
+                RTOS_APP_BUSY = BIT_FALSE;
 
 #ifdef DEBUG_LOG_APP_RUN
                 DebugLog("APP [RUN]\n");
@@ -180,20 +1046,63 @@ void RTOS_APP_Task(void *ParamsIn)
             }
         }
 
-        //fast switch to other task
-        taskYIELD();
+        //debug-handler is served after scan (start of scan is not delayed),
+        //RTE_MOD_APP_SERIAL: variables are not changed by runs of other periodic groups meanwhile
+#ifdef RTE_MOD_APP_DEBUG_HANDLER
+#if defined(RTE_MOD_APP_TIM) && defined(RTE_MOD_APP_SERIAL)
+        if(xSemaphoreTake(RTOS_APP_RUN_MTX, RTOS_APP_RUN_MTX_TM) == pdTRUE)
+        {
+            dbg_handler();
+            xSemaphoreGive(RTOS_APP_RUN_MTX);
+        }
+#else
+        dbg_handler();
+#endif //RTE_MOD_APP_SERIAL
+#endif //RTE_MOD_APP_DEBUG_HANDLER
+
+        //application image is corrupted (background check by idle task):
+        //application is stopped, DO are switched into safe state at once
+        //(it does not depend on time of safety watchdog, SYS_SET.SFTY_TIM_TM may be 0)
+        if(!AppCrcErr && PlcApp_CrcIsErr())
+        {
+        	AppCrcErr = BIT_TRUE;
+        	PlcApp_Stop();
+#ifdef RTE_MOD_DO
+        	PlcSfty_Trip();
+#endif //RTE_MOD_DO
+        	xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+        	REG_SYS_STAT1_Set(PLC_SYS_STAT1_APP_CRC_ERR, BIT_TRUE);
+        	xSemaphoreGive(RTOS_MBTABLES_MTX);
+#ifdef DEBUG_LOG_MAIN
+        	DebugLog("APP [STOPPED] (CRC)\n");
+#endif //DEBUG_LOG_MAIN
+        }
+
+#ifdef RTE_MOD_APP_TIM
+        //scan timer runs while application is started (restarted by a new setup of application)
+        if(PLC_APP_STATE == PLC_APP_STATE_STARTED)
+        {
+        	if(PLC_APP_TIM_STATUS && plc_tick_get(NULL, NULL) != PLC_APP_TIM_SETUP) RTOS_APP_TIM_Stop();
+        	RTOS_APP_TIM_Start();
+        }
+        else
+        {
+        	RTOS_APP_TIM_Stop();
+        }
+#endif // RTE_MOD_APP_TIM
     }
 }
 
 
-/** @brief  APP_TIM Handler (one-shot)
- *  @param  TimerIn - timer.
- *  @return none.
+#if (configUSE_IDLE_HOOK == 1)
+/** @brief  Idle hook (FreeRTOS).
+ *  @param  None.
+ *  @return None.
+ *  @note   Application image is checked by chunks in idle time (never blocks),
+ *          so the check never delays a scan.
  */
-void RTOS_APP_TIM_Handler(TimerHandle_t TimerIn)
+void vApplicationIdleHook(void)
 {
-    (void)TimerIn; //fix unused
-
-    RTOS_APP_TIM_Stop();
-    xSemaphoreGive(RTOS_APP_SEMA);
+	PlcApp_CrcStep();
 }
+#endif //configUSE_IDLE_HOOK
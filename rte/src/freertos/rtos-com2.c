@@ -180,6 +180,11 @@ void RTOS_COM2_Task(void *ParamsIn)
 					//create answer
 					if(MBRTU_COM2.RxExc == MBRTU_EXC_OK)
 	                {
+#ifdef RTE_MOD_DO
+						//valid request: master is alive
+						PlcSfty_Kick(PLC_SFTY_WD_COMM);
+#endif //RTE_MOD_DO
+
 						//waiting until the access to the memory of ModBus-tables is released
 	                    if(xSemaphoreTake(RTOS_MBTABLES_MTX, RTOS_COM2_DELAY_BUSY) == pdPASS)
 	                    {
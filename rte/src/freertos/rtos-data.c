@@ -59,6 +59,26 @@ static void RTOS_DI_DATA_Q_ToReg(const PlcDI_Q_t *DataIn)
                     REG_CopyRegByPos((REG_DI_CNTR_SETPOINT_REACHED__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
 					break;
 
+				case PLC_DI_Q_ID_CNTR_CMP_ALLOW:
+					BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_DI_CNTR_CMP_ALLOW__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_DI_Q_ID_CNTR_CMP_DO:
+					BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_DI_CNTR_CMP_DO__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_DI_Q_ID_CNTR_CMP_DO_VAL:
+					BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_DI_CNTR_CMP_DO_VAL__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_DI_Q_ID_CNTR_CMP_REACHED:
+					BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_DI_CNTR_CMP_REACHED__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
 				case PLC_DI_Q_ID_TACH_VAL:
 					BuffWo = (uint16_t)DataIn->Val;
                     REG_CopyRegByPos((REG_DI_TACH_VAL__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
@@ -93,6 +113,25 @@ static void RTOS_DI_DATA_Q_ToReg(const PlcDI_Q_t *DataIn)
 					BuffBy = DataIn->Val;
                     REG_CopyRegByPos((REG_DI_FILTER_DELAY__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
 					break;
+
+				case PLC_DI_Q_ID_EVT_HEAD:
+					BuffDWo = DataIn->Val;
+                    REG_CopyRegByPos((REG_DI_EVT_HEAD__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+					break;
+
+				case PLC_DI_Q_ID_EVT_CURSOR:
+					BuffDWo = DataIn->Val;
+                    REG_CopyRegByPos((REG_DI_EVT_CURSOR__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+					break;
+
+				case PLC_DI_Q_ID_EVT_WIN:
+					//records are read from the log in place
+					for(uint8_t i=0; i<PLC_DI_EVT_WIN_SZ; i++)
+					{
+						BuffDWo = RTOS_DI_ReadEvt(DataIn->Ch, DataIn->Val+i);
+						REG_CopyRegByPos((REG_DI_EVT_WIN__POS+(DataIn->Ch)*PLC_DI_EVT_WIN_SZ+i), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+					}
+					break;
             }
 #ifdef DEBUG_LOG_DI_DATA_Q
             DebugLog("DI[%d].ID=%d .Val=%d\n\n", DataIn->Ch, DataIn->ID, DataIn->Val);
@@ -158,6 +197,33 @@ static void RTOS_DI_Q_Send(const REG_t *DataIn)
         		}
 				break;
 
+        	case REG_DI_CNTR_CMP_ALLOW__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DI_Q_ID_CNTR_CMP_ALLOW;
+            		QueueData.Val = (uint32_t)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_DI_CNTR_CMP_DO__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DI_Q_ID_CNTR_CMP_DO;
+            		QueueData.Val = (uint32_t)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_DI_CNTR_CMP_DO_VAL__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DI_Q_ID_CNTR_CMP_DO_VAL;
+            		QueueData.Val = (uint32_t)BuffAny32.data_byte;
+        		}
+				break;
+
         	case REG_DI_MODE__GID:
         		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
         		{
@@ -184,6 +250,15 @@ static void RTOS_DI_Q_Send(const REG_t *DataIn)
             		QueueData.Val = (uint32_t)BuffAny32.data_dword;
         		}
 				break;
+
+        	case REG_DI_EVT_CURSOR__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DI_Q_ID_EVT_CURSOR;
+            		QueueData.Val = (uint32_t)BuffAny32.data_dword;
+        		}
+				break;
         }
 
 		if(QueueData.ID != PLC_DI_Q_ID_NONE)
@@ -221,8 +296,11 @@ static void RTOS_DO_DATA_Q_ToReg(const PlcDO_Q_t *DataIn)
     {
         if(DataIn->Ch < PLC_DO_SZ)
         {
-            uint8_t  BuffBy;
-            float    BuffFlo;
+            uint8_t   BuffBy;
+            uint16_t  BuffWo;
+            uint32_t  BuffDWo;
+            float     BuffFlo;
+            ANY32_uwt BuffAny32;
 
             switch(DataIn->ID)
             {
@@ -260,6 +338,96 @@ static void RTOS_DO_DATA_Q_ToReg(const PlcDO_Q_t *DataIn)
             		BuffBy = (uint8_t)DataIn->Val;
             		REG_CopyRegByPos((REG_DO_STATUS__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
             		break;
+
+            	//DWORD is packed into Val (exact above 2^24)
+            	case PLC_DO_Q_ID_PWM_FREQ:
+            		BuffAny32.data_float = DataIn->Val;
+            		BuffDWo = BuffAny32.data_dword;
+            		REG_CopyRegByPos((REG_DO_PWM_FREQ__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PWM_T_NS:
+            		BuffAny32.data_float = DataIn->Val;
+            		BuffDWo = BuffAny32.data_dword;
+            		REG_CopyRegByPos((REG_DO_PWM_PERIOD_NS__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PWM_RES:
+            		BuffAny32.data_float = DataIn->Val;
+            		BuffDWo = BuffAny32.data_dword;
+            		REG_CopyRegByPos((REG_DO_PWM_RES__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PWM_FREQ_ACT:
+            		BuffFlo = DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PWM_FREQ_ACT__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+            		break;
+
+            	case PLC_DO_Q_ID_PWM_RES_ACT:
+            		BuffAny32.data_float = DataIn->Val;
+            		BuffDWo = BuffAny32.data_dword;
+            		REG_CopyRegByPos((REG_DO_PWM_RES_ACT__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_PULSES:
+            		BuffDWo = (uint32_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_PULSES__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_FREQ_START:
+            		BuffDWo = (uint32_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_FREQ_START__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_FREQ_MAX:
+            		BuffDWo = (uint32_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_FREQ_MAX__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_ACCEL:
+            		BuffDWo = (uint32_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_ACCEL__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_PROFILE:
+            		BuffBy = (uint8_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_PROFILE__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_START:
+            		BuffBy = (uint8_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_START__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+            		break;
+
+            	case PLC_DO_Q_ID_PTO_DONE:
+            		BuffBy = (uint8_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_PTO_DONE__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+            		break;
+
+            	case PLC_DO_Q_ID_CMP_HELD:
+            		BuffBy = (uint8_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_CMP_HELD__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+            		break;
+
+            	case PLC_DO_Q_ID_SAFE_VAL:
+            		BuffBy = (uint8_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_SAFE_VAL__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+            		break;
+
+            	case PLC_DO_Q_ID_SAFE_ALLOW:
+            		BuffBy = (uint8_t)DataIn->Val;
+            		REG_CopyRegByPos((REG_DO_SAFE_ALLOW__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+            		break;
+
+            	case PLC_DO_Q_ID_IMG_LAT:
+            		BuffWo = ((DataIn->Val < 65535.0f) ? (uint16_t)DataIn->Val : 65535);
+            		REG_CopyRegByPos(REG_SYS_STAT__POS_DO_LAT, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+            		break;
+
+            	case PLC_DO_Q_ID_IMG_LAT_MAX:
+            		BuffWo = ((DataIn->Val < 65535.0f) ? (uint16_t)DataIn->Val : 65535);
+            		REG_CopyRegByPos(REG_SYS_STAT__POS_DO_LAT_MAX, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+            		break;
             }
 #ifdef DEBUG_LOG_DO_DATA
             DebugLog("DO[%d].ID=%d .Val=%f\n\n", DataIn->Ch, DataIn->ID, DataIn->Val);
@@ -325,6 +493,34 @@ static void RTOS_DO_Q_Send(const REG_t *DataIn)
         		}
 				break;
 
+        	case REG_DO_PWM_FREQ__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		//DWORD is packed into Val (exact above 2^24)
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PWM_FREQ;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
+        	case REG_DO_PWM_PERIOD_NS__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PWM_T_NS;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
+        	case REG_DO_PWM_RES__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PWM_RES;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
         	case REG_DO_PWM_VAL__GID:
         		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
         		{
@@ -351,6 +547,78 @@ static void RTOS_DO_Q_Send(const REG_t *DataIn)
             		QueueData.Val = (float)BuffAny32.data_byte;
         		}
 				break;
+
+        	case REG_DO_PTO_PULSES__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PTO_PULSES;
+            		QueueData.Val = (float)BuffAny32.data_dword;
+        		}
+				break;
+
+        	case REG_DO_PTO_FREQ_START__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PTO_FREQ_START;
+            		QueueData.Val = (float)BuffAny32.data_dword;
+        		}
+				break;
+
+        	case REG_DO_PTO_FREQ_MAX__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PTO_FREQ_MAX;
+            		QueueData.Val = (float)BuffAny32.data_dword;
+        		}
+				break;
+
+        	case REG_DO_PTO_ACCEL__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PTO_ACCEL;
+            		QueueData.Val = (float)BuffAny32.data_dword;
+        		}
+				break;
+
+        	case REG_DO_PTO_PROFILE__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PTO_PROFILE;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_DO_PTO_START__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_PTO_START;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_DO_SAFE_VAL__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_SAFE_VAL;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_DO_SAFE_ALLOW__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_DO_Q_ID_SAFE_ALLOW;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
         }
 
 		if(QueueData.ID != PLC_DO_Q_ID_NONE)
@@ -374,6 +642,77 @@ static void RTOS_DO_Q_Send(const REG_t *DataIn)
 
 #ifdef RTE_MOD_AI
 
+/** @brief  Send data of waveform capture from AI_DATA_Q into REG
+ *  @param  DataIn - pointer to data.
+ *  @return None.
+ *  @note   Status and window are read from capture in place.
+ */
+static void RTOS_AI_CAP_DATA_Q_ToReg(const PlcAI_Q_t *DataIn)
+{
+	PlcAI_Cap_t Cap;
+	uint16_t    BuffWo;
+
+	switch(DataIn->ID)
+	{
+		case PLC_AI_Q_ID_CAP_SET:
+			if(DataIn->Ch < REG_AI_CAP_SET_SZ)
+			{
+				BuffWo = (uint16_t)DataIn->Val;
+				REG_CopyRegByPos((REG_AI_CAP_SET__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+			}
+			break;
+
+		case PLC_AI_Q_ID_CAP_CMD:
+			if(DataIn->Ch < REG_AI_CAP_CMD_SZ)
+			{
+				BuffWo = (uint16_t)DataIn->Val;
+				REG_CopyRegByPos((REG_AI_CAP_CMD__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+			}
+			break;
+
+		case PLC_AI_Q_ID_CAP_STAT:
+			BuffWo = PlcAI_CapGet(&Cap);
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_STATE, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+			BuffWo = Cap.Len;
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_LEN, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+			BuffWo = ((Cap.Len) ? Cap.Pre : 0);
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_TRIG, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+			BuffWo = (uint16_t)Cap.Hz;
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_RATE, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+			BuffWo = PLC_AI_SZ;
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_CH_SZ, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+			//window is refreshed after a change of state
+			BuffWo = PLC_AI_CAP_CODE_NONE;
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_WIN, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+			break;
+
+		case PLC_AI_Q_ID_CAP_WIN:
+			//scans are interleaved: Scan0.Ch0, Scan0.Ch1, ..., Scan1.Ch0, ...
+			for(uint16_t i=0; i<PLC_AI_CAP_WIN_SCANS; i++)
+			{
+				for(uint8_t j=0; j<PLC_AI_SZ; j++)
+				{
+					BuffWo = PlcAI_CapRead((uint16_t)DataIn->Val+i, j);
+					REG_CopyRegByPos((REG_AI_CAP_WIN__POS+i*PLC_AI_SZ+j), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+				}
+			}
+
+			//window is ready
+			BuffWo = (uint16_t)DataIn->Val;
+			REG_CopyRegByPos(REG_AI_CAP_STAT__POS_WIN, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+			break;
+	}
+
+#ifdef DEBUG_LOG_AI_DATA_Q
+	DebugLog("AI.CAP[%d].ID=%d .Val=%f\n\n", DataIn->Ch, DataIn->ID, DataIn->Val);
+#endif //DEBUG_LOG_AI_DATA_Q
+}
+
 /** @brief  Send data from AI_DATA_Q into REG
  *  @param  DataIn - pointer to data.
  *  @return None.
@@ -386,10 +725,15 @@ static void RTOS_AI_DATA_Q_ToReg(const PlcAI_Q_t *DataIn)
 
     if(DataIn)
     {
-        if(DataIn->Ch < PLC_AI_SZ)
+        if(DataIn->ID >= PLC_AI_Q_ID_CAP_SET && DataIn->ID <= PLC_AI_Q_ID_CAP_WIN)
         {
-            uint8_t BuffBy;
-            float   BuffFlo;
+        	RTOS_AI_CAP_DATA_Q_ToReg(DataIn);
+        }
+        else if(DataIn->Ch < PLC_AI_SZ)
+        {
+            uint8_t  BuffBy;
+            uint16_t BuffWo;
+            float    BuffFlo;
 
             switch(DataIn->ID)
             {
@@ -417,6 +761,71 @@ static void RTOS_AI_DATA_Q_ToReg(const PlcAI_Q_t *DataIn)
                     BuffBy = (uint8_t)DataIn->Val;
                     REG_CopyRegByPos((REG_AI_STATUS__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
 					break;
+
+				case PLC_AI_Q_ID_FLTR:
+                    BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_FLTR__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_AI_Q_ID_FLTR_PRM:
+                    BuffWo = (uint16_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_FLTR_PRM__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+					break;
+
+				case PLC_AI_Q_ID_OVS:
+                    BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_OVS__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_AI_Q_ID_RATE_ACT:
+					BuffFlo = DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_RATE_ACT__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+					break;
+
+				case PLC_AI_Q_ID_BITS_ACT:
+                    BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_BITS_ACT__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_AI_Q_ID_DB:
+					BuffFlo = DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_DB__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+					break;
+
+				case PLC_AI_Q_ID_DB_PCT:
+					BuffFlo = DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_DB_PCT__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+					break;
+
+				case PLC_AI_Q_ID_PUB_MIN:
+                    BuffWo = (uint16_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_PUB_MIN__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+					break;
+
+				case PLC_AI_Q_ID_PUB_HB:
+                    BuffWo = (uint16_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_PUB_HB__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+					break;
+
+				case PLC_AI_Q_ID_LIN:
+                    BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_LIN__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_AI_Q_ID_LIN_SZ:
+                    BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_LIN_SZ__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
+
+				case PLC_AI_Q_ID_THR:
+					BuffFlo = DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_THR__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+					break;
+
+				case PLC_AI_Q_ID_THR_REACHED:
+                    BuffBy = (uint8_t)DataIn->Val;
+                    REG_CopyRegByPos((REG_AI_THR_REACHED__POS+(DataIn->Ch)), REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+					break;
             }
 #ifdef DEBUG_LOG_AI_DATA_Q
 #ifdef DEBUG_LOG_AI_DATA_Q_VAL
@@ -479,6 +888,123 @@ static void RTOS_AI_Q_Send(const REG_t *DataIn)
             		QueueData.Val = BuffAny32.data_float;
         		}
 				break;
+
+        	case REG_AI_FLTR__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_FLTR;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_AI_FLTR_PRM__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_FLTR_PRM;
+            		QueueData.Val = (float)BuffAny32.data_word;
+        		}
+				break;
+
+        	case REG_AI_OVS__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_OVS;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_AI_DB__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_DB;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
+        	case REG_AI_DB_PCT__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_DB_PCT;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
+        	case REG_AI_PUB_MIN__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_PUB_MIN;
+            		QueueData.Val = (float)BuffAny32.data_word;
+        		}
+				break;
+
+        	case REG_AI_PUB_HB__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_PUB_HB;
+            		QueueData.Val = (float)BuffAny32.data_word;
+        		}
+				break;
+
+        	case REG_AI_LIN__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_LIN;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_AI_LIN_SZ__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_LIN_SZ;
+            		QueueData.Val = (float)BuffAny32.data_byte;
+        		}
+				break;
+
+        	case REG_AI_LIN_TBL__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_LIN_TBL;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
+        	case REG_AI_THR__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_THR;
+            		QueueData.Val = BuffAny32.data_float;
+        		}
+				break;
+
+        	case REG_AI_CAP_SET__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_CAP_SET;
+            		QueueData.Val = (float)BuffAny32.data_word;
+        		}
+				break;
+
+        	case REG_AI_CAP_CMD__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+            		QueueData.Ch  = DataIn->iGroup;
+            		QueueData.ID  = PLC_AI_Q_ID_CAP_CMD;
+            		QueueData.Val = (float)BuffAny32.data_word;
+        		}
+				break;
         }
 
 		if(QueueData.ID != PLC_AI_Q_ID_NONE)
@@ -500,8 +1026,190 @@ static void RTOS_AI_Q_Send(const REG_t *DataIn)
 #endif //RTE_MOD_AI
 
 
+#ifdef RTE_MOD_DO
+
+/** @var Watchdog statuses (last written into SYS_STAT1)
+ */
+static uint8_t RTOS_SFTY_CPLT[PLC_SFTY_WD_SZ];
+
+/** @brief  Set time of watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @param  TmIn - time (ms), 0 - off.
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX.
+ */
+static void RTOS_SFTY_SetTm(uint8_t WdIn, uint16_t TmIn)
+{
+	PlcSfty_SetTm(WdIn, TmIn);
+	REG_SYS_STAT1_Set(((WdIn == PLC_SFTY_WD_SCAN) ? PLC_SYS_STAT1_SFTY_TIM_SET : PLC_SYS_STAT1_WD_TIM_SET), ((TmIn) ? BIT_TRUE : BIT_FALSE));
+}
+
+/** @brief  Update watchdog statuses in SYS_STAT1.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX.
+ */
+static void RTOS_SFTY_Update(void)
+{
+	uint8_t Cplt;
+
+	for(uint8_t i=0; i<PLC_SFTY_WD_SZ; i++)
+	{
+		Cplt = PlcSfty_IsCplt(i);
+		if(Cplt != RTOS_SFTY_CPLT[i])
+		{
+			RTOS_SFTY_CPLT[i] = Cplt;
+			REG_SYS_STAT1_Set(((i == PLC_SFTY_WD_SCAN) ? PLC_SYS_STAT1_SFTY_TIM_CPLT : PLC_SYS_STAT1_WD_TIM_CPLT), Cplt);
+		}
+	}
+}
+
+/** @brief  Test change of watchdog statuses.
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - not changed
+ *  @arg    = 1 - changed
+ */
+static uint8_t RTOS_SFTY_IsChanged(void)
+{
+	for(uint8_t i=0; i<PLC_SFTY_WD_SZ; i++)
+	{
+		if(PlcSfty_IsCplt(i) != RTOS_SFTY_CPLT[i]) return (BIT_TRUE);
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Init. watchdogs by SYS_SET.
+ *  @param  None.
+ *  @return None.
+ */
+static void RTOS_SFTY_Init(void)
+{
+	uint16_t BuffWo;
+
+	for(uint8_t i=0; i<PLC_SFTY_WD_SZ; i++)
+	{
+		RTOS_SFTY_CPLT[i] = BIT_FALSE;
+	}
+
+	//LOCK
+	xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+
+	BuffWo = 0;
+	REG_CopyRegByPos(REG_SYS_SET__POS_SFTY_TIM_TM, REG_COPY_MB_TO_VAR, &BuffWo);
+	RTOS_SFTY_SetTm(PLC_SFTY_WD_SCAN, BuffWo);
+
+	BuffWo = 0;
+	REG_CopyRegByPos(REG_SYS_SET__POS_WD_TIM_TM, REG_COPY_MB_TO_VAR, &BuffWo);
+	RTOS_SFTY_SetTm(PLC_SFTY_WD_COMM, BuffWo);
+
+	RTOS_SFTY_Update();
+
+	xSemaphoreGive(RTOS_MBTABLES_MTX);
+	//UNLOCK
+}
+
+#endif //RTE_MOD_DO
+
+
 #ifdef RTE_MOD_SYS_REG
 
+/** @var Wall clock: time of the latest check and publishing (ms), published second
+ */
+static uint32_t RTOS_SYS_RTC_SYNC_TS = 0;
+static uint32_t RTOS_SYS_RTC_PUB_TS  = 0;
+static uint32_t RTOS_SYS_RTC_PUB_SEC = 0;
+
+/** @brief  Publish date and time of wall clock (SYS_STAT.RTC_...).
+ *  @param  None.
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX.
+ */
+static void RTOS_SYS_RTC_Pub(void)
+{
+	PlcDt_t  Dt;
+	uint16_t BuffWo[REG_SYS_RTC_SET_SZ];
+
+	plc_rtc_dt_get(&Dt);
+	RTOS_SYS_RTC_PUB_SEC = PlcDt_ToSec(&Dt);
+
+	BuffWo[0] = Dt.Year;
+	BuffWo[1] = Dt.Mon;
+	BuffWo[2] = Dt.Day;
+	BuffWo[3] = Dt.Hour;
+	BuffWo[4] = Dt.Min;
+	BuffWo[5] = Dt.Sec;
+
+	for(uint16_t i=0; i<REG_SYS_RTC_SET_SZ; i++)
+	{
+		REG_CopyRegByPos(REG_SYS_STAT__POS_RTC_YEAR+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo[i]);
+	}
+}
+
+/** @brief  Set RTC by SYS_RTC_SET.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called with locked RTOS_MBTABLES_MTX.
+ *          Invalid date and time is ignored (SYS_STAT.RTC_... is not changed).
+ */
+static void RTOS_SYS_RTC_Set(void)
+{
+	PlcDt_t  Dt;
+	uint16_t BuffWo[REG_SYS_RTC_SET_SZ];
+
+	for(uint16_t i=0; i<REG_SYS_RTC_SET_SZ; i++)
+	{
+		BuffWo[i] = 0;
+		REG_CopyRegByPos(REG_SYS_RTC_SET__POS_YEAR+i, REG_COPY_MB_TO_VAR, &BuffWo[i]);
+		if(i && BuffWo[i] > 0xFF) return;
+	}
+
+	Dt.Year = BuffWo[0];
+	Dt.Mon  = (uint8_t)BuffWo[1];
+	Dt.Day  = (uint8_t)BuffWo[2];
+	Dt.Hour = (uint8_t)BuffWo[3];
+	Dt.Min  = (uint8_t)BuffWo[4];
+	Dt.Sec  = (uint8_t)BuffWo[5];
+
+	if(plc_rtc_dt_set(&Dt))
+	{
+		RTOS_SYS_RTC_Pub();
+	}
+}
+
+/** @brief  Update wall clock.
+ *  @param  None.
+ *  @return None.
+ *  @note   Wall clock is checked by RTC every RTOS_DATA_RTC_SYNC_TM,
+ *          SYS_STAT.RTC_... are written on change of second.
+ */
+static void RTOS_SYS_RTC_Update(void)
+{
+	uint32_t Ts = HAL_GetTick();
+	PlcDt_t  Dt;
+
+	if((Ts-RTOS_SYS_RTC_SYNC_TS) >= RTOS_DATA_RTC_SYNC_TM)
+	{
+		RTOS_SYS_RTC_SYNC_TS = Ts;
+		plc_rtc_sync();
+	}
+
+	if((Ts-RTOS_SYS_RTC_PUB_TS) >= RTOS_DATA_RTC_PUB_TM)
+	{
+		RTOS_SYS_RTC_PUB_TS = Ts;
+
+		plc_rtc_dt_get(&Dt);
+		if(PlcDt_ToSec(&Dt) != RTOS_SYS_RTC_PUB_SEC)
+		{
+			//LOCK
+			xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+			RTOS_SYS_RTC_Pub();
+			xSemaphoreGive(RTOS_MBTABLES_MTX);
+			//UNLOCK
+		}
+	}
+}
+
 /** @brief  Set System Registers
  *  @param  DataIn - pointer to data.
  *  @return None.
@@ -530,7 +1238,70 @@ static void RTOS_SYS_REG_Set(const REG_t *DataIn)
         				REG_SYS_STAT1_Set(PLC_SYS_STAT1_LED_USER, BuffAny32.data_byte);
         			}
         		}
+#ifdef RTE_MOD_DO
+        		else if(DataIn->iReg == REG_SYS_CMD__POS_SFTY_TIM_RST || DataIn->iReg == REG_SYS_CMD__POS_WD_TIM_RST)
+        		{
+        			if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        			{
+        				if(BuffAny32.data_byte)
+        				{
+        					PlcSfty_Reset(((DataIn->iReg == REG_SYS_CMD__POS_SFTY_TIM_RST) ? PLC_SFTY_WD_SCAN : PLC_SFTY_WD_COMM));
+        					RTOS_SFTY_Update();
+
+        					//command is done
+        					BuffBy = BIT_FALSE;
+        					REG_CopyRegByPos(DataIn->iReg, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+        				}
+        			}
+        		}
+#endif // RTE_MOD_DO
+#ifdef RTE_MOD_APP
+        		else if(DataIn->iReg == REG_SYS_CMD__POS_PROF_RST)
+        		{
+        			if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        			{
+        				if(BuffAny32.data_byte)
+        				{
+        					RTOS_APP_ProfReset();
+
+        					//command is done
+        					BuffBy = BIT_FALSE;
+        					REG_CopyRegByPos(DataIn->iReg, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+        				}
+        			}
+        		}
+#endif // RTE_MOD_APP
+        		else if(DataIn->iReg == REG_SYS_CMD__POS_RTC_SET)
+        		{
+        			if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        			{
+        				if(BuffAny32.data_byte)
+        				{
+        					RTOS_SYS_RTC_Set();
+
+        					//command is done
+        					BuffBy = BIT_FALSE;
+        					REG_CopyRegByPos(DataIn->iReg, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+        				}
+        			}
+        		}
+				break;
+
+#ifdef RTE_MOD_DO
+        	case REG_SYS_SET__GID:
+        		if(REG_CopyValueFromMb(DataIn->Type, &BuffBy, BuffAny32.words, DataIn->MbTable, DataIn->pMbVar))
+        		{
+        			if(DataIn->iReg == REG_SYS_SET__POS_SFTY_TIM_TM)
+        			{
+        				RTOS_SFTY_SetTm(PLC_SFTY_WD_SCAN, BuffAny32.data_word);
+        			}
+        			else if(DataIn->iReg == REG_SYS_SET__POS_WD_TIM_TM)
+        			{
+        				RTOS_SFTY_SetTm(PLC_SFTY_WD_COMM, BuffAny32.data_word);
+        			}
+        		}
 				break;
+#endif // RTE_MOD_DO
         }
 	}
 }
@@ -593,6 +1364,22 @@ static void RTOS_REG_MON_Set(uint16_t IDxIn)
 #endif // RTE_MOD_REG_MON
 
 
+#ifdef RTE_MOD_RETAIN
+/** @var Retain-data: time of the latest commit (ms)
+ */
+static uint32_t RTOS_DATA_RETAIN_TS = 0;
+
+/** @var Retain-data: the spare sector is to be reclaimed after the latest commit
+ */
+static uint8_t RTOS_DATA_RETAIN_PREP = BIT_FALSE;
+
+/** @var Retain-data: commits are deferred, overflow (published values of SYS_STAT1.RetainWait, RetainOvf)
+ */
+static uint8_t RTOS_DATA_RETAIN_WAIT = BIT_FALSE;
+static uint8_t RTOS_DATA_RETAIN_OVF  = BIT_FALSE;
+#endif // RTE_MOD_RETAIN
+
+
 /** @brief  Task DATA_T
  *  @param  ParamsIn - pointer to additional task parameters.
  *  @return none.
@@ -624,6 +1411,11 @@ void RTOS_DATA_Task(void *ParamsIn)
     //INIT
     (void)ParamsIn; //fix unused
 
+#ifdef RTE_MOD_DO
+    //Fail-safe outputs (watchdogs)
+    RTOS_SFTY_Init();
+#endif // RTE_MOD_DO
+
     //START
     for(;;)
     {
@@ -687,6 +1479,59 @@ void RTOS_DATA_Task(void *ParamsIn)
         }
 #endif // RTE_MOD_REG_MON
 
+#ifdef RTE_MOD_DO
+        //Watchdog statuses (changed by SysTick ISR)
+        if(RTOS_SFTY_IsChanged())
+        {
+            //LOCK
+            xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+            RTOS_SFTY_Update();
+            xSemaphoreGive(RTOS_MBTABLES_MTX);
+            //UNLOCK
+        }
+#endif // RTE_MOD_DO
+
+#ifdef RTE_MOD_SYS_REG
+        //Wall clock
+        RTOS_SYS_RTC_Update();
+#endif // RTE_MOD_SYS_REG
+
+#ifdef RTE_MOD_RETAIN
+        //Retain-data of application (changed blocks):
+        //committed every RTOS_DATA_RETAIN_FLUSH_TM while application is started,
+        //at once while it is stopped, then flash is prepared for the next compaction;
+        //CPU is stalled by erasing, so while application is started the spare sector
+        //is reclaimed once between commits (nothing is done if it is erased already)
+        if(PLC_APP_STATE != PLC_APP_STATE_STARTED)
+        {
+            plc_backup_flush();
+            plc_backup_prepare();
+        }
+        else if((HAL_GetTick()-RTOS_DATA_RETAIN_TS) >= RTOS_DATA_RETAIN_FLUSH_TM)
+        {
+            RTOS_DATA_RETAIN_TS   = HAL_GetTick();
+            RTOS_DATA_RETAIN_PREP = BIT_TRUE;
+            plc_backup_flush();
+        }
+        else if(RTOS_DATA_RETAIN_PREP && (HAL_GetTick()-RTOS_DATA_RETAIN_TS) >= RTOS_DATA_RETAIN_PREP_TM)
+        {
+            RTOS_DATA_RETAIN_PREP = BIT_FALSE;
+            plc_backup_prepare();
+        }
+
+        if(RTOS_DATA_RETAIN_WAIT != (uint8_t)plc_backup_is_wait() || RTOS_DATA_RETAIN_OVF != (uint8_t)plc_backup_is_ovf())
+        {
+            RTOS_DATA_RETAIN_WAIT = (uint8_t)plc_backup_is_wait();
+            RTOS_DATA_RETAIN_OVF  = (uint8_t)plc_backup_is_ovf();
+            //LOCK
+            xSemaphoreTake(RTOS_MBTABLES_MTX, portMAX_DELAY);
+            REG_SYS_STAT1_Set(PLC_SYS_STAT1_RETAIN_WAIT, RTOS_DATA_RETAIN_WAIT);
+            REG_SYS_STAT1_Set(PLC_SYS_STAT1_RETAIN_OVF, RTOS_DATA_RETAIN_OVF);
+            xSemaphoreGive(RTOS_MBTABLES_MTX);
+            //UNLOCK
+        }
+#endif // RTE_MOD_RETAIN
+
         //fast switch to other task
         taskYIELD();
     }
@@ -13,6 +13,13 @@
  */
 static PlcDI_t PLC_DI[PLC_DI_SZ];
 volatile PlcDI_Fltr_t PLC_DI_FLTR[PLC_DI_SZ];
+volatile PlcDI_Cmp_t PLC_DI_CMP[PLC_DI_SZ];
+volatile PlcDI_Evt_t PLC_DI_EVT[PLC_DI_SZ];
+
+/** @var Event log: read cursors and last published heads
+ */
+static uint32_t PLC_DI_EVT_CURSOR[PLC_DI_SZ];
+static uint32_t PLC_DI_EVT_HEAD[PLC_DI_SZ];
 
 /** @var Timer statuses
  */
@@ -68,6 +75,26 @@ static uint8_t RTOS_DI_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 				QueueData.Val = (uint32_t)PLC_DI[ChIn].Pack.CntrSetpointReached;
 				break;
 
+			case PLC_DI_Q_ID_CNTR_CMP_ALLOW:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (uint32_t)PLC_DI[ChIn].Pack.CntrCmpAllow;
+				break;
+
+			case PLC_DI_Q_ID_CNTR_CMP_DO:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (uint32_t)PLC_DI[ChIn].CntrCmpDO;
+				break;
+
+			case PLC_DI_Q_ID_CNTR_CMP_DO_VAL:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (uint32_t)PLC_DI[ChIn].Pack.CntrCmpDOVal;
+				break;
+
+			case PLC_DI_Q_ID_CNTR_CMP_REACHED:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (uint32_t)PLC_DI[ChIn].Pack.CntrCmpReached;
+				break;
+
 			case PLC_DI_Q_ID_TACH_VAL:
 				QueueData.ID  = IDIn;
 				QueueData.Val = (uint32_t)PLC_DI[ChIn].TachVal;
@@ -102,6 +129,17 @@ static uint8_t RTOS_DI_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 				QueueData.ID  = IDIn;
 				QueueData.Val = PLC_DI_FLTR[ChIn].FltrDelay;
 				break;
+
+			case PLC_DI_Q_ID_EVT_HEAD:
+				QueueData.ID  = IDIn;
+				QueueData.Val = PLC_DI_EVT_HEAD[ChIn];
+				break;
+
+			case PLC_DI_Q_ID_EVT_CURSOR:
+			case PLC_DI_Q_ID_EVT_WIN:
+				QueueData.ID  = IDIn;
+				QueueData.Val = PLC_DI_EVT_CURSOR[ChIn];
+				break;
 		}
 
 		if(QueueData.ID != PLC_DI_Q_ID_NONE)
@@ -230,6 +268,11 @@ static uint8_t RTOS_DI_TestCntrSetpoint(uint8_t ChIn)
 {
     if(ChIn< PLC_DI_SZ)
     {
+#ifdef RTE_MOD_APP
+        //status before the test (event on rising edge)
+        uint8_t Prev = PLC_DI[ChIn].Pack.CntrSetpointReached;
+#endif //RTE_MOD_APP
+
         PLC_DI[ChIn].Pack.CntrSetpointReached = BIT_FALSE;
 
         if(PLC_DI[ChIn].Pack.CntrSetpointAllow)
@@ -239,11 +282,119 @@ static uint8_t RTOS_DI_TestCntrSetpoint(uint8_t ChIn)
                 PLC_DI[ChIn].Pack.CntrSetpointReached = BIT_TRUE;
             }
         }
+
+#ifdef RTE_MOD_APP
+        //event of tasks of application (setpoint is reached)
+        if(!Prev && PLC_DI[ChIn].Pack.CntrSetpointReached && (RTOS_APP_TRIG.Ch[RTOS_APP_TRIG_DI_CNTR] & ((uint32_t)1 << ChIn)))
+        {
+        	RTOS_APP_TRIG.Func(RTOS_APP_TRIG_DI_CNTR, ChIn, NULL);
+        }
+#endif //RTE_MOD_APP
         return (BIT_TRUE);
     }
     return (BIT_FALSE);
 }
 
+/** @brief  Ask DO_T to update status "Held by DI counter compare-match" of DO-channel.
+ *  @param  DOIn - DO-channel number.
+ *  @return None.
+ */
+static void RTOS_DI_CmpHeld_Send(uint8_t DOIn)
+{
+#ifdef RTE_MOD_DO
+	PlcDO_Q_t QueueData;
+
+	if(DOIn < PLC_DO_SZ)
+	{
+		QueueData.Ch  = DOIn;
+		QueueData.ID  = PLC_DO_Q_ID_CMP_HELD;
+		QueueData.Val = (float)0;
+
+		//Send data into RTOS_DO_Q (not-blocking)
+		xQueueSendToBack(RTOS_DO_Q, &QueueData, 0);
+	}
+#else
+	(void)DOIn;
+#endif // RTE_MOD_DO
+}
+
+/** @brief  Arm Counter compare-match.
+ *         The EXTI-side counter is synchronized with the task counter,
+ *         the latched status is cleared and the linked DO is released.
+ *  @param  ChIn - channel number.
+ *  @return Result:
+ *  @arg    = 0 - not armed
+ *  @arg    = 1 - armed
+ */
+static uint8_t RTOS_DI_ArmCntrCmp(uint8_t ChIn)
+{
+	uint8_t Armed;
+	uint8_t Held;
+
+    if(ChIn < PLC_DI_SZ)
+    {
+    	Armed = ((PLC_DI[ChIn].Mode == PLC_DI_MODE_CNTR && PLC_DI[ChIn].Pack.CntrCmpAllow && PLC_DI[ChIn].CntrCmpDO < PLC_DO_SZ) ? BIT_TRUE : BIT_FALSE);
+    	Held  = PLC_DO_SZ;
+
+    	taskENTER_CRITICAL();
+
+    	if(PLC_DI_CMP[ChIn].Reached && PLC_DI_CMP[ChIn].DO < PLC_DO_SZ)
+    	{
+    		PlcDO_ReleaseVal(PLC_DI_CMP[ChIn].DO, PLC_DO_FORCE_CMP);
+    		Held = PLC_DI_CMP[ChIn].DO;
+    	}
+
+    	PLC_DI_CMP[ChIn].DO       = PLC_DI[ChIn].CntrCmpDO;
+    	PLC_DI_CMP[ChIn].DOVal    = PLC_DI[ChIn].Pack.CntrCmpDOVal;
+    	PLC_DI_CMP[ChIn].Setpoint = PLC_DI[ChIn].CntrSetpoint;
+    	PLC_DI_CMP[ChIn].CntrVal  = PLC_DI[ChIn].CntrVal;
+    	PLC_DI_CMP[ChIn].PrevVal  = PLC_DI[ChIn].NormVal;
+    	PLC_DI_CMP[ChIn].Reached  = BIT_FALSE;
+    	PLC_DI_CMP[ChIn].Armed    = Armed;
+
+    	taskEXIT_CRITICAL();
+
+    	//DO released
+    	RTOS_DI_CmpHeld_Send(Held);
+
+    	if(PLC_DI[ChIn].Pack.CntrCmpReached)
+    	{
+    		PLC_DI[ChIn].Pack.CntrCmpReached = BIT_FALSE;
+    		RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_CMP_REACHED);
+    	}
+
+#ifdef DEBUG_LOG_DI
+		DebugLog("DI[%d].Cmp.Armed=%d .DO=%d .DOVal=%d .Sp=%d\n", ChIn, PLC_DI_CMP[ChIn].Armed, PLC_DI_CMP[ChIn].DO, PLC_DI_CMP[ChIn].DOVal, PLC_DI_CMP[ChIn].Setpoint);
+#endif // DEBUG_LOG_DI
+
+    	return (Armed);
+    }
+    return (BIT_FALSE);
+}
+
+/** @brief  Test Counter compare-match status (latched by EXTI).
+ *  @param  ChIn - channel number.
+ *  @return Result:
+ *  @arg    = 0 - not changed
+ *  @arg    = 1 - changed
+ */
+static uint8_t RTOS_DI_TestCntrCmp(uint8_t ChIn)
+{
+    if(ChIn < PLC_DI_SZ)
+    {
+    	if(PLC_DI[ChIn].Pack.CntrCmpReached != PLC_DI_CMP[ChIn].Reached)
+    	{
+    		PLC_DI[ChIn].Pack.CntrCmpReached = PLC_DI_CMP[ChIn].Reached;
+    		RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_CMP_REACHED);
+
+    		//DO forced
+    		if(PLC_DI[ChIn].Pack.CntrCmpReached) RTOS_DI_CmpHeld_Send(PLC_DI_CMP[ChIn].DO);
+    		return (BIT_TRUE);
+    	}
+    }
+    return (BIT_FALSE);
+}
+
 /** @brief  Reset Counter.
  *  @param  ChIn  - channel number.
  *  @return Result:
@@ -260,6 +411,7 @@ static uint8_t RTOS_DI_ResetCntr(uint8_t ChIn)
     {
     	PLC_DI[ChIn].CntrVal = 0;
     	RTOS_DI_TestCntrSetpoint(ChIn);
+    	RTOS_DI_ArmCntrCmp(ChIn);
 
 #ifdef DEBUG_LOG_DI
 		DebugLog("DI[%d].CntrVal=%d .Sp=%d .SpA=%d .SpR=%d\n", ChIn, PLC_DI[ChIn].CntrVal, PLC_DI[ChIn].CntrSetpoint, PLC_DI[ChIn].Pack.CntrSetpointAllow, PLC_DI[ChIn].Pack.CntrSetpointReached);
@@ -300,6 +452,7 @@ static uint8_t RTOS_DI_SetCntr(uint8_t ChIn, uint8_t ValIn, uint8_t ValPrevIn)
 
             RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_VAL);
             RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_SETPOINT_REACHED);
+            RTOS_DI_TestCntrCmp(ChIn);
             return (BIT_TRUE);
         }
     }
@@ -664,6 +817,7 @@ static uint8_t RTOS_DI_SetCntrSetpoint(uint8_t ChIn, uint32_t ValIn)
 		{
 			PLC_DI[ChIn].CntrSetpoint = ValIn;
 			RTOS_DI_TestCntrSetpoint(ChIn);
+			RTOS_DI_ArmCntrCmp(ChIn);
 
 			RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_SETPOINT);
 			RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_SETPOINT_REACHED);
@@ -709,6 +863,89 @@ static uint8_t RTOS_DI_SetCntrSetpointAllow(uint8_t ChIn, uint8_t ValIn)
 	return (BIT_FALSE);
 }
 
+/** @brief  Set Counter compare-match allow.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - compare-match allow.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DI_SetCntrCmpAllow(uint8_t ChIn, uint8_t ValIn)
+{
+#ifdef DEBUG_LOG_DI_Q
+	DebugLog("RTOS_DI_SetCntrCmpAllow\n");
+#endif // DEBUG_LOG_DI_Q
+
+	if(ChIn < PLC_DI_SZ)
+	{
+		if(PLC_DI[ChIn].Pack.CntrCmpAllow != ValIn)
+		{
+			PLC_DI[ChIn].Pack.CntrCmpAllow = ((ValIn) ? BIT_TRUE : BIT_FALSE);
+			RTOS_DI_ArmCntrCmp(ChIn);
+
+			RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_CMP_ALLOW);
+            return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set DO-channel linked to Counter compare-match.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - DO-channel number:
+ *  @arg    = 0 ... PLC_DO_SZ-1
+ *  @arg    = PLC_DI_CNTR_CMP_DO_NONE (or any other value) - not linked
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DI_SetCntrCmpDO(uint8_t ChIn, uint8_t ValIn)
+{
+#ifdef DEBUG_LOG_DI_Q
+	DebugLog("RTOS_DI_SetCntrCmpDO\n");
+#endif // DEBUG_LOG_DI_Q
+
+	if(ChIn < PLC_DI_SZ)
+	{
+		if(PLC_DI[ChIn].CntrCmpDO != ValIn)
+		{
+			PLC_DI[ChIn].CntrCmpDO = ValIn;
+			RTOS_DI_ArmCntrCmp(ChIn);
+
+			RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_CMP_DO);
+            return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set DO-value of Counter compare-match.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - DO-value.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DI_SetCntrCmpDOVal(uint8_t ChIn, uint8_t ValIn)
+{
+#ifdef DEBUG_LOG_DI_Q
+	DebugLog("RTOS_DI_SetCntrCmpDOVal\n");
+#endif // DEBUG_LOG_DI_Q
+
+	if(ChIn < PLC_DI_SZ)
+	{
+		if(PLC_DI[ChIn].Pack.CntrCmpDOVal != ValIn)
+		{
+			PLC_DI[ChIn].Pack.CntrCmpDOVal = ((ValIn) ? BIT_TRUE : BIT_FALSE);
+			RTOS_DI_ArmCntrCmp(ChIn);
+
+			RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_CNTR_CMP_DO_VAL);
+            return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
 /** @brief  Set Tachometer setpoint value.
  *  @param  ChIn  - channel number.
  *  @param  ValIn - setpoint value.
@@ -832,6 +1069,79 @@ static uint8_t RTOS_DI_SetFilterDelay(uint8_t ChIn, uint32_t ValIn)
 	return (BIT_FALSE);
 }
 
+/** @brief  Set Event log read cursor.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - number of the first record in the window.
+ *  @return Result:
+ *  @arg    = 0 - not set (out of channels)
+ *  @arg    = 1 - set
+ *  @note   The cursor is clamped to the records that are still in the log,
+ *          so a jump of the published cursor means lost records.
+ */
+static uint8_t RTOS_DI_SetEvtCursor(uint8_t ChIn, uint32_t ValIn)
+{
+#ifdef DEBUG_LOG_DI_Q
+	DebugLog("RTOS_DI_SetEvtCursor\n");
+#endif // DEBUG_LOG_DI_Q
+
+	uint32_t Head;
+
+	if(ChIn < PLC_DI_SZ)
+	{
+		Head = PLC_DI_EVT[ChIn].Head;
+
+		if((uint32_t)(Head - ValIn) > PLC_DI_EVT_LOG_SZ)
+		{
+			//cursor is behind the oldest record (or ahead of head)
+			ValIn = (((int32_t)(Head - ValIn) < 0) ? Head : (Head - PLC_DI_EVT_LOG_SZ));
+		}
+
+		PLC_DI_EVT_CURSOR[ChIn] = ValIn;
+
+		RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_EVT_CURSOR);
+		RTOS_DI_DATA_Q_Send(ChIn, PLC_DI_Q_ID_EVT_WIN);
+
+#ifdef DEBUG_LOG_DI_Q
+		DebugLog("DI[%d].Evt.Head=%d .Cursor=%d\n", ChIn, Head, PLC_DI_EVT_CURSOR[ChIn]);
+#endif // DEBUG_LOG_DI_Q
+		return (BIT_TRUE);
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Survey Event logs (publish new records).
+ *  @param  None.
+ *  @return None.
+ */
+static void RTOS_DI_SurveyEvt(void)
+{
+	uint32_t Head;
+	uint32_t HeadPrev;
+
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		Head = PLC_DI_EVT[i].Head;
+
+		if(Head != PLC_DI_EVT_HEAD[i])
+		{
+			HeadPrev = PLC_DI_EVT_HEAD[i];
+			PLC_DI_EVT_HEAD[i] = Head;
+			RTOS_DI_DATA_Q_Send(i, PLC_DI_Q_ID_EVT_HEAD);
+
+			if((uint32_t)(Head - PLC_DI_EVT_CURSOR[i]) > PLC_DI_EVT_LOG_SZ)
+			{
+				//unread records are overwritten
+				RTOS_DI_SetEvtCursor(i, PLC_DI_EVT_CURSOR[i]);
+			}
+			else if((int32_t)(HeadPrev - PLC_DI_EVT_CURSOR[i]) < (int32_t)PLC_DI_EVT_WIN_SZ)
+			{
+				//new records are in the window
+				RTOS_DI_DATA_Q_Send(i, PLC_DI_Q_ID_EVT_WIN);
+			}
+		}
+	}
+}
+
 /** @brief  Set settings.
  *  @param  DataIn - pointer to data.
  *  @return None.
@@ -854,6 +1164,18 @@ static void RTOS_DI_Set(const PlcDI_Q_t *DataIn)
             	RTOS_DI_SetCntrSetpointAllow(DataIn->Ch, (uint8_t)DataIn->Val);
             	break;
 
+            case PLC_DI_Q_ID_CNTR_CMP_ALLOW:
+            	RTOS_DI_SetCntrCmpAllow(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_DI_Q_ID_CNTR_CMP_DO:
+            	RTOS_DI_SetCntrCmpDO(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_DI_Q_ID_CNTR_CMP_DO_VAL:
+            	RTOS_DI_SetCntrCmpDOVal(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
             case PLC_DI_Q_ID_TACH_SETPOINT:
             	RTOS_DI_SetTachSetpoint(DataIn->Ch, (uint16_t)DataIn->Val);
             	break;
@@ -869,11 +1191,56 @@ static void RTOS_DI_Set(const PlcDI_Q_t *DataIn)
             case PLC_DI_Q_ID_FILTER_DELAY:
             	RTOS_DI_SetFilterDelay(DataIn->Ch, DataIn->Val);
             	break;
+
+            case PLC_DI_Q_ID_EVT_CURSOR:
+            	RTOS_DI_SetEvtCursor(DataIn->Ch, DataIn->Val);
+            	break;
         }
     }
 }
 
 
+/** @brief  Counter compare-match (EXTI-side counter).
+ *         Counts rising edges and forces the linked DO-channel
+ *         as soon as the counter reaches the setpoint.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - channel value.
+ *  @return None.
+ *  @note   Called from ISR (or DI_FLTR_TIM for filtered channels), does not use RTOS API.
+ */
+static void PlcDI_CntrCmp(uint8_t ChIn, uint8_t ValIn)
+{
+	if(PLC_DI_CMP[ChIn].Armed)
+	{
+		//by Front
+		if(ValIn && !PLC_DI_CMP[ChIn].PrevVal)
+		{
+			PLC_DI_CMP[ChIn].CntrVal++;
+
+			if(!PLC_DI_CMP[ChIn].Reached && PLC_DI_CMP[ChIn].CntrVal >= PLC_DI_CMP[ChIn].Setpoint)
+			{
+				PlcDO_ForceVal(PLC_DI_CMP[ChIn].DO, PLC_DO_FORCE_CMP, PLC_DI_CMP[ChIn].DOVal);
+				PLC_DI_CMP[ChIn].Reached = BIT_TRUE;
+			}
+		}
+		PLC_DI_CMP[ChIn].PrevVal = ValIn;
+	}
+}
+
+/** @brief  Capture edge into Event log.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - new level.
+ *  @return None.
+ *  @note   Called from ISR, the record is written in place.
+ */
+static void PlcDI_CaptureEvt(uint8_t ChIn, uint8_t ValIn)
+{
+	uint32_t Head = PLC_DI_EVT[ChIn].Head;
+
+	PLC_DI_EVT[ChIn].Buff[Head & (PLC_DI_EVT_LOG_SZ-1)] = PLC_DI_EVT_REC(PlcSysTick_GetUs(), ValIn);
+	PLC_DI_EVT[ChIn].Head = Head+1;
+}
+
 /** @brief  Callback for DI.IRQ.Exti
  *  @param  DataIn - channel number.
  *  @return None.
@@ -884,6 +1251,12 @@ static void PlcDI_Exti(PlcDI_IRQ_Q_t DataIn)
 
 	if(DataIn.Ch < PLC_DI_SZ)
 	{
+		//raw edge (before filter)
+		if(PLC_DI[DataIn.Ch].Mode != PLC_DI_MODE_OFF)
+		{
+			PlcDI_CaptureEvt(DataIn.Ch, DataIn.Val);
+		}
+
 		if(PLC_DI_FLTR[DataIn.Ch].FltrDelay)
 		{
 			//with filter
@@ -898,11 +1271,23 @@ static void PlcDI_Exti(PlcDI_IRQ_Q_t DataIn)
 		}
 		else
 		{
-		    //Send IRQ-data to RTOS_DI_IRQ_Q (not-blocking)
 			//without filter
+			PlcDI_CntrCmp(DataIn.Ch, DataIn.Val);
+
+		    //Send IRQ-data to RTOS_DI_IRQ_Q (not-blocking)
 		    xQueueSendToBackFromISR(RTOS_DI_IRQ_Q, &DataIn, &HiTaskWoken);
+
+#ifdef RTE_MOD_APP
+		    //event of tasks of application (rising edge)
+		    if(DataIn.Val && PLC_DI[DataIn.Ch].Mode != PLC_DI_MODE_OFF && (RTOS_APP_TRIG.Ch[RTOS_APP_TRIG_DI_EDGE] & ((uint32_t)1 << DataIn.Ch)))
+		    {
+		    	RTOS_APP_TRIG.Func(RTOS_APP_TRIG_DI_EDGE, DataIn.Ch, &HiTaskWoken);
+		    }
+#endif //RTE_MOD_APP
 		}
 	}
+
+	portYIELD_FROM_ISR(HiTaskWoken);
 }
 
 
@@ -942,6 +1327,19 @@ static void RTOS_DI_Init(void)
 
 		PLC_DI[i].Pack.Reset = BIT_FALSE;
 
+		BuffBy = PLC_DI_CNTR_CMP_ALLOW_DEF;
+		REG_CopyRegByPos(REG_DI_CNTR_CMP_ALLOW__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+		PLC_DI[i].Pack.CntrCmpAllow   = BuffBy;
+		PLC_DI[i].Pack.CntrCmpReached = BIT_FALSE;
+
+		BuffBy = PLC_DI_CNTR_CMP_DO_VAL_DEF;
+		REG_CopyRegByPos(REG_DI_CNTR_CMP_DO_VAL__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+		PLC_DI[i].Pack.CntrCmpDOVal = BuffBy;
+
+		BuffBy = PLC_DI_CNTR_CMP_DO_DEF;
+		REG_CopyRegByPos(REG_DI_CNTR_CMP_DO__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+		PLC_DI[i].CntrCmpDO = BuffBy;
+
 		BuffDWo = PLC_DI_CNTR_SETPOINT_DEF;
 		REG_CopyRegByPos(REG_DI_CNTR_SETPOINT__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
 		PLC_DI[i].CntrSetpoint = BuffDWo;
@@ -963,6 +1361,13 @@ static void RTOS_DI_Init(void)
 		PLC_DI_FLTR[i].FltrTs    = HAL_GetTick();
 		PLC_DI_FLTR[i].FltrVal   = BIT_FALSE;
 
+		PLC_DI_CMP[i].Reached = BIT_FALSE;
+		RTOS_DI_ArmCntrCmp(i);
+
+		PLC_DI_EVT[i].Head    = 0;
+		PLC_DI_EVT_HEAD[i]    = 0;
+		PLC_DI_EVT_CURSOR[i]  = 0;
+
 		if(PLC_DI[i].Mode == PLC_DI_MODE_TACH || (PLC_DI[i].Mode == PLC_DI_MODE_INC2 && PLC_DI_IS_PHASE_B(i)))
 		{
 			cTachSurv++;
@@ -973,10 +1378,9 @@ static void RTOS_DI_Init(void)
 #endif // DEBUG_LOG_DI
 	}
 
-	PLC_DI00_USER_FUNC.Exti = PlcDI_Exti;
-	PLC_DI01_USER_FUNC.Exti = PlcDI_Exti;
+	PLC_DI_USER_FUNC.Exti = PlcDI_Exti;
 
-	PlcDI_Init();
+	if(!PlcDI_Init()) _Error_Handler(__FILE__, __LINE__);
 	if(cTachSurv) RTOS_DI_TACH_TIM_Start(BIT_FALSE);
 }
 
@@ -1011,13 +1415,15 @@ void RTOS_DI_Task(void *ParamsIn)
     //start
     for(;;)
     {
-    	//Read RTOS_DI_Q (blocking)
-		QueueStatus = xQueueReceive(RTOS_DI_Q, &QueueData, portMAX_DELAY);
+    	//Read RTOS_DI_Q (blocking up to Event log survey period)
+		QueueStatus = xQueueReceive(RTOS_DI_Q, &QueueData, RTOS_DI_EVT_SURVEY_TM);
 		if(QueueStatus == pdPASS)
 		{
 			RTOS_DI_Set(&QueueData);
 		}
 
+		RTOS_DI_SurveyEvt();
+
         //fast switch to other task
         taskYIELD();
     }
@@ -1026,6 +1432,56 @@ void RTOS_DI_Task(void *ParamsIn)
 }
 
 
+/** @brief  Read Event log record.
+ *  @param  ChIn  - channel number.
+ *  @param  SeqIn - record number.
+ *  @return Record or PLC_DI_EVT_REC_NONE (not captured yet or overwritten).
+ */
+uint32_t RTOS_DI_ReadEvt(uint8_t ChIn, uint32_t SeqIn)
+{
+	uint32_t Rec = PLC_DI_EVT_REC_NONE;
+
+	if(ChIn < PLC_DI_SZ)
+	{
+		if((uint32_t)(PLC_DI_EVT[ChIn].Head - SeqIn - 1) < PLC_DI_EVT_LOG_SZ)
+		{
+			Rec = PLC_DI_EVT[ChIn].Buff[SeqIn & (PLC_DI_EVT_LOG_SZ-1)];
+
+			//the record could be overwritten while reading
+			if((uint32_t)(PLC_DI_EVT[ChIn].Head - SeqIn - 1) >= PLC_DI_EVT_LOG_SZ) Rec = PLC_DI_EVT_REC_NONE;
+		}
+	}
+	return (Rec);
+}
+
+
+/** @brief  Latch input values of all channels (input image).
+ *  @param  NormOut - normal values [PLC_DI_SZ].
+ *  @param  CntrOut - counter values [PLC_DI_SZ].
+ *  @param  TachOut - tachometer values [PLC_DI_SZ].
+ *  @return None.
+ *  @note   Called by APP_T at the start of scan (scheduler is suspended).
+ *          Pins are read by one pass of GPIO (IDR),
+ *          filtered channels return the filtered value.
+ */
+void RTOS_DI_Latch(uint8_t *NormOut, uint32_t *CntrOut, uint16_t *TachOut)
+{
+	uint32_t Pins = PlcDI_ReadAll();
+
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		if(NormOut)
+		{
+			if(PLC_DI[i].Mode == PLC_DI_MODE_OFF) NormOut[i] = BIT_FALSE;
+			else if(PLC_DI_FLTR[i].FltrDelay)     NormOut[i] = PLC_DI[i].NormVal;
+			else                                  NormOut[i] = ((Pins & ((uint32_t)1 << i)) ? BIT_TRUE : BIT_FALSE);
+		}
+		if(CntrOut) CntrOut[i] = PLC_DI[i].CntrVal;
+		if(TachOut) TachOut[i] = PLC_DI[i].TachVal;
+	}
+}
+
+
 /** @brief  DI_TACH_TIM Handler (auto-reloaded with controlled launch)
  *  @param  TimerIn - timer.
  *  @return None.
@@ -1095,8 +1551,21 @@ void RTOS_DI_FLTR_TIM_Handler(TimerHandle_t TimerIn)
         		QueueData.Ch  = PLC_DI[i].Ch;
         		QueueData.Val = PLC_DI_FLTR[i].FltrVal;
         		PLC_DI_FLTR[i].Fltr = BIT_FALSE;
+
+        		taskENTER_CRITICAL();
+        		PlcDI_CntrCmp(i, QueueData.Val);
+        		taskEXIT_CRITICAL();
+
     			//Send filtered normal value to RTOS_DI_IRQ_Q (not-blocking)
     			xQueueSendToBack(RTOS_DI_IRQ_Q, &QueueData, 0);
+
+#ifdef RTE_MOD_APP
+    			//event of tasks of application (rising edge of filtered value)
+    			if(QueueData.Val && !PLC_DI[i].NormVal && (RTOS_APP_TRIG.Ch[RTOS_APP_TRIG_DI_EDGE] & ((uint32_t)1 << i)))
+    			{
+    				RTOS_APP_TRIG.Func(RTOS_APP_TRIG_DI_EDGE, i, NULL);
+    			}
+#endif //RTE_MOD_APP
         	}
         	else
         	{
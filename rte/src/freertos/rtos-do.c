@@ -14,6 +14,11 @@
  */
 static PlcDO_t PLC_DO[PLC_DO_SZ];
 
+/** @var Latency of output image (us): last, max.
+ */
+static uint32_t RTOS_DO_IMG_LAT;
+static uint32_t RTOS_DO_IMG_LAT_MAX;
+
 
 /** @brief  Copy data into RTOS_DO_DATA_Q (confirmed data).
  *  @param  ChIn - channel number.
@@ -25,6 +30,7 @@ static PlcDO_t PLC_DO[PLC_DO_SZ];
 static uint8_t RTOS_DO_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 {
 	PlcDO_Q_t QueueData;
+	ANY32_uwt BuffAny32;
 
 	if(ChIn < PLC_DO_SZ)
 	{
@@ -53,6 +59,36 @@ static uint8_t RTOS_DO_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 				QueueData.Val = PLC_DO[ChIn].PwmT;
 				break;
 
+			//DWORD is packed into Val (exact above 2^24)
+			case PLC_DO_Q_ID_PWM_FREQ:
+				QueueData.ID  = IDIn;
+				BuffAny32.data_dword = PLC_DO[ChIn].PwmFreq;
+				QueueData.Val = BuffAny32.data_float;
+				break;
+
+			case PLC_DO_Q_ID_PWM_T_NS:
+				QueueData.ID  = IDIn;
+				BuffAny32.data_dword = PLC_DO[ChIn].PwmTns;
+				QueueData.Val = BuffAny32.data_float;
+				break;
+
+			case PLC_DO_Q_ID_PWM_RES:
+				QueueData.ID  = IDIn;
+				BuffAny32.data_dword = PLC_DO[ChIn].PwmRes;
+				QueueData.Val = BuffAny32.data_float;
+				break;
+
+			case PLC_DO_Q_ID_PWM_FREQ_ACT:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].PwmFreqAct/1000.0f;
+				break;
+
+			case PLC_DO_Q_ID_PWM_RES_ACT:
+				QueueData.ID  = IDIn;
+				BuffAny32.data_dword = PLC_DO[ChIn].PwmResAct;
+				QueueData.Val = BuffAny32.data_float;
+				break;
+
 			case PLC_DO_Q_ID_PWM_D:
 				QueueData.ID  = IDIn;
 				QueueData.Val = PLC_DO[ChIn].PwmD;
@@ -77,6 +113,56 @@ static uint8_t RTOS_DO_DATA_Q_Send(uint8_t ChIn, uint8_t IDIn)
 				QueueData.ID  = IDIn;
 				QueueData.Val = (float)PLC_DO[ChIn].Status;
 				break;
+
+			case PLC_DO_Q_ID_PTO_PULSES:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].PtoPulses;
+				break;
+
+			case PLC_DO_Q_ID_PTO_FREQ_START:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].PtoFreqStart;
+				break;
+
+			case PLC_DO_Q_ID_PTO_FREQ_MAX:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].PtoFreqMax;
+				break;
+
+			case PLC_DO_Q_ID_PTO_ACCEL:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].PtoAccel;
+				break;
+
+			case PLC_DO_Q_ID_PTO_PROFILE:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].PtoProfile;
+				break;
+
+			case PLC_DO_Q_ID_PTO_START:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].Pack.PtoStart;
+				break;
+
+			case PLC_DO_Q_ID_PTO_DONE:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].Pack.PtoDone;
+				break;
+
+			case PLC_DO_Q_ID_CMP_HELD:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)PLC_DO[ChIn].Pack.CmpHeld;
+				break;
+
+			case PLC_DO_Q_ID_IMG_LAT:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)RTOS_DO_IMG_LAT;
+				break;
+
+			case PLC_DO_Q_ID_IMG_LAT_MAX:
+				QueueData.ID  = IDIn;
+				QueueData.Val = (float)RTOS_DO_IMG_LAT_MAX;
+				break;
 		}
 
 		if(QueueData.ID != PLC_DO_Q_ID_NONE)
@@ -193,6 +279,32 @@ static uint8_t RTOS_DO_SetModePwm(uint8_t ChIn)
 	return (BIT_FALSE);
 }
 
+/** @brief  Set Mode PTO.
+ *  @param  ChIn - channel number.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DO_SetModePto(uint8_t ChIn)
+{
+	if(ChIn < PLC_DO_SZ)
+	{
+#ifdef DEBUG_LOG_DO_Q
+	DebugLog("RTOS_DO_SetModePto\n");
+#endif // DEBUG_LOG_DO_Q
+
+		PLC_DO[ChIn].Mode   = PLC_DO_MODE_PTO;
+		PLC_DO[ChIn].Status = PLC_DO_STATUS_PTO_OFF;
+		PlcDO_SetNormVal(&PLC_DO[ChIn], BIT_FALSE);
+
+#ifdef DEBUG_LOG_DO_Q
+	DebugLog("DO[%d].Mode=%d(PTO) .Stat=%d\n\n", ChIn, PLC_DO[ChIn].Mode, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q
+		return (BIT_TRUE);
+	}
+	return (BIT_FALSE);
+}
+
 /** @brief  Set Mode.
  *  @param  ChIn   - channel number.
  *  @param  ModeIn - mode.
@@ -210,6 +322,14 @@ static uint8_t RTOS_DO_SetMode(uint8_t ChIn, uint8_t ModeIn)
 	{
 		if(PLC_DO[ChIn].Mode != ModeIn)
 		{
+			if(PLC_DO[ChIn].Mode == PLC_DO_MODE_PTO)
+			{
+				//abort pulse train
+				PlcDO_PtoStop(&PLC_DO[ChIn]);
+				PLC_DO[ChIn].Pack.PtoStart = BIT_FALSE;
+				RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_START);
+			}
+
 			switch(ModeIn)
 			{
 				case PLC_DO_MODE_OFF:
@@ -227,6 +347,10 @@ static uint8_t RTOS_DO_SetMode(uint8_t ChIn, uint8_t ModeIn)
 				case PLC_DO_MODE_PWM:
 					RTOS_DO_SetModePwm(ChIn);
 					break;
+
+				case PLC_DO_MODE_PTO:
+					RTOS_DO_SetModePto(ChIn);
+					break;
 			}
 
 			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_MODE);
@@ -241,6 +365,9 @@ static uint8_t RTOS_DO_SetMode(uint8_t ChIn, uint8_t ModeIn)
 				PlcDO_Stop(&PLC_DO[ChIn]);
 			}
 
+			//channel is re-configured: keep safe output if a watchdog is expired
+			PlcSfty_SetOut(ChIn, PLC_DO[ChIn].Pack.SafeAllow, PLC_DO[ChIn].SafeVal);
+
 			return (BIT_TRUE);
 		}
 	}
@@ -317,12 +444,46 @@ static uint8_t RTOS_DO_SetFastVal(uint8_t ChIn, uint8_t ValIn)
 	return (BIT_FALSE);
 }
 
+/** @brief  Plan PWM.Period by active request and confirm achieved values.
+ *  @param  ChIn  - channel number.
+ *  @return None.
+ *  @note   Active request: PwmFreq (Hz) > 0, else PwmTns (ns) > 0, else PwmT (ms).
+ */
+static void RTOS_DO_SetPwmPlan(uint8_t ChIn)
+{
+	if(ChIn < PLC_DO_SZ)
+	{
+		//period and refreshed pulse are applied together
+		if(PLC_DO[ChIn].PwmFreq)
+		{
+			PlcDO_SetPlan(&PLC_DO[ChIn], PLC_PWM_PLAN_UNIT_HZ, PLC_DO[ChIn].PwmFreq);
+		}
+		else if(PLC_DO[ChIn].PwmTns)
+		{
+			PlcDO_SetPlan(&PLC_DO[ChIn], PLC_PWM_PLAN_UNIT_NS, PLC_DO[ChIn].PwmTns);
+		}
+		else
+		{
+			PlcDO_SetPeriod(&PLC_DO[ChIn], PLC_DO[ChIn].PwmT);
+		}
+
+		RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_T);
+		RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_FREQ_ACT);
+		RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_RES_ACT);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+		DebugLog("DO[%d].PwmT=%f .Psc=%d .Arr=%d .FreqAct=%d .Plan=%d .PwmD=%f .Ccr=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PwmT, PLC_DO[ChIn].Psc, PLC_DO[ChIn].Arr, PLC_DO[ChIn].PwmFreqAct, PLC_DO[ChIn].PwmPlan, PLC_DO[ChIn].PwmD, PLC_DO[ChIn].Ccr, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+	}
+}
+
 /** @brief  Set PWM.Period.
  *  @param  ChIn  - channel number.
- *  @param  ValIn - value.
+ *  @param  ValIn - value (ms).
  *  @return Result:
  *  @arg    = 0 - not set
  *  @arg    = 1 - set
+ *  @note   Requests by frequency and by period (ns) are reset.
  */
 static uint8_t RTOS_DO_SetPwmPeriod(uint8_t ChIn, float ValIn)
 {
@@ -332,16 +493,115 @@ static uint8_t RTOS_DO_SetPwmPeriod(uint8_t ChIn, float ValIn)
 
 	if(ChIn < PLC_DO_SZ)
 	{
-		if(PLC_DO[ChIn].PwmT != ValIn)
+		if(PLC_DO[ChIn].PwmT != ValIn || PLC_DO[ChIn].PwmFreq || PLC_DO[ChIn].PwmTns)
+		{
+			PLC_DO[ChIn].PwmFreq = 0;
+			PLC_DO[ChIn].PwmTns  = 0;
+			PLC_DO[ChIn].PwmT    = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_FREQ);
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_T_NS);
+			RTOS_DO_SetPwmPlan(ChIn);
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PWM.Frequency.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value (Hz):
+ *  @arg    = 0 - not used (PWM.Period is used)
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Request by period (ns) is reset.
+ */
+static uint8_t RTOS_DO_SetPwmFreq(uint8_t ChIn, uint32_t ValIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPwmFreq\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(ValIn > PLC_DO_PWM_FREQ__MAX) ValIn = PLC_DO_PWM_FREQ__MAX;
+
+		if(PLC_DO[ChIn].PwmFreq != ValIn)
 		{
-			PLC_DO[ChIn].PwmT = PlcDO_SetPeriod(&PLC_DO[ChIn], ValIn);
-			//refresh pulse
-			PlcDO_SetPulse(&PLC_DO[ChIn], PLC_DO[ChIn].PwmD);
-			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_T);
+			PLC_DO[ChIn].PwmFreq = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_FREQ);
+
+			if(ValIn && PLC_DO[ChIn].PwmTns)
+			{
+				PLC_DO[ChIn].PwmTns = 0;
+				RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_T_NS);
+			}
+
+			RTOS_DO_SetPwmPlan(ChIn);
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
 
+/** @brief  Set PWM.Period (ns).
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value (ns):
+ *  @arg    = 0 - not used (PWM.Period is used)
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Request by frequency is reset.
+ */
+static uint8_t RTOS_DO_SetPwmPeriodNs(uint8_t ChIn, uint32_t ValIn)
+{
 #ifdef DEBUG_LOG_DO_Q_VAL
-			DebugLog("DO[%d].PwmT=%f .Arr=%d .Ka=%f .Kb=%f .PwmD=%f .Ccr=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PwmT, PLC_DO[ChIn].Arr, PLC_DO[ChIn].Ka, PLC_DO[ChIn].Kb, PLC_DO[ChIn].PwmD, PLC_DO[ChIn].Ccr, PLC_DO[ChIn].Status);
+	DebugLog("RTOS_DO_SetPwmPeriodNs\n");
 #endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(ValIn && ValIn < PLC_DO_PWM_T_NS__MIN) ValIn = PLC_DO_PWM_T_NS__MIN;
+
+		if(PLC_DO[ChIn].PwmTns != ValIn)
+		{
+			PLC_DO[ChIn].PwmTns = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_T_NS);
+
+			if(ValIn && PLC_DO[ChIn].PwmFreq)
+			{
+				PLC_DO[ChIn].PwmFreq = 0;
+				RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_FREQ);
+			}
+
+			RTOS_DO_SetPwmPlan(ChIn);
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PWM.Resolution.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value (min. quantity of steps per period):
+ *  @arg    = 0 - the best resolution only
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DO_SetPwmRes(uint8_t ChIn, uint32_t ValIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPwmRes\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(PLC_DO[ChIn].PwmRes != ValIn)
+		{
+			PLC_DO[ChIn].PwmRes = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_RES);
+			RTOS_DO_SetPwmPlan(ChIn);
 			return (BIT_TRUE);
 		}
 	}
@@ -369,7 +629,7 @@ static uint8_t RTOS_DO_SetPwmPulse(uint8_t ChIn, float ValIn)
 			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PWM_D);
 
 #ifdef DEBUG_LOG_DO_Q_VAL
-			DebugLog("DO[%d].PwmT=%f .Arr=%d .Ka=%f .Kb=%f .PwmD=%f .Ccr=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PwmT, PLC_DO[ChIn].Arr, PLC_DO[ChIn].Ka, PLC_DO[ChIn].Kb, PLC_DO[ChIn].PwmD, PLC_DO[ChIn].Ccr, PLC_DO[ChIn].Status);
+			DebugLog("DO[%d].PwmT=%f .Arr=%d .Ka=%d .Kb=%d .PwmD=%f .Ccr=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PwmT, PLC_DO[ChIn].Arr, PLC_DO[ChIn].Ka, PLC_DO[ChIn].Kb, PLC_DO[ChIn].PwmD, PLC_DO[ChIn].Ccr, PLC_DO[ChIn].Status);
 #endif // DEBUG_LOG_DO_Q_VAL
 			return (BIT_TRUE);
 		}
@@ -440,6 +700,7 @@ static uint8_t RTOS_DO_SetSafeVal(uint8_t ChIn, uint8_t ValIn)
 		if(PLC_DO[ChIn].SafeVal != ValIn)
 		{
 			PLC_DO[ChIn].SafeVal = ((ValIn) ? BIT_TRUE : BIT_FALSE);
+			PlcSfty_SetOut(ChIn, PLC_DO[ChIn].Pack.SafeAllow, PLC_DO[ChIn].SafeVal);
 			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_SAFE_VAL);
 
 #ifdef DEBUG_LOG_DO_Q_VAL
@@ -469,6 +730,7 @@ static uint8_t RTOS_DO_SetSafeAllow(uint8_t ChIn, uint8_t ValIn)
 		if(PLC_DO[ChIn].Pack.SafeAllow != ValIn)
 		{
 			PLC_DO[ChIn].Pack.SafeAllow = ((ValIn) ? BIT_TRUE : BIT_FALSE);
+			PlcSfty_SetOut(ChIn, PLC_DO[ChIn].Pack.SafeAllow, PLC_DO[ChIn].SafeVal);
 			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_SAFE_ALLOW);
 
 #ifdef DEBUG_LOG_DO_Q_VAL
@@ -480,28 +742,156 @@ static uint8_t RTOS_DO_SetSafeAllow(uint8_t ChIn, uint8_t ValIn)
 	return (BIT_FALSE);
 }
 
-/** @brief  Set POSTPON.Value.
+/** @brief  Apply output image (end of scan).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Values are applied only for channels in the corresponding mode (Norm, PWM).
+ *          CCR of all changed channels are written at once.
+ */
+static uint8_t RTOS_DO_ImgApply(void)
+{
+	PlcDO_Img_t Img;
+	uint32_t    Bit;
+	uint32_t    Upd = 0;
+	uint32_t    Imm = 0;
+	uint8_t     Val;
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_ImgApply\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(!PlcDO_ImgTake(&Img)) return (BIT_FALSE);
+
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		Bit = ((uint32_t)1 << i);
+
+		if(PLC_DO[i].Mode == PLC_DO_MODE_NORM && (Img.NormMask & Bit))
+		{
+			Val = ((Img.Norm & Bit) ? BIT_TRUE : BIT_FALSE);
+			if(PLC_DO[i].NormVal != Val)
+			{
+				PLC_DO[i].NormVal = Val;
+				PlcDO_CalcPulse(&PLC_DO[i], ((Val) ? PLC_DO_PWM_D__MAX : PLC_DO_PWM_D__MIN));
+				Upd |= Bit;
+				Imm |= Bit;
+			}
+		}
+		else if(PLC_DO[i].Mode == PLC_DO_MODE_PWM && (Img.PwmMask & Bit))
+		{
+			if(PLC_DO[i].PwmD != Img.Pwm[i])
+			{
+				PLC_DO[i].PwmD = PlcDO_CalcPulse(&PLC_DO[i], Img.Pwm[i]);
+				Upd |= Bit;
+			}
+		}
+	}
+
+	PlcDO_Write(PLC_DO, Upd, Imm);
+
+	RTOS_DO_IMG_LAT = PlcDO_ImgLatency(&Img);
+	if(RTOS_DO_IMG_LAT > RTOS_DO_IMG_LAT_MAX) RTOS_DO_IMG_LAT_MAX = RTOS_DO_IMG_LAT;
+
+	//confirmed data
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		if(Imm & ((uint32_t)1 << i))      RTOS_DO_DATA_Q_Send(i, PLC_DO_Q_ID_NORM_VAL);
+		else if(Upd & ((uint32_t)1 << i)) RTOS_DO_DATA_Q_Send(i, PLC_DO_Q_ID_PWM_D);
+	}
+	RTOS_DO_DATA_Q_Send(PLC_DO_00, PLC_DO_Q_ID_IMG_LAT);
+	RTOS_DO_DATA_Q_Send(PLC_DO_00, PLC_DO_Q_ID_IMG_LAT_MAX);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("DO.Img .Upd=%d .Imm=%d .Lat=%d .LatMax=%d\n\n", Upd, Imm, RTOS_DO_IMG_LAT, RTOS_DO_IMG_LAT_MAX);
+#endif // DEBUG_LOG_DO_Q_VAL
+	return (BIT_TRUE);
+}
+
+/** @brief  Set PTO.Pulses.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Applied by the next start of pulse train.
+ */
+static uint8_t RTOS_DO_SetPtoPulses(uint8_t ChIn, uint32_t ValIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPtoPulses\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(PLC_DO[ChIn].PtoPulses != ValIn)
+		{
+			PLC_DO[ChIn].PtoPulses = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_PULSES);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].PtoPulses=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PtoPulses, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PTO.FreqStart.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Applied by the next start of pulse train.
+ */
+static uint8_t RTOS_DO_SetPtoFreqStart(uint8_t ChIn, uint32_t ValIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPtoFreqStart\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(PLC_DO[ChIn].PtoFreqStart != ValIn)
+		{
+			PLC_DO[ChIn].PtoFreqStart = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_FREQ_START);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].PtoFreqStart=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PtoFreqStart, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PTO.FreqMax.
  *  @param  ChIn  - channel number.
  *  @param  ValIn - value.
  *  @return Result:
  *  @arg    = 0 - not set
  *  @arg    = 1 - set
+ *  @note   Applied by the next start of pulse train.
  */
-static uint8_t RTOS_DO_SetPostponedVal(uint8_t ChIn, uint8_t ValIn)
+static uint8_t RTOS_DO_SetPtoFreqMax(uint8_t ChIn, uint32_t ValIn)
 {
 #ifdef DEBUG_LOG_DO_Q_VAL
-	DebugLog("RTOS_DO_SetPostponedVal\n");
+	DebugLog("RTOS_DO_SetPtoFreqMax\n");
 #endif // DEBUG_LOG_DO_Q_VAL
 
 	if(ChIn < PLC_DO_SZ)
 	{
-		if(PLC_DO[ChIn].PostponedVal != ValIn)
+		if(PLC_DO[ChIn].PtoFreqMax != ValIn)
 		{
-			PLC_DO[ChIn].PostponedVal      = ((ValIn) ? BIT_TRUE : BIT_FALSE);
-			PLC_DO[ChIn].Pack.PostponReady = BIT_TRUE;
+			PLC_DO[ChIn].PtoFreqMax = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_FREQ_MAX);
 
 #ifdef DEBUG_LOG_DO_Q_VAL
-			DebugLog("DO[%d].PostponedVal=%d .Pack.Postponed=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PostponedVal, PLC_DO[ChIn].Pack.PostponReady, PLC_DO[ChIn].Status);
+			DebugLog("DO[%d].PtoFreqMax=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PtoFreqMax, PLC_DO[ChIn].Status);
 #endif // DEBUG_LOG_DO_Q_VAL
 			return (BIT_TRUE);
 		}
@@ -509,33 +899,218 @@ static uint8_t RTOS_DO_SetPostponedVal(uint8_t ChIn, uint8_t ValIn)
 	return (BIT_FALSE);
 }
 
-/** @brief  Set POSTPON.Apply (command to set all postponed valued).
+/** @brief  Set PTO.Accel.
+ *  @param  ChIn  - channel number.
  *  @param  ValIn - value.
  *  @return Result:
  *  @arg    = 0 - not set
  *  @arg    = 1 - set
+ *  @note   Applied by the next start of pulse train.
  */
-static uint8_t RTOS_DO_SetPostponedApply(uint8_t ValIn)
+static uint8_t RTOS_DO_SetPtoAccel(uint8_t ChIn, uint32_t ValIn)
 {
 #ifdef DEBUG_LOG_DO_Q_VAL
-	DebugLog("RTOS_DO_SetPostponedApply\n");
+	DebugLog("RTOS_DO_SetPtoAccel\n");
 #endif // DEBUG_LOG_DO_Q_VAL
 
-	if(ValIn)
+	if(ChIn < PLC_DO_SZ)
 	{
-		for(uint8_t i=0; i<PLC_DO_SZ; i++)
+		if(PLC_DO[ChIn].PtoAccel != ValIn)
 		{
-			if(PLC_DO[i].Mode == PLC_DO_MODE_NORM && PLC_DO[i].Pack.PostponReady)
+			PLC_DO[ChIn].PtoAccel = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_ACCEL);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].PtoAccel=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PtoAccel, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PTO.Profile.
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value (PLC_PTO_PROFILE_...).
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   Applied by the next start of pulse train.
+ */
+static uint8_t RTOS_DO_SetPtoProfile(uint8_t ChIn, uint8_t ValIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPtoProfile\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(PLC_DO[ChIn].PtoProfile != ValIn)
+		{
+			PLC_DO[ChIn].PtoProfile = ValIn;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_PROFILE);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].PtoProfile=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].PtoProfile, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PTO.Start (start/stop pulse train).
+ *  @param  ChIn  - channel number.
+ *  @param  ValIn - value:
+ *  @arg    = 0 - stop (abort)
+ *  @arg    = 1 - start
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DO_SetPtoStart(uint8_t ChIn, uint8_t ValIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPtoStart\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		ValIn = ((ValIn) ? BIT_TRUE : BIT_FALSE);
+
+		if(PLC_DO[ChIn].Pack.PtoStart != ValIn)
+		{
+			if(PLC_DO[ChIn].Mode == PLC_DO_MODE_PTO)
 			{
-				RTOS_DO_SetNormVal(i, PLC_DO[i].PostponedVal);
-				PLC_DO[i].Pack.PostponReady = BIT_FALSE;
+				if(ValIn)
+				{
+					PLC_DO[ChIn].Pack.PtoDone = BIT_FALSE;
+
+					if(PlcDO_PtoStart(&PLC_DO[ChIn]) == PLC_PTO_OK)
+					{
+						PLC_DO[ChIn].Pack.PtoStart = BIT_TRUE;
+						PLC_DO[ChIn].Status        = PLC_DO_STATUS_PTO_RUN;
+					}
+					else
+					{
+						PLC_DO[ChIn].Status = PLC_DO_STATUS_PTO_ERR;
+					}
+				}
+				else
+				{
+					PlcDO_PtoStop(&PLC_DO[ChIn]);
+					PlcDO_SetNormVal(&PLC_DO[ChIn], BIT_FALSE);
+					PlcDO_Stop(&PLC_DO[ChIn]);
+					PLC_DO[ChIn].Pack.PtoStart = BIT_FALSE;
+					PLC_DO[ChIn].Status        = PLC_DO_STATUS_PTO_OFF;
+				}
 			}
+
+			//confirm (start is not confirmed if mode is not PTO or settings are invalid)
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_START);
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_DONE);
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_STATUS);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].Mode=%d .Pack.PtoStart=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].Mode, PLC_DO[ChIn].Pack.PtoStart, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Set PTO.Done (the last pulse is queued).
+ *  @param  ChIn  - channel number.
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ */
+static uint8_t RTOS_DO_SetPtoDone(uint8_t ChIn)
+{
+#ifdef DEBUG_LOG_DO_Q_VAL
+	DebugLog("RTOS_DO_SetPtoDone\n");
+#endif // DEBUG_LOG_DO_Q_VAL
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(PLC_DO[ChIn].Mode == PLC_DO_MODE_PTO && PLC_DO[ChIn].Pack.PtoStart)
+		{
+			PLC_DO[ChIn].Pack.PtoStart = BIT_FALSE;
+			PLC_DO[ChIn].Pack.PtoDone  = BIT_TRUE;
+			PLC_DO[ChIn].Status        = PLC_DO_STATUS_PTO_OFF;
+			PlcDO_Stop(&PLC_DO[ChIn]);
+
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_START);
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_PTO_DONE);
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_STATUS);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].Pack.PtoDone=%d .Stat=%d\n\n", ChIn, PLC_DO[ChIn].Pack.PtoDone, PLC_DO[ChIn].Status);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
+		}
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Update status "Held by DI counter compare-match" (owners of forced output are kept by do.c).
+ *  @param  ChIn - channel number.
+ *  @return Result:
+ *  @arg    = 0 - not changed
+ *  @arg    = 1 - changed
+ */
+static uint8_t RTOS_DO_SetCmpHeld(uint8_t ChIn)
+{
+	uint8_t Held;
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		Held = ((PlcDO_GetForce(ChIn) & PLC_DO_FORCE_CMP) ? BIT_TRUE : BIT_FALSE);
+
+		if(PLC_DO[ChIn].Pack.CmpHeld != Held)
+		{
+			PLC_DO[ChIn].Pack.CmpHeld = Held;
+			RTOS_DO_DATA_Q_Send(ChIn, PLC_DO_Q_ID_CMP_HELD);
+
+#ifdef DEBUG_LOG_DO_Q_VAL
+			DebugLog("DO[%d].Pack.CmpHeld=%d\n", ChIn, PLC_DO[ChIn].Pack.CmpHeld);
+#endif // DEBUG_LOG_DO_Q_VAL
+			return (BIT_TRUE);
 		}
-		return (BIT_TRUE);
 	}
 	return (BIT_FALSE);
 }
 
+/** @brief  PTO done callback (DMA ISR).
+ *  @param  ChIn - channel number.
+ *  @return None.
+ */
+static void RTOS_DO_PtoDone(uint8_t ChIn)
+{
+	PlcDO_Q_t  QueueData;
+	BaseType_t HiTaskWoken = pdFALSE;
+
+	QueueData.Ch  = ChIn;
+	QueueData.ID  = PLC_DO_Q_ID_PTO_DONE;
+	QueueData.Val = (float)BIT_TRUE;
+
+	//Send data into RTOS_DO_Q (not-blocking)
+	xQueueSendToBackFromISR(RTOS_DO_Q, &QueueData, &HiTaskWoken);
+}
+
+/** @brief  Get DWORD packed into queue value.
+ *  @param  ValIn - queue value.
+ *  @return DWORD.
+ */
+static uint32_t RTOS_DO_Q_GetDWord(float ValIn)
+{
+	ANY32_uwt BuffAny32;
+
+	BuffAny32.data_float = ValIn;
+	return (BuffAny32.data_dword);
+}
+
 /** @brief  Set settings.
  *  @param  DataIn - pointer to data.
  *  @return None.
@@ -562,6 +1137,18 @@ static void RTOS_DO_Set(const PlcDO_Q_t *DataIn)
             	RTOS_DO_SetPwmPeriod(DataIn->Ch, DataIn->Val);
             	break;
 
+            case PLC_DO_Q_ID_PWM_FREQ:
+            	RTOS_DO_SetPwmFreq(DataIn->Ch, RTOS_DO_Q_GetDWord(DataIn->Val));
+            	break;
+
+            case PLC_DO_Q_ID_PWM_T_NS:
+            	RTOS_DO_SetPwmPeriodNs(DataIn->Ch, RTOS_DO_Q_GetDWord(DataIn->Val));
+            	break;
+
+            case PLC_DO_Q_ID_PWM_RES:
+            	RTOS_DO_SetPwmRes(DataIn->Ch, RTOS_DO_Q_GetDWord(DataIn->Val));
+            	break;
+
             case PLC_DO_Q_ID_PWM_D:
             	RTOS_DO_SetPwmPulse(DataIn->Ch, DataIn->Val);
             	break;
@@ -578,13 +1165,47 @@ static void RTOS_DO_Set(const PlcDO_Q_t *DataIn)
             	RTOS_DO_SetSafeAllow(DataIn->Ch, (uint8_t)DataIn->Val);
             	break;
 
-            case PLC_DO_Q_ID_POSTPONED_VAL:
-            	RTOS_DO_SetPostponedVal(DataIn->Ch, (uint8_t)DataIn->Val);
+            case PLC_DO_Q_ID_IMG_APPLY:
+            	RTOS_DO_ImgApply();
+            	break;
+
+            case PLC_DO_Q_ID_PTO_PULSES:
+            	RTOS_DO_SetPtoPulses(DataIn->Ch, (uint32_t)DataIn->Val);
+            	break;
+
+            case PLC_DO_Q_ID_PTO_FREQ_START:
+            	RTOS_DO_SetPtoFreqStart(DataIn->Ch, (uint32_t)DataIn->Val);
+            	break;
+
+            case PLC_DO_Q_ID_PTO_FREQ_MAX:
+            	RTOS_DO_SetPtoFreqMax(DataIn->Ch, (uint32_t)DataIn->Val);
             	break;
 
-            case PLC_DO_Q_ID_POSTPONED_APPLY:
-            	RTOS_DO_SetPostponedApply((uint8_t)DataIn->Val);
+            case PLC_DO_Q_ID_PTO_ACCEL:
+            	RTOS_DO_SetPtoAccel(DataIn->Ch, (uint32_t)DataIn->Val);
             	break;
+
+            case PLC_DO_Q_ID_PTO_PROFILE:
+            	RTOS_DO_SetPtoProfile(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_DO_Q_ID_PTO_START:
+            	RTOS_DO_SetPtoStart(DataIn->Ch, (uint8_t)DataIn->Val);
+            	break;
+
+            case PLC_DO_Q_ID_PTO_DONE:
+            	RTOS_DO_SetPtoDone(DataIn->Ch);
+            	break;
+
+            case PLC_DO_Q_ID_CMP_HELD:
+            	RTOS_DO_SetCmpHeld(DataIn->Ch);
+            	break;
+        }
+
+        //values expected by output image of application
+        for(uint8_t i=0; i<PLC_DO_SZ; i++)
+        {
+        	PlcDO_ImgSync(i, PLC_DO[i].NormVal, PLC_DO[i].PwmD);
         }
     }
 }
@@ -599,8 +1220,15 @@ static void RTOS_DO_Init(void)
     DebugLog("RTOS_DO_Init\n");
 #endif // DEBUG_LOG_MAIN
 
-    uint8_t BuffBy;
-    float   BuffFlo;
+    uint8_t  BuffBy;
+    uint32_t BuffDWo;
+    float    BuffFlo;
+
+    PLC_DO_USER_FUNC.PtoDone = RTOS_DO_PtoDone;
+
+    PlcDO_ImgInit();
+    RTOS_DO_IMG_LAT     = 0;
+    RTOS_DO_IMG_LAT_MAX = 0;
 
 	for(uint8_t i=0; i<PLC_DO_SZ; i++)
 	{
@@ -620,12 +1248,25 @@ static void RTOS_DO_Init(void)
         REG_CopyRegByPos(REG_DO_PWM_VAL__POS+i, REG_COPY_MB_TO_VAR, &BuffFlo);
 	    PLC_DO[i].PwmD = BuffFlo;
 
+		BuffDWo = PLC_DO_PWM_FREQ_DEF;
+		REG_CopyRegByPos(REG_DO_PWM_FREQ__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PwmFreq = ((BuffDWo > PLC_DO_PWM_FREQ__MAX) ? PLC_DO_PWM_FREQ__MAX : BuffDWo);
+
+		BuffDWo = PLC_DO_PWM_T_NS_DEF;
+		REG_CopyRegByPos(REG_DO_PWM_PERIOD_NS__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PwmTns = ((BuffDWo && BuffDWo < PLC_DO_PWM_T_NS__MIN) ? PLC_DO_PWM_T_NS__MIN : BuffDWo);
+
+		BuffDWo = PLC_DO_PWM_RES_DEF;
+		REG_CopyRegByPos(REG_DO_PWM_RES__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PwmRes = BuffDWo;
+
 		BuffBy = PLC_DO_PWM_ALLOW_DEF;
 		REG_CopyRegByPos(REG_DO_PWM_ALLOW__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
 		PLC_DO[i].Pack.PwmAllow = BuffBy;
 
-		PLC_DO[i].Pack.SafeAllow    = PLC_DO_SAFE_ALLOW_DEF;
-		PLC_DO[i].Pack.PostponReady = BIT_FALSE;
+		BuffBy = PLC_DO_SAFE_ALLOW_DEF;
+		REG_CopyRegByPos(REG_DO_SAFE_ALLOW__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+		PLC_DO[i].Pack.SafeAllow = BuffBy;
 
 		BuffBy = PLC_DO_NORM_VAL_DEF;
 		REG_CopyRegByPos(REG_DO_NORM_VAL__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
@@ -635,13 +1276,37 @@ static void RTOS_DO_Init(void)
 		REG_CopyRegByPos(REG_DO_FAST_VAL__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
 		PLC_DO[i].FastVal = BuffBy;
 
-		PLC_DO[i].SafeVal      = PLC_DO_SAFE_VAL_DEF;
-		PLC_DO[i].PostponedVal = BIT_FALSE;
+		BuffBy = PLC_DO_SAFE_VAL_DEF;
+		REG_CopyRegByPos(REG_DO_SAFE_VAL__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+		PLC_DO[i].SafeVal = BuffBy;
+
+		BuffDWo = PLC_DO_PTO_PULSES_DEF;
+		REG_CopyRegByPos(REG_DO_PTO_PULSES__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PtoPulses = BuffDWo;
+
+		BuffDWo = PLC_DO_PTO_FREQ_START_DEF;
+		REG_CopyRegByPos(REG_DO_PTO_FREQ_START__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PtoFreqStart = BuffDWo;
 
-        PLC_DO[i].Status = PLC_DO[i].Mode;
+		BuffDWo = PLC_DO_PTO_FREQ_MAX_DEF;
+		REG_CopyRegByPos(REG_DO_PTO_FREQ_MAX__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PtoFreqMax = BuffDWo;
 
-        //set TIM.PWM.Period
-        PlcDO_SetPeriod(&PLC_DO[i], PLC_DO[i].PwmT);
+		BuffDWo = PLC_DO_PTO_ACCEL_DEF;
+		REG_CopyRegByPos(REG_DO_PTO_ACCEL__POS+i, REG_COPY_MB_TO_VAR, &BuffDWo);
+		PLC_DO[i].PtoAccel = BuffDWo;
+
+		BuffBy = PLC_DO_PTO_PROFILE_DEF;
+		REG_CopyRegByPos(REG_DO_PTO_PROFILE__POS+i, REG_COPY_MB_TO_VAR, &BuffBy);
+		PLC_DO[i].PtoProfile = BuffBy;
+
+		PLC_DO[i].Pack.PtoStart = BIT_FALSE;
+		PLC_DO[i].Pack.PtoDone  = BIT_FALSE;
+
+        PLC_DO[i].Status = ((PLC_DO[i].Mode == PLC_DO_MODE_PTO) ? PLC_DO_STATUS_PTO_OFF : PLC_DO[i].Mode);
+
+        //set TIM.PWM.Period (planned PSC, ARR), achieved values into registers
+        RTOS_DO_SetPwmPlan(i);
 
         //set TIM.PWM.CH.Pulse
         if(PLC_DO[i].Mode == PLC_DO_MODE_NORM)
@@ -662,6 +1327,9 @@ static void RTOS_DO_Init(void)
         	PlcDO_Start(&PLC_DO[i]);
         }
 
+        //safe output (forced at once if a watchdog is already expired)
+        PlcSfty_SetOut(i, PLC_DO[i].Pack.SafeAllow, PLC_DO[i].SafeVal);
+
 #ifdef DEBUG_LOG_DO
         DebugLog("DO[%d].Mode=%d .NormVal=%d .FastVal=%d .PwmT=%f .PwmD=%f .Pack.PwmAllow=%d\n", i, PLC_DO[i].Mode, PLC_DO[i].NormVal, PLC_DO[i].FastVal, PLC_DO[i].PwmT, PLC_DO[i].PwmD, PLC_DO[i].Pack.PwmAllow);
 #endif // DEBUG_LOG_DO
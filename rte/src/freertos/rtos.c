@@ -46,6 +46,9 @@ QueueHandle_t RTOS_COM2_Q;
 #endif // RTE_MOD_COM2
 
 #ifdef RTE_MOD_APP
-SemaphoreHandle_t RTOS_APP_SEMA;
-TimerHandle_t RTOS_APP_TIM;
+TaskHandle_t RTOS_APP_T;
+#ifdef RTE_MOD_APP_SERIAL
+SemaphoreHandle_t RTOS_APP_RUN_MTX;
+#endif //RTE_MOD_APP_SERIAL
+RTOS_APP_Trig_t RTOS_APP_TRIG;
 #endif // RTE_MOD_APP
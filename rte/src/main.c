@@ -6,6 +6,16 @@
 
 #include "config.h"
 #include "rtos.h"
+#include "dwt.h"
+#include "crc.h"
+
+#ifdef RTE_MOD_RTC
+#include "plc_rtc.h"
+#endif //RTE_MOD_RTC
+
+#ifdef RTE_MOD_RETAIN
+#include "plc_backup.h"
+#endif //RTE_MOD_RETAIN
 
 #ifdef DEBUG
 #include "debug-log.h"
@@ -54,6 +64,11 @@
  */
 int main(void)
 {
+#ifdef DEBUG_LOG_MAIN
+	//boot time of application and registers (core clock cycles)
+	uint32_t BootCyc = 0;
+#endif //DEBUG_LOG_MAIN
+
 	/** INIT
 	 */
 
@@ -68,17 +83,45 @@ int main(void)
 #endif //DEBUG_LOG_MAIN
 
 
+    //Cycle counter (time base of application)
+    PlcDwt_Init();
+
+
+#ifdef RTE_MOD_RTC
+    //Wall clock (RTC is inited only once, it keeps running over reset)
+    plc_rtc_init();
+#ifdef DEBUG_LOG_MAIN
+    DebugLog("RTC [INITED]\n");
+#endif //DEBUG_LOG_MAIN
+#endif //RTE_MOD_RTC
+
+
+#ifdef RTE_MOD_RETAIN
+    //Retain-data of application (restored from flash before start of application)
+    plc_backup_init();
+#ifdef DEBUG_LOG_MAIN
+    DebugLog("RETAIN [INITED]\n");
+#endif //DEBUG_LOG_MAIN
+#endif //RTE_MOD_RETAIN
+
+
+#ifdef DEBUG_LOG_MAIN
+    BootCyc = PlcDwt_GetCyc();
+#endif //DEBUG_LOG_MAIN
+
 #ifdef RTE_MOD_APP
+    //CRC unit (check of application image)
+    PlcCrc_Init();
+
     PlcApp_Init();
     PlcApp_InitSysFunc();
 
-    RTOS_APP_SEMA = xSemaphoreCreateBinary();
-    if(!RTOS_APP_SEMA) _Error_Handler(__FILE__, __LINE__);
+#ifdef RTE_MOD_APP_SERIAL
+    RTOS_APP_RUN_MTX = xSemaphoreCreateMutex();
+    if(!RTOS_APP_RUN_MTX) _Error_Handler(__FILE__, __LINE__);
+#endif //RTE_MOD_APP_SERIAL
 
-    RTOS_APP_TIM = xTimerCreate(RTOS_APP_TIM_NAME, RTOS_APP_TIM_TM, pdFALSE, 0, RTOS_APP_TIM_Handler);
-    if(!RTOS_APP_TIM) _Error_Handler(__FILE__, __LINE__);
-
-    if(xTaskCreate(RTOS_APP_Task, RTOS_APP_T_NAME, RTOS_APP_T_STACK_SZ, NULL, RTOS_APP_T_PRIORITY, NULL) != pdTRUE)
+    if(xTaskCreate(RTOS_APP_Task, RTOS_APP_T_NAME, RTOS_APP_T_STACK_SZ, NULL, RTOS_APP_T_PRIORITY, &RTOS_APP_T) != pdTRUE)
     {
     	_Error_Handler(__FILE__, __LINE__);
     }
@@ -93,7 +136,7 @@ int main(void)
     REG_Init();
     REG_SetDef();
 #ifdef DEBUG_LOG_MAIN
-    DebugLog("REG [INITED]\n");
+    DebugLog("REG [INITED] %lu us\n", (unsigned long)PlcDwt_CycToUs(PlcDwt_GetCyc()-BootCyc));
 #endif //DEBUG_LOG_MAIN
 #endif //RTE_MOD_REG
 
@@ -146,6 +189,9 @@ int main(void)
 
 
 #ifdef RTE_MOD_DO
+    //Fail-safe outputs (before SysTick starts RTOS)
+    PlcSfty_Init();
+
     RTOS_DO_Q = xQueueCreate(RTOS_DO_Q_SZ, RTOS_DO_Q_ISZ);
     if(!RTOS_DO_Q) _Error_Handler(__FILE__, __LINE__);
 
@@ -169,7 +215,7 @@ int main(void)
     RTOS_AI_DATA_Q = xQueueCreate(RTOS_AI_DATA_Q_SZ, RTOS_AI_DATA_Q_ISZ);
     if(!RTOS_AI_DATA_Q) _Error_Handler(__FILE__, __LINE__);
 
-    RTOS_AI_TIM = xTimerCreate(RTOS_AI_TIM_NAME, RTOS_AI_TIM_TM, pdFALSE, 0, RTOS_AI_TIM_Handler);
+    RTOS_AI_TIM = xTimerCreate(RTOS_AI_TIM_NAME, RTOS_AI_TIM_TM, pdTRUE, 0, RTOS_AI_TIM_Handler);
     if(!RTOS_AI_TIM) _Error_Handler(__FILE__, __LINE__);
 
     if(xTaskCreate(RTOS_AI_Task, RTOS_AI_T_NAME, RTOS_AI_T_STACK_SZ, NULL, RTOS_AI_T_PRIORITY, NULL) != pdTRUE)
@@ -316,17 +316,15 @@ void dbg_handler(void)
             }
             else
             {
-                /*
-                tm new_time;
-                //Set RTC
-                new_time.tm_year = plc_dbg_ctrl.tr.set_rtc.year;
-                new_time.tm_mon  = plc_dbg_ctrl.tr.set_rtc.mon;
-                new_time.tm_day  = plc_dbg_ctrl.tr.set_rtc.day;
-                new_time.tm_hour = plc_dbg_ctrl.tr.set_rtc.hour;
-                new_time.tm_min  = plc_dbg_ctrl.tr.set_rtc.min;
-                new_time.tm_sec  = plc_dbg_ctrl.tr.set_rtc.sec;
+                PlcDt_t new_time;
+                //Set RTC (year is sent as two digits)
+                new_time.Year = PLC_DT_YEAR__MIN + plc_dbg_ctrl.tr.set_rtc.year;
+                new_time.Mon  = plc_dbg_ctrl.tr.set_rtc.mon;
+                new_time.Day  = plc_dbg_ctrl.tr.set_rtc.day;
+                new_time.Hour = plc_dbg_ctrl.tr.set_rtc.hour;
+                new_time.Min  = plc_dbg_ctrl.tr.set_rtc.min;
+                new_time.Sec  = plc_dbg_ctrl.tr.set_rtc.sec;
                 plc_rtc_dt_set(&new_time);
-                */
                 plc_dbg_ctrl.state = GET_CMD;
             }
         }
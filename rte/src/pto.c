@@ -0,0 +1,234 @@
+/* @page pto.c
+ *       Pulse train profiles (PTO)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "pto.h"
+
+
+/** @def Iterations of bisection (ramp position -> ramp time)
+ */
+#define PLC_PTO_BISECT_ITER                      24
+
+
+/** @brief  Ramp shape: frequency.
+ *  @param  ProfileIn - profile type.
+ *  @param  XIn - relative ramp time (0.0 ... 1.0).
+ *  @return Relative frequency (0.0 ... 1.0).
+ */
+static float PlcPto_G(uint8_t ProfileIn, float XIn)
+{
+	if(ProfileIn == PLC_PTO_PROFILE_SCURVE)
+	{
+		return (XIn*XIn*(3.0f-2.0f*XIn));
+	}
+	return (XIn);
+}
+
+/** @brief  Ramp shape: integral of frequency.
+ *  @param  ProfileIn - profile type.
+ *  @param  XIn - relative ramp time (0.0 ... 1.0).
+ *  @return Integral of PlcPto_G() from 0 to XIn.
+ */
+static float PlcPto_GI(uint8_t ProfileIn, float XIn)
+{
+	if(ProfileIn == PLC_PTO_PROFILE_SCURVE)
+	{
+		return (XIn*XIn*XIn*(1.0f-0.5f*XIn));
+	}
+	return (0.5f*XIn*XIn);
+}
+
+/** @brief  Ramp position (pulses) by relative ramp time.
+ *  @param  CfgIn - pointer to settings.
+ *  @param  TIn - ramp duration (s).
+ *  @param  XIn - relative ramp time (0.0 ... 1.0).
+ *  @return Quantity of pulses from ramp start.
+ */
+static float PlcPto_N(const PlcPto_Cfg_t *CfgIn, float TIn, float XIn)
+{
+	return (TIn*((float)CfgIn->FreqStart*XIn + (float)(CfgIn->FreqMax-CfgIn->FreqStart)*PlcPto_GI(CfgIn->Profile, XIn)));
+}
+
+/** @brief  Ramp frequency by ramp position.
+ *  @param  CfgIn - pointer to settings.
+ *  @param  TIn - ramp duration (s).
+ *  @param  NIn - quantity of pulses from ramp start.
+ *  @return Frequency (Hz).
+ */
+static float PlcPto_FreqByN(const PlcPto_Cfg_t *CfgIn, float TIn, float NIn)
+{
+	float Lo = 0.0f;
+	float Hi = 1.0f;
+	float X;
+
+	for(uint8_t i=0; i<PLC_PTO_BISECT_ITER; i++)
+	{
+		X = 0.5f*(Lo+Hi);
+		if(PlcPto_N(CfgIn, TIn, X) < NIn) Lo = X;
+		else                              Hi = X;
+	}
+	X = 0.5f*(Lo+Hi);
+
+	return ((float)CfgIn->FreqStart + (float)(CfgIn->FreqMax-CfgIn->FreqStart)*PlcPto_G(CfgIn->Profile, X));
+}
+
+/** @brief  Convert frequency into period (ARR).
+ *  @param  CfgIn - pointer to settings.
+ *  @param  FreqIn - frequency (Hz).
+ *  @return Period (ARR).
+ */
+static uint32_t PlcPto_FreqToArr(const PlcPto_Cfg_t *CfgIn, float FreqIn)
+{
+	float Ticks;
+
+	if(FreqIn <= 0.0f) return (CfgIn->ArrMax);
+
+	Ticks = (float)CfgIn->TickHz/FreqIn + 0.5f;
+	if(Ticks >= (float)CfgIn->ArrMax+1.0f) return (CfgIn->ArrMax);
+	if(Ticks <= (float)CfgIn->ArrMin+1.0f) return (CfgIn->ArrMin);
+
+	return ((uint32_t)Ticks-1);
+}
+
+/** @brief  Append run (step + segment).
+ *  @param  CfgIn - pointer to settings.
+ *  @param  ProfIn - pointer to profile.
+ *  @param  ArrIn - period (ARR).
+ *  @param  CcrIn - pulse (CCR).
+ *  @param  CntIn - quantity of pulses (>= 1).
+ *  @return None.
+ */
+static void PlcPto_AddRun(const PlcPto_Cfg_t *CfgIn, PlcPto_Prof_t *ProfIn, uint32_t ArrIn, uint32_t CcrIn, uint32_t CntIn)
+{
+	PlcPto_Step_t *Step;
+	PlcPto_Seg_t  *Seg;
+
+	if(ProfIn->StepsQty >= PLC_PTO_STEPS_SZ) return;
+
+	Step = &ProfIn->Steps[ProfIn->StepsQty];
+	Step->Arr    = ArrIn;
+	Step->Rcr    = 0;
+	Step->Ccr[0] = 0;
+	Step->Ccr[1] = 0;
+	Step->Ccr[CfgIn->Ccr] = CcrIn;
+
+	//single pulses are joined into one segment until a repeated step closes it
+	if(ProfIn->SegsQty > 0 && ProfIn->Segs[ProfIn->SegsQty-1].Rep == 0)
+	{
+		Seg = &ProfIn->Segs[ProfIn->SegsQty-1];
+		Seg->Qty++;
+	}
+	else
+	{
+		Seg = &ProfIn->Segs[ProfIn->SegsQty++];
+		Seg->First = ProfIn->StepsQty;
+		Seg->Qty   = 1;
+	}
+	Seg->Rep = CntIn-1;
+
+	ProfIn->StepsQty++;
+}
+
+/** @brief  Append run with pulse 50%.
+ *  @param  CfgIn - pointer to settings.
+ *  @param  ProfIn - pointer to profile.
+ *  @param  FreqIn - frequency (Hz).
+ *  @param  CntIn - quantity of pulses (>= 1).
+ *  @return None.
+ */
+static void PlcPto_AddPulses(const PlcPto_Cfg_t *CfgIn, PlcPto_Prof_t *ProfIn, float FreqIn, uint32_t CntIn)
+{
+	uint32_t Arr = PlcPto_FreqToArr(CfgIn, FreqIn);
+	PlcPto_AddRun(CfgIn, ProfIn, Arr, ((Arr+1)>>1), CntIn);
+}
+
+/** @brief  Build profile.
+ *  @param  CfgIn  - pointer to settings.
+ *  @param  ProfIn - pointer to profile (result).
+ *  @return Result code:
+ *  @arg    = PLC_PTO_OK
+ *  @arg    = PLC_PTO_ERR_...
+ *  @note   Terminal step (CCR=0) holds output low after the last pulse.
+ */
+uint8_t PlcPto_Build(const PlcPto_Cfg_t *CfgIn, PlcPto_Prof_t *ProfIn)
+{
+	float    T = 0.0f;
+	float    FreqCruise;
+	float    RampFreq[PLC_PTO_RAMP_SZ];
+	uint32_t RampCnt[PLC_PTO_RAMP_SZ];
+	uint32_t Ramp   = 0;
+	uint32_t Runs   = 0;
+	uint32_t Cruise;
+	uint32_t k0, k1;
+	int32_t  j;
+
+	if(!CfgIn || !ProfIn || !CfgIn->TickHz || CfgIn->ArrMin > CfgIn->ArrMax || CfgIn->Ccr > PLC_PTO_CCR2) return (PLC_PTO_ERR_ARG);
+	if(!CfgIn->Pulses) return (PLC_PTO_ERR_PULSES);
+	if(!CfgIn->FreqMax || CfgIn->FreqMax > CfgIn->TickHz/(CfgIn->ArrMin+1) || CfgIn->FreqStart > CfgIn->FreqMax) return (PLC_PTO_ERR_FREQ);
+	if(CfgIn->Profile != PLC_PTO_PROFILE_TRAP && CfgIn->Profile != PLC_PTO_PROFILE_SCURVE) return (PLC_PTO_ERR_PROFILE);
+
+	ProfIn->StepsQty   = 0;
+	ProfIn->SegsQty    = 0;
+	ProfIn->RampPulses = 0;
+	FreqCruise         = (float)CfgIn->FreqMax;
+
+	//ramp length (pulses)
+	if(CfgIn->Accel && CfgIn->FreqStart < CfgIn->FreqMax)
+	{
+		T = (float)(CfgIn->FreqMax-CfgIn->FreqStart)/(float)CfgIn->Accel;
+		if(CfgIn->Profile == PLC_PTO_PROFILE_SCURVE)
+		{
+			//peak acceleration of smoothstep is 1.5 of average
+			T *= 1.5f;
+		}
+
+		Ramp = (uint32_t)(PlcPto_N(CfgIn, T, 1.0f)+0.5f);
+		if(!Ramp) Ramp = 1;
+
+		if(Ramp > (CfgIn->Pulses>>1))
+		{
+			//max. frequency is not reached (triangle)
+			Ramp       = (CfgIn->Pulses>>1);
+			FreqCruise = PlcPto_FreqByN(CfgIn, T, (float)Ramp);
+		}
+	}
+
+	//ramp runs
+	Runs = ((Ramp < PLC_PTO_RAMP_SZ) ? Ramp : PLC_PTO_RAMP_SZ);
+	for(uint32_t i=0; i<Runs; i++)
+	{
+		k0 = (uint32_t)(((uint64_t)i*Ramp)/Runs);
+		k1 = (uint32_t)(((uint64_t)(i+1)*Ramp)/Runs);
+		RampCnt[i]  = k1-k0;
+		RampFreq[i] = PlcPto_FreqByN(CfgIn, T, 0.5f*(float)(k0+k1));
+	}
+
+	Cruise = CfgIn->Pulses-2*Ramp;
+
+	//accel.
+	for(uint32_t i=0; i<Runs; i++)
+	{
+		PlcPto_AddPulses(CfgIn, ProfIn, RampFreq[i], RampCnt[i]);
+	}
+
+	//cruise
+	if(Cruise)
+	{
+		PlcPto_AddPulses(CfgIn, ProfIn, FreqCruise, Cruise);
+	}
+
+	//decel.
+	for(j=(int32_t)Runs-1; j>=0; j--)
+	{
+		PlcPto_AddPulses(CfgIn, ProfIn, RampFreq[j], RampCnt[j]);
+	}
+
+	//terminal step
+	PlcPto_AddRun(CfgIn, ProfIn, ProfIn->Steps[ProfIn->StepsQty-1].Arr, 0, 1);
+
+	ProfIn->RampPulses = Ramp;
+
+	return (PLC_PTO_OK);
+}
@@ -0,0 +1,166 @@
+/* @page pwm-plan.c
+ *       PWM period planner (prescaler, period)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "pwm-plan.h"
+
+
+/** @def Nanoseconds per second
+ */
+#define PLC_PWM_PLAN_NS_PER_S                    (uint64_t)1000000000
+
+/** @def Max. prescaler supported (16-bit PSC)
+ */
+#define PLC_PWM_PLAN_PSC__MAX                    (uint32_t)0xFFFF
+
+/** @def Max. numerator of request (keeps products in 64 bit)
+ */
+#define PLC_PWM_PLAN_NUM__MAX                    (uint64_t)(UINT64_MAX >> 2)
+
+
+/** @brief  Greatest common divisor.
+ *  @param  AIn, BIn - values.
+ *  @return GCD.
+ */
+static uint64_t PlcPwmPlan_Gcd(uint64_t AIn, uint64_t BIn)
+{
+	uint64_t T;
+
+	while(BIn)
+	{
+		T   = AIn%BIn;
+		AIn = BIn;
+		BIn = T;
+	}
+	return (AIn);
+}
+
+/** @brief  Set plan by limit.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  MaxIn - limit:
+ *  @arg    = 0 - min. period
+ *  @arg    = 1 - max. period
+ *  @param  PlanIn - pointer to plan (result).
+ *  @return PLC_PWM_PLAN_ERR_RANGE.
+ */
+static uint8_t PlcPwmPlan_Limit(const PlcPwmPlan_Tim_t *TimIn, uint8_t MaxIn, PlcPwmPlan_t *PlanIn)
+{
+	PlanIn->Psc = ((MaxIn) ? TimIn->PscMax : 0);
+	PlanIn->Arr = ((MaxIn) ? TimIn->ArrMax : TimIn->ArrMin);
+	return (PLC_PWM_PLAN_ERR_RANGE);
+}
+
+
+/** @brief  Calculate prescaler and period.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  UnitIn - unit of request (PLC_PWM_PLAN_UNIT_...).
+ *  @param  ValIn - requested frequency (Hz) or period (ns).
+ *  @param  ResIn - min. resolution (ARR+1) accepted to improve accuracy of period:
+ *  @arg    = 0 - the best resolution only
+ *  @param  PlanIn - pointer to plan (result).
+ *  @return Result code:
+ *  @arg    = PLC_PWM_PLAN_OK
+ *  @arg    = PLC_PWM_PLAN_ERR_...
+ */
+uint8_t PlcPwmPlan_Calc(const PlcPwmPlan_Tim_t *TimIn, uint8_t UnitIn, uint64_t ValIn, uint32_t ResIn, PlcPwmPlan_t *PlanIn)
+{
+	uint64_t Num, Den, G;
+	uint64_t Ticks, ArrSz;
+	uint64_t P, PMin, PMax;
+	uint64_t A, PD, AP, Err;
+	uint64_t BestErr = UINT64_MAX;
+	uint32_t Res;
+
+	if(!TimIn || !PlanIn || !TimIn->ClkHz || !ValIn) return (PLC_PWM_PLAN_ERR_ARG);
+	if(TimIn->PscMax > PLC_PWM_PLAN_PSC__MAX || TimIn->ArrMin > TimIn->ArrMax) return (PLC_PWM_PLAN_ERR_ARG);
+
+	//requested period as fraction of timer clock ticks
+	if(UnitIn == PLC_PWM_PLAN_UNIT_HZ)
+	{
+		Num = TimIn->ClkHz;
+		Den = ValIn;
+	}
+	else if(UnitIn == PLC_PWM_PLAN_UNIT_NS)
+	{
+		G   = PlcPwmPlan_Gcd(TimIn->ClkHz, PLC_PWM_PLAN_NS_PER_S);
+		Num = TimIn->ClkHz/G;
+		Den = PLC_PWM_PLAN_NS_PER_S/G;
+		if(ValIn > PLC_PWM_PLAN_NUM__MAX/Num) return (PlcPwmPlan_Limit(TimIn, 1, PlanIn));
+		Num *= ValIn;
+	}
+	else
+	{
+		return (PLC_PWM_PLAN_ERR_ARG);
+	}
+
+	//limits of timer
+	ArrSz = (uint64_t)TimIn->ArrMax+1;
+	Ticks = (Num + Den/2)/Den;
+	if(Ticks < (uint64_t)TimIn->ArrMin+1) return (PlcPwmPlan_Limit(TimIn, 0, PlanIn));
+	if(Ticks > ((uint64_t)TimIn->PscMax+1)*ArrSz) return (PlcPwmPlan_Limit(TimIn, 1, PlanIn));
+
+	//the least prescaler (the best resolution)
+	PMin = (Ticks + ArrSz - 1)/ArrSz;
+	if(!PMin) PMin = 1;
+
+	//the greatest prescaler (requested resolution)
+	Res  = ((ResIn > TimIn->ArrMin+1) ? ResIn : TimIn->ArrMin+1);
+	PMax = ((ResIn) ? Ticks/Res : PMin);
+	if(PMax > (uint64_t)TimIn->PscMax+1)       PMax = (uint64_t)TimIn->PscMax+1;
+	if(PMax > PMin+PLC_PWM_PLAN_SEARCH_SZ-1)   PMax = PMin+PLC_PWM_PLAN_SEARCH_SZ-1;
+	if(PMax < PMin)                            PMax = PMin;
+
+	for(P=PMin; P<=PMax; P++)
+	{
+		PD = P*Den;
+		A  = (Num + PD/2)/PD;
+		if(A < (uint64_t)TimIn->ArrMin+1) A = (uint64_t)TimIn->ArrMin+1;
+		if(A > ArrSz)                     A = ArrSz;
+
+		AP  = A*PD;
+		Err = ((AP > Num) ? AP-Num : Num-AP);
+		if(Err < BestErr)
+		{
+			BestErr     = Err;
+			PlanIn->Psc = (uint32_t)(P-1);
+			PlanIn->Arr = (uint32_t)(A-1);
+			if(!Err) break;
+		}
+	}
+
+	if(ResIn && PlanIn->Arr+1 < ResIn) return (PLC_PWM_PLAN_ERR_RES);
+
+	return (PLC_PWM_PLAN_OK);
+}
+
+/** @brief  Get frequency of plan.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  PlanIn - pointer to plan.
+ *  @return Frequency (mHz, rounded).
+ */
+uint64_t PlcPwmPlan_FreqMilliHz(const PlcPwmPlan_Tim_t *TimIn, const PlcPwmPlan_t *PlanIn)
+{
+	uint64_t Ticks;
+
+	if(!TimIn || !PlanIn) return (0);
+
+	Ticks = ((uint64_t)PlanIn->Psc+1)*((uint64_t)PlanIn->Arr+1);
+	return (((uint64_t)TimIn->ClkHz*1000 + Ticks/2)/Ticks);
+}
+
+/** @brief  Get period of plan.
+ *  @param  TimIn - pointer to timer limits.
+ *  @param  PlanIn - pointer to plan.
+ *  @return Period (ns, rounded).
+ */
+uint64_t PlcPwmPlan_PeriodNs(const PlcPwmPlan_Tim_t *TimIn, const PlcPwmPlan_t *PlanIn)
+{
+	uint64_t Ticks;
+
+	if(!TimIn || !PlanIn || !TimIn->ClkHz) return (0);
+
+	Ticks = ((uint64_t)PlanIn->Psc+1)*((uint64_t)PlanIn->Arr+1);
+	return ((Ticks/TimIn->ClkHz)*PLC_PWM_PLAN_NS_PER_S + ((Ticks%TimIn->ClkHz)*PLC_PWM_PLAN_NS_PER_S + TimIn->ClkHz/2)/TimIn->ClkHz);
+}
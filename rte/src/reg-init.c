@@ -35,6 +35,13 @@ uint16_t REG_Init(void)
     Res += REG_InitRegs(REG_DI_RESET__GID, REG_DI_RESET__ZONE, REG_DI_RESET__TYPESZ, REG_DI_RESET__GROUP, REG_DI_RESET__TYPE, REG_DI_RESET__POS, REG_DI_RESET__SZ, REG_DI_RESET__SADDR, REG_DI_RESET__MBTABLE, REG_DI_RESET__MBPOS, REG_DI_RESET__A00, REG_DI_RESET__A01, REG_DI_RESET__A02, REG_DI_RESET__DTABLE, REG_DI_RESET__DPOS, REG_DI_RESET__RETAIN, REG_DI_RESET__STR);
     Res += REG_InitRegs(REG_DI_STATUS__GID, REG_DI_STATUS__ZONE, REG_DI_STATUS__TYPESZ, REG_DI_STATUS__GROUP, REG_DI_STATUS__TYPE, REG_DI_STATUS__POS, REG_DI_STATUS__SZ, REG_DI_STATUS__SADDR, REG_DI_STATUS__MBTABLE, REG_DI_STATUS__MBPOS, REG_DI_STATUS__A00, REG_DI_STATUS__A01, REG_DI_STATUS__A02, REG_DI_STATUS__DTABLE, REG_DI_STATUS__DPOS, REG_DI_STATUS__RETAIN, REG_DI_STATUS__STR);
     Res += REG_InitRegs(REG_DI_FILTER_DELAY__GID, REG_DI_FILTER_DELAY__ZONE, REG_DI_FILTER_DELAY__TYPESZ, REG_DI_FILTER_DELAY__GROUP, REG_DI_FILTER_DELAY__TYPE, REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ, REG_DI_FILTER_DELAY__SADDR, REG_DI_FILTER_DELAY__MBTABLE, REG_DI_FILTER_DELAY__MBPOS, REG_DI_FILTER_DELAY__A00, REG_DI_FILTER_DELAY__A01, REG_DI_FILTER_DELAY__A02, REG_DI_FILTER_DELAY__DTABLE, REG_DI_FILTER_DELAY__DPOS, REG_DI_FILTER_DELAY__RETAIN, REG_DI_FILTER_DELAY__STR);
+    Res += REG_InitRegs(REG_DI_CNTR_CMP_ALLOW__GID, REG_DI_CNTR_CMP_ALLOW__ZONE, REG_DI_CNTR_CMP_ALLOW__TYPESZ, REG_DI_CNTR_CMP_ALLOW__GROUP, REG_DI_CNTR_CMP_ALLOW__TYPE, REG_DI_CNTR_CMP_ALLOW__POS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_DI_CNTR_CMP_ALLOW__SADDR, REG_DI_CNTR_CMP_ALLOW__MBTABLE, REG_DI_CNTR_CMP_ALLOW__MBPOS, REG_DI_CNTR_CMP_ALLOW__A00, REG_DI_CNTR_CMP_ALLOW__A01, REG_DI_CNTR_CMP_ALLOW__A02, REG_DI_CNTR_CMP_ALLOW__DTABLE, REG_DI_CNTR_CMP_ALLOW__DPOS, REG_DI_CNTR_CMP_ALLOW__RETAIN, REG_DI_CNTR_CMP_ALLOW__STR);
+    Res += REG_InitRegs(REG_DI_CNTR_CMP_DO_VAL__GID, REG_DI_CNTR_CMP_DO_VAL__ZONE, REG_DI_CNTR_CMP_DO_VAL__TYPESZ, REG_DI_CNTR_CMP_DO_VAL__GROUP, REG_DI_CNTR_CMP_DO_VAL__TYPE, REG_DI_CNTR_CMP_DO_VAL__POS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_DI_CNTR_CMP_DO_VAL__SADDR, REG_DI_CNTR_CMP_DO_VAL__MBTABLE, REG_DI_CNTR_CMP_DO_VAL__MBPOS, REG_DI_CNTR_CMP_DO_VAL__A00, REG_DI_CNTR_CMP_DO_VAL__A01, REG_DI_CNTR_CMP_DO_VAL__A02, REG_DI_CNTR_CMP_DO_VAL__DTABLE, REG_DI_CNTR_CMP_DO_VAL__DPOS, REG_DI_CNTR_CMP_DO_VAL__RETAIN, REG_DI_CNTR_CMP_DO_VAL__STR);
+    Res += REG_InitRegs(REG_DI_CNTR_CMP_REACHED__GID, REG_DI_CNTR_CMP_REACHED__ZONE, REG_DI_CNTR_CMP_REACHED__TYPESZ, REG_DI_CNTR_CMP_REACHED__GROUP, REG_DI_CNTR_CMP_REACHED__TYPE, REG_DI_CNTR_CMP_REACHED__POS, REG_DI_CNTR_CMP_REACHED__SZ, REG_DI_CNTR_CMP_REACHED__SADDR, REG_DI_CNTR_CMP_REACHED__MBTABLE, REG_DI_CNTR_CMP_REACHED__MBPOS, REG_DI_CNTR_CMP_REACHED__A00, REG_DI_CNTR_CMP_REACHED__A01, REG_DI_CNTR_CMP_REACHED__A02, REG_DI_CNTR_CMP_REACHED__DTABLE, REG_DI_CNTR_CMP_REACHED__DPOS, REG_DI_CNTR_CMP_REACHED__RETAIN, REG_DI_CNTR_CMP_REACHED__STR);
+    Res += REG_InitRegs(REG_DI_CNTR_CMP_DO__GID, REG_DI_CNTR_CMP_DO__ZONE, REG_DI_CNTR_CMP_DO__TYPESZ, REG_DI_CNTR_CMP_DO__GROUP, REG_DI_CNTR_CMP_DO__TYPE, REG_DI_CNTR_CMP_DO__POS, REG_DI_CNTR_CMP_DO__SZ, REG_DI_CNTR_CMP_DO__SADDR, REG_DI_CNTR_CMP_DO__MBTABLE, REG_DI_CNTR_CMP_DO__MBPOS, REG_DI_CNTR_CMP_DO__A00, REG_DI_CNTR_CMP_DO__A01, REG_DI_CNTR_CMP_DO__A02, REG_DI_CNTR_CMP_DO__DTABLE, REG_DI_CNTR_CMP_DO__DPOS, REG_DI_CNTR_CMP_DO__RETAIN, REG_DI_CNTR_CMP_DO__STR);
+    Res += REG_InitRegs(REG_DI_EVT_HEAD__GID, REG_DI_EVT_HEAD__ZONE, REG_DI_EVT_HEAD__TYPESZ, REG_DI_EVT_HEAD__GROUP, REG_DI_EVT_HEAD__TYPE, REG_DI_EVT_HEAD__POS, REG_DI_EVT_HEAD__SZ, REG_DI_EVT_HEAD__SADDR, REG_DI_EVT_HEAD__MBTABLE, REG_DI_EVT_HEAD__MBPOS, REG_DI_EVT_HEAD__A00, REG_DI_EVT_HEAD__A01, REG_DI_EVT_HEAD__A02, REG_DI_EVT_HEAD__DTABLE, REG_DI_EVT_HEAD__DPOS, REG_DI_EVT_HEAD__RETAIN, REG_DI_EVT_HEAD__STR);
+    Res += REG_InitRegs(REG_DI_EVT_CURSOR__GID, REG_DI_EVT_CURSOR__ZONE, REG_DI_EVT_CURSOR__TYPESZ, REG_DI_EVT_CURSOR__GROUP, REG_DI_EVT_CURSOR__TYPE, REG_DI_EVT_CURSOR__POS, REG_DI_EVT_CURSOR__SZ, REG_DI_EVT_CURSOR__SADDR, REG_DI_EVT_CURSOR__MBTABLE, REG_DI_EVT_CURSOR__MBPOS, REG_DI_EVT_CURSOR__A00, REG_DI_EVT_CURSOR__A01, REG_DI_EVT_CURSOR__A02, REG_DI_EVT_CURSOR__DTABLE, REG_DI_EVT_CURSOR__DPOS, REG_DI_EVT_CURSOR__RETAIN, REG_DI_EVT_CURSOR__STR);
+    Res += REG_InitRegs(REG_DI_EVT_WIN__GID, REG_DI_EVT_WIN__ZONE, REG_DI_EVT_WIN__TYPESZ, REG_DI_EVT_WIN__GROUP, REG_DI_EVT_WIN__TYPE, REG_DI_EVT_WIN__POS, REG_DI_EVT_WIN__SZ, REG_DI_EVT_WIN__SADDR, REG_DI_EVT_WIN__MBTABLE, REG_DI_EVT_WIN__MBPOS, REG_DI_EVT_WIN__A00, REG_DI_EVT_WIN__A01, REG_DI_EVT_WIN__A02, REG_DI_EVT_WIN__DTABLE, REG_DI_EVT_WIN__DPOS, REG_DI_EVT_WIN__RETAIN, REG_DI_EVT_WIN__STR);
 
     //DO
     Res += REG_InitRegs(REG_DO_NORM_VAL__GID, REG_DO_NORM_VAL__ZONE, REG_DO_NORM_VAL__TYPESZ, REG_DO_NORM_VAL__GROUP, REG_DO_NORM_VAL__TYPE, REG_DO_NORM_VAL__POS, REG_DO_NORM_VAL__SZ, REG_DO_NORM_VAL__SADDR, REG_DO_NORM_VAL__MBTABLE, REG_DO_NORM_VAL__MBPOS, REG_DO_NORM_VAL__A00, REG_DO_NORM_VAL__A01, REG_DO_NORM_VAL__A02, REG_DO_NORM_VAL__DTABLE, REG_DO_NORM_VAL__DPOS, REG_DO_NORM_VAL__RETAIN, REG_DO_NORM_VAL__STR);
@@ -44,6 +51,21 @@ uint16_t REG_Init(void)
     Res += REG_InitRegs(REG_DO_PWM_PERIOD__GID, REG_DO_PWM_PERIOD__ZONE, REG_DO_PWM_PERIOD__TYPESZ, REG_DO_PWM_PERIOD__GROUP, REG_DO_PWM_PERIOD__TYPE, REG_DO_PWM_PERIOD__POS, REG_DO_PWM_PERIOD__SZ, REG_DO_PWM_PERIOD__SADDR, REG_DO_PWM_PERIOD__MBTABLE, REG_DO_PWM_PERIOD__MBPOS, REG_DO_PWM_PERIOD__A00, REG_DO_PWM_PERIOD__A01, REG_DO_PWM_PERIOD__A02, REG_DO_PWM_PERIOD__DTABLE, REG_DO_PWM_PERIOD__DPOS, REG_DO_PWM_PERIOD__RETAIN, REG_DO_PWM_PERIOD__STR);
     Res += REG_InitRegs(REG_DO_MODE__GID, REG_DO_MODE__ZONE, REG_DO_MODE__TYPESZ, REG_DO_MODE__GROUP, REG_DO_MODE__TYPE, REG_DO_MODE__POS, REG_DO_MODE__SZ, REG_DO_MODE__SADDR, REG_DO_MODE__MBTABLE, REG_DO_MODE__MBPOS, REG_DO_MODE__A00, REG_DO_MODE__A01, REG_DO_MODE__A02, REG_DO_MODE__DTABLE, REG_DO_MODE__DPOS, REG_DO_MODE__RETAIN, REG_DO_MODE__STR);
     Res += REG_InitRegs(REG_DO_STATUS__GID, REG_DO_STATUS__ZONE, REG_DO_STATUS__TYPESZ, REG_DO_STATUS__GROUP, REG_DO_STATUS__TYPE, REG_DO_STATUS__POS, REG_DO_STATUS__SZ, REG_DO_STATUS__SADDR, REG_DO_STATUS__MBTABLE, REG_DO_STATUS__MBPOS, REG_DO_STATUS__A00, REG_DO_STATUS__A01, REG_DO_STATUS__A02, REG_DO_STATUS__DTABLE, REG_DO_STATUS__DPOS, REG_DO_STATUS__RETAIN, REG_DO_STATUS__STR);
+    Res += REG_InitRegs(REG_DO_PTO_PULSES__GID, REG_DO_PTO_PULSES__ZONE, REG_DO_PTO_PULSES__TYPESZ, REG_DO_PTO_PULSES__GROUP, REG_DO_PTO_PULSES__TYPE, REG_DO_PTO_PULSES__POS, REG_DO_PTO_PULSES__SZ, REG_DO_PTO_PULSES__SADDR, REG_DO_PTO_PULSES__MBTABLE, REG_DO_PTO_PULSES__MBPOS, REG_DO_PTO_PULSES__A00, REG_DO_PTO_PULSES__A01, REG_DO_PTO_PULSES__A02, REG_DO_PTO_PULSES__DTABLE, REG_DO_PTO_PULSES__DPOS, REG_DO_PTO_PULSES__RETAIN, REG_DO_PTO_PULSES__STR);
+    Res += REG_InitRegs(REG_DO_PTO_FREQ_START__GID, REG_DO_PTO_FREQ_START__ZONE, REG_DO_PTO_FREQ_START__TYPESZ, REG_DO_PTO_FREQ_START__GROUP, REG_DO_PTO_FREQ_START__TYPE, REG_DO_PTO_FREQ_START__POS, REG_DO_PTO_FREQ_START__SZ, REG_DO_PTO_FREQ_START__SADDR, REG_DO_PTO_FREQ_START__MBTABLE, REG_DO_PTO_FREQ_START__MBPOS, REG_DO_PTO_FREQ_START__A00, REG_DO_PTO_FREQ_START__A01, REG_DO_PTO_FREQ_START__A02, REG_DO_PTO_FREQ_START__DTABLE, REG_DO_PTO_FREQ_START__DPOS, REG_DO_PTO_FREQ_START__RETAIN, REG_DO_PTO_FREQ_START__STR);
+    Res += REG_InitRegs(REG_DO_PTO_FREQ_MAX__GID, REG_DO_PTO_FREQ_MAX__ZONE, REG_DO_PTO_FREQ_MAX__TYPESZ, REG_DO_PTO_FREQ_MAX__GROUP, REG_DO_PTO_FREQ_MAX__TYPE, REG_DO_PTO_FREQ_MAX__POS, REG_DO_PTO_FREQ_MAX__SZ, REG_DO_PTO_FREQ_MAX__SADDR, REG_DO_PTO_FREQ_MAX__MBTABLE, REG_DO_PTO_FREQ_MAX__MBPOS, REG_DO_PTO_FREQ_MAX__A00, REG_DO_PTO_FREQ_MAX__A01, REG_DO_PTO_FREQ_MAX__A02, REG_DO_PTO_FREQ_MAX__DTABLE, REG_DO_PTO_FREQ_MAX__DPOS, REG_DO_PTO_FREQ_MAX__RETAIN, REG_DO_PTO_FREQ_MAX__STR);
+    Res += REG_InitRegs(REG_DO_PTO_ACCEL__GID, REG_DO_PTO_ACCEL__ZONE, REG_DO_PTO_ACCEL__TYPESZ, REG_DO_PTO_ACCEL__GROUP, REG_DO_PTO_ACCEL__TYPE, REG_DO_PTO_ACCEL__POS, REG_DO_PTO_ACCEL__SZ, REG_DO_PTO_ACCEL__SADDR, REG_DO_PTO_ACCEL__MBTABLE, REG_DO_PTO_ACCEL__MBPOS, REG_DO_PTO_ACCEL__A00, REG_DO_PTO_ACCEL__A01, REG_DO_PTO_ACCEL__A02, REG_DO_PTO_ACCEL__DTABLE, REG_DO_PTO_ACCEL__DPOS, REG_DO_PTO_ACCEL__RETAIN, REG_DO_PTO_ACCEL__STR);
+    Res += REG_InitRegs(REG_DO_PTO_PROFILE__GID, REG_DO_PTO_PROFILE__ZONE, REG_DO_PTO_PROFILE__TYPESZ, REG_DO_PTO_PROFILE__GROUP, REG_DO_PTO_PROFILE__TYPE, REG_DO_PTO_PROFILE__POS, REG_DO_PTO_PROFILE__SZ, REG_DO_PTO_PROFILE__SADDR, REG_DO_PTO_PROFILE__MBTABLE, REG_DO_PTO_PROFILE__MBPOS, REG_DO_PTO_PROFILE__A00, REG_DO_PTO_PROFILE__A01, REG_DO_PTO_PROFILE__A02, REG_DO_PTO_PROFILE__DTABLE, REG_DO_PTO_PROFILE__DPOS, REG_DO_PTO_PROFILE__RETAIN, REG_DO_PTO_PROFILE__STR);
+    Res += REG_InitRegs(REG_DO_PTO_START__GID, REG_DO_PTO_START__ZONE, REG_DO_PTO_START__TYPESZ, REG_DO_PTO_START__GROUP, REG_DO_PTO_START__TYPE, REG_DO_PTO_START__POS, REG_DO_PTO_START__SZ, REG_DO_PTO_START__SADDR, REG_DO_PTO_START__MBTABLE, REG_DO_PTO_START__MBPOS, REG_DO_PTO_START__A00, REG_DO_PTO_START__A01, REG_DO_PTO_START__A02, REG_DO_PTO_START__DTABLE, REG_DO_PTO_START__DPOS, REG_DO_PTO_START__RETAIN, REG_DO_PTO_START__STR);
+    Res += REG_InitRegs(REG_DO_PTO_DONE__GID, REG_DO_PTO_DONE__ZONE, REG_DO_PTO_DONE__TYPESZ, REG_DO_PTO_DONE__GROUP, REG_DO_PTO_DONE__TYPE, REG_DO_PTO_DONE__POS, REG_DO_PTO_DONE__SZ, REG_DO_PTO_DONE__SADDR, REG_DO_PTO_DONE__MBTABLE, REG_DO_PTO_DONE__MBPOS, REG_DO_PTO_DONE__A00, REG_DO_PTO_DONE__A01, REG_DO_PTO_DONE__A02, REG_DO_PTO_DONE__DTABLE, REG_DO_PTO_DONE__DPOS, REG_DO_PTO_DONE__RETAIN, REG_DO_PTO_DONE__STR);
+    Res += REG_InitRegs(REG_DO_SAFE_VAL__GID, REG_DO_SAFE_VAL__ZONE, REG_DO_SAFE_VAL__TYPESZ, REG_DO_SAFE_VAL__GROUP, REG_DO_SAFE_VAL__TYPE, REG_DO_SAFE_VAL__POS, REG_DO_SAFE_VAL__SZ, REG_DO_SAFE_VAL__SADDR, REG_DO_SAFE_VAL__MBTABLE, REG_DO_SAFE_VAL__MBPOS, REG_DO_SAFE_VAL__A00, REG_DO_SAFE_VAL__A01, REG_DO_SAFE_VAL__A02, REG_DO_SAFE_VAL__DTABLE, REG_DO_SAFE_VAL__DPOS, REG_DO_SAFE_VAL__RETAIN, REG_DO_SAFE_VAL__STR);
+    Res += REG_InitRegs(REG_DO_SAFE_ALLOW__GID, REG_DO_SAFE_ALLOW__ZONE, REG_DO_SAFE_ALLOW__TYPESZ, REG_DO_SAFE_ALLOW__GROUP, REG_DO_SAFE_ALLOW__TYPE, REG_DO_SAFE_ALLOW__POS, REG_DO_SAFE_ALLOW__SZ, REG_DO_SAFE_ALLOW__SADDR, REG_DO_SAFE_ALLOW__MBTABLE, REG_DO_SAFE_ALLOW__MBPOS, REG_DO_SAFE_ALLOW__A00, REG_DO_SAFE_ALLOW__A01, REG_DO_SAFE_ALLOW__A02, REG_DO_SAFE_ALLOW__DTABLE, REG_DO_SAFE_ALLOW__DPOS, REG_DO_SAFE_ALLOW__RETAIN, REG_DO_SAFE_ALLOW__STR);
+    Res += REG_InitRegs(REG_DO_PWM_FREQ__GID, REG_DO_PWM_FREQ__ZONE, REG_DO_PWM_FREQ__TYPESZ, REG_DO_PWM_FREQ__GROUP, REG_DO_PWM_FREQ__TYPE, REG_DO_PWM_FREQ__POS, REG_DO_PWM_FREQ__SZ, REG_DO_PWM_FREQ__SADDR, REG_DO_PWM_FREQ__MBTABLE, REG_DO_PWM_FREQ__MBPOS, REG_DO_PWM_FREQ__A00, REG_DO_PWM_FREQ__A01, REG_DO_PWM_FREQ__A02, REG_DO_PWM_FREQ__DTABLE, REG_DO_PWM_FREQ__DPOS, REG_DO_PWM_FREQ__RETAIN, REG_DO_PWM_FREQ__STR);
+    Res += REG_InitRegs(REG_DO_PWM_PERIOD_NS__GID, REG_DO_PWM_PERIOD_NS__ZONE, REG_DO_PWM_PERIOD_NS__TYPESZ, REG_DO_PWM_PERIOD_NS__GROUP, REG_DO_PWM_PERIOD_NS__TYPE, REG_DO_PWM_PERIOD_NS__POS, REG_DO_PWM_PERIOD_NS__SZ, REG_DO_PWM_PERIOD_NS__SADDR, REG_DO_PWM_PERIOD_NS__MBTABLE, REG_DO_PWM_PERIOD_NS__MBPOS, REG_DO_PWM_PERIOD_NS__A00, REG_DO_PWM_PERIOD_NS__A01, REG_DO_PWM_PERIOD_NS__A02, REG_DO_PWM_PERIOD_NS__DTABLE, REG_DO_PWM_PERIOD_NS__DPOS, REG_DO_PWM_PERIOD_NS__RETAIN, REG_DO_PWM_PERIOD_NS__STR);
+    Res += REG_InitRegs(REG_DO_PWM_RES__GID, REG_DO_PWM_RES__ZONE, REG_DO_PWM_RES__TYPESZ, REG_DO_PWM_RES__GROUP, REG_DO_PWM_RES__TYPE, REG_DO_PWM_RES__POS, REG_DO_PWM_RES__SZ, REG_DO_PWM_RES__SADDR, REG_DO_PWM_RES__MBTABLE, REG_DO_PWM_RES__MBPOS, REG_DO_PWM_RES__A00, REG_DO_PWM_RES__A01, REG_DO_PWM_RES__A02, REG_DO_PWM_RES__DTABLE, REG_DO_PWM_RES__DPOS, REG_DO_PWM_RES__RETAIN, REG_DO_PWM_RES__STR);
+    Res += REG_InitRegs(REG_DO_PWM_FREQ_ACT__GID, REG_DO_PWM_FREQ_ACT__ZONE, REG_DO_PWM_FREQ_ACT__TYPESZ, REG_DO_PWM_FREQ_ACT__GROUP, REG_DO_PWM_FREQ_ACT__TYPE, REG_DO_PWM_FREQ_ACT__POS, REG_DO_PWM_FREQ_ACT__SZ, REG_DO_PWM_FREQ_ACT__SADDR, REG_DO_PWM_FREQ_ACT__MBTABLE, REG_DO_PWM_FREQ_ACT__MBPOS, REG_DO_PWM_FREQ_ACT__A00, REG_DO_PWM_FREQ_ACT__A01, REG_DO_PWM_FREQ_ACT__A02, REG_DO_PWM_FREQ_ACT__DTABLE, REG_DO_PWM_FREQ_ACT__DPOS, REG_DO_PWM_FREQ_ACT__RETAIN, REG_DO_PWM_FREQ_ACT__STR);
+    Res += REG_InitRegs(REG_DO_PWM_RES_ACT__GID, REG_DO_PWM_RES_ACT__ZONE, REG_DO_PWM_RES_ACT__TYPESZ, REG_DO_PWM_RES_ACT__GROUP, REG_DO_PWM_RES_ACT__TYPE, REG_DO_PWM_RES_ACT__POS, REG_DO_PWM_RES_ACT__SZ, REG_DO_PWM_RES_ACT__SADDR, REG_DO_PWM_RES_ACT__MBTABLE, REG_DO_PWM_RES_ACT__MBPOS, REG_DO_PWM_RES_ACT__A00, REG_DO_PWM_RES_ACT__A01, REG_DO_PWM_RES_ACT__A02, REG_DO_PWM_RES_ACT__DTABLE, REG_DO_PWM_RES_ACT__DPOS, REG_DO_PWM_RES_ACT__RETAIN, REG_DO_PWM_RES_ACT__STR);
+    Res += REG_InitRegs(REG_DO_CMP_HELD__GID, REG_DO_CMP_HELD__ZONE, REG_DO_CMP_HELD__TYPESZ, REG_DO_CMP_HELD__GROUP, REG_DO_CMP_HELD__TYPE, REG_DO_CMP_HELD__POS, REG_DO_CMP_HELD__SZ, REG_DO_CMP_HELD__SADDR, REG_DO_CMP_HELD__MBTABLE, REG_DO_CMP_HELD__MBPOS, REG_DO_CMP_HELD__A00, REG_DO_CMP_HELD__A01, REG_DO_CMP_HELD__A02, REG_DO_CMP_HELD__DTABLE, REG_DO_CMP_HELD__DPOS, REG_DO_CMP_HELD__RETAIN, REG_DO_CMP_HELD__STR);
 
     //AI
     Res += REG_InitRegs(REG_AI_VAL__GID, REG_AI_VAL__ZONE, REG_AI_VAL__TYPESZ, REG_AI_VAL__GROUP, REG_AI_VAL__TYPE, REG_AI_VAL__POS, REG_AI_VAL__SZ, REG_AI_VAL__SADDR, REG_AI_VAL__MBTABLE, REG_AI_VAL__MBPOS, REG_AI_VAL__A00, REG_AI_VAL__A01, REG_AI_VAL__A02, REG_AI_VAL__DTABLE, REG_AI_VAL__DPOS, REG_AI_VAL__RETAIN, REG_AI_VAL__STR);
@@ -51,10 +73,29 @@ uint16_t REG_Init(void)
     Res += REG_InitRegs(REG_AI_STATUS__GID, REG_AI_STATUS__ZONE, REG_AI_STATUS__TYPESZ, REG_AI_STATUS__GROUP, REG_AI_STATUS__TYPE, REG_AI_STATUS__POS, REG_AI_STATUS__SZ, REG_AI_STATUS__SADDR, REG_AI_STATUS__MBTABLE, REG_AI_STATUS__MBPOS, REG_AI_STATUS__A00, REG_AI_STATUS__A01, REG_AI_STATUS__A02, REG_AI_STATUS__DTABLE, REG_AI_STATUS__DPOS, REG_AI_STATUS__RETAIN, REG_AI_STATUS__STR);
     Res += REG_InitRegs(REG_AI_KA__GID, REG_AI_KA__ZONE, REG_AI_KA__TYPESZ, REG_AI_KA__GROUP, REG_AI_KA__TYPE, REG_AI_KA__POS, REG_AI_KA__SZ, REG_AI_KA__SADDR, REG_AI_KA__MBTABLE, REG_AI_KA__MBPOS, REG_AI_KA__A00, REG_AI_KA__A01, REG_AI_KA__A02, REG_AI_KA__DTABLE, REG_AI_KA__DPOS, REG_AI_KA__RETAIN, REG_AI_KA__STR);
     Res += REG_InitRegs(REG_AI_KB__GID, REG_AI_KB__ZONE, REG_AI_KB__TYPESZ, REG_AI_KB__GROUP, REG_AI_KB__TYPE, REG_AI_KB__POS, REG_AI_KB__SZ, REG_AI_KB__SADDR, REG_AI_KB__MBTABLE, REG_AI_KB__MBPOS, REG_AI_KB__A00, REG_AI_KB__A01, REG_AI_KB__A02, REG_AI_KB__DTABLE, REG_AI_KB__DPOS, REG_AI_KB__RETAIN, REG_AI_KB__STR);
+    Res += REG_InitRegs(REG_AI_FLTR__GID, REG_AI_FLTR__ZONE, REG_AI_FLTR__TYPESZ, REG_AI_FLTR__GROUP, REG_AI_FLTR__TYPE, REG_AI_FLTR__POS, REG_AI_FLTR__SZ, REG_AI_FLTR__SADDR, REG_AI_FLTR__MBTABLE, REG_AI_FLTR__MBPOS, REG_AI_FLTR__A00, REG_AI_FLTR__A01, REG_AI_FLTR__A02, REG_AI_FLTR__DTABLE, REG_AI_FLTR__DPOS, REG_AI_FLTR__RETAIN, REG_AI_FLTR__STR);
+    Res += REG_InitRegs(REG_AI_FLTR_PRM__GID, REG_AI_FLTR_PRM__ZONE, REG_AI_FLTR_PRM__TYPESZ, REG_AI_FLTR_PRM__GROUP, REG_AI_FLTR_PRM__TYPE, REG_AI_FLTR_PRM__POS, REG_AI_FLTR_PRM__SZ, REG_AI_FLTR_PRM__SADDR, REG_AI_FLTR_PRM__MBTABLE, REG_AI_FLTR_PRM__MBPOS, REG_AI_FLTR_PRM__A00, REG_AI_FLTR_PRM__A01, REG_AI_FLTR_PRM__A02, REG_AI_FLTR_PRM__DTABLE, REG_AI_FLTR_PRM__DPOS, REG_AI_FLTR_PRM__RETAIN, REG_AI_FLTR_PRM__STR);
+    Res += REG_InitRegs(REG_AI_OVS__GID, REG_AI_OVS__ZONE, REG_AI_OVS__TYPESZ, REG_AI_OVS__GROUP, REG_AI_OVS__TYPE, REG_AI_OVS__POS, REG_AI_OVS__SZ, REG_AI_OVS__SADDR, REG_AI_OVS__MBTABLE, REG_AI_OVS__MBPOS, REG_AI_OVS__A00, REG_AI_OVS__A01, REG_AI_OVS__A02, REG_AI_OVS__DTABLE, REG_AI_OVS__DPOS, REG_AI_OVS__RETAIN, REG_AI_OVS__STR);
+    Res += REG_InitRegs(REG_AI_RATE_ACT__GID, REG_AI_RATE_ACT__ZONE, REG_AI_RATE_ACT__TYPESZ, REG_AI_RATE_ACT__GROUP, REG_AI_RATE_ACT__TYPE, REG_AI_RATE_ACT__POS, REG_AI_RATE_ACT__SZ, REG_AI_RATE_ACT__SADDR, REG_AI_RATE_ACT__MBTABLE, REG_AI_RATE_ACT__MBPOS, REG_AI_RATE_ACT__A00, REG_AI_RATE_ACT__A01, REG_AI_RATE_ACT__A02, REG_AI_RATE_ACT__DTABLE, REG_AI_RATE_ACT__DPOS, REG_AI_RATE_ACT__RETAIN, REG_AI_RATE_ACT__STR);
+    Res += REG_InitRegs(REG_AI_BITS_ACT__GID, REG_AI_BITS_ACT__ZONE, REG_AI_BITS_ACT__TYPESZ, REG_AI_BITS_ACT__GROUP, REG_AI_BITS_ACT__TYPE, REG_AI_BITS_ACT__POS, REG_AI_BITS_ACT__SZ, REG_AI_BITS_ACT__SADDR, REG_AI_BITS_ACT__MBTABLE, REG_AI_BITS_ACT__MBPOS, REG_AI_BITS_ACT__A00, REG_AI_BITS_ACT__A01, REG_AI_BITS_ACT__A02, REG_AI_BITS_ACT__DTABLE, REG_AI_BITS_ACT__DPOS, REG_AI_BITS_ACT__RETAIN, REG_AI_BITS_ACT__STR);
+    Res += REG_InitRegs(REG_AI_DB__GID, REG_AI_DB__ZONE, REG_AI_DB__TYPESZ, REG_AI_DB__GROUP, REG_AI_DB__TYPE, REG_AI_DB__POS, REG_AI_DB__SZ, REG_AI_DB__SADDR, REG_AI_DB__MBTABLE, REG_AI_DB__MBPOS, REG_AI_DB__A00, REG_AI_DB__A01, REG_AI_DB__A02, REG_AI_DB__DTABLE, REG_AI_DB__DPOS, REG_AI_DB__RETAIN, REG_AI_DB__STR);
+    Res += REG_InitRegs(REG_AI_DB_PCT__GID, REG_AI_DB_PCT__ZONE, REG_AI_DB_PCT__TYPESZ, REG_AI_DB_PCT__GROUP, REG_AI_DB_PCT__TYPE, REG_AI_DB_PCT__POS, REG_AI_DB_PCT__SZ, REG_AI_DB_PCT__SADDR, REG_AI_DB_PCT__MBTABLE, REG_AI_DB_PCT__MBPOS, REG_AI_DB_PCT__A00, REG_AI_DB_PCT__A01, REG_AI_DB_PCT__A02, REG_AI_DB_PCT__DTABLE, REG_AI_DB_PCT__DPOS, REG_AI_DB_PCT__RETAIN, REG_AI_DB_PCT__STR);
+    Res += REG_InitRegs(REG_AI_PUB_MIN__GID, REG_AI_PUB_MIN__ZONE, REG_AI_PUB_MIN__TYPESZ, REG_AI_PUB_MIN__GROUP, REG_AI_PUB_MIN__TYPE, REG_AI_PUB_MIN__POS, REG_AI_PUB_MIN__SZ, REG_AI_PUB_MIN__SADDR, REG_AI_PUB_MIN__MBTABLE, REG_AI_PUB_MIN__MBPOS, REG_AI_PUB_MIN__A00, REG_AI_PUB_MIN__A01, REG_AI_PUB_MIN__A02, REG_AI_PUB_MIN__DTABLE, REG_AI_PUB_MIN__DPOS, REG_AI_PUB_MIN__RETAIN, REG_AI_PUB_MIN__STR);
+    Res += REG_InitRegs(REG_AI_PUB_HB__GID, REG_AI_PUB_HB__ZONE, REG_AI_PUB_HB__TYPESZ, REG_AI_PUB_HB__GROUP, REG_AI_PUB_HB__TYPE, REG_AI_PUB_HB__POS, REG_AI_PUB_HB__SZ, REG_AI_PUB_HB__SADDR, REG_AI_PUB_HB__MBTABLE, REG_AI_PUB_HB__MBPOS, REG_AI_PUB_HB__A00, REG_AI_PUB_HB__A01, REG_AI_PUB_HB__A02, REG_AI_PUB_HB__DTABLE, REG_AI_PUB_HB__DPOS, REG_AI_PUB_HB__RETAIN, REG_AI_PUB_HB__STR);
+    Res += REG_InitRegs(REG_AI_CAP_SET__GID, REG_AI_CAP_SET__ZONE, REG_AI_CAP_SET__TYPESZ, REG_AI_CAP_SET__GROUP, REG_AI_CAP_SET__TYPE, REG_AI_CAP_SET__POS, REG_AI_CAP_SET__SZ, REG_AI_CAP_SET__SADDR, REG_AI_CAP_SET__MBTABLE, REG_AI_CAP_SET__MBPOS, REG_AI_CAP_SET__A00, REG_AI_CAP_SET__A01, REG_AI_CAP_SET__A02, REG_AI_CAP_SET__DTABLE, REG_AI_CAP_SET__DPOS, REG_AI_CAP_SET__RETAIN, REG_AI_CAP_SET__STR);
+    Res += REG_InitRegs(REG_AI_CAP_CMD__GID, REG_AI_CAP_CMD__ZONE, REG_AI_CAP_CMD__TYPESZ, REG_AI_CAP_CMD__GROUP, REG_AI_CAP_CMD__TYPE, REG_AI_CAP_CMD__POS, REG_AI_CAP_CMD__SZ, REG_AI_CAP_CMD__SADDR, REG_AI_CAP_CMD__MBTABLE, REG_AI_CAP_CMD__MBPOS, REG_AI_CAP_CMD__A00, REG_AI_CAP_CMD__A01, REG_AI_CAP_CMD__A02, REG_AI_CAP_CMD__DTABLE, REG_AI_CAP_CMD__DPOS, REG_AI_CAP_CMD__RETAIN, REG_AI_CAP_CMD__STR);
+    Res += REG_InitRegs(REG_AI_CAP_STAT__GID, REG_AI_CAP_STAT__ZONE, REG_AI_CAP_STAT__TYPESZ, REG_AI_CAP_STAT__GROUP, REG_AI_CAP_STAT__TYPE, REG_AI_CAP_STAT__POS, REG_AI_CAP_STAT__SZ, REG_AI_CAP_STAT__SADDR, REG_AI_CAP_STAT__MBTABLE, REG_AI_CAP_STAT__MBPOS, REG_AI_CAP_STAT__A00, REG_AI_CAP_STAT__A01, REG_AI_CAP_STAT__A02, REG_AI_CAP_STAT__DTABLE, REG_AI_CAP_STAT__DPOS, REG_AI_CAP_STAT__RETAIN, REG_AI_CAP_STAT__STR);
+    Res += REG_InitRegs(REG_AI_CAP_WIN__GID, REG_AI_CAP_WIN__ZONE, REG_AI_CAP_WIN__TYPESZ, REG_AI_CAP_WIN__GROUP, REG_AI_CAP_WIN__TYPE, REG_AI_CAP_WIN__POS, REG_AI_CAP_WIN__SZ, REG_AI_CAP_WIN__SADDR, REG_AI_CAP_WIN__MBTABLE, REG_AI_CAP_WIN__MBPOS, REG_AI_CAP_WIN__A00, REG_AI_CAP_WIN__A01, REG_AI_CAP_WIN__A02, REG_AI_CAP_WIN__DTABLE, REG_AI_CAP_WIN__DPOS, REG_AI_CAP_WIN__RETAIN, REG_AI_CAP_WIN__STR);
+    Res += REG_InitRegs(REG_AI_LIN__GID, REG_AI_LIN__ZONE, REG_AI_LIN__TYPESZ, REG_AI_LIN__GROUP, REG_AI_LIN__TYPE, REG_AI_LIN__POS, REG_AI_LIN__SZ, REG_AI_LIN__SADDR, REG_AI_LIN__MBTABLE, REG_AI_LIN__MBPOS, REG_AI_LIN__A00, REG_AI_LIN__A01, REG_AI_LIN__A02, REG_AI_LIN__DTABLE, REG_AI_LIN__DPOS, REG_AI_LIN__RETAIN, REG_AI_LIN__STR);
+    Res += REG_InitRegs(REG_AI_LIN_SZ__GID, REG_AI_LIN_SZ__ZONE, REG_AI_LIN_SZ__TYPESZ, REG_AI_LIN_SZ__GROUP, REG_AI_LIN_SZ__TYPE, REG_AI_LIN_SZ__POS, REG_AI_LIN_SZ__SZ, REG_AI_LIN_SZ__SADDR, REG_AI_LIN_SZ__MBTABLE, REG_AI_LIN_SZ__MBPOS, REG_AI_LIN_SZ__A00, REG_AI_LIN_SZ__A01, REG_AI_LIN_SZ__A02, REG_AI_LIN_SZ__DTABLE, REG_AI_LIN_SZ__DPOS, REG_AI_LIN_SZ__RETAIN, REG_AI_LIN_SZ__STR);
+    Res += REG_InitRegs(REG_AI_LIN_TBL__GID, REG_AI_LIN_TBL__ZONE, REG_AI_LIN_TBL__TYPESZ, REG_AI_LIN_TBL__GROUP, REG_AI_LIN_TBL__TYPE, REG_AI_LIN_TBL__POS, REG_AI_LIN_TBL__SZ, REG_AI_LIN_TBL__SADDR, REG_AI_LIN_TBL__MBTABLE, REG_AI_LIN_TBL__MBPOS, REG_AI_LIN_TBL__A00, REG_AI_LIN_TBL__A01, REG_AI_LIN_TBL__A02, REG_AI_LIN_TBL__DTABLE, REG_AI_LIN_TBL__DPOS, REG_AI_LIN_TBL__RETAIN, REG_AI_LIN_TBL__STR);
+    Res += REG_InitRegs(REG_AI_THR__GID, REG_AI_THR__ZONE, REG_AI_THR__TYPESZ, REG_AI_THR__GROUP, REG_AI_THR__TYPE, REG_AI_THR__POS, REG_AI_THR__SZ, REG_AI_THR__SADDR, REG_AI_THR__MBTABLE, REG_AI_THR__MBPOS, REG_AI_THR__A00, REG_AI_THR__A01, REG_AI_THR__A02, REG_AI_THR__DTABLE, REG_AI_THR__DPOS, REG_AI_THR__RETAIN, REG_AI_THR__STR);
+    Res += REG_InitRegs(REG_AI_THR_REACHED__GID, REG_AI_THR_REACHED__ZONE, REG_AI_THR_REACHED__TYPESZ, REG_AI_THR_REACHED__GROUP, REG_AI_THR_REACHED__TYPE, REG_AI_THR_REACHED__POS, REG_AI_THR_REACHED__SZ, REG_AI_THR_REACHED__SADDR, REG_AI_THR_REACHED__MBTABLE, REG_AI_THR_REACHED__MBPOS, REG_AI_THR_REACHED__A00, REG_AI_THR_REACHED__A01, REG_AI_THR_REACHED__A02, REG_AI_THR_REACHED__DTABLE, REG_AI_THR_REACHED__DPOS, REG_AI_THR_REACHED__RETAIN, REG_AI_THR_REACHED__STR);
 
     //SYS
     Res += REG_InitRegs(REG_SYS_STAT__GID, REG_SYS_STAT__ZONE, REG_SYS_STAT__TYPESZ, REG_SYS_STAT__GROUP, REG_SYS_STAT__TYPE, REG_SYS_STAT__POS, REG_SYS_STAT__SZ, REG_SYS_STAT__SADDR, REG_SYS_STAT__MBTABLE, REG_SYS_STAT__MBPOS, REG_SYS_STAT__A00, REG_SYS_STAT__A01, REG_SYS_STAT__A02, REG_SYS_STAT__DTABLE, REG_SYS_STAT__DPOS, REG_SYS_STAT__RETAIN, 0);
     Res += REG_InitRegs(REG_SYS_SET__GID, REG_SYS_SET__ZONE, REG_SYS_SET__TYPESZ, REG_SYS_SET__GROUP, REG_SYS_SET__TYPE, REG_SYS_SET__POS, REG_SYS_SET__SZ, REG_SYS_SET__SADDR, REG_SYS_SET__MBTABLE, REG_SYS_SET__MBPOS, REG_SYS_SET__A00, REG_SYS_SET__A01, REG_SYS_SET__A02, REG_SYS_SET__DTABLE, REG_SYS_SET__DPOS, REG_SYS_SET__RETAIN, 0);
+    Res += REG_InitRegs(REG_SYS_RTC_SET__GID, REG_SYS_RTC_SET__ZONE, REG_SYS_RTC_SET__TYPESZ, REG_SYS_RTC_SET__GROUP, REG_SYS_RTC_SET__TYPE, REG_SYS_RTC_SET__POS, REG_SYS_RTC_SET__SZ, REG_SYS_RTC_SET__SADDR, REG_SYS_RTC_SET__MBTABLE, REG_SYS_RTC_SET__MBPOS, REG_SYS_RTC_SET__A00, REG_SYS_RTC_SET__A01, REG_SYS_RTC_SET__A02, REG_SYS_RTC_SET__DTABLE, REG_SYS_RTC_SET__DPOS, REG_SYS_RTC_SET__RETAIN, 0);
     Res += REG_InitRegs(REG_SYS_CMD__GID, REG_SYS_CMD__ZONE, REG_SYS_CMD__TYPESZ, REG_SYS_CMD__GROUP, REG_SYS_CMD__TYPE, REG_SYS_CMD__POS, REG_SYS_CMD__SZ, REG_SYS_CMD__SADDR, REG_SYS_CMD__MBTABLE, REG_SYS_CMD__MBPOS, REG_SYS_CMD__A00, REG_SYS_CMD__A01, REG_SYS_CMD__A02, REG_SYS_CMD__DTABLE, REG_SYS_CMD__DPOS, REG_SYS_CMD__RETAIN, 0);
 
     //USER_DATA
@@ -69,78 +110,257 @@ uint16_t REG_Init(void)
 }
 
 #ifdef RTE_MOD_APP
+/** @var List collected instead of copy (REG_ListMbToApp, REG_ListAppToMb)
+ */
+static REG_List_t *REG_APP_LIST = 0;
+
+/** @brief  Copy registers of tasks (Data Tables <> Located variables).
+ *  @param  PosIn - start position.
+ *  @param  SzIn - number of registers.
+ *  @param  DstIn - destination (REG_COPY_MB_TO_APP, REG_COPY_APP_TO_MB).
+ *  @param  TasksIn - mask of tasks of Application.
+ *  @return The number of copied registers.
+ */
+static uint16_t REG_CopyAppRegs(uint16_t PosIn, uint16_t SzIn, uint8_t DstIn, uint8_t TasksIn)
+{
+    uint16_t Res = 0, i;
+    REG_t   *Reg;
+
+    if(PosIn < REG_SZ && SzIn > 0 && (PosIn + SzIn) <= REG_SZ)
+    {
+        for(i=PosIn; i<(PosIn + SzIn); i++)
+        {
+            Reg = REG_GetByIDx(i);
+            if(Reg && (Reg->AppTasks & TasksIn))
+            {
+                if(!REG_APP_LIST)
+                {
+                    Res += REG_CopyReg(Reg, DstIn, 0);
+                }
+                else if(REG_APP_LIST->Sz < REG_LIST_SZ)
+                {
+                    REG_APP_LIST->Reg[REG_APP_LIST->Sz++] = Reg;
+                    Res++;
+                }
+                else
+                {
+                    REG_APP_LIST->Ovf = BIT_TRUE;
+                }
+            }
+        }
+    }
+    return (Res);
+}
+
 /** @brief  Copy from Data Tables into Located variables.
- *  @param  None.
+ *  @param  TasksIn - mask of tasks of Application (registers of other tasks are not copied).
  *  @return The number of copied registers.
  */
-uint16_t REG_CopyMbToApp(void)
+uint16_t REG_CopyMbToApp(uint8_t TasksIn)
 {
     uint16_t Res = 0;
 
-    Res += REG_CopyRegs(REG_DI_NORM_VAL__POS, REG_DI_NORM_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_CNTR_VAL__POS, REG_DI_CNTR_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_CNTR_SETPOINT__POS, REG_DI_CNTR_SETPOINT__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_CNTR_SETPOINT_REACHED__POS, REG_DI_CNTR_SETPOINT_REACHED__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_TACH_VAL__POS, REG_DI_TACH_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_TACH_SETPOINT__POS, REG_DI_TACH_SETPOINT__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_TACH_SETPOINT_REACHED__POS, REG_DI_TACH_SETPOINT_REACHED__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_MODE__POS, REG_DI_MODE__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_RESET__POS, REG_DI_RESET__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_STATUS__POS, REG_DI_STATUS__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ, REG_COPY_MB_TO_APP, 0);
-
-    Res += REG_CopyRegs(REG_DO_NORM_VAL__POS, REG_DO_NORM_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DO_FAST_VAL__POS, REG_DO_FAST_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DO_PWM_VAL__POS, REG_DO_PWM_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DO_PWM_ALLOW__POS, REG_DO_PWM_ALLOW__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DO_PWM_PERIOD__POS, REG_DO_PWM_PERIOD__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DO_MODE__POS, REG_DO_MODE__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_DO_STATUS__POS, REG_DO_STATUS__SZ, REG_COPY_MB_TO_APP, 0);
-
-    Res += REG_CopyRegs(REG_AI_VAL__POS, REG_AI_VAL__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_AI_MODE__POS, REG_AI_MODE__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_AI_STATUS__POS, REG_AI_STATUS__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_AI_KA__POS, REG_AI_KA__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_AI_KB__POS, REG_AI_KB__SZ, REG_COPY_MB_TO_APP, 0);
-
-    Res += REG_CopyRegs(REG_SYS_CMD__POS, REG_SYS_CMD__SZ, REG_COPY_MB_TO_APP, 0);
-
-    Res += REG_CopyRegs(REG_USER_DATA1__POS, REG_USER_DATA1__SZ, REG_COPY_MB_TO_APP, 0);
-    Res += REG_CopyRegs(REG_USER_DATA2__POS, REG_USER_DATA2__SZ, REG_COPY_MB_TO_APP, 0);
+#ifndef RTE_MOD_DI
+    //with DI_T: latched by APP_T (input image)
+    Res += REG_CopyAppRegs(REG_DI_NORM_VAL__POS, REG_DI_NORM_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_VAL__POS, REG_DI_CNTR_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+#endif // RTE_MOD_DI
+    Res += REG_CopyAppRegs(REG_DI_CNTR_SETPOINT__POS, REG_DI_CNTR_SETPOINT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_SETPOINT_REACHED__POS, REG_DI_CNTR_SETPOINT_REACHED__SZ, REG_COPY_MB_TO_APP, TasksIn);
+#ifndef RTE_MOD_DI
+    Res += REG_CopyAppRegs(REG_DI_TACH_VAL__POS, REG_DI_TACH_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+#endif // RTE_MOD_DI
+    Res += REG_CopyAppRegs(REG_DI_TACH_SETPOINT__POS, REG_DI_TACH_SETPOINT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_TACH_SETPOINT_REACHED__POS, REG_DI_TACH_SETPOINT_REACHED__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_MODE__POS, REG_DI_MODE__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_RESET__POS, REG_DI_RESET__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_STATUS__POS, REG_DI_STATUS__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_ALLOW__POS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_DO_VAL__POS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_REACHED__POS, REG_DI_CNTR_CMP_REACHED__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_DO__POS, REG_DI_CNTR_CMP_DO__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_EVT_HEAD__POS, REG_DI_EVT_HEAD__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_EVT_CURSOR__POS, REG_DI_EVT_CURSOR__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_EVT_WIN__POS, REG_DI_EVT_WIN__SZ, REG_COPY_MB_TO_APP, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_DO_NORM_VAL__POS, REG_DO_NORM_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_FAST_VAL__POS, REG_DO_FAST_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_VAL__POS, REG_DO_PWM_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_ALLOW__POS, REG_DO_PWM_ALLOW__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_PERIOD__POS, REG_DO_PWM_PERIOD__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_MODE__POS, REG_DO_MODE__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_STATUS__POS, REG_DO_STATUS__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_PULSES__POS, REG_DO_PTO_PULSES__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_FREQ_START__POS, REG_DO_PTO_FREQ_START__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_FREQ_MAX__POS, REG_DO_PTO_FREQ_MAX__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_ACCEL__POS, REG_DO_PTO_ACCEL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_PROFILE__POS, REG_DO_PTO_PROFILE__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_START__POS, REG_DO_PTO_START__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_DONE__POS, REG_DO_PTO_DONE__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_SAFE_VAL__POS, REG_DO_SAFE_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_SAFE_ALLOW__POS, REG_DO_SAFE_ALLOW__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_FREQ__POS, REG_DO_PWM_FREQ__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_PERIOD_NS__POS, REG_DO_PWM_PERIOD_NS__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_RES__POS, REG_DO_PWM_RES__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_FREQ_ACT__POS, REG_DO_PWM_FREQ_ACT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_RES_ACT__POS, REG_DO_PWM_RES_ACT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_CMP_HELD__POS, REG_DO_CMP_HELD__SZ, REG_COPY_MB_TO_APP, TasksIn);
+
+#ifndef RTE_MOD_AI
+    //with AI_T: latched by APP_T (input image)
+    Res += REG_CopyAppRegs(REG_AI_VAL__POS, REG_AI_VAL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+#endif // RTE_MOD_AI
+    Res += REG_CopyAppRegs(REG_AI_MODE__POS, REG_AI_MODE__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_STATUS__POS, REG_AI_STATUS__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_KA__POS, REG_AI_KA__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_KB__POS, REG_AI_KB__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_FLTR__POS, REG_AI_FLTR__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_FLTR_PRM__POS, REG_AI_FLTR_PRM__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_OVS__POS, REG_AI_OVS__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_RATE_ACT__POS, REG_AI_RATE_ACT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_BITS_ACT__POS, REG_AI_BITS_ACT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_DB__POS, REG_AI_DB__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_DB_PCT__POS, REG_AI_DB_PCT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_PUB_MIN__POS, REG_AI_PUB_MIN__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_PUB_HB__POS, REG_AI_PUB_HB__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_CAP_SET__POS, REG_AI_CAP_SET__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_CAP_CMD__POS, REG_AI_CAP_CMD__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_CAP_STAT__POS, REG_AI_CAP_STAT__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_CAP_WIN__POS, REG_AI_CAP_WIN__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_LIN__POS, REG_AI_LIN__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_LIN_SZ__POS, REG_AI_LIN_SZ__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_LIN_TBL__POS, REG_AI_LIN_TBL__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_THR__POS, REG_AI_THR__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_THR_REACHED__POS, REG_AI_THR_REACHED__SZ, REG_COPY_MB_TO_APP, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_SYS_SET__POS, REG_SYS_SET__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_SYS_RTC_SET__POS, REG_SYS_RTC_SET__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_SYS_CMD__POS, REG_SYS_CMD__SZ, REG_COPY_MB_TO_APP, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_USER_DATA1__POS, REG_USER_DATA1__SZ, REG_COPY_MB_TO_APP, TasksIn);
+    Res += REG_CopyAppRegs(REG_USER_DATA2__POS, REG_USER_DATA2__SZ, REG_COPY_MB_TO_APP, TasksIn);
 
     return (Res);
 }
 
 /** @brief  Copy from Located variables into Data Tables.
- *  @param  None.
+ *  @param  TasksIn - mask of tasks of Application (registers of other tasks are not copied).
  *  @return The number of copied registers.
  */
-uint16_t REG_CopyAppToMb(void)
+uint16_t REG_CopyAppToMb(uint8_t TasksIn)
 {
     uint16_t Res = 0;
 
-    Res += REG_CopyRegs(REG_DI_CNTR_SETPOINT__POS, REG_DI_CNTR_SETPOINT__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DI_TACH_SETPOINT__POS, REG_DI_TACH_SETPOINT__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DI_MODE__POS, REG_DI_MODE__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DI_RESET__POS, REG_DI_RESET__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ, REG_COPY_APP_TO_MB, 0);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_SETPOINT__POS, REG_DI_CNTR_SETPOINT__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_TACH_SETPOINT__POS, REG_DI_TACH_SETPOINT__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_MODE__POS, REG_DI_MODE__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_RESET__POS, REG_DI_RESET__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_FILTER_DELAY__POS, REG_DI_FILTER_DELAY__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_ALLOW__POS, REG_DI_CNTR_CMP_ALLOW__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_DO_VAL__POS, REG_DI_CNTR_CMP_DO_VAL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_CNTR_CMP_DO__POS, REG_DI_CNTR_CMP_DO__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DI_EVT_CURSOR__POS, REG_DI_EVT_CURSOR__SZ, REG_COPY_APP_TO_MB, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_DO_NORM_VAL__POS, REG_DO_NORM_VAL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_FAST_VAL__POS, REG_DO_FAST_VAL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_VAL__POS, REG_DO_PWM_VAL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_ALLOW__POS, REG_DO_PWM_ALLOW__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_PERIOD__POS, REG_DO_PWM_PERIOD__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_MODE__POS, REG_DO_MODE__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_PULSES__POS, REG_DO_PTO_PULSES__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_FREQ_START__POS, REG_DO_PTO_FREQ_START__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_FREQ_MAX__POS, REG_DO_PTO_FREQ_MAX__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_ACCEL__POS, REG_DO_PTO_ACCEL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_PROFILE__POS, REG_DO_PTO_PROFILE__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PTO_START__POS, REG_DO_PTO_START__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_SAFE_VAL__POS, REG_DO_SAFE_VAL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_SAFE_ALLOW__POS, REG_DO_SAFE_ALLOW__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_FREQ__POS, REG_DO_PWM_FREQ__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_PERIOD_NS__POS, REG_DO_PWM_PERIOD_NS__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_DO_PWM_RES__POS, REG_DO_PWM_RES__SZ, REG_COPY_APP_TO_MB, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_AI_MODE__POS, REG_AI_MODE__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_KA__POS, REG_AI_KA__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_KB__POS, REG_AI_KB__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_FLTR__POS, REG_AI_FLTR__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_FLTR_PRM__POS, REG_AI_FLTR_PRM__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_OVS__POS, REG_AI_OVS__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_DB__POS, REG_AI_DB__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_DB_PCT__POS, REG_AI_DB_PCT__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_PUB_MIN__POS, REG_AI_PUB_MIN__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_PUB_HB__POS, REG_AI_PUB_HB__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_CAP_SET__POS, REG_AI_CAP_SET__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_LIN__POS, REG_AI_LIN__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_LIN_SZ__POS, REG_AI_LIN_SZ__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_LIN_TBL__POS, REG_AI_LIN_TBL__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_AI_THR__POS, REG_AI_THR__SZ, REG_COPY_APP_TO_MB, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_SYS_SET__POS, REG_SYS_SET__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_SYS_RTC_SET__POS, REG_SYS_RTC_SET__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_SYS_CMD__POS, REG_SYS_CMD__SZ, REG_COPY_APP_TO_MB, TasksIn);
+
+    Res += REG_CopyAppRegs(REG_USER_DATA1__POS, REG_USER_DATA1__SZ, REG_COPY_APP_TO_MB, TasksIn);
+    Res += REG_CopyAppRegs(REG_USER_DATA2__POS, REG_USER_DATA2__SZ, REG_COPY_APP_TO_MB, TasksIn);
 
-    Res += REG_CopyRegs(REG_DO_NORM_VAL__POS, REG_DO_NORM_VAL__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DO_FAST_VAL__POS, REG_DO_FAST_VAL__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DO_PWM_VAL__POS, REG_DO_PWM_VAL__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DO_PWM_ALLOW__POS, REG_DO_PWM_ALLOW__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DO_PWM_PERIOD__POS, REG_DO_PWM_PERIOD__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_DO_MODE__POS, REG_DO_MODE__SZ, REG_COPY_APP_TO_MB, 0);
+    return (Res);
+}
 
-    Res += REG_CopyRegs(REG_AI_MODE__POS, REG_AI_MODE__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_AI_KA__POS, REG_AI_KA__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_AI_KB__POS, REG_AI_KB__SZ, REG_COPY_APP_TO_MB, 0);
+/** @brief  Collect registers copied by REG_CopyMbToApp(TasksIn) into list.
+ *  @param  TasksIn - mask of tasks of Application.
+ *  @param  ListOut - list.
+ *  @return The number of registers in list.
+ */
+uint16_t REG_ListMbToApp(uint8_t TasksIn, REG_List_t *ListOut)
+{
+    if(!ListOut) return (0);
 
-    Res += REG_CopyRegs(REG_SYS_CMD__POS, REG_SYS_CMD__SZ, REG_COPY_APP_TO_MB, 0);
+    ListOut->Sz  = 0;
+    ListOut->Ovf = BIT_FALSE;
 
-    Res += REG_CopyRegs(REG_USER_DATA1__POS, REG_USER_DATA1__SZ, REG_COPY_APP_TO_MB, 0);
-    Res += REG_CopyRegs(REG_USER_DATA2__POS, REG_USER_DATA2__SZ, REG_COPY_APP_TO_MB, 0);
+    REG_APP_LIST = ListOut;
+    REG_CopyMbToApp(TasksIn);
+    REG_APP_LIST = 0;
+
+    return (ListOut->Sz);
+}
+
+/** @brief  Collect registers copied by REG_CopyAppToMb(TasksIn) into list.
+ *  @param  TasksIn - mask of tasks of Application.
+ *  @param  ListOut - list.
+ *  @return The number of registers in list.
+ */
+uint16_t REG_ListAppToMb(uint8_t TasksIn, REG_List_t *ListOut)
+{
+    if(!ListOut) return (0);
 
+    ListOut->Sz  = 0;
+    ListOut->Ovf = BIT_FALSE;
+
+    REG_APP_LIST = ListOut;
+    REG_CopyAppToMb(TasksIn);
+    REG_APP_LIST = 0;
+
+    return (ListOut->Sz);
+}
+
+/** @brief  Copy registers of list.
+ *  @param  ListIn - list (collected by REG_ListMbToApp, REG_ListAppToMb).
+ *  @param  DstIn - destination (REG_COPY_MB_TO_APP, REG_COPY_APP_TO_MB).
+ *  @param  TasksIn - mask of tasks of Application (registers of other tasks are not copied).
+ *  @return The number of copied registers.
+ */
+uint16_t REG_CopyList(const REG_List_t *ListIn, uint8_t DstIn, uint8_t TasksIn)
+{
+    uint16_t Res = 0, i;
+
+    if(ListIn)
+    {
+        for(i=0; i<ListIn->Sz; i++)
+        {
+            if(ListIn->Reg[i]->AppTasks & TasksIn) Res += REG_CopyReg(ListIn->Reg[i], DstIn, 0);
+        }
+    }
     return (Res);
 }
 #endif // RTE_MOD_APP
@@ -172,6 +392,15 @@ void REG_SetDef(void)
 
         BuffDWo = PLC_DI_FLTR_DELAY_DEF;
         REG_CopyRegByPos(REG_DI_FILTER_DELAY__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffBy = PLC_DI_CNTR_CMP_ALLOW_DEF;
+        REG_CopyRegByPos(REG_DI_CNTR_CMP_ALLOW__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+        BuffBy = PLC_DI_CNTR_CMP_DO_DEF;
+        REG_CopyRegByPos(REG_DI_CNTR_CMP_DO__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+        BuffBy = PLC_DI_CNTR_CMP_DO_VAL_DEF;
+        REG_CopyRegByPos(REG_DI_CNTR_CMP_DO_VAL__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
     }
 
     //DO ======================================================================
@@ -194,6 +423,36 @@ void REG_SetDef(void)
 
         BuffBy = PLC_DO_FAST_VAL_DEF;
         REG_CopyRegByPos(REG_DO_FAST_VAL__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+        BuffDWo = PLC_DO_PTO_PULSES_DEF;
+        REG_CopyRegByPos(REG_DO_PTO_PULSES__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffDWo = PLC_DO_PTO_FREQ_START_DEF;
+        REG_CopyRegByPos(REG_DO_PTO_FREQ_START__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffDWo = PLC_DO_PTO_FREQ_MAX_DEF;
+        REG_CopyRegByPos(REG_DO_PTO_FREQ_MAX__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffDWo = PLC_DO_PTO_ACCEL_DEF;
+        REG_CopyRegByPos(REG_DO_PTO_ACCEL__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffBy = PLC_DO_PTO_PROFILE_DEF;
+        REG_CopyRegByPos(REG_DO_PTO_PROFILE__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+        BuffBy = PLC_DO_SAFE_VAL_DEF;
+        REG_CopyRegByPos(REG_DO_SAFE_VAL__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+        BuffBy = PLC_DO_SAFE_ALLOW_DEF;
+        REG_CopyRegByPos(REG_DO_SAFE_ALLOW__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+        BuffDWo = PLC_DO_PWM_FREQ_DEF;
+        REG_CopyRegByPos(REG_DO_PWM_FREQ__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffDWo = PLC_DO_PWM_T_NS_DEF;
+        REG_CopyRegByPos(REG_DO_PWM_PERIOD_NS__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
+
+        BuffDWo = PLC_DO_PWM_RES_DEF;
+        REG_CopyRegByPos(REG_DO_PWM_RES__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffDWo);
     }
 
     //AI ======================================================================
@@ -207,8 +466,59 @@ void REG_SetDef(void)
 
 		BuffFlo = PLC_AI_KB_DEF;
 		REG_CopyRegByPos(REG_AI_KB__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+
+		BuffBy = PLC_AI_FLTR_DEF;
+		REG_CopyRegByPos(REG_AI_FLTR__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+		BuffWo = PLC_AI_FLTR_PRM_DEF;
+		REG_CopyRegByPos(REG_AI_FLTR_PRM__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+		BuffBy = PLC_AI_OVS_DEF;
+		REG_CopyRegByPos(REG_AI_OVS__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+		BuffFlo = PLC_AI_DB_DEF;
+		REG_CopyRegByPos(REG_AI_DB__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+
+		BuffFlo = PLC_AI_DB_PCT_DEF;
+		REG_CopyRegByPos(REG_AI_DB_PCT__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+
+		BuffWo = PLC_AI_PUB_MIN_DEF;
+		REG_CopyRegByPos(REG_AI_PUB_MIN__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+		BuffWo = PLC_AI_PUB_HB_DEF;
+		REG_CopyRegByPos(REG_AI_PUB_HB__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+		BuffBy = PLC_AI_LIN_DEF;
+		REG_CopyRegByPos(REG_AI_LIN__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+		BuffBy = PLC_AI_LIN_SZ_DEF;
+		REG_CopyRegByPos(REG_AI_LIN_SZ__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffBy);
+
+		BuffFlo = PLC_AI_THR_DEF;
+		REG_CopyRegByPos(REG_AI_THR__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
+	}
+
+	BuffFlo = PLC_AI_LIN_TBL_DEF;
+	for(uint16_t i=0; i<REG_AI_LIN_TBL_SZ; i++)
+	{
+		REG_CopyRegByPos(REG_AI_LIN_TBL__POS+i, REG_COPY_VAR_TO_MB__NO_MON, &BuffFlo);
 	}
 
+	BuffWo = PLC_AI_CAP_CH_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_CH, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	BuffWo = PLC_AI_CAP_EDGE_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_EDGE, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	BuffWo = PLC_AI_CAP_LEVEL_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_LEVEL, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	BuffWo = PLC_AI_CAP_PRE_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_PRE, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+	BuffWo = PLC_AI_CAP_POST_DEF;
+	REG_CopyRegByPos(REG_AI_CAP_SET__POS_POST, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
     //SYS_STAT =================================================================
     BuffWo = PLC_HW_CODE;
     REG_CopyRegByPos(REG_SYS_STAT__POS_HW_CODE, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
@@ -224,12 +534,35 @@ void REG_SetDef(void)
 
     BuffWo = PLC_RTE_DDMM;
     REG_CopyRegByPos(REG_SYS_STAT__POS_RTE_DDMM, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+    BuffWo = 0;
+    REG_CopyRegByPos(REG_SYS_STAT__POS_DO_LAT, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    REG_CopyRegByPos(REG_SYS_STAT__POS_DO_LAT_MAX, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    REG_CopyRegByPos(REG_SYS_STAT__POS_APP_OVR, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    REG_CopyRegByPos(REG_SYS_STAT__POS_APP_JIT, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    REG_CopyRegByPos(REG_SYS_STAT__POS_APP_JIT_MAX, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    for(uint16_t i=REG_SYS_STAT__POS_PROF_LOCK_MIN; i<=REG_SYS_STAT__POS_RTC_SEC; i++)
+    {
+    	REG_CopyRegByPos(i, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    }
+
+    //SYS_SET ==================================================================
+    BuffWo = 0;
+    REG_CopyRegByPos(REG_SYS_SET__POS_SFTY_TIM_TM, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    REG_CopyRegByPos(REG_SYS_SET__POS_WD_TIM_TM, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+
+    //SYS_RTC_SET ==============================================================
+    BuffWo = 0;
+    for(uint16_t i=REG_SYS_RTC_SET__POS_YEAR; i<=REG_SYS_RTC_SET__POS_SEC; i++)
+    {
+    	REG_CopyRegByPos(i, REG_COPY_VAR_TO_MB__NO_MON, &BuffWo);
+    }
 }
 
 
 /** @brief  Set register SYS_STAT1.
  *  @param  FieldIn - field number:
- *  @arg    = PLC_SYS_STAT1_APP_INITED ... PLC_SYS_STAT1_LED_USER
+ *  @arg    = PLC_SYS_STAT1_APP_INITED ... PLC_SYS_STAT1_RETAIN_OVF
  *  @param  ValueIn - field value:
  *  @arg    = BIT_FALSE
  *  @arg    = BIT_TRUE
@@ -287,6 +620,34 @@ void REG_SYS_STAT1_Set(uint8_t FieldIn, uint8_t ValueIn)
 			PLC_SYS_STAT1.Pack.LedUser = Value;
 #ifdef DEBUG_LOG_SYS_REG
 			DebugLog("PLC_SYS_STAT1.Pack.LedUser=%d\n", PLC_SYS_STAT1.Pack.LedUser);
+#endif // DEBUG_LOG_SYS_REG
+			break;
+
+		case PLC_SYS_STAT1_WD_TIM_CPLT:
+			PLC_SYS_STAT1.Pack.WdTimCplt = Value;
+#ifdef DEBUG_LOG_SYS_REG
+			DebugLog("PLC_SYS_STAT1.Pack.WdTimCplt=%d\n", PLC_SYS_STAT1.Pack.WdTimCplt);
+#endif // DEBUG_LOG_SYS_REG
+			break;
+
+		case PLC_SYS_STAT1_APP_CRC_ERR:
+			PLC_SYS_STAT1.Pack.AppCrcErr = Value;
+#ifdef DEBUG_LOG_SYS_REG
+			DebugLog("PLC_SYS_STAT1.Pack.AppCrcErr=%d\n", PLC_SYS_STAT1.Pack.AppCrcErr);
+#endif // DEBUG_LOG_SYS_REG
+			break;
+
+		case PLC_SYS_STAT1_RETAIN_WAIT:
+			PLC_SYS_STAT1.Pack.RetainWait = Value;
+#ifdef DEBUG_LOG_SYS_REG
+			DebugLog("PLC_SYS_STAT1.Pack.RetainWait=%d\n", PLC_SYS_STAT1.Pack.RetainWait);
+#endif // DEBUG_LOG_SYS_REG
+			break;
+
+		case PLC_SYS_STAT1_RETAIN_OVF:
+			PLC_SYS_STAT1.Pack.RetainOvf = Value;
+#ifdef DEBUG_LOG_SYS_REG
+			DebugLog("PLC_SYS_STAT1.Pack.RetainOvf=%d\n", PLC_SYS_STAT1.Pack.RetainOvf);
 #endif // DEBUG_LOG_SYS_REG
 			break;
 	}
@@ -80,6 +80,16 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_RESET__MBPOS, REG_DI_RESET__TYPE_WSZ);
                 Pos    = REG_DI_RESET__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DI_CNTR_CMP_ALLOW__MBPOS, MbAddrIn, REG_DI_CNTR_CMP_ALLOW__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_CNTR_CMP_ALLOW__MBPOS, REG_DI_CNTR_CMP_ALLOW__TYPE_WSZ);
+                Pos    = REG_DI_CNTR_CMP_ALLOW__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DI_CNTR_CMP_DO_VAL__MBPOS, MbAddrIn, REG_DI_CNTR_CMP_DO_VAL__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_CNTR_CMP_DO_VAL__MBPOS, REG_DI_CNTR_CMP_DO_VAL__TYPE_WSZ);
+                Pos    = REG_DI_CNTR_CMP_DO_VAL__POS;
+            }
             else if(VAL_IN_LIMITS(REG_DO_NORM_VAL__MBPOS, MbAddrIn, REG_DO_NORM_VAL__MBPOS_END))
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_NORM_VAL__MBPOS, REG_DO_NORM_VAL__TYPE_WSZ);
@@ -95,6 +105,21 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_ALLOW__MBPOS, REG_DO_PWM_ALLOW__TYPE_WSZ);
                 Pos    = REG_DO_PWM_ALLOW__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_START__MBPOS, MbAddrIn, REG_DO_PTO_START__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_START__MBPOS, REG_DO_PTO_START__TYPE_WSZ);
+                Pos    = REG_DO_PTO_START__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_SAFE_VAL__MBPOS, MbAddrIn, REG_DO_SAFE_VAL__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_SAFE_VAL__MBPOS, REG_DO_SAFE_VAL__TYPE_WSZ);
+                Pos    = REG_DO_SAFE_VAL__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_SAFE_ALLOW__MBPOS, MbAddrIn, REG_DO_SAFE_ALLOW__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_SAFE_ALLOW__MBPOS, REG_DO_SAFE_ALLOW__TYPE_WSZ);
+                Pos    = REG_DO_SAFE_ALLOW__POS;
+            }
             else if(VAL_IN_LIMITS(REG_SYS_CMD__MBPOS, MbAddrIn, REG_SYS_CMD__MBPOS_END))
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_SYS_CMD__MBPOS, REG_SYS_CMD__TYPE_WSZ);
@@ -128,6 +153,26 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_CNTR_SETPOINT_REACHED__MBPOS, REG_DI_CNTR_SETPOINT_REACHED__TYPE_WSZ);
                 Pos    = REG_DI_CNTR_SETPOINT_REACHED__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DI_CNTR_CMP_REACHED__MBPOS, MbAddrIn, REG_DI_CNTR_CMP_REACHED__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_CNTR_CMP_REACHED__MBPOS, REG_DI_CNTR_CMP_REACHED__TYPE_WSZ);
+                Pos    = REG_DI_CNTR_CMP_REACHED__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_DONE__MBPOS, MbAddrIn, REG_DO_PTO_DONE__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_DONE__MBPOS, REG_DO_PTO_DONE__TYPE_WSZ);
+                Pos    = REG_DO_PTO_DONE__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_CMP_HELD__MBPOS, MbAddrIn, REG_DO_CMP_HELD__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_CMP_HELD__MBPOS, REG_DO_CMP_HELD__TYPE_WSZ);
+                Pos    = REG_DO_CMP_HELD__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_THR_REACHED__MBPOS, MbAddrIn, REG_AI_THR_REACHED__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_THR_REACHED__MBPOS, REG_AI_THR_REACHED__TYPE_WSZ);
+                Pos    = REG_AI_THR_REACHED__POS;
+            }
             else
             {
                 return (0);
@@ -156,6 +201,16 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_FILTER_DELAY__MBPOS, REG_DI_FILTER_DELAY__TYPE_WSZ);
                 Pos    = REG_DI_FILTER_DELAY__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DI_CNTR_CMP_DO__MBPOS, MbAddrIn, REG_DI_CNTR_CMP_DO__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_CNTR_CMP_DO__MBPOS, REG_DI_CNTR_CMP_DO__TYPE_WSZ);
+                Pos    = REG_DI_CNTR_CMP_DO__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DI_EVT_CURSOR__MBPOS, MbAddrIn, REG_DI_EVT_CURSOR__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_EVT_CURSOR__MBPOS, REG_DI_EVT_CURSOR__TYPE_WSZ);
+                Pos    = REG_DI_EVT_CURSOR__POS;
+            }
             else if(VAL_IN_LIMITS(REG_DO_PWM_VAL__MBPOS, MbAddrIn, REG_DO_PWM_VAL__MBPOS_END))
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_VAL__MBPOS, REG_DO_PWM_VAL__TYPE_WSZ);
@@ -171,6 +226,46 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_MODE__MBPOS, REG_DO_MODE__TYPE_WSZ);
                 Pos    = REG_DO_MODE__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_PULSES__MBPOS, MbAddrIn, REG_DO_PTO_PULSES__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_PULSES__MBPOS, REG_DO_PTO_PULSES__TYPE_WSZ);
+                Pos    = REG_DO_PTO_PULSES__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_FREQ_START__MBPOS, MbAddrIn, REG_DO_PTO_FREQ_START__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_FREQ_START__MBPOS, REG_DO_PTO_FREQ_START__TYPE_WSZ);
+                Pos    = REG_DO_PTO_FREQ_START__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_FREQ_MAX__MBPOS, MbAddrIn, REG_DO_PTO_FREQ_MAX__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_FREQ_MAX__MBPOS, REG_DO_PTO_FREQ_MAX__TYPE_WSZ);
+                Pos    = REG_DO_PTO_FREQ_MAX__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_ACCEL__MBPOS, MbAddrIn, REG_DO_PTO_ACCEL__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_ACCEL__MBPOS, REG_DO_PTO_ACCEL__TYPE_WSZ);
+                Pos    = REG_DO_PTO_ACCEL__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PTO_PROFILE__MBPOS, MbAddrIn, REG_DO_PTO_PROFILE__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PTO_PROFILE__MBPOS, REG_DO_PTO_PROFILE__TYPE_WSZ);
+                Pos    = REG_DO_PTO_PROFILE__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PWM_FREQ__MBPOS, MbAddrIn, REG_DO_PWM_FREQ__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_FREQ__MBPOS, REG_DO_PWM_FREQ__TYPE_WSZ);
+                Pos    = REG_DO_PWM_FREQ__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PWM_PERIOD_NS__MBPOS, MbAddrIn, REG_DO_PWM_PERIOD_NS__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_PERIOD_NS__MBPOS, REG_DO_PWM_PERIOD_NS__TYPE_WSZ);
+                Pos    = REG_DO_PWM_PERIOD_NS__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PWM_RES__MBPOS, MbAddrIn, REG_DO_PWM_RES__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_RES__MBPOS, REG_DO_PWM_RES__TYPE_WSZ);
+                Pos    = REG_DO_PWM_RES__POS;
+            }
             else if(VAL_IN_LIMITS(REG_AI_MODE__MBPOS, MbAddrIn, REG_AI_MODE__MBPOS_END))
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_MODE__MBPOS, REG_AI_MODE__TYPE_WSZ);
@@ -185,6 +280,81 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_KB__MBPOS, REG_AI_KB__TYPE_WSZ);
                 Pos    = REG_AI_KB__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_FLTR__MBPOS, MbAddrIn, REG_AI_FLTR__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_FLTR__MBPOS, REG_AI_FLTR__TYPE_WSZ);
+                Pos    = REG_AI_FLTR__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_FLTR_PRM__MBPOS, MbAddrIn, REG_AI_FLTR_PRM__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_FLTR_PRM__MBPOS, REG_AI_FLTR_PRM__TYPE_WSZ);
+                Pos    = REG_AI_FLTR_PRM__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_OVS__MBPOS, MbAddrIn, REG_AI_OVS__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_OVS__MBPOS, REG_AI_OVS__TYPE_WSZ);
+                Pos    = REG_AI_OVS__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_DB__MBPOS, MbAddrIn, REG_AI_DB__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_DB__MBPOS, REG_AI_DB__TYPE_WSZ);
+                Pos    = REG_AI_DB__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_DB_PCT__MBPOS, MbAddrIn, REG_AI_DB_PCT__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_DB_PCT__MBPOS, REG_AI_DB_PCT__TYPE_WSZ);
+                Pos    = REG_AI_DB_PCT__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_PUB_MIN__MBPOS, MbAddrIn, REG_AI_PUB_MIN__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_PUB_MIN__MBPOS, REG_AI_PUB_MIN__TYPE_WSZ);
+                Pos    = REG_AI_PUB_MIN__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_PUB_HB__MBPOS, MbAddrIn, REG_AI_PUB_HB__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_PUB_HB__MBPOS, REG_AI_PUB_HB__TYPE_WSZ);
+                Pos    = REG_AI_PUB_HB__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_CAP_SET__MBPOS, MbAddrIn, REG_AI_CAP_SET__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_CAP_SET__MBPOS, REG_AI_CAP_SET__TYPE_WSZ);
+                Pos    = REG_AI_CAP_SET__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_CAP_CMD__MBPOS, MbAddrIn, REG_AI_CAP_CMD__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_CAP_CMD__MBPOS, REG_AI_CAP_CMD__TYPE_WSZ);
+                Pos    = REG_AI_CAP_CMD__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_LIN__MBPOS, MbAddrIn, REG_AI_LIN__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_LIN__MBPOS, REG_AI_LIN__TYPE_WSZ);
+                Pos    = REG_AI_LIN__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_LIN_SZ__MBPOS, MbAddrIn, REG_AI_LIN_SZ__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_LIN_SZ__MBPOS, REG_AI_LIN_SZ__TYPE_WSZ);
+                Pos    = REG_AI_LIN_SZ__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_LIN_TBL__MBPOS, MbAddrIn, REG_AI_LIN_TBL__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_LIN_TBL__MBPOS, REG_AI_LIN_TBL__TYPE_WSZ);
+                Pos    = REG_AI_LIN_TBL__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_AI_THR__MBPOS, MbAddrIn, REG_AI_THR__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_THR__MBPOS, REG_AI_THR__TYPE_WSZ);
+                Pos    = REG_AI_THR__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_SYS_SET__MBPOS, MbAddrIn, REG_SYS_SET__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_SYS_SET__MBPOS, REG_SYS_SET__TYPE_WSZ);
+                Pos    = REG_SYS_SET__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_SYS_RTC_SET__MBPOS, MbAddrIn, REG_SYS_RTC_SET__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_SYS_RTC_SET__MBPOS, REG_SYS_RTC_SET__TYPE_WSZ);
+                Pos    = REG_SYS_RTC_SET__POS;
             }
         	else if(VAL_IN_LIMITS(REG_USER_DATA2__MBPOS, MbAddrIn, REG_USER_DATA2__MBPOS_END))
             {
@@ -214,11 +384,31 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_STATUS__MBPOS, REG_DI_STATUS__TYPE_WSZ);
                 Pos    = REG_DI_STATUS__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DI_EVT_HEAD__MBPOS, MbAddrIn, REG_DI_EVT_HEAD__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_EVT_HEAD__MBPOS, REG_DI_EVT_HEAD__TYPE_WSZ);
+                Pos    = REG_DI_EVT_HEAD__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DI_EVT_WIN__MBPOS, MbAddrIn, REG_DI_EVT_WIN__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DI_EVT_WIN__MBPOS, REG_DI_EVT_WIN__TYPE_WSZ);
+                Pos    = REG_DI_EVT_WIN__POS;
+            }
             else if(VAL_IN_LIMITS(REG_DO_STATUS__MBPOS, MbAddrIn, REG_DO_STATUS__MBPOS_END))
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_STATUS__MBPOS, REG_DO_STATUS__TYPE_WSZ);
                 Pos    = REG_DO_STATUS__POS;
             }
+            else if(VAL_IN_LIMITS(REG_DO_PWM_FREQ_ACT__MBPOS, MbAddrIn, REG_DO_PWM_FREQ_ACT__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_FREQ_ACT__MBPOS, REG_DO_PWM_FREQ_ACT__TYPE_WSZ);
+                Pos    = REG_DO_PWM_FREQ_ACT__POS;
+            }
+            else if(VAL_IN_LIMITS(REG_DO_PWM_RES_ACT__MBPOS, MbAddrIn, REG_DO_PWM_RES_ACT__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_DO_PWM_RES_ACT__MBPOS, REG_DO_PWM_RES_ACT__TYPE_WSZ);
+                Pos    = REG_DO_PWM_RES_ACT__POS;
+            }
             else if(VAL_IN_LIMITS(REG_AI_VAL__MBPOS, MbAddrIn, REG_AI_VAL__MBPOS_END))
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_VAL__MBPOS, REG_AI_VAL__TYPE_WSZ);
@@ -228,6 +418,26 @@ REG_t *REG_GetByMbAddr(uint8_t MbTableIn, uint16_t MbAddrIn)
             {
                 iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_STATUS__MBPOS, REG_AI_STATUS__TYPE_WSZ);
                 Pos    = REG_AI_STATUS__POS;
+            }
+        	else if(VAL_IN_LIMITS(REG_AI_RATE_ACT__MBPOS, MbAddrIn, REG_AI_RATE_ACT__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_RATE_ACT__MBPOS, REG_AI_RATE_ACT__TYPE_WSZ);
+                Pos    = REG_AI_RATE_ACT__POS;
+            }
+        	else if(VAL_IN_LIMITS(REG_AI_BITS_ACT__MBPOS, MbAddrIn, REG_AI_BITS_ACT__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_BITS_ACT__MBPOS, REG_AI_BITS_ACT__TYPE_WSZ);
+                Pos    = REG_AI_BITS_ACT__POS;
+            }
+        	else if(VAL_IN_LIMITS(REG_AI_CAP_STAT__MBPOS, MbAddrIn, REG_AI_CAP_STAT__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_CAP_STAT__MBPOS, REG_AI_CAP_STAT__TYPE_WSZ);
+                Pos    = REG_AI_CAP_STAT__POS;
+            }
+        	else if(VAL_IN_LIMITS(REG_AI_CAP_WIN__MBPOS, MbAddrIn, REG_AI_CAP_WIN__MBPOS_END))
+            {
+                iGroup = REG_CALC_POS_BY_MBADDR(MbAddrIn, REG_AI_CAP_WIN__MBPOS, REG_AI_CAP_WIN__TYPE_WSZ);
+                Pos    = REG_AI_CAP_WIN__POS;
             }
         	else if(VAL_IN_LIMITS(REG_SYS_STAT__MBPOS, MbAddrIn, REG_SYS_STAT__MBPOS_END))
             {
@@ -2243,6 +2453,7 @@ uint16_t REG_InitRegs(uint16_t GIDIn, uint8_t ZoneIn, uint8_t TypeSzIn, uint16_t
 
 #ifdef RTE_MOD_APP
             (Reg+i)->pAppVar   = PlcApp_TestLocVar(ZoneIn, TypeSzIn, GroupIn, A00, A01, A02);
+            (Reg+i)->AppTasks  = PlcApp_GetLocTasks((Reg+i)->pAppVar);
 #endif // RTE_MOD_APP
 
             (Reg+i)->MbTable   = MbTableIn;
@@ -0,0 +1,393 @@
+/* @page retain.c
+ *       Retain-data journal (double-sector, flash-like storage)
+ *       Platform-Independent Code
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "retain.h"
+
+
+/** @def Erased word
+ */
+#define PLC_RETAIN_ERASED                        (uint32_t)0xFFFFFFFF
+
+/** @def Offsets of words
+ */
+//header
+#define PLC_RETAIN_HDR_MAGIC_POS                 0
+#define PLC_RETAIN_HDR_GEN_POS                   1
+#define PLC_RETAIN_HDR_ID_POS                    2
+#define PLC_RETAIN_HDR_CRC_POS                   3
+//record
+#define PLC_RETAIN_REC_TAG_POS                   0
+#define PLC_RETAIN_REC_SEQ_POS                   1
+#define PLC_RETAIN_REC_DATA_POS                  2
+#define PLC_RETAIN_REC_CRC_POS                   (PLC_RETAIN_REC_WSZ-1)
+
+
+/** @typedef Journal
+ */
+typedef struct PlcRetain_t_
+{
+	//@var Storage
+	const PlcRetain_Port_t *Port;
+
+	//@var Active sector (PLC_RETAIN_SECT_NONE - nothing is stored)
+	uint8_t Sect;
+
+	//@var Generation of active sector
+	uint32_t Gen;
+
+	//@var Id of application in active sector
+	uint32_t Id;
+
+	//@var Number of the last commit
+	uint32_t Seq;
+
+	//@var The next free record of active sector
+	uint32_t Pos;
+
+	//@var The other sector is erased (compaction is possible)
+	uint8_t Spare;
+
+} PlcRetain_t;
+
+/** @var Journal
+ */
+static PlcRetain_t PlcRetain = { 0, PLC_RETAIN_SECT_NONE, 0, 0, 0, 0, BIT_FALSE };
+
+/** @var CRC-32 (reflected 0x04C11DB7), table of nibbles
+ */
+static const uint32_t PlcRetain_CrcTbl[16] =
+{
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+
+/** @brief  Calculate CRC-32.
+ *  @param  DataIn - pointer to data.
+ *  @param  SzIn - size of data (bytes).
+ *  @return CRC-32.
+ */
+static uint32_t PlcRetain_Crc(const void *DataIn, uint32_t SzIn)
+{
+	const uint8_t *Data = (const uint8_t *)DataIn;
+	uint32_t Crc = 0xFFFFFFFF;
+
+	while(SzIn--)
+	{
+		Crc ^= *Data++;
+		Crc  = (Crc >> 4) ^ PlcRetain_CrcTbl[Crc & 0x0F];
+		Crc  = (Crc >> 4) ^ PlcRetain_CrcTbl[Crc & 0x0F];
+	}
+	return (~Crc);
+}
+
+/** @brief  Get pointer to record.
+ *  @param  SectIn - number of sector.
+ *  @param  PosIn - number of record.
+ *  @return Pointer to the first word of record.
+ */
+static const uint32_t *PlcRetain_Rec(uint8_t SectIn, uint32_t PosIn)
+{
+	return (PlcRetain.Port->Sect[SectIn] + PLC_RETAIN_HDR_WSZ + PosIn*PLC_RETAIN_REC_WSZ);
+}
+
+/** @brief  Check header of sector.
+ *  @param  SectIn - number of sector.
+ *  @return Result:
+ *  @arg    = 0 - invalid (not written)
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcRetain_IsHdr(uint8_t SectIn)
+{
+	const uint32_t *Hdr = PlcRetain.Port->Sect[SectIn];
+
+	if(Hdr[PLC_RETAIN_HDR_MAGIC_POS] != PLC_RETAIN_HDR_MAGIC) return (BIT_FALSE);
+	return ((Hdr[PLC_RETAIN_HDR_CRC_POS] == PlcRetain_Crc(Hdr, PLC_RETAIN_HDR_CRC_POS*4)) ? BIT_TRUE : BIT_FALSE);
+}
+
+/** @brief  Check erased sector.
+ *  @param  SectIn - number of sector.
+ *  @return Result:
+ *  @arg    = 0 - sector is written
+ *  @arg    = 1 - sector is erased
+ */
+static uint8_t PlcRetain_IsBlank(uint8_t SectIn)
+{
+	const uint32_t *Sect = PlcRetain.Port->Sect[SectIn];
+	uint32_t i;
+
+	for(i=0; i<PLC_RETAIN_SECT_SZ/4; i++)
+	{
+		if(Sect[i] != PLC_RETAIN_ERASED) return (BIT_FALSE);
+	}
+	return (BIT_TRUE);
+}
+
+/** @brief  Get number of sector for compaction.
+ *  @param  None.
+ *  @return Number of sector.
+ */
+static uint8_t PlcRetain_Other(void)
+{
+	return ((PlcRetain.Sect == PLC_RETAIN_SECT_NONE) ? 0 : (uint8_t)(PlcRetain.Sect^1));
+}
+
+/** @brief  Erase sector if it is written.
+ *  @param  SectIn - number of sector.
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcRetain_EraseSect(uint8_t SectIn)
+{
+	if(PlcRetain_IsBlank(SectIn)) return (BIT_TRUE);
+	return (PlcRetain.Port->Erase(SectIn));
+}
+
+/** @brief  Write record.
+ *  @param  SectIn - number of sector.
+ *  @param  PosIn - number of record.
+ *  @param  TagIn - tag.
+ *  @param  DataIn - pointer to block (PLC_RETAIN_BLK_SZ bytes) or NULL (END-record).
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcRetain_WriteRec(uint8_t SectIn, uint32_t PosIn, uint32_t TagIn, const uint8_t *DataIn)
+{
+	uint32_t Rec[PLC_RETAIN_REC_WSZ];
+
+	Rec[PLC_RETAIN_REC_TAG_POS] = TagIn;
+	Rec[PLC_RETAIN_REC_SEQ_POS] = PlcRetain.Seq;
+
+	if(DataIn) memcpy(&Rec[PLC_RETAIN_REC_DATA_POS], DataIn, PLC_RETAIN_BLK_SZ);
+	else       memset(&Rec[PLC_RETAIN_REC_DATA_POS], 0, PLC_RETAIN_BLK_SZ);
+
+	Rec[PLC_RETAIN_REC_CRC_POS] = PlcRetain_Crc(Rec, PLC_RETAIN_REC_CRC_POS*4);
+
+	return (PlcRetain.Port->Write(PlcRetain_Rec(SectIn, PosIn), Rec, PLC_RETAIN_REC_WSZ));
+}
+
+/** @brief  Write the whole image into the other sector.
+ *  @param  ImgIn - pointer to image.
+ *  @param  IdIn - id of application.
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK (the other sector is active)
+ *  @arg    = PLC_RETAIN_WAIT - the other sector is not erased
+ *  @note   Sector is never erased here (see PlcRetain_Prepare).
+ */
+static uint8_t PlcRetain_Compact(const uint8_t *ImgIn, uint32_t IdIn)
+{
+	uint8_t  Sect = PlcRetain_Other();
+	uint32_t Hdr[PLC_RETAIN_HDR_WSZ];
+	uint32_t i;
+
+	if(!PlcRetain.Spare) return (PLC_RETAIN_WAIT);
+
+	//a failed compaction leaves the other sector written
+	PlcRetain.Spare = BIT_FALSE;
+
+	PlcRetain.Seq++;
+	for(i=0; i<PLC_RETAIN_BLK_NUM; i++)
+	{
+		if(!PlcRetain_WriteRec(Sect, i, (PLC_RETAIN_TAG | i), &ImgIn[i*PLC_RETAIN_BLK_SZ])) return (BIT_FALSE);
+	}
+	if(!PlcRetain_WriteRec(Sect, i, PLC_RETAIN_TAG_END, 0)) return (BIT_FALSE);
+
+	//header is written the last
+	Hdr[PLC_RETAIN_HDR_MAGIC_POS] = PLC_RETAIN_HDR_MAGIC;
+	Hdr[PLC_RETAIN_HDR_GEN_POS]   = PlcRetain.Gen+1;
+	Hdr[PLC_RETAIN_HDR_ID_POS]    = IdIn;
+	Hdr[PLC_RETAIN_HDR_CRC_POS]   = PlcRetain_Crc(Hdr, PLC_RETAIN_HDR_CRC_POS*4);
+
+	if(!PlcRetain.Port->Write(PlcRetain.Port->Sect[Sect], Hdr, PLC_RETAIN_HDR_WSZ)) return (BIT_FALSE);
+
+	PlcRetain.Sect = Sect;
+	PlcRetain.Gen++;
+	PlcRetain.Id   = IdIn;
+	PlcRetain.Pos  = PLC_RETAIN_BLK_NUM+1;
+
+	//the old sector is erased by PlcRetain_Prepare
+	PlcRetain.Spare = PlcRetain_IsBlank(PlcRetain_Other());
+
+	return (BIT_TRUE);
+}
+
+/** @brief  Restore image from active sector.
+ *  @param  ImgOut - pointer to image.
+ *  @param  TmpIn - pointer to buffer for records of an unfinished commit.
+ *  @return Result:
+ *  @arg    = 0 - no complete commit
+ *  @arg    = 1 - image is restored
+ */
+static uint8_t PlcRetain_Replay(uint8_t *ImgOut, uint8_t *TmpIn)
+{
+	const uint32_t *Rec;
+	uint32_t i, Blk, Seq = 0;
+	uint8_t  Res = BIT_FALSE, Open = BIT_FALSE;
+
+	for(i=0; i<PLC_RETAIN_REC_NUM; i++)
+	{
+		Rec = PlcRetain_Rec(PlcRetain.Sect, i);
+
+		//the first erased record is the end of journal
+		if(Rec[PLC_RETAIN_REC_TAG_POS] == PLC_RETAIN_ERASED) break;
+		PlcRetain.Pos = i+1;
+
+		//torn record (power loss)
+		if(Rec[PLC_RETAIN_REC_CRC_POS] != PlcRetain_Crc(Rec, PLC_RETAIN_REC_CRC_POS*4)) continue;
+		if((Rec[PLC_RETAIN_REC_TAG_POS] & 0xFFFF0000) != PLC_RETAIN_TAG) continue;
+
+		//the next commit (records of an unfinished one are dropped)
+		if(!Open || Rec[PLC_RETAIN_REC_SEQ_POS] != Seq)
+		{
+			memcpy(TmpIn, ImgOut, PLC_RETAIN_SZ);
+			Seq  = Rec[PLC_RETAIN_REC_SEQ_POS];
+			Open = BIT_TRUE;
+		}
+		if((int32_t)(Seq - PlcRetain.Seq) > 0) PlcRetain.Seq = Seq;
+
+		if(Rec[PLC_RETAIN_REC_TAG_POS] == PLC_RETAIN_TAG_END)
+		{
+			memcpy(ImgOut, TmpIn, PLC_RETAIN_SZ);
+			Open = BIT_FALSE;
+			Res  = BIT_TRUE;
+		}
+		else
+		{
+			Blk = (Rec[PLC_RETAIN_REC_TAG_POS] & 0xFFFF);
+			if(Blk < PLC_RETAIN_BLK_NUM) memcpy(&TmpIn[Blk*PLC_RETAIN_BLK_SZ], &Rec[PLC_RETAIN_REC_DATA_POS], PLC_RETAIN_BLK_SZ);
+		}
+	}
+
+	return (Res);
+}
+
+
+/** @brief  Get id of application.
+ *  @param  StrIn - id (string, e.g. md5 of application).
+ *  @return Id (CRC-32 of string).
+ */
+uint32_t PlcRetain_GetId(const char *StrIn)
+{
+	return ((StrIn) ? PlcRetain_Crc(StrIn, (uint32_t)strlen(StrIn)) : 0);
+}
+
+/** @brief  Init. journal and restore image.
+ *  @param  PortIn - pointer to storage.
+ *  @param  ImgOut - pointer to image (PLC_RETAIN_SZ bytes).
+ *  @param  TmpIn - pointer to buffer (PLC_RETAIN_SZ bytes) for records of an unfinished commit.
+ *  @param  IdOut - pointer to id of application stored in journal.
+ *  @return Result:
+ *  @arg    = 0 - nothing is stored (image is zeroed)
+ *  @arg    = 1 - image is restored
+ *  @note   Called before start of scheduler (an invalid or obsolete sector is erased).
+ */
+uint8_t PlcRetain_Init(const PlcRetain_Port_t *PortIn, uint8_t *ImgOut, uint8_t *TmpIn, uint32_t *IdOut)
+{
+	uint8_t  Valid[PLC_RETAIN_SECT_NUM];
+	uint8_t  i, Res = BIT_FALSE;
+	uint32_t Gen;
+
+	PlcRetain.Port = PortIn;
+	PlcRetain.Sect = PLC_RETAIN_SECT_NONE;
+	PlcRetain.Gen  = 0;
+	PlcRetain.Id   = 0;
+	PlcRetain.Seq  = 0;
+	PlcRetain.Pos  = 0;
+	PlcRetain.Spare = BIT_FALSE;
+
+	memset(ImgOut, 0, PLC_RETAIN_SZ);
+	if(!PortIn || !TmpIn) return (BIT_FALSE);
+
+	//active sector: valid header, the greater generation
+	for(i=0; i<PLC_RETAIN_SECT_NUM; i++)
+	{
+		Valid[i] = PlcRetain_IsHdr(i);
+		if(!Valid[i]) continue;
+
+		Gen = PortIn->Sect[i][PLC_RETAIN_HDR_GEN_POS];
+		if(PlcRetain.Sect == PLC_RETAIN_SECT_NONE || (int32_t)(Gen - PlcRetain.Gen) > 0)
+		{
+			PlcRetain.Sect = i;
+			PlcRetain.Gen  = Gen;
+		}
+	}
+
+	if(PlcRetain.Sect != PLC_RETAIN_SECT_NONE)
+	{
+		PlcRetain.Id = PortIn->Sect[PlcRetain.Sect][PLC_RETAIN_HDR_ID_POS];
+		Res = PlcRetain_Replay(ImgOut, TmpIn);
+	}
+
+	//other sectors are free for compaction
+	for(i=0; i<PLC_RETAIN_SECT_NUM; i++)
+	{
+		if(i != PlcRetain.Sect) PlcRetain_EraseSect(i);
+	}
+	PlcRetain.Spare = PlcRetain_IsBlank(PlcRetain_Other());
+
+	if(IdOut) *IdOut = PlcRetain.Id;
+
+	return (Res);
+}
+
+/** @brief  Commit blocks of image.
+ *  @param  ImgIn - pointer to image (PLC_RETAIN_SZ bytes, not changed during the call).
+ *  @param  MaskIn - changed blocks (bit i - block i).
+ *  @param  IdIn - id of application.
+ *  @return Result:
+ *  @arg    = 0 - error of storage (blocks must be committed again)
+ *  @arg    = 1 - OK
+ *  @arg    = PLC_RETAIN_WAIT - journal is full (blocks must be committed again after PlcRetain_Prepare)
+ *  @note   Storage is not available until PlcRetain_Init.
+ *          Sector is never erased by commit.
+ */
+uint8_t PlcRetain_Write(const uint8_t *ImgIn, uint32_t MaskIn, uint32_t IdIn)
+{
+	uint32_t i, Num = 0;
+
+	if(!PlcRetain.Port || !ImgIn) return (BIT_FALSE);
+	if(!MaskIn) return (BIT_TRUE);
+
+	for(i=0; i<PLC_RETAIN_BLK_NUM; i++)
+	{
+		if(MaskIn & ((uint32_t)1 << i)) Num++;
+	}
+
+	if(PlcRetain.Sect == PLC_RETAIN_SECT_NONE || PlcRetain.Id != IdIn || (PlcRetain.Pos + Num + 1) > PLC_RETAIN_REC_NUM)
+	{
+		return (PlcRetain_Compact(ImgIn, IdIn));
+	}
+
+	//a failed record is skipped by the next commit
+	PlcRetain.Seq++;
+	for(i=0; i<PLC_RETAIN_BLK_NUM; i++)
+	{
+		if(!(MaskIn & ((uint32_t)1 << i))) continue;
+		if(!PlcRetain_WriteRec(PlcRetain.Sect, PlcRetain.Pos++, (PLC_RETAIN_TAG | i), &ImgIn[i*PLC_RETAIN_BLK_SZ])) return (BIT_FALSE);
+	}
+	return (PlcRetain_WriteRec(PlcRetain.Sect, PlcRetain.Pos++, PLC_RETAIN_TAG_END, 0));
+}
+
+/** @brief  Erase the other sector (prepare the next compaction).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - error of storage
+ *  @arg    = 1 - OK (the other sector is erased)
+ *  @note   Flash: CPU is stalled while sector is erased (one sector per call),
+ *          so it is called while application is stopped or once between commits.
+ *          Nothing is done if the other sector is erased already.
+ */
+uint8_t PlcRetain_Prepare(void)
+{
+	if(!PlcRetain.Port) return (BIT_FALSE);
+	if(PlcRetain.Spare) return (BIT_TRUE);
+
+	PlcRetain.Spare = PlcRetain_EraseSect(PlcRetain_Other());
+	return (PlcRetain.Spare);
+}
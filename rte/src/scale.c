@@ -4,6 +4,7 @@
  */
 
 #include "scale.h"
+#include <math.h>
 
 
 /** @brief  Scaling an input-value.
@@ -45,3 +46,77 @@ float ScaleA_Kb(float Y1In, float Y2In, float In1, float In2)
     float In = (In2 - In1);
     return ((In > 0.0) ? (((Y1In*In2) - (Y2In*In1))/In) : (float)0.0);
 }
+
+/** @brief  Set fixed-point scale factors.
+ *  @param  ScaleOut - pointer to factors.
+ *  @param  KaIn - scale Ka-factor (|Ka| < 2^31).
+ *  @param  KbIn - scale Kb-factor (|Kb| < 2^15).
+ *  @return Result:
+ *  @arg    = 0 - factors are out of range of fixed point (or NaN)
+ *  @arg    = 1 - OK
+ */
+uint8_t ScaleQ_Set(ScaleQ_t *ScaleOut, float KaIn, float KbIn)
+{
+    float   Frac;
+    int     Exp;
+    int64_t Mant;
+
+    if(!ScaleOut) return (BIT_FALSE);
+
+    //NaN fails both comparisons
+    if(!(KbIn > -32767.0f && KbIn < 32767.0f))             return (BIT_FALSE);
+    if(!(KaIn > -2147483648.0f && KaIn < 2147483648.0f)) return (BIT_FALSE);
+
+    //Ka = Frac*2^Exp, 0.5 <= |Frac| < 1
+    Frac = frexpf(KaIn, &Exp);
+    Mant = (int64_t)llroundf(ldexpf(Frac, 31));
+    if(Mant >= INT32_MAX || Mant <= -INT32_MAX)
+    {
+    	//rounded up to 2^31
+    	Mant /= 2;
+    	Exp++;
+    }
+
+    if(!Mant || (31-Exp) > 62)
+    {
+    	//negligible factor
+    	ScaleOut->KaMant = 0;
+    	ScaleOut->KaSh   = 0;
+    }
+    else
+    {
+    	if((31-Exp) < 0) return (BIT_FALSE);
+    	ScaleOut->KaMant = (int32_t)Mant;
+    	ScaleOut->KaSh   = (uint8_t)(31-Exp);
+    }
+
+    ScaleOut->Kb = (int32_t)lroundf(KbIn*(float)SCALE_Q_ONE);
+    return (BIT_TRUE);
+}
+
+/** @brief  Scaling an input-value (fixed point).
+ *  @param  In - input-value (Q16).
+ *  @param  ScaleIn - pointer to factors.
+ *  @return Real-value (Y, Q16, saturated).
+ *  @note   Y = Ka*In + Kb
+ */
+int32_t ScaleQ(int32_t In, const ScaleQ_t *ScaleIn)
+{
+    int64_t Y = (int64_t)In*ScaleIn->KaMant;
+
+    if(ScaleIn->KaSh) Y = ((Y + ((int64_t)1 << (ScaleIn->KaSh-1))) >> ScaleIn->KaSh);
+    Y += ScaleIn->Kb;
+
+    if(Y > INT32_MAX) Y = INT32_MAX;
+    if(Y < INT32_MIN) Y = INT32_MIN;
+    return ((int32_t)Y);
+}
+
+/** @brief  Convert fixed-point value into real-value.
+ *  @param  In - value (Q16).
+ *  @return Real-value.
+ */
+float ScaleQ_ToReal(int32_t In)
+{
+    return ((float)In/(float)SCALE_Q_ONE);
+}
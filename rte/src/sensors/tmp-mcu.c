@@ -12,5 +12,5 @@
  */
 inline float TmpMcu_GetTemp(float V)
 {
-	return (((V-TMP_MCU_V25)*TMP_MCU_AVG_SLOPE2)+25.0);
+	return (((V-TMP_MCU_V25)*TMP_MCU_AVG_SLOPE2)+TMP_MCU_T25);
 }
@@ -26,10 +26,443 @@ static DMA_HandleTypeDef PLC_ADC1_DMA;
 static uint8_t PLC_AI_DMA_STATUS = BIT_FALSE;
 
 
-/** @var ADC buffer by channels
+/** @var ADC buffer by channels (ring of blocks, capture buffer)
  */
 static volatile uint16_t PLC_AI_ADC_BUFF[PLC_AI_ADC_BUFF_SZ];
 
+/** @var Spare blocks of ADC buffer (DMA.M0, DMA.M1 while capture is frozen)
+ */
+static volatile uint16_t PLC_AI_ADC_SPARE[2*PLC_AI_ADC_BLK_SZ_OVS];
+
+/** @def Spare block
+ */
+#define PLC_AI_ADC_BLK_SPARE                     (uint16_t)0xFFFF
+
+/** @var Blocks of ADC buffer in DMA.M0, DMA.M1
+ */
+static uint16_t PLC_AI_ADC_MEM[2];
+
+/** @var Quantity of blocks in ring (by mode) and the next block for DMA
+ */
+static uint16_t PLC_AI_ADC_BLKS     = 0;
+static uint16_t PLC_AI_ADC_BLK_NEXT = 0;
+
+/** @var Waveform capture
+ */
+static PlcAI_Cap_t PLC_AI_CAP;
+
+/** @var ADC accumulators by channels
+ */
+static volatile PlcAI_Acc_t PLC_AI_ACC[PLC_AI_SZ];
+
+/** @var Filters by channels
+ */
+static PlcAI_Fltr_t PLC_AI_FLTR[PLC_AI_SZ];
+static uint16_t     PLC_AI_FLTR_PRM[PLC_AI_SZ];
+
+/** @var Oversampling by channels
+ */
+static PlcAI_Ovs_t PLC_AI_OVS[PLC_AI_SZ];
+
+/** @var ADC mode: oversampling
+ */
+static uint8_t PLC_AI_ADC_OVS = BIT_FALSE;
+
+/** @var Size of a block of ADC buffer (by mode)
+ */
+static uint16_t PLC_AI_ADC_BLK = PLC_AI_ADC_BLK_SZ;
+
+#ifdef PLC_AI_ADC_TRIG_TIM
+
+/** @var TIM3 Handler (ADC trigger)
+ */
+static TIM_HandleTypeDef PLC_AI_TRIG_TIM;
+
+#endif //PLC_AI_ADC_TRIG_TIM
+
+
+/** @brief  Reset accumulators.
+ *  @param  None.
+ *  @return None.
+ */
+static void PlcAI_AccReset(void)
+{
+	uint32_t Prim = __get_PRIMASK();
+	__disable_irq();
+
+	for(uint8_t i=0; i<PLC_AI_SZ; i++)
+	{
+		PLC_AI_ACC[i].Sum  = 0;
+		PLC_AI_ACC[i].Cnt  = 0;
+		PLC_AI_ACC[i].Code = PLC_AI_DIG_MIN;
+		PLC_AI_OVS[i].Sum  = 0;
+		PLC_AI_OVS[i].Cnt  = 0;
+		PlcAI_Fltr_Reset(&PLC_AI_FLTR[i]);
+	}
+
+	__set_PRIMASK(Prim);
+}
+
+/** @brief  Add a block of ADC buffer into accumulators.
+ *  @param  BuffIn - pointer to the block of ADC buffer.
+ *  @return None.
+ *  @note   Called from DMA ISR (DMA fills the other block meanwhile).
+ */
+static void PlcAI_AccAdd(const volatile uint16_t *BuffIn)
+{
+	uint32_t Sum[PLC_AI_SZ];
+	uint32_t Cnt[PLC_AI_SZ];
+	uint16_t i, Code;
+	uint8_t  Ch;
+
+	for(Ch=0; Ch<PLC_AI_SZ; Ch++)
+	{
+		Sum[Ch] = 0;
+		Cnt[Ch] = 0;
+	}
+
+	for(i=0; i<PLC_AI_ADC_BLK; i+=PLC_AI_SZ)
+	{
+		for(Ch=0; Ch<PLC_AI_SZ; Ch++)
+		{
+			Code = BuffIn[i+Ch];
+
+			if(PLC_AI_OVS[Ch].Bits)
+			{
+				//decimation: 4^n measurements -> 12+n bits
+				PLC_AI_OVS[Ch].Sum += Code;
+				if(++PLC_AI_OVS[Ch].Cnt < ((uint16_t)1 << (2*PLC_AI_OVS[Ch].Bits))) continue;
+
+				Code = (uint16_t)(PLC_AI_OVS[Ch].Sum >> PLC_AI_OVS[Ch].Bits);
+				PLC_AI_OVS[Ch].Sum = 0;
+				PLC_AI_OVS[Ch].Cnt = 0;
+			}
+
+			Sum[Ch] += Code;
+			Cnt[Ch]++;
+			if(PLC_AI_FLTR[Ch].Type != PLC_AI_FLTR_OFF) PlcAI_Fltr_Put(&PLC_AI_FLTR[Ch], Code);
+		}
+	}
+
+	for(Ch=0; Ch<PLC_AI_SZ; Ch++)
+	{
+		if(PLC_AI_ACC[Ch].Cnt >= PLC_AI_ADC_ACC_CNT__MAX)
+		{
+			//not read for a long time: restart from the latest block
+			PLC_AI_ACC[Ch].Sum = 0;
+			PLC_AI_ACC[Ch].Cnt = 0;
+		}
+		PLC_AI_ACC[Ch].Sum += Sum[Ch];
+		PLC_AI_ACC[Ch].Cnt += Cnt[Ch];
+	}
+
+	if(PLC_ADC1_USER_FUNC.ConvCplt != NULL) PLC_ADC1_USER_FUNC.ConvCplt();
+}
+
+/** @brief  Get sample rate of ADC (by mode).
+ *  @param  None.
+ *  @return Sample rate per a ADC-channel (Hz).
+ */
+static uint32_t PlcAI_AdcHz(void)
+{
+	return ((PLC_AI_ADC_OVS) ? PLC_AI_ADC_SAMPLE_HZ_OVS : PLC_AI_ADC_SAMPLE_HZ);
+}
+
+/** @brief  Search trigger and count post-trigger scans of waveform capture.
+ *  @param  BlkIn - block of ring.
+ *  @return None.
+ *  @note   Called from DMA ISR before the block memory of DMA is moved.
+ */
+static void PlcAI_CapAdd(uint16_t BlkIn)
+{
+	PlcAI_Cap_t *Cap = &PLC_AI_CAP;
+	const volatile uint16_t *Buff;
+	uint16_t Scans, Scan, Code, i;
+	uint8_t  Trig;
+
+	if(Cap->State != PLC_AI_CAP_ARMED && Cap->State != PLC_AI_CAP_TRIG) return;
+
+	Scans = PLC_AI_ADC_BLK/PLC_AI_SZ;
+	Scan  = BlkIn*Scans;
+	Buff  = &PLC_AI_ADC_BUFF[BlkIn*PLC_AI_ADC_BLK];
+
+	for(i=0; i<Scans; i++, Scan++)
+	{
+		if(Cap->State == PLC_AI_CAP_ARMED)
+		{
+			Code = Buff[i*PLC_AI_SZ+Cap->Ch];
+
+			if(Cap->Cnt >= Cap->Pre)
+			{
+				switch(Cap->Edge)
+				{
+					case PLC_AI_CAP_EDGE_RISE:
+						Trig = (Cap->Cnt && Cap->Prev < Cap->Level && Code >= Cap->Level);
+						break;
+					case PLC_AI_CAP_EDGE_FALL:
+						Trig = (Cap->Cnt && Cap->Prev >= Cap->Level && Code < Cap->Level);
+						break;
+					case PLC_AI_CAP_EDGE_ANY:
+						Trig = (Cap->Cnt && ((Cap->Prev < Cap->Level) != (Code < Cap->Level)));
+						break;
+					default:
+						Trig = BIT_TRUE;
+						break;
+				}
+
+				if(Trig)
+				{
+					Cap->Trig  = Scan;
+					Cap->Left  = Cap->Post;
+					Cap->State = PLC_AI_CAP_TRIG;
+				}
+			}
+
+			Cap->Prev = Code;
+			Cap->Cnt++;
+		}
+
+		if(Cap->State == PLC_AI_CAP_TRIG)
+		{
+			if(!(--Cap->Left))
+			{
+				Cap->Len   = Cap->Pre+Cap->Post;
+				Cap->Start = (uint16_t)((Cap->Trig + Cap->Ring - Cap->Pre)%Cap->Ring);
+				Cap->State = PLC_AI_CAP_FROZEN;
+				break;
+			}
+		}
+	}
+}
+
+/** @brief  Get the next block for memory of DMA.
+ *  @param  MemIn - memory (0 - DMA.M0, 1 - DMA.M1).
+ *  @return Address of block.
+ *  @note   Spare block is used while capture is frozen.
+ */
+static uint32_t PlcAI_NextMem(uint8_t MemIn)
+{
+	uint16_t Blk;
+
+	if(PLC_AI_CAP.State == PLC_AI_CAP_FROZEN)
+	{
+		PLC_AI_ADC_MEM[MemIn] = PLC_AI_ADC_BLK_SPARE;
+		return ((uint32_t)&PLC_AI_ADC_SPARE[MemIn*PLC_AI_ADC_BLK_SZ_OVS]);
+	}
+
+	Blk = PLC_AI_ADC_BLK_NEXT;
+	if(++PLC_AI_ADC_BLK_NEXT >= PLC_AI_ADC_BLKS) PLC_AI_ADC_BLK_NEXT = 0;
+
+	PLC_AI_ADC_MEM[MemIn] = Blk;
+	return ((uint32_t)&PLC_AI_ADC_BUFF[Blk*PLC_AI_ADC_BLK]);
+}
+
+/** @brief  Process completed block of ADC buffer.
+ *  @param  MemIn - memory (0 - DMA.M0, 1 - DMA.M1).
+ *  @return None.
+ *  @note   Called from DMA ISR, DMA fills the other memory meanwhile.
+ */
+static void PlcAI_DmaCplt(uint8_t MemIn)
+{
+	uint16_t Blk = PLC_AI_ADC_MEM[MemIn];
+	const volatile uint16_t *Buff;
+
+	if(Blk != PLC_AI_ADC_BLK_SPARE)
+	{
+		Buff = &PLC_AI_ADC_BUFF[Blk*PLC_AI_ADC_BLK];
+		PlcAI_CapAdd(Blk);
+	}
+	else
+	{
+		Buff = &PLC_AI_ADC_SPARE[MemIn*PLC_AI_ADC_BLK_SZ_OVS];
+	}
+
+	//the block is processed before DMA comes back to the memory (1 ms)
+	HAL_DMAEx_ChangeMemory(&PLC_ADC1_DMA, PlcAI_NextMem(MemIn), ((MemIn) ? MEMORY1 : MEMORY0));
+	PlcAI_AccAdd(Buff);
+}
+
+/** @brief  DMA2.ADC(Tc) Transfer completed Callback (DMA.M0).
+ *  @param  HandleIn - pointer to DMA-handle.
+ *  @return None.
+ */
+static void PlcAI_DmaM0Cplt(DMA_HandleTypeDef *HandleIn)
+{
+	(void)HandleIn;
+	PlcAI_DmaCplt(0);
+}
+
+/** @brief  DMA2.ADC(Tc) Transfer completed Callback (DMA.M1).
+ *  @param  HandleIn - pointer to DMA-handle.
+ *  @return None.
+ */
+static void PlcAI_DmaM1Cplt(DMA_HandleTypeDef *HandleIn)
+{
+	(void)HandleIn;
+	PlcAI_DmaCplt(1);
+}
+
+/** @brief  DMA2.ADC Error Callback.
+ *  @param  HandleIn - pointer to DMA-handle.
+ *  @return None.
+ *  @note   Stream is disabled by hardware, values hold until PlcAI_Stop(), PlcAI_Start().
+ */
+static void PlcAI_DmaError(DMA_HandleTypeDef *HandleIn)
+{
+	(void)HandleIn;
+	PLC_ADC1.ErrorCode |= HAL_ADC_ERROR_DMA;
+}
+
+/** @brief  Start ADC and DMA (double-buffer mode).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ *  @note   HAL_ADC_Start_DMA() without double-buffer mode.
+ */
+static uint8_t PlcAI_AdcStartDma(void)
+{
+	__IO uint32_t Cnt;
+	uint32_t M0, M1;
+
+	//ring of blocks (by mode), frozen capture keeps it
+	PLC_AI_ADC_BLKS     = (uint16_t)(PLC_AI_ADC_BUFF_SZ/PLC_AI_ADC_BLK);
+	PLC_AI_ADC_BLK_NEXT = 0;
+	if(PLC_AI_CAP.State == PLC_AI_CAP_ARMED || PLC_AI_CAP.State == PLC_AI_CAP_TRIG)
+	{
+		//rearm
+		PLC_AI_CAP.Ring  = (uint16_t)(PLC_AI_ADC_BLKS*(PLC_AI_ADC_BLK/PLC_AI_SZ));
+		PLC_AI_CAP.Hz    = PlcAI_AdcHz();
+		PLC_AI_CAP.Cnt   = 0;
+		PLC_AI_CAP.State = PLC_AI_CAP_ARMED;
+	}
+	M0 = PlcAI_NextMem(0);
+	M1 = PlcAI_NextMem(1);
+
+	if(!(PLC_ADC1.Instance->CR2 & ADC_CR2_ADON))
+	{
+		__HAL_ADC_ENABLE(&PLC_ADC1);
+		//stabilization time
+		Cnt = (ADC_STAB_DELAY_US*(SystemCoreClock/1000000U));
+		while(Cnt != 0U) Cnt--;
+	}
+	if(!(PLC_ADC1.Instance->CR2 & ADC_CR2_ADON)) return (BIT_FALSE);
+
+	ADC_STATE_CLR_SET(PLC_ADC1.State, HAL_ADC_STATE_READY|HAL_ADC_STATE_REG_EOC|HAL_ADC_STATE_REG_OVR, HAL_ADC_STATE_REG_BUSY);
+	PLC_ADC1.ErrorCode = HAL_ADC_ERROR_NONE;
+
+	PLC_ADC1_DMA.XferCpltCallback       = PlcAI_DmaM0Cplt;
+	PLC_ADC1_DMA.XferM1CpltCallback     = PlcAI_DmaM1Cplt;
+	PLC_ADC1_DMA.XferHalfCpltCallback   = NULL;
+	PLC_ADC1_DMA.XferM1HalfCpltCallback = NULL;
+	PLC_ADC1_DMA.XferErrorCallback      = PlcAI_DmaError;
+
+	__HAL_ADC_CLEAR_FLAG(&PLC_ADC1, ADC_FLAG_EOC|ADC_FLAG_OVR);
+	PLC_ADC1.Instance->CR2 |= ADC_CR2_DMA;
+
+	if(HAL_DMAEx_MultiBufferStart_IT(&PLC_ADC1_DMA, (uint32_t)&PLC_ADC1.Instance->DR, M0, M1, (uint32_t)PLC_AI_ADC_BLK) != HAL_OK)
+	{
+		HAL_ADC_Stop_DMA(&PLC_ADC1);
+		return (BIT_FALSE);
+	}
+
+#ifndef PLC_AI_ADC_TRIG_TIM
+	PLC_ADC1.Instance->CR2 |= ADC_CR2_SWSTART;
+#endif //PLC_AI_ADC_TRIG_TIM
+
+	return (BIT_TRUE);
+}
+
+/** @brief  Get sample period of filter of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @return Sample period (us).
+ */
+static uint32_t PlcAI_FltrTs(uint8_t ChIn)
+{
+	return ((uint32_t)(((uint64_t)1000000 << (2*PLC_AI_OVS[ChIn].Bits))/PlcAI_AdcHz()));
+}
+
+/** @brief  Config. ADC channels (by mode).
+ *  @param  None.
+ *  @return None.
+ *  @note   ADC is stopped.
+ */
+static void PlcAI_ConfigChannels(void)
+{
+	ADC_ChannelConfTypeDef AdcChannelCfg;
+
+	AdcChannelCfg.SamplingTime = ((PLC_AI_ADC_OVS) ? PLC_AI_ADC_SMPL_OVS : PLC_AI_ADC_SMPL);
+	// CH0
+	AdcChannelCfg.Channel = PLC_AI_00__ADC_CH;
+	AdcChannelCfg.Rank    = (PLC_AI_00+1);
+	if(HAL_ADC_ConfigChannel(&PLC_ADC1, &AdcChannelCfg) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+	// CH1
+	AdcChannelCfg.Channel = PLC_AI_01__ADC_CH;
+	AdcChannelCfg.Rank    = (PLC_AI_01+1);
+	if(HAL_ADC_ConfigChannel(&PLC_ADC1, &AdcChannelCfg) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+	// MCU_TEMP
+	AdcChannelCfg.SamplingTime = PLC_AI_ADC_SMPL_TEMP;
+	AdcChannelCfg.Channel      = PLC_AI_MCU_TEMP__ADC_CH;
+	AdcChannelCfg.Rank         = (PLC_AI_MCU_TEMP+1);
+	if(HAL_ADC_ConfigChannel(&PLC_ADC1, &AdcChannelCfg) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+
+	PLC_AI_ADC_BLK = ((PLC_AI_ADC_OVS) ? PLC_AI_ADC_BLK_SZ_OVS : PLC_AI_ADC_BLK_SZ);
+}
+
+#ifdef PLC_AI_ADC_TRIG_TIM
+
+/** @brief  Init. TIM3 (ADC trigger).
+ *  @param  None.
+ *  @return None.
+ */
+static void PlcAI_TrigTimInit(void)
+{
+	TIM_ClockConfigTypeDef  TimClockCfg;
+	TIM_MasterConfigTypeDef TimMasterCfg;
+
+	//Enable clock
+	__HAL_RCC_TIM3_CLK_ENABLE();
+
+	//Counter settings
+	PLC_AI_TRIG_TIM.Instance               = TIM3;
+	PLC_AI_TRIG_TIM.Init.Prescaler         = PLC_AI_TRIG_TIM_PRESCALER;
+	PLC_AI_TRIG_TIM.Init.CounterMode       = TIM_COUNTERMODE_UP;
+	PLC_AI_TRIG_TIM.Init.Period            = PLC_AI_TRIG_TIM_PERIOD;
+	PLC_AI_TRIG_TIM.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;
+	PLC_AI_TRIG_TIM.Init.RepetitionCounter = 0;
+	PLC_AI_TRIG_TIM.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+	if(HAL_TIM_Base_Init(&PLC_AI_TRIG_TIM) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+
+	//Clock source
+	TimClockCfg.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+	if(HAL_TIM_ConfigClockSource(&PLC_AI_TRIG_TIM, &TimClockCfg) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+
+	//Trigger settings (TRGO on update)
+	TimMasterCfg.MasterOutputTrigger = TIM_TRGO_UPDATE;
+	TimMasterCfg.MasterSlaveMode     = TIM_MASTERSLAVEMODE_DISABLE;
+	if(HAL_TIMEx_MasterConfigSynchronization(&PLC_AI_TRIG_TIM, &TimMasterCfg) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+}
+
+#endif //PLC_AI_ADC_TRIG_TIM
+
 
 /** @brief  AI Init.
  *  @param  none.
@@ -38,7 +471,6 @@ static volatile uint16_t PLC_AI_ADC_BUFF[PLC_AI_ADC_BUFF_SZ];
 void PlcAI_Init(void)
 {
 	GPIO_InitTypeDef GpioDef;
-	ADC_ChannelConfTypeDef AdcChannelCfg;
 
 	//Enable clock
 	__HAL_RCC_GPIOB_CLK_ENABLE();
@@ -57,12 +489,19 @@ void PlcAI_Init(void)
 	PLC_ADC1.Init.Resolution              = ADC_RESOLUTION_12B;
 	PLC_ADC1.Init.DataAlign               = ADC_DATAALIGN_RIGHT;
 	PLC_ADC1.Init.ScanConvMode            = ENABLE;
-	PLC_ADC1.Init.ContinuousConvMode      = ENABLE;
 	PLC_ADC1.Init.DiscontinuousConvMode   = DISABLE;
 	PLC_ADC1.Init.DMAContinuousRequests   = ENABLE;
 	PLC_ADC1.Init.EOCSelection			  = ADC_EOC_SINGLE_CONV;
-	PLC_ADC1.Init.ExternalTrigConv        = ADC_SOFTWARE_START;
+#ifdef PLC_AI_ADC_TRIG_TIM
+	//one scan per TIM3.TRGO
+	PLC_ADC1.Init.ContinuousConvMode      = DISABLE;
+	PLC_ADC1.Init.ExternalTrigConv        = ADC_EXTERNALTRIGCONV_T3_TRGO;
 	PLC_ADC1.Init.ExternalTrigConvEdge    = ADC_EXTERNALTRIGCONVEDGE_RISING;
+#else
+	PLC_ADC1.Init.ContinuousConvMode      = ENABLE;
+	PLC_ADC1.Init.ExternalTrigConv        = ADC_SOFTWARE_START;
+	PLC_ADC1.Init.ExternalTrigConvEdge    = ADC_EXTERNALTRIGCONVEDGE_NONE;
+#endif //PLC_AI_ADC_TRIG_TIM
 	PLC_ADC1.Init.NbrOfConversion         = PLC_AI_SZ;
 	if(HAL_ADC_Init(&PLC_ADC1) != HAL_OK)
 	{
@@ -70,28 +509,7 @@ void PlcAI_Init(void)
 	}
 
 	//ADC channel settings
-	AdcChannelCfg.SamplingTime = ADC_SAMPLETIME_480CYCLES;
-	// CH0
-	AdcChannelCfg.Channel = PLC_AI_00__ADC_CH;
-	AdcChannelCfg.Rank    = (PLC_AI_00+1);
-	if(HAL_ADC_ConfigChannel(&PLC_ADC1, &AdcChannelCfg) != HAL_OK)
-	{
-		_Error_Handler(__FILE__, __LINE__);
-	}
-	// CH1
-	AdcChannelCfg.Channel = PLC_AI_01__ADC_CH;
-	AdcChannelCfg.Rank    = (PLC_AI_01+1);
-	if(HAL_ADC_ConfigChannel(&PLC_ADC1, &AdcChannelCfg) != HAL_OK)
-	{
-		_Error_Handler(__FILE__, __LINE__);
-	}
-	// MCU_TEMP
-	AdcChannelCfg.Channel = PLC_AI_MCU_TEMP__ADC_CH;
-	AdcChannelCfg.Rank    = (PLC_AI_MCU_TEMP+1);
-	if(HAL_ADC_ConfigChannel(&PLC_ADC1, &AdcChannelCfg) != HAL_OK)
-	{
-		_Error_Handler(__FILE__, __LINE__);
-	}
+	PlcAI_ConfigChannels();
 
 	//ADC1.DMA2 Init.
 	PLC_ADC1_DMA.Instance                 = DMA2_Stream0;
@@ -101,7 +519,7 @@ void PlcAI_Init(void)
 	PLC_ADC1_DMA.Init.MemInc 			  = DMA_MINC_ENABLE;
 	PLC_ADC1_DMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
 	PLC_ADC1_DMA.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;
-	PLC_ADC1_DMA.Init.Mode				  = DMA_NORMAL;
+	PLC_ADC1_DMA.Init.Mode				  = DMA_CIRCULAR;
 	PLC_ADC1_DMA.Init.Priority			  = PLC_DMA_PRIO_AI;
 	PLC_ADC1_DMA.Init.FIFOMode			  = DMA_FIFOMODE_DISABLE;
 	PLC_ADC1_DMA.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
@@ -118,6 +536,26 @@ void PlcAI_Init(void)
     // DMA2
     HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, PLC_NVIC_PPRIO_AI_DMA, PLC_NVIC_SPRIO_AI_DMA);
     HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
+
+#ifdef PLC_AI_ADC_TRIG_TIM
+    PlcAI_TrigTimInit();
+#endif //PLC_AI_ADC_TRIG_TIM
+
+    PLC_AI_CAP.Ch    = PLC_AI_CAP_CH_DEF;
+    PLC_AI_CAP.Edge  = PLC_AI_CAP_EDGE_DEF;
+    PLC_AI_CAP.Level = PLC_AI_CAP_LEVEL_DEF;
+    PLC_AI_CAP.Pre   = PLC_AI_CAP_PRE_DEF;
+    PLC_AI_CAP.Post  = PLC_AI_CAP_POST_DEF;
+    PLC_AI_CAP.State = PLC_AI_CAP_IDLE;
+    PLC_AI_CAP.Len   = 0;
+
+    for(uint8_t i=0; i<PLC_AI_SZ; i++)
+    {
+    	PLC_AI_OVS[i].Bits  = PLC_AI_OVS_DEF;
+    	PLC_AI_FLTR_PRM[i]  = PLC_AI_FLTR_PRM_DEF;
+    	PlcAI_Fltr_Set(&PLC_AI_FLTR[i], PLC_AI_FLTR_DEF, PLC_AI_FLTR_PRM[i], PlcAI_FltrTs(i));
+    }
+    PlcAI_AccReset();
 }
 
 /** @brief  AI DeInit.
@@ -137,6 +575,12 @@ void PlcAI_DeInit(void)
 
 	//DMA DeInit
 	HAL_DMA_DeInit(&PLC_ADC1_DMA);
+
+#ifdef PLC_AI_ADC_TRIG_TIM
+	//TIM3 DeInit
+	HAL_TIM_Base_DeInit(&PLC_AI_TRIG_TIM);
+	__HAL_RCC_TIM3_CLK_DISABLE();
+#endif //PLC_AI_ADC_TRIG_TIM
 }
 
 /** @brief  Start AI.
@@ -151,10 +595,16 @@ void PlcAI_Start(void)
         DebugLog("PlcAI_Start\n");
 #endif // DEBUG_LOG_ADC
 
-        //Restarting the DMA automatically starts the ADC
-        //HAL_ADC_Start(&PLC_ADC1);
-        if(HAL_ADC_Start_DMA(&PLC_ADC1, (uint32_t*)PLC_AI_ADC_BUFF, PLC_AI_ADC_BUFF_SZ) == HAL_OK)
+        PlcAI_AccReset();
+
+        //DMA runs over the ring until PlcAI_Stop()
+        if(PlcAI_AdcStartDma())
         {
+#ifdef PLC_AI_ADC_TRIG_TIM
+        	__HAL_TIM_SET_AUTORELOAD(&PLC_AI_TRIG_TIM, ((PLC_AI_ADC_OVS) ? PLC_AI_TRIG_TIM_PERIOD_OVS : PLC_AI_TRIG_TIM_PERIOD));
+        	__HAL_TIM_SET_COUNTER(&PLC_AI_TRIG_TIM, 0);
+        	HAL_TIM_Base_Start(&PLC_AI_TRIG_TIM);
+#endif //PLC_AI_ADC_TRIG_TIM
         	PLC_AI_DMA_STATUS = BIT_TRUE;
         }
 	}
@@ -166,10 +616,12 @@ void PlcAI_Start(void)
  */
 void PlcAI_Stop(void)
 {
-	HAL_ADC_Stop(&PLC_ADC1);
+#ifdef PLC_AI_ADC_TRIG_TIM
+	HAL_TIM_Base_Stop(&PLC_AI_TRIG_TIM);
+#endif //PLC_AI_ADC_TRIG_TIM
+	//DMA works in double-buffer mode, so it is stopped together with ADC
+	HAL_ADC_Stop_DMA(&PLC_ADC1);
 	PLC_AI_DMA_STATUS = BIT_FALSE;
-	//DMA works in normal mode, so its will stop automatically when the data is read
-	//HAL_ADC_Stop_DMA(&PLC_ADC1);
 }
 
 
@@ -192,51 +644,239 @@ void DMA2_Stream0_IRQHandler(void)
 }
 
 
-/** @brief  DMA2.ADC(Tc) Transfer completed Callback.
- *  @param  HandleIn - pointer to ADC-handle.
- *  @return None.
- *  @note   HAL ReImplementation.
+/** @brief  Set filter of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @param  TypeIn - filter type (PLC_AI_FLTR_...).
+ *  @param  PrmIn - filter parameter.
+ *  @return Result:
+ *  @arg    = 0 - not set (filter is off)
+ *  @arg    = 1 - set
  */
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *HandleIn)
+uint8_t PlcAI_SetFltr(uint8_t ChIn, uint8_t TypeIn, uint16_t PrmIn)
 {
-	if(HandleIn == &PLC_ADC1)
+	uint32_t Prim;
+	uint8_t  Res = BIT_FALSE;
+
+	if(ChIn < PLC_AI_SZ)
 	{
-		if(PLC_ADC1_USER_FUNC.ConvCplt != NULL) PLC_ADC1_USER_FUNC.ConvCplt();
+		//DMA ISR feeds the filter
+		Prim = __get_PRIMASK();
+		__disable_irq();
+		PLC_AI_FLTR_PRM[ChIn] = PrmIn;
+		Res = PlcAI_Fltr_Set(&PLC_AI_FLTR[ChIn], TypeIn, PrmIn, PlcAI_FltrTs(ChIn));
+		__set_PRIMASK(Prim);
 	}
+	return (Res);
+}
+
+/** @brief  Set oversampling of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @param  BitsIn - extra bits (n):
+ *  @arg    = 0 ... PLC_AI_OVS__MAX (4^n measurements per output)
+ *  @return Result:
+ *  @arg    = 0 - not set
+ *  @arg    = 1 - set
+ *  @note   ADC is restarted if mode of ADC is changed.
+ */
+uint8_t PlcAI_SetOvs(uint8_t ChIn, uint8_t BitsIn)
+{
+	uint8_t  Ovs = BIT_FALSE;
+	uint8_t  Run = PLC_AI_DMA_STATUS;
+	uint8_t  i;
+	uint32_t Prim;
+
+	if(ChIn >= PLC_AI_SZ || BitsIn > PLC_AI_OVS__MAX) return (BIT_FALSE);
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+	PLC_AI_OVS[ChIn].Bits = BitsIn;
+	PLC_AI_OVS[ChIn].Sum  = 0;
+	PLC_AI_OVS[ChIn].Cnt  = 0;
+	__set_PRIMASK(Prim);
+
+	for(i=0; i<PLC_AI_SZ; i++)
+	{
+		if(PLC_AI_OVS[i].Bits) Ovs = BIT_TRUE;
+	}
+
+	if(Ovs != PLC_AI_ADC_OVS)
+	{
+		//mode of ADC is changed: sample time, sample rate
+		if(Run) PlcAI_Stop();
+		PLC_AI_ADC_OVS = Ovs;
+		PlcAI_ConfigChannels();
+		if(Run) PlcAI_Start();
+
+		//rate of all channels is changed
+		for(i=0; i<PLC_AI_SZ; i++) PlcAI_SetFltr(i, PLC_AI_FLTR[i].Type, PLC_AI_FLTR_PRM[i]);
+	}
+	else
+	{
+		PlcAI_SetFltr(ChIn, PLC_AI_FLTR[ChIn].Type, PLC_AI_FLTR_PRM[ChIn]);
+	}
+
+	return (BIT_TRUE);
+}
+
+/** @brief  Get effective sample rate of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @return Sample rate (Hz).
+ */
+float PlcAI_GetRate(uint8_t ChIn)
+{
+	if(ChIn < PLC_AI_SZ)
+	{
+		return ((float)PlcAI_AdcHz()/(float)((uint32_t)1 << (2*PLC_AI_OVS[ChIn].Bits)));
+	}
+	return (0.0f);
+}
+
+/** @brief  Get effective resolution of AI-channel.
+ *  @param  ChIn - channel number.
+ *  @return Resolution (bits).
+ */
+uint8_t PlcAI_GetBits(uint8_t ChIn)
+{
+	return ((ChIn < PLC_AI_SZ) ? (uint8_t)(PLC_AI_DIG_BITS+PLC_AI_OVS[ChIn].Bits) : PLC_AI_DIG_BITS);
+}
+
+
+/** @brief  Get max. length of waveform capture (by mode of ADC).
+ *  @param  None.
+ *  @return Pre+Post (scans).
+ */
+uint16_t PlcAI_CapLenMax(void)
+{
+	//2 blocks are being written when capture is frozen
+	return ((uint16_t)(((PLC_AI_ADC_BUFF_SZ/PLC_AI_ADC_BLK)-2)*(PLC_AI_ADC_BLK/PLC_AI_SZ)));
+}
+
+/** @brief  Arm waveform capture.
+ *  @param  CapIn - pointer to settings (Ch, Edge, Level, Pre, Post).
+ *  @return Result:
+ *  @arg    = 0 - not armed (invalid settings)
+ *  @arg    = 1 - armed
+ *  @note   Pre and Post are limited by PlcAI_CapLenMax(), Post >= 1.
+ *          A frozen capture is dropped.
+ */
+uint8_t PlcAI_CapArm(const PlcAI_Cap_t *CapIn)
+{
+	uint16_t Max = PlcAI_CapLenMax();
+	uint16_t Pre, Post;
+	uint32_t Prim;
+
+	if(!CapIn || CapIn->Ch >= PLC_AI_SZ || CapIn->Edge > PLC_AI_CAP_EDGE_ANY) return (BIT_FALSE);
+
+	Post = ((CapIn->Post) ? CapIn->Post : 1);
+	if(Post > Max) Post = Max;
+	Pre  = ((CapIn->Pre <= Max-Post) ? CapIn->Pre : Max-Post);
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+
+	PLC_AI_CAP.Ch    = CapIn->Ch;
+	PLC_AI_CAP.Edge  = CapIn->Edge;
+	PLC_AI_CAP.Level = CapIn->Level;
+	PLC_AI_CAP.Pre   = Pre;
+	PLC_AI_CAP.Post  = Post;
+	PLC_AI_CAP.Ring  = (uint16_t)((PLC_AI_ADC_BUFF_SZ/PLC_AI_ADC_BLK)*(PLC_AI_ADC_BLK/PLC_AI_SZ));
+	PLC_AI_CAP.Hz    = PlcAI_AdcHz();
+	PLC_AI_CAP.Cnt   = 0;
+	PLC_AI_CAP.Len   = 0;
+	PLC_AI_CAP.State = PLC_AI_CAP_ARMED;
+
+	__set_PRIMASK(Prim);
+	return (BIT_TRUE);
+}
+
+/** @brief  Release waveform capture (ring is returned to DMA).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcAI_CapRelease(void)
+{
+	uint32_t Prim = __get_PRIMASK();
+	__disable_irq();
+
+	PLC_AI_CAP.State = PLC_AI_CAP_IDLE;
+	PLC_AI_CAP.Len   = 0;
+
+	__set_PRIMASK(Prim);
+}
+
+/** @brief  Get state of waveform capture.
+ *  @param  CapOut - pointer to copy of capture (settings and state).
+ *  @return State (PLC_AI_CAP_...).
+ */
+uint8_t PlcAI_CapGet(PlcAI_Cap_t *CapOut)
+{
+	uint32_t Prim;
+	uint8_t  State;
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+	if(CapOut) *CapOut = PLC_AI_CAP;
+	State = PLC_AI_CAP.State;
+	__set_PRIMASK(Prim);
+
+	return (State);
+}
+
+/** @brief  Read measurement of frozen waveform capture.
+ *  @param  ScanIn - scan number (0 ... Len-1, trigger scan is Pre).
+ *  @param  ChIn - channel number.
+ *  @return ADC-code or PLC_AI_CAP_CODE_NONE (not frozen or out of capture).
+ *  @note   Measurement is read from the ring in place.
+ */
+uint16_t PlcAI_CapRead(uint16_t ScanIn, uint8_t ChIn)
+{
+	//ring is not written while capture is frozen
+	if(PLC_AI_CAP.State != PLC_AI_CAP_FROZEN || ScanIn >= PLC_AI_CAP.Len || ChIn >= PLC_AI_SZ) return (PLC_AI_CAP_CODE_NONE);
+
+	return (PLC_AI_ADC_BUFF[((PLC_AI_CAP.Start+ScanIn)%PLC_AI_CAP.Ring)*PLC_AI_SZ+ChIn]);
 }
 
 
 /** @brief  Get ADC-code of AI-channel.
  *  @param  ChIn - channel number.
  *  @return Digital level:
- *  @arg    = PLC_AI_DIG_MIN ... PLC_AI_DIG_MAX
- *  @note   Current ADC-code
+ *  @arg    = PLC_AI_DIG_MIN ... PLC_AI_DIG_MAX*2^n (n - oversampling)
+ *  @note   Average ADC-code since the last call
+ *          (the latest one if there are no new measurements)
+ *          or the latest output of filter
  */
 uint16_t PlcAI_GetCode(uint8_t ChIn)
 {
     uint16_t Res = PLC_AI_DIG_MIN;
+    uint16_t Max = PLC_AI_DIG_MAX;
+    uint32_t Prim;
 
     if(ChIn < PLC_AI_SZ)
     {
-#if (PLC_AI_ADC_CHANNEL_MEASURES > 1)
-        //summ of all measurements of the channel
-        uint32_t Sum = 0;
-        uint16_t iBuff;
-
-        for(uint16_t i=0; i<PLC_AI_ADC_CHANNEL_MEASURES; i++)
-        {
-        	iBuff = ((PLC_AI_SZ*i)+ChIn);
-            Sum += PLC_AI_ADC_BUFF[iBuff];
-        }
-        //average value
-        Res = (uint16_t)(Sum/PLC_AI_ADC_CHANNEL_MEASURES);
-#else
-        //single value
-        Res = PLC_AI_ADC_BUFF[ChIn];
-#endif //PLC_AI_ADC_CHANNEL_MEASURES
+    	Prim = __get_PRIMASK();
+    	__disable_irq();
+
+    	if(PLC_AI_FLTR[ChIn].Type != PLC_AI_FLTR_OFF && PLC_AI_FLTR[ChIn].Cnt)
+    	{
+    		//the latest output of filter
+    		PLC_AI_ACC[ChIn].Code = PLC_AI_FLTR[ChIn].Out;
+    		PLC_AI_ACC[ChIn].Sum  = 0;
+    		PLC_AI_ACC[ChIn].Cnt  = 0;
+    	}
+    	else if(PLC_AI_ACC[ChIn].Cnt)
+    	{
+    		//average value (rounded)
+    		PLC_AI_ACC[ChIn].Code = (uint16_t)((PLC_AI_ACC[ChIn].Sum + PLC_AI_ACC[ChIn].Cnt/2)/PLC_AI_ACC[ChIn].Cnt);
+    		PLC_AI_ACC[ChIn].Sum  = 0;
+    		PLC_AI_ACC[ChIn].Cnt  = 0;
+    	}
+    	Res = PLC_AI_ACC[ChIn].Code;
+    	Max = (uint16_t)(PLC_AI_DIG_MAX << PLC_AI_OVS[ChIn].Bits);
+
+    	__set_PRIMASK(Prim);
     }
 
-    return ((Res <= PLC_AI_DIG_MAX) ? Res : PLC_AI_DIG_MAX);
+    return ((Res <= Max) ? Res : Max);
 }
 
 /** @brief  Get analog value of AI-channel.
@@ -251,7 +891,8 @@ float PlcAI_GetAna(uint8_t ChIn)
     if(ChIn < PLC_AI_SZ)
     {
         uint16_t Code = PlcAI_GetCode(ChIn);
-        Res = ScaleA((float)Code, PLC_AI_KA_3V3, PLC_AI_KB_3V3);
+        //oversampling: 4095*2^n is full scale
+        Res = ScaleA((float)Code, PLC_AI_KA_3V3/(float)((uint32_t)1 << PLC_AI_OVS[ChIn].Bits), PLC_AI_KB_3V3);
 
 #ifdef DEBUG_LOG_ADC
         DebugLog("ADC: Ch=%d Code=%d Ana=%f\n", ChIn, Code, Res);
@@ -260,3 +901,21 @@ float PlcAI_GetAna(uint8_t ChIn)
 
     return (Res);
 }
+
+/** @brief  Get analog value of AI-channel (fixed point).
+ *  @param  ChIn - channel number.
+ *  @return Analog value (V, Q16):
+ *  @arg    = PLC_AI_ANA_MIN ... PLC_AI_ANA_MAX
+ */
+int32_t PlcAI_GetAnaQ(uint8_t ChIn)
+{
+    int32_t Res = 0;
+
+    if(ChIn < PLC_AI_SZ)
+    {
+        //oversampling: 4095*2^n is full scale, Q32*2^n > Q16
+        Res = PLC_AI_CODE_TO_ANA_Q(PlcAI_GetCode(ChIn), PLC_AI_OVS[ChIn].Bits);
+    }
+
+    return (Res);
+}
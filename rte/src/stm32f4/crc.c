@@ -0,0 +1,56 @@
+/* @page crc.c
+ *       PLC411::RTE
+ *       CRC calculation unit driver
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "crc.h"
+
+
+/** @brief  Init. (enable clock of CRC unit).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcCrc_Init(void)
+{
+	__HAL_RCC_CRC_CLK_ENABLE();
+
+	PlcCrc_Reset();
+}
+
+/** @brief  Reset CRC (start of calculation).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcCrc_Reset(void)
+{
+	CRC->CR = CRC_CR_RESET;
+}
+
+/** @brief  Put data into calculation.
+ *  @param  DataIn - pointer to data (32-bit words).
+ *  @param  SzIn   - size of data (number of words).
+ *  @return CRC of data put since PlcCrc_Reset().
+ */
+uint32_t PlcCrc_Put(const uint32_t *DataIn, uint32_t SzIn)
+{
+	while(SzIn--)
+	{
+		CRC->DR = *DataIn++;
+	}
+
+	return (CRC->DR);
+}
+
+/** @brief  Calculate CRC.
+ *  @param  DataIn - pointer to data (32-bit words).
+ *  @param  SzIn   - size of data (number of words).
+ *  @return CRC of data.
+ */
+uint32_t PlcCrc_Calc(const uint32_t *DataIn, uint32_t SzIn)
+{
+	PlcCrc_Reset();
+
+	return (PlcCrc_Put(DataIn, SzIn));
+}
@@ -8,41 +8,131 @@
 #include "di.h"
 
 
-/** @var DI Callback user-functions
+/** @def Number of EXTI lines connected to GPIO
  */
-PLC_DI_UserFunc_t PLC_DI00_USER_FUNC;
-PLC_DI_UserFunc_t PLC_DI01_USER_FUNC;
+#define PLC_DI_EXTI_LINES_SZ                     16
+
+/** @def EXTI line is not used by DI
+ */
+#define PLC_DI_EXTI_CH_NONE                      (uint8_t)0xFF
+
+
+/** @var DI-channel GPIO references (index = channel number)
+ */
+const PlcDI_Pin_t PLC_DI_PINS[PLC_DI_SZ] =
+{
+	{ PLC_DI_00__PORT, PLC_DI_00__PIN },
+	{ PLC_DI_01__PORT, PLC_DI_01__PIN },
+};
+
+_Static_assert(PLC_DI_PINS_OR == PLC_DI_PINS_SUM, "EXTI line is shared by DI-channels (pin number must be unique)");
+
+/** @var DI Callback user-functions (common for all channels)
+ */
+PLC_DI_UserFunc_t PLC_DI_USER_FUNC;
+
+/** @var EXTI line -> channel number
+ */
+static uint8_t PLC_DI_EXTI_CH[PLC_DI_EXTI_LINES_SZ];
+
+/** @var EXTI lines used by DI
+ */
+static uint32_t PLC_DI_EXTI_MASK = 0;
+
+
+/** @brief  Get EXTI line number by GPIO pin.
+ *  @param  PinIn - GPIO pin (single).
+ *  @return EXTI line number.
+ */
+static uint32_t PlcDI_ExtiLine(uint16_t PinIn)
+{
+	return (__CLZ(__RBIT((uint32_t)PinIn)));
+}
+
+/** @brief  Get IRQ number by EXTI line number.
+ *  @param  LineIn - EXTI line number.
+ *  @return IRQ number.
+ */
+static IRQn_Type PlcDI_ExtiIRQn(uint32_t LineIn)
+{
+	if(LineIn < 5)  return ((IRQn_Type)(EXTI0_IRQn+LineIn));
+	if(LineIn < 10) return (EXTI9_5_IRQn);
+	return (EXTI15_10_IRQn);
+}
+
+/** @brief  Enable clock of GPIO port.
+ *  @param  PortIn - GPIO port.
+ *  @return None.
+ */
+static void PlcDI_EnableClock(GPIO_TypeDef *PortIn)
+{
+	if(PortIn == GPIOA) __HAL_RCC_GPIOA_CLK_ENABLE();
+	if(PortIn == GPIOB) __HAL_RCC_GPIOB_CLK_ENABLE();
+	if(PortIn == GPIOC) __HAL_RCC_GPIOC_CLK_ENABLE();
+#ifdef GPIOD
+	if(PortIn == GPIOD) __HAL_RCC_GPIOD_CLK_ENABLE();
+#endif // GPIOD
+#ifdef GPIOE
+	if(PortIn == GPIOE) __HAL_RCC_GPIOE_CLK_ENABLE();
+#endif // GPIOE
+	if(PortIn == GPIOH) __HAL_RCC_GPIOH_CLK_ENABLE();
+}
 
 
 /** @brief  Init. DI.
  *  @param  None.
- *  @return None.
+ *  @return Result:
+ *  @arg    = 0 - PLC_DI_PINS is invalid (pin is not single or EXTI line is shared by channels), nothing is initialized
+ *  @arg    = 1 - OK
  */
-void PlcDI_Init(void)
+uint8_t PlcDI_Init(void)
 {
 	GPIO_InitTypeDef GpioDef;
+	uint32_t Line;
+	uint32_t Mask = 0;
+
+	for(Line=0; Line<PLC_DI_EXTI_LINES_SZ; Line++)
+	{
+		PLC_DI_EXTI_CH[Line] = PLC_DI_EXTI_CH_NONE;
+	}
+	PLC_DI_EXTI_MASK = 0;
 
-	//Enable clock
-	__HAL_RCC_GPIOA_CLK_ENABLE();
-	__HAL_RCC_GPIOB_CLK_ENABLE();
-
-	//GPIO Init.
-	GpioDef.Pin  = PLC_DI_00__PIN;
-	GpioDef.Mode = GPIO_MODE_IT_RISING_FALLING;
-	GpioDef.Pull = GPIO_PULLDOWN;
-	HAL_GPIO_Init(PLC_DI_00__PORT, &GpioDef);
-
-	GpioDef.Pin  = PLC_DI_01__PIN;
-	GpioDef.Mode = GPIO_MODE_IT_RISING_FALLING;
-	GpioDef.Pull = GPIO_PULLDOWN;
-	HAL_GPIO_Init(PLC_DI_01__PORT, &GpioDef);
-
-	//IRQ Init.
-    // EXTI
-    HAL_NVIC_SetPriority(EXTI9_5_IRQn, PLC_NVIC_PPRIO_DI_EXTI, PLC_NVIC_SPRIO_DI_EXTI);
-    HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
-    HAL_NVIC_SetPriority(EXTI15_10_IRQn, PLC_NVIC_PPRIO_DI_EXTI, PLC_NVIC_SPRIO_DI_EXTI);
-    HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
+	//check the table before any GPIO is touched
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		if(PLC_DI_PINS[i].Port == NULL || !PLC_DI_PINS[i].Pin) continue;
+
+		//pin is not single or EXTI line is already used by other channel
+		if((PLC_DI_PINS[i].Pin & (PLC_DI_PINS[i].Pin-1)) || (Mask & PLC_DI_PINS[i].Pin)) return (BIT_FALSE);
+
+		Mask |= PLC_DI_PINS[i].Pin;
+	}
+
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		if(PLC_DI_PINS[i].Port == NULL || !PLC_DI_PINS[i].Pin) continue;
+
+		Line = PlcDI_ExtiLine(PLC_DI_PINS[i].Pin);
+
+		PLC_DI_EXTI_CH[Line] = i;
+		PLC_DI_EXTI_MASK    |= ((uint32_t)1 << Line);
+
+		//Enable clock
+		PlcDI_EnableClock(PLC_DI_PINS[i].Port);
+
+		//GPIO Init.
+		GpioDef.Pin  = PLC_DI_PINS[i].Pin;
+		GpioDef.Mode = GPIO_MODE_IT_RISING_FALLING;
+		GpioDef.Pull = GPIO_PULLDOWN;
+		HAL_GPIO_Init(PLC_DI_PINS[i].Port, &GpioDef);
+
+		//IRQ Init.
+	    // EXTI
+	    HAL_NVIC_SetPriority(PlcDI_ExtiIRQn(Line), PLC_NVIC_PPRIO_DI_EXTI, PLC_NVIC_SPRIO_DI_EXTI);
+	    HAL_NVIC_EnableIRQ(PlcDI_ExtiIRQn(Line));
+	}
+
+	return (BIT_TRUE);
 }
 
 /** @brief  DeInit. DI.
@@ -51,13 +141,22 @@ void PlcDI_Init(void)
  */
 void PlcDI_DeInit(void)
 {
-	//Disable IRQ
-	HAL_NVIC_DisableIRQ(EXTI9_5_IRQn);
-	HAL_NVIC_DisableIRQ(EXTI15_10_IRQn);
+	uint32_t Line;
+
+	for(Line=0; Line<PLC_DI_EXTI_LINES_SZ; Line++)
+	{
+		if(PLC_DI_EXTI_CH[Line] != PLC_DI_EXTI_CH_NONE)
+		{
+			//Disable IRQ (lines 5-9 and 10-15 share IRQs, they are disabled several times)
+			HAL_NVIC_DisableIRQ(PlcDI_ExtiIRQn(Line));
 
-	//GPIO DeInit
-	HAL_GPIO_DeInit(PLC_DI_00__PORT, PLC_DI_00__PIN);
-	HAL_GPIO_DeInit(PLC_DI_01__PORT, PLC_DI_01__PIN);
+			//GPIO DeInit
+			HAL_GPIO_DeInit(PLC_DI_PINS[PLC_DI_EXTI_CH[Line]].Port, PLC_DI_PINS[PLC_DI_EXTI_CH[Line]].Pin);
+
+			PLC_DI_EXTI_CH[Line] = PLC_DI_EXTI_CH_NONE;
+		}
+	}
+	PLC_DI_EXTI_MASK = 0;
 }
 
 
@@ -67,61 +166,142 @@ void PlcDI_DeInit(void)
  */
 uint8_t PlcDI_ReadNormVal(uint8_t ChIn)
 {
-	switch(ChIn)
+	if(ChIn < PLC_DI_SZ && PLC_DI_PINS[ChIn].Port != NULL)
 	{
-		case PLC_DI_00:
-			return (PlcGpio_DI_Get(PLC_DI_00__PORT, PLC_DI_00__PIN, PLC_GPIO_DI_NORM));
-		case PLC_DI_01:
-			return (PlcGpio_DI_Get(PLC_DI_01__PORT, PLC_DI_01__PIN, PLC_GPIO_DI_NORM));
+		return (PlcGpio_DI_Get(PLC_DI_PINS[ChIn].Port, PLC_DI_PINS[ChIn].Pin, PLC_GPIO_DI_NORM));
 	}
 
 	return (BIT_FALSE);
 }
 
+/** @brief  Read normal values of all channels at once.
+ *  @param  None.
+ *  @return Normal values (bit per channel).
+ *  @note   Every GPIO port is read once (IDR), all ports are read back-to-back.
+ */
+uint32_t PlcDI_ReadAll(void)
+{
+	uint32_t Idr[PLC_DI_SZ];
+	uint32_t Prim;
+	uint32_t Res = 0;
+	uint8_t  i, j;
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
 
-/** @brief  EXTI9-5 IRQ Handler.
+	for(i=0; i<PLC_DI_SZ; i++)
+	{
+		Idr[i] = 0;
+		if(PLC_DI_PINS[i].Port == NULL) continue;
+
+		//port is already read by other channel
+		for(j=0; j<i; j++)
+		{
+			if(PLC_DI_PINS[j].Port == PLC_DI_PINS[i].Port) break;
+		}
+		Idr[i] = ((j < i) ? Idr[j] : PLC_DI_PINS[i].Port->IDR);
+	}
+
+	__set_PRIMASK(Prim);
+
+	for(i=0; i<PLC_DI_SZ; i++)
+	{
+		if(Idr[i] & PLC_DI_PINS[i].Pin) Res |= ((uint32_t)1 << i);
+	}
+
+	return (Res);
+}
+
+
+/** @brief  EXTI dispatcher.
  *  @param  None.
  *  @return None.
+ *  @note   All pending DI-lines are cleared and decoded in one pass,
+ *          the cost per edge does not depend on quantity of channels.
  */
-void EXTI9_5_IRQHandler(void)
+static void PlcDI_ExtiDispatch(void)
 {
-	HAL_GPIO_EXTI_IRQHandler(PLC_DI_00__PIN);
+	PlcDI_IRQ_Q_t Data;
+	uint32_t Pending = (EXTI->PR & PLC_DI_EXTI_MASK);
+	uint32_t Line;
+
+	//clear pending lines (write 1)
+	EXTI->PR = Pending;
+
+	while(Pending)
+	{
+		Line     = PlcDI_ExtiLine((uint16_t)(Pending & (~Pending+1)));
+		Pending &= (Pending-1);
+
+		if(PLC_DI_USER_FUNC.Exti != NULL)
+		{
+			Data.Ch  = PLC_DI_EXTI_CH[Line];
+			Data.Val = PlcGpio_DI_Get(PLC_DI_PINS[Data.Ch].Port, PLC_DI_PINS[Data.Ch].Pin, PLC_GPIO_DI_NORM);
+			PLC_DI_USER_FUNC.Exti(Data);
+		}
+	}
 }
 
-/** @brief  EXTI15-10 IRQ Handler.
+
+/** @brief  EXTI0 IRQ Handler.
  *  @param  None.
  *  @return None.
  */
-void EXTI15_10_IRQHandler(void)
+void EXTI0_IRQHandler(void)
 {
-	HAL_GPIO_EXTI_IRQHandler(PLC_DI_01__PIN);
+	PlcDI_ExtiDispatch();
 }
 
+/** @brief  EXTI1 IRQ Handler.
+ *  @param  None.
+ *  @return None.
+ */
+void EXTI1_IRQHandler(void)
+{
+	PlcDI_ExtiDispatch();
+}
 
-/** @brief  EXTI line detection callbacks.
-  * @param  PinIn - specifies the pins connected EXTI line.
-  * @return None.
-  */
-void HAL_GPIO_EXTI_Callback(uint16_t PinIn)
+/** @brief  EXTI2 IRQ Handler.
+ *  @param  None.
+ *  @return None.
+ */
+void EXTI2_IRQHandler(void)
 {
-	PlcDI_IRQ_Q_t Data;
+	PlcDI_ExtiDispatch();
+}
 
-	if(PinIn == PLC_DI_00__PIN)
-	{
-		if(PLC_DI00_USER_FUNC.Exti != NULL)
-		{
-			Data.Ch  = PLC_DI_00;
-			Data.Val = PlcDI_ReadNormVal(Data.Ch);
-			PLC_DI00_USER_FUNC.Exti(Data);
-		}
-	}
-	else if(PinIn == PLC_DI_01__PIN)
-	{
-		if(PLC_DI01_USER_FUNC.Exti != NULL)
-		{
-			Data.Ch  = PLC_DI_01;
-			Data.Val = PlcDI_ReadNormVal(Data.Ch);
-			PLC_DI01_USER_FUNC.Exti(Data);
-		}
-	}
+/** @brief  EXTI3 IRQ Handler.
+ *  @param  None.
+ *  @return None.
+ */
+void EXTI3_IRQHandler(void)
+{
+	PlcDI_ExtiDispatch();
+}
+
+/** @brief  EXTI4 IRQ Handler.
+ *  @param  None.
+ *  @return None.
+ */
+void EXTI4_IRQHandler(void)
+{
+	PlcDI_ExtiDispatch();
+}
+
+/** @brief  EXTI9-5 IRQ Handler.
+ *  @param  None.
+ *  @return None.
+ */
+void EXTI9_5_IRQHandler(void)
+{
+	PlcDI_ExtiDispatch();
+}
+
+/** @brief  EXTI15-10 IRQ Handler.
+ *  @param  None.
+ *  @return None.
+ */
+void EXTI15_10_IRQHandler(void)
+{
+	PlcDI_ExtiDispatch();
 }
@@ -8,8 +8,195 @@
 #include "do.h"
 
 
-uint8_t PLC_DO_POSTPONED = BIT_FALSE;
+/** @var DO Callback user-functions
+ */
+PLC_DO_UserFunc_t PLC_DO_USER_FUNC = { .PtoDone = NULL };
+
+
+/** @var TIM limits of PWM planner
+ */
+static const PlcPwmPlan_Tim_t PLC_DO_PWM_TIM = PLC_DO_PWM_PLAN_TIM;
+
+/** @var Output image (build by scan, ready to apply)
+ */
+static PlcDO_Img_t PLC_DO_IMG_BUILD;
+static PlcDO_Img_t PLC_DO_IMG_READY;
+
+/** @var Output image: values expected at output (committed by scan or synchronized by DO_T),
+ *       masks - value is known
+ */
+static PlcDO_Img_t PLC_DO_IMG_LAST;
+
+/** @var Forced outputs: owners of channel, levels of owners (bit per owner, PLC_DO_FORCE_...)
+ */
+static volatile uint8_t PLC_DO_FORCE_OWN[PLC_DO_SZ];
+static volatile uint8_t PLC_DO_FORCE_LVL[PLC_DO_SZ];
+
+
+/** @typedef PTO state of channel
+ */
+typedef struct PlcDO_Pto_t_
+{
+	//@var Profile
+	PlcPto_Prof_t Prof;
+
+	//@var Next segment
+	uint16_t Seg;
+
+	//@var Pulses left to repeat the last step of previous segment
+	uint32_t RepLeft;
+
+	//@var Pulse train is running
+	volatile uint8_t Busy;
 
+	//@var Channel number
+	uint8_t Ch;
+
+	//@var TIM Handler
+	TIM_HandleTypeDef *Tim;
+
+	//@var TIM.UP.DMA Handler
+	DMA_HandleTypeDef *Dma;
+
+} PlcDO_Pto_t;
+
+/** @var PTO states
+ */
+static PlcDO_Pto_t PLC_DO_PTO[PLC_DO_SZ];
+
+
+/** @brief  Start DMA-transfer into TIM (by update event).
+ *  @param  PtoIn - PTO state.
+ *  @param  SrcIn - source (steps).
+ *  @param  LenIn - quantity of words.
+ *  @param  BurstIn - quantity of registers per update event:
+ *  @arg    = 1 - ARR only (memory is not incremented, step is repeated)
+ *  @arg    = 4 - ARR, RCR, CCR1, CCR2 (next step per update event)
+ *  @return None.
+ */
+static void PlcDO_PtoDma(PlcDO_Pto_t *PtoIn, const uint32_t *SrcIn, uint32_t LenIn, uint8_t BurstIn)
+{
+	MODIFY_REG(PtoIn->Dma->Instance->CR, DMA_SxCR_MINC, ((BurstIn > 1) ? DMA_MINC_ENABLE : DMA_MINC_DISABLE));
+	PlcTim_SetUpdateBurst(PtoIn->Tim, BurstIn);
+	HAL_DMA_Start_IT(PtoIn->Dma, (uint32_t)SrcIn, (uint32_t)&PtoIn->Tim->Instance->DMAR, LenIn);
+}
+
+/** @brief  Start next part of pulse train.
+ *  @param  PtoIn - PTO state.
+ *  @return None.
+ *  @note   Called at start and from DMA.TC ISR.
+ */
+static void PlcDO_PtoNext(PlcDO_Pto_t *PtoIn)
+{
+	const PlcPto_Seg_t *Seg;
+	uint32_t Len;
+
+	if(!PtoIn->Busy) return;
+
+	if(PtoIn->RepLeft)
+	{
+		//repeat the last step of previous segment (ARR only)
+		Seg = &PtoIn->Prof.Segs[PtoIn->Seg-1];
+		Len = ((PtoIn->RepLeft > 0xFFFF) ? 0xFFFF : PtoIn->RepLeft);
+		PtoIn->RepLeft -= Len;
+		PlcDO_PtoDma(PtoIn, &PtoIn->Prof.Steps[Seg->First+Seg->Qty-1].Arr, Len, 1);
+	}
+	else if(PtoIn->Seg < PtoIn->Prof.SegsQty)
+	{
+		//steps of segment (one step per pulse)
+		Seg = &PtoIn->Prof.Segs[PtoIn->Seg++];
+		PtoIn->RepLeft = Seg->Rep;
+		PlcDO_PtoDma(PtoIn, &PtoIn->Prof.Steps[Seg->First].Arr, ((uint32_t)Seg->Qty*4), 4);
+	}
+	else
+	{
+		//terminal step is loaded
+		PlcTim_SetUpdateBurst(PtoIn->Tim, 0);
+		PtoIn->Busy = BIT_FALSE;
+
+		if(PLC_DO_USER_FUNC.PtoDone != NULL)
+		{
+			PLC_DO_USER_FUNC.PtoDone(PtoIn->Ch);
+		}
+	}
+}
+
+/** @brief  DMA transfer complete callback (TIM.UP).
+ *  @param  DmaIn - DMA Handler.
+ *  @return None.
+ */
+static void PlcDO_PtoDmaCplt(DMA_HandleTypeDef *DmaIn)
+{
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		if(PLC_DO_PTO[i].Dma == DmaIn)
+		{
+			PlcDO_PtoNext(&PLC_DO_PTO[i]);
+			break;
+		}
+	}
+}
+
+/** @brief  DMA error callback (TIM.UP).
+ *  @param  DmaIn - DMA Handler.
+ *  @return None.
+ *  @note   Pulse train is finished by terminal step.
+ */
+static void PlcDO_PtoDmaError(DMA_HandleTypeDef *DmaIn)
+{
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		if(PLC_DO_PTO[i].Dma == DmaIn && PLC_DO_PTO[i].Busy)
+		{
+			PLC_DO_PTO[i].Seg     = PLC_DO_PTO[i].Prof.SegsQty;
+			PLC_DO_PTO[i].RepLeft = 0;
+			PlcTim_SetChannelPulse(PLC_DO_PTO[i].Tim, ((PLC_DO_PTO[i].Tim == &PLC_TIM2) ? PLC_TIM2_DO_CH : PLC_TIM5_DO_CH), 0);
+			PlcDO_PtoNext(&PLC_DO_PTO[i]);
+			break;
+		}
+	}
+}
+
+
+/** @brief  Apply forced output level of DO-channel by its owners.
+ *  @param  ChIn - channel number.
+ *  @return None.
+ *  @note   Called with masked IRQ.
+ */
+static void PlcDO_ApplyForce(uint8_t ChIn)
+{
+	TIM_HandleTypeDef *Tim;
+	uint32_t TimCh;
+	uint8_t  Own = PLC_DO_FORCE_OWN[ChIn];
+	uint8_t  Top;
+
+	switch(ChIn)
+	{
+		case PLC_DO_00:
+			Tim   = &PLC_TIM2;
+			TimCh = PLC_TIM2_DO_CH;
+			break;
+
+		case PLC_DO_01:
+			Tim   = &PLC_TIM5;
+			TimCh = PLC_TIM5_DO_CH;
+			break;
+
+		default:
+			return;
+	}
+
+	if(!Own)
+	{
+		PlcTim_ReleaseChannelOutput(Tim, TimCh);
+		return;
+	}
+
+	//owner of the highest priority
+	for(Top=PLC_DO_FORCE_TOP; Top && !(Own & Top); Top >>= 1);
+
+	PlcTim_ForceChannelOutput(Tim, TimCh, ((PLC_DO_FORCE_LVL[ChIn] & Top) ? BIT_TRUE : BIT_FALSE));
+}
 
 /** @brief  Init. DO.
  *  @param  DOIn - channel.
@@ -40,6 +227,7 @@ void PlcDO_Init(PlcDO_t *DOIn)
 				DOIn->Pin         = GPIO_PIN_0;
 				DOIn->Tim         = &PLC_TIM2;
 				DOIn->TimCh       = PLC_TIM2_DO_CH;
+				PLC_DO_PTO[DOIn->Ch].Dma = &PLC_TIM2_UP_DMA;
 				break;
 
 			case PLC_DO_01:
@@ -50,9 +238,35 @@ void PlcDO_Init(PlcDO_t *DOIn)
 				DOIn->Pin         = GPIO_PIN_1;
 				DOIn->Tim         = &PLC_TIM5;
 				DOIn->TimCh       = PLC_TIM5_DO_CH;
+				PLC_DO_PTO[DOIn->Ch].Dma = &PLC_TIM5_UP_DMA;
 				break;
 		}
 
+		//PTO
+		if(DOIn->Ch < PLC_DO_SZ && PLC_DO_PTO[DOIn->Ch].Dma != NULL)
+		{
+			PLC_DO_PTO[DOIn->Ch].Ch      = DOIn->Ch;
+			PLC_DO_PTO[DOIn->Ch].Tim     = DOIn->Tim;
+			PLC_DO_PTO[DOIn->Ch].Busy    = BIT_FALSE;
+			PLC_DO_PTO[DOIn->Ch].Dma->XferCpltCallback  = PlcDO_PtoDmaCplt;
+			PLC_DO_PTO[DOIn->Ch].Dma->XferErrorCallback = PlcDO_PtoDmaError;
+		}
+
+		//PWM: period and pulse are applied by update event
+		if(DOIn->Tim != NULL)
+		{
+			PlcTim_SetPreload(DOIn->Tim, DOIn->TimCh, BIT_TRUE);
+		}
+
+		//forced level is kept over re-init. of TIM (owners are not changed)
+		if(DOIn->Ch < PLC_DO_SZ && PLC_DO_FORCE_OWN[DOIn->Ch])
+		{
+			uint32_t Prim = __get_PRIMASK();
+			__disable_irq();
+			PlcDO_ApplyForce(DOIn->Ch);
+			__set_PRIMASK(Prim);
+		}
+
 		//GPIO Init
 		HAL_GPIO_Init(GPIOA, &GpioDef);
 	}
@@ -66,6 +280,7 @@ void PlcDO_DeInit(PlcDO_t *DOIn)
 {
 	if(DOIn)
 	{
+		PlcDO_PtoStop(DOIn);
 		PlcDO_Stop(DOIn);
 		//GPIO DeInit
 		HAL_GPIO_DeInit(DOIn->Port, DOIn->Pin);
@@ -97,31 +312,78 @@ inline void PlcDO_Stop(PlcDO_t *DOIn)
 	}
 }
 
-/** @brief  Convert Period (ms) into 32-bit register value (ARR).
- *  @param  PeriodIn - period (ms).
- *  @return 32-bit register value (ARR).
+/** @brief  Recalculate scale factors (Ka, Kb) by period (ARR).
+ *  @param  DOIn - channel.
+ *  @return None.
  */
-static uint32_t PlcDO_ConvPeriodMsToArr(float PeriodIn)
+static void PlcDO_CalcK(PlcDO_t *DOIn)
 {
-	return ((uint32_t)(PeriodIn/PLC_TIM2_MS));
+	uint32_t Ticks = DOIn->Arr+1;
+
+	DOIn->Ka = Ticks/PLC_DO_PWM_D__FULL;
+	DOIn->Kb = (uint32_t)(((uint64_t)(Ticks%PLC_DO_PWM_D__FULL) << 16)/PLC_DO_PWM_D__FULL);
 }
 
-/** @brief  Convert Pulse (%) into 32-bit register value (CCR).
- *  @param  PulseIn - pulse (%).
- *  @param  KaIn - scale factor.
- *  @param  KbIn - scale factor.
+/** @brief  Convert Duty (0.01 %) into 32-bit register value (CCR).
+ *  @param  DOIn - channel (scale factors).
+ *  @param  DutyIn - pulse (0.01 %).
  *  @return 32-bit register value (CCR).
+ *  @note   100 % gives CCR = ARR+1 (output is not dropped for the last tick).
+ */
+static uint32_t PlcDO_ConvDutyToCcr(const PlcDO_t *DOIn, uint32_t DutyIn)
+{
+	if(DutyIn >= PLC_DO_PWM_D__FULL) return (DOIn->Arr+1);
+	return (DutyIn*DOIn->Ka + ((DutyIn*DOIn->Kb) >> 16));
+}
+
+/** @brief  Plan prescaler and period of TIM.PWM by frequency or period.
+ *  @param  DOIn - channel (PwmRes - requested resolution).
+ *  @param  UnitIn - unit of request:
+ *  @arg    = PLC_PWM_PLAN_UNIT_HZ - frequency (Hz)
+ *  @arg    = PLC_PWM_PLAN_UNIT_NS - period (ns)
+ *  @param  ValIn - frequency (Hz) or period (ns).
+ *  @return Result code (PLC_PWM_PLAN_...).
+ *  @note   Pulse is recalculated for the new period (the same fill factor),
+ *          PSC, ARR and CCR are applied by the next update event.
+ *          TIM is not changed while pulse train is running (restored by PlcDO_PtoStop()).
  */
-static uint32_t PlcDO_ConvPulsePercToCcr(float PulseIn, float KaIn, float KbIn)
+uint8_t PlcDO_SetPlan(PlcDO_t *DOIn, uint8_t UnitIn, uint64_t ValIn)
 {
-	return ((uint32_t)ScaleA(PulseIn, KaIn, KbIn));
+	PlcPwmPlan_t Plan;
+	uint8_t      Res;
+
+	if(!DOIn) return (PLC_PWM_PLAN_ERR_ARG);
+
+	Res = PlcPwmPlan_Calc(&PLC_DO_PWM_TIM, UnitIn, ValIn, DOIn->PwmRes, &Plan);
+	if(Res == PLC_PWM_PLAN_ERR_ARG) return (Res);
+
+	DOIn->Psc     = Plan.Psc;
+	DOIn->Arr     = Plan.Arr;
+	DOIn->PwmPlan = Res;
+
+	//achieved values
+	DOIn->PwmT       = (float)PlcPwmPlan_PeriodNs(&PLC_DO_PWM_TIM, &Plan)/1000000.0f;
+	DOIn->PwmFreqAct = (uint32_t)PlcPwmPlan_FreqMilliHz(&PLC_DO_PWM_TIM, &Plan);
+	DOIn->PwmResAct  = Plan.Arr+1;
+
+	//recalculate scale factors and CCR
+	PlcDO_CalcK(DOIn);
+	DOIn->Ccr = PlcDO_ConvDutyToCcr(DOIn, DOIn->Duty);
+
+	if(DOIn->Ch >= PLC_DO_SZ || !PLC_DO_PTO[DOIn->Ch].Busy)
+	{
+		PlcTim_SetChannelPwm(DOIn->Tim, DOIn->TimCh, DOIn->Psc, DOIn->Arr, DOIn->Ccr);
+	}
+
+	return (Res);
 }
 
 /** @brief  Set new period value into TIM.PWM.
  *  @param  DOIn - channel.
  *  @param  PeriodIn - new period value (ms):
  *  @arg    = PLC_DO_PWM_T__MIN ... PLC_DO_PWM_T__MAX
- *  @return New period value (ms).
+ *  @return Achieved period value (ms).
+ *  @note   Period is converted into ns and planned by PlcDO_SetPlan().
  */
 float PlcDO_SetPeriod(PlcDO_t *DOIn, float PeriodIn)
 {
@@ -138,26 +400,21 @@ float PlcDO_SetPeriod(PlcDO_t *DOIn, float PeriodIn)
 
 	if(DOIn)
 	{
-		//recalculate ARR
-		DOIn->Arr = PlcDO_ConvPeriodMsToArr(Period);
-
-		//recalculate scale factors
-		DOIn->Ka = ScaleA_Ka(0.0, DOIn->Arr, PLC_DO_PWM_D__MIN, PLC_DO_PWM_D__MAX);
-		DOIn->Kb = ScaleA_Kb(0.0, DOIn->Arr, PLC_DO_PWM_D__MIN, PLC_DO_PWM_D__MAX);
-
-		PlcTim_SetChannelPeriod(DOIn->Tim, DOIn->Arr);
+		PlcDO_SetPlan(DOIn, PLC_PWM_PLAN_UNIT_NS, (uint64_t)((double)Period*1000000.0+0.5));
+		Period = DOIn->PwmT;
 	}
 
 	return (Period);
 }
 
-/** @brief  Set new pulse value (fill factor) into TIM.PWM.
+/** @brief  Calculate pulse value (CCR) without writing into TIM.PWM.
  *  @param  DOIn - channel.
  *  @param  PulseIn - new pulse value (%):
  *  @arg    = PLC_DO_PWM_D__MIN ... PLC_DO_PWM_D__MAX
  *  @return New pulse value (%).
+ *  @note   TIM is not changed (see PlcDO_Write()).
  */
-float PlcDO_SetPulse(PlcDO_t *DOIn, float PulseIn)
+float PlcDO_CalcPulse(PlcDO_t *DOIn, float PulseIn)
 {
 	float Pulse = PulseIn;
 
@@ -173,7 +430,26 @@ float PlcDO_SetPulse(PlcDO_t *DOIn, float PulseIn)
 	if(DOIn)
 	{
 		//recalculate CCR
-		DOIn->Ccr = PlcDO_ConvPulsePercToCcr(Pulse, DOIn->Ka, DOIn->Kb);
+		DOIn->Duty = (uint32_t)(Pulse*(float)PLC_DO_PWM_D__SCALE+0.5f);
+		DOIn->Ccr  = PlcDO_ConvDutyToCcr(DOIn, DOIn->Duty);
+	}
+
+	return (Pulse);
+}
+
+/** @brief  Set new pulse value into TIM.PWM.
+ *  @param  DOIn - channel.
+ *  @param  PulseIn - new pulse value (%):
+ *  @arg    = PLC_DO_PWM_D__MIN ... PLC_DO_PWM_D__MAX
+ *  @return New pulse value (%).
+ *  @note   Applied by the next update event (the current period is finished).
+ */
+float PlcDO_SetPulse(PlcDO_t *DOIn, float PulseIn)
+{
+	float Pulse = PlcDO_CalcPulse(DOIn, PulseIn);
+
+	if(DOIn)
+	{
 		PlcTim_SetChannelPulse(DOIn->Tim, DOIn->TimCh, DOIn->Ccr);
 	}
 
@@ -186,6 +462,7 @@ float PlcDO_SetPulse(PlcDO_t *DOIn, float PulseIn)
  *  @arg    = 0 - low output level
  *  @arg    = 1 - high output level
  *  @return None.
+ *  @note   Applied immediately (update event is generated).
  */
 void PlcDO_SetNormVal(PlcDO_t *DOIn, uint8_t ValIn)
 {
@@ -197,4 +474,385 @@ void PlcDO_SetNormVal(PlcDO_t *DOIn, uint8_t ValIn)
 	{
 		PlcDO_SetPulse(DOIn, PLC_DO_PWM_D__MAX);
 	}
+
+	if(DOIn)
+	{
+		PlcTim_GenUpdate(DOIn->Tim);
+	}
+}
+
+
+/** @brief  Init. output image.
+ *  @param  None.
+ *  @return None.
+ *  @note   DWT cycle counter is enabled (latency of output image).
+ */
+void PlcDO_ImgInit(void)
+{
+	uint32_t Prim = __get_PRIMASK();
+	__disable_irq();
+	PLC_DO_IMG_BUILD.Norm     = 0;
+	PLC_DO_IMG_BUILD.NormMask = 0;
+	PLC_DO_IMG_BUILD.PwmMask  = 0;
+	PLC_DO_IMG_READY.Norm     = 0;
+	PLC_DO_IMG_READY.NormMask = 0;
+	PLC_DO_IMG_READY.PwmMask  = 0;
+	PLC_DO_IMG_LAST.Norm      = 0;
+	PLC_DO_IMG_LAST.NormMask  = 0;
+	PLC_DO_IMG_LAST.PwmMask   = 0;
+	__set_PRIMASK(Prim);
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/** @brief  Set normal value into output image (scan).
+ *  @param  ChIn - channel number.
+ *  @param  ValIn - normal value.
+ *  @return None.
+ *  @note   Image is built by every task of application (preempted by each other).
+ */
+void PlcDO_ImgSetNorm(uint8_t ChIn, uint8_t ValIn)
+{
+	uint32_t Prim;
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		Prim = __get_PRIMASK();
+		__disable_irq();
+		if(ValIn) PLC_DO_IMG_BUILD.Norm |=  ((uint32_t)1 << ChIn);
+		else      PLC_DO_IMG_BUILD.Norm &= ~((uint32_t)1 << ChIn);
+		PLC_DO_IMG_BUILD.NormMask |= ((uint32_t)1 << ChIn);
+		__set_PRIMASK(Prim);
+	}
+}
+
+/** @brief  Set PWM fill factor into output image (scan).
+ *  @param  ChIn - channel number.
+ *  @param  PulseIn - fill factor (%).
+ *  @return None.
+ *  @note   Fill factor is limited as by PlcDO_CalcPulse().
+ */
+void PlcDO_ImgSetPwm(uint8_t ChIn, float PulseIn)
+{
+	uint32_t Prim;
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		if(PulseIn < PLC_DO_PWM_D__MIN)      PulseIn = PLC_DO_PWM_D__MIN;
+		else if(PulseIn > PLC_DO_PWM_D__MAX) PulseIn = PLC_DO_PWM_D__MAX;
+
+		Prim = __get_PRIMASK();
+		__disable_irq();
+		PLC_DO_IMG_BUILD.Pwm[ChIn] = PulseIn;
+		PLC_DO_IMG_BUILD.PwmMask  |= ((uint32_t)1 << ChIn);
+		__set_PRIMASK(Prim);
+	}
+}
+
+/** @brief  Commit output image (end of scan).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - image is empty (no changes)
+ *  @arg    = 1 - image is ready to apply
+ *  @note   Only values that differ from the expected ones (PLC_DO_IMG_LAST) are committed,
+ *          image is merged with the previous one if it is not applied yet.
+ */
+uint8_t PlcDO_ImgCommit(void)
+{
+	uint32_t Prim;
+	uint32_t NormMask;
+	uint32_t PwmMask = 0;
+	uint32_t Bit;
+	uint8_t  Res;
+
+	if(!PLC_DO_IMG_BUILD.NormMask && !PLC_DO_IMG_BUILD.PwmMask) return (BIT_FALSE);
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+
+	//changed values
+	NormMask = (PLC_DO_IMG_BUILD.NormMask & (~PLC_DO_IMG_LAST.NormMask | (PLC_DO_IMG_BUILD.Norm ^ PLC_DO_IMG_LAST.Norm)));
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		Bit = ((uint32_t)1 << i);
+		if((PLC_DO_IMG_BUILD.PwmMask & Bit) && (!(PLC_DO_IMG_LAST.PwmMask & Bit) || PLC_DO_IMG_LAST.Pwm[i] != PLC_DO_IMG_BUILD.Pwm[i]))
+		{
+			PLC_DO_IMG_READY.Pwm[i] = PLC_DO_IMG_BUILD.Pwm[i];
+			PLC_DO_IMG_LAST.Pwm[i]  = PLC_DO_IMG_BUILD.Pwm[i];
+			PwmMask |= Bit;
+		}
+	}
+
+	PLC_DO_IMG_READY.Norm      = ((PLC_DO_IMG_READY.Norm & ~NormMask) | (PLC_DO_IMG_BUILD.Norm & NormMask));
+	PLC_DO_IMG_READY.NormMask |= NormMask;
+	PLC_DO_IMG_READY.PwmMask  |= PwmMask;
+	if(NormMask || PwmMask) PLC_DO_IMG_READY.Stamp = DWT->CYCCNT;
+
+	PLC_DO_IMG_LAST.Norm       = ((PLC_DO_IMG_LAST.Norm & ~NormMask) | (PLC_DO_IMG_BUILD.Norm & NormMask));
+	PLC_DO_IMG_LAST.NormMask  |= NormMask;
+	PLC_DO_IMG_LAST.PwmMask   |= PwmMask;
+
+	PLC_DO_IMG_BUILD.NormMask  = 0;
+	PLC_DO_IMG_BUILD.PwmMask   = 0;
+
+	Res = ((PLC_DO_IMG_READY.NormMask || PLC_DO_IMG_READY.PwmMask) ? BIT_TRUE : BIT_FALSE);
+
+	__set_PRIMASK(Prim);
+
+	return (Res);
+}
+
+/** @brief  Take committed output image.
+ *  @param  ImgOut - pointer to image (result).
+ *  @return Result:
+ *  @arg    = 0 - no image
+ *  @arg    = 1 - image is taken
+ */
+uint8_t PlcDO_ImgTake(PlcDO_Img_t *ImgOut)
+{
+	uint32_t Prim;
+	uint8_t  Res = BIT_FALSE;
+
+	if(ImgOut)
+	{
+		Prim = __get_PRIMASK();
+		__disable_irq();
+
+		if(PLC_DO_IMG_READY.NormMask || PLC_DO_IMG_READY.PwmMask)
+		{
+			*ImgOut = PLC_DO_IMG_READY;
+			PLC_DO_IMG_READY.NormMask = 0;
+			PLC_DO_IMG_READY.PwmMask  = 0;
+			Res = BIT_TRUE;
+		}
+
+		__set_PRIMASK(Prim);
+	}
+
+	return (Res);
+}
+
+/** @brief  Synchronize values expected at output with the values applied by DO_T.
+ *  @param  ChIn - channel number.
+ *  @param  NormIn - normal value of channel.
+ *  @param  PwmIn - PWM fill factor of channel (%).
+ *  @return None.
+ *  @note   Values written not by scan (ModBus, mode change) are taken into account,
+ *          so the next value of scan that differs from them is committed.
+ *          Values of a committed image that is not taken yet are kept.
+ */
+void PlcDO_ImgSync(uint8_t ChIn, uint8_t NormIn, float PwmIn)
+{
+	uint32_t Prim;
+	uint32_t Bit;
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		Bit  = ((uint32_t)1 << ChIn);
+		Prim = __get_PRIMASK();
+		__disable_irq();
+
+		if(!(PLC_DO_IMG_READY.NormMask & Bit))
+		{
+			if(NormIn) PLC_DO_IMG_LAST.Norm |=  Bit;
+			else       PLC_DO_IMG_LAST.Norm &= ~Bit;
+			PLC_DO_IMG_LAST.NormMask |= Bit;
+		}
+		if(!(PLC_DO_IMG_READY.PwmMask & Bit))
+		{
+			PLC_DO_IMG_LAST.Pwm[ChIn] = PwmIn;
+			PLC_DO_IMG_LAST.PwmMask  |= Bit;
+		}
+
+		__set_PRIMASK(Prim);
+	}
+}
+
+/** @brief  Get latency of output image.
+ *  @param  ImgIn - pointer to image.
+ *  @return Time from the end of scan (us).
+ */
+uint32_t PlcDO_ImgLatency(const PlcDO_Img_t *ImgIn)
+{
+	uint32_t Clk = SystemCoreClock/1000000;
+
+	if(!ImgIn || !Clk) return (0);
+
+	return ((DWT->CYCCNT-ImgIn->Stamp)/Clk);
+}
+
+/** @brief  Write pulses (CCR) of channels at once.
+ *  @param  DOIn - channels.
+ *  @param  MaskIn - channels to write (bit per channel).
+ *  @param  ImmMaskIn - channels to apply immediately (normal values).
+ *  @return None.
+ *  @note   CCR are prepared by PlcDO_CalcPulse().
+ *          Other channels (PWM) are applied by their update events.
+ */
+void PlcDO_Write(PlcDO_t *DOIn, uint32_t MaskIn, uint32_t ImmMaskIn)
+{
+	uint32_t Prim;
+
+	if(!DOIn) return;
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		if(MaskIn & ((uint32_t)1 << i))
+		{
+			PlcTim_SetChannelPulse(DOIn[i].Tim, DOIn[i].TimCh, DOIn[i].Ccr);
+		}
+	}
+
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		if(ImmMaskIn & MaskIn & ((uint32_t)1 << i))
+		{
+			PlcTim_GenUpdate(DOIn[i].Tim);
+		}
+	}
+
+	__set_PRIMASK(Prim);
+}
+
+/** @brief  Force output level of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @param  OwnerIn - source of forcing (PLC_DO_FORCE_...).
+ *  @param  ValIn - output level:
+ *  @arg    = 0 - low output level
+ *  @arg    = 1 - high output level
+ *  @return Result:
+ *  @arg    = 0 - level is held by an owner of higher priority (applied after its release)
+ *  @arg    = 1 - level is applied
+ *  @note   The level is held until PlcDO_ReleaseVal() and overrides Norm/Fast/PWM values.
+ *          Safe to call from ISR.
+ */
+uint8_t PlcDO_ForceVal(uint8_t ChIn, uint8_t OwnerIn, uint8_t ValIn)
+{
+	uint32_t Prim;
+	uint8_t  Res;
+
+	if(ChIn >= PLC_DO_SZ || !OwnerIn) return (BIT_FALSE);
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+
+	PLC_DO_FORCE_OWN[ChIn] |= OwnerIn;
+	if(ValIn) PLC_DO_FORCE_LVL[ChIn] |=  OwnerIn;
+	else      PLC_DO_FORCE_LVL[ChIn] &= ~OwnerIn;
+	PlcDO_ApplyForce(ChIn);
+
+	//no owner of higher priority
+	Res = ((PLC_DO_FORCE_OWN[ChIn] & ~((OwnerIn << 1)-1)) ? BIT_FALSE : BIT_TRUE);
+
+	__set_PRIMASK(Prim);
+
+	return (Res);
+}
+
+/** @brief  Release forced output level of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @param  OwnerIn - source of forcing (PLC_DO_FORCE_...).
+ *  @return None.
+ *  @note   Level of the next owner is applied (or Norm/Fast/PWM value if no owner is left).
+ *          Safe to call from ISR.
+ */
+void PlcDO_ReleaseVal(uint8_t ChIn, uint8_t OwnerIn)
+{
+	uint32_t Prim;
+
+	if(ChIn >= PLC_DO_SZ) return;
+
+	Prim = __get_PRIMASK();
+	__disable_irq();
+
+	if(PLC_DO_FORCE_OWN[ChIn] & OwnerIn)
+	{
+		PLC_DO_FORCE_OWN[ChIn] &= ~OwnerIn;
+		PlcDO_ApplyForce(ChIn);
+	}
+
+	__set_PRIMASK(Prim);
+}
+
+/** @brief  Get owners of forced output level of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @return Owners (bit per owner, PLC_DO_FORCE_...), 0 - output is not forced.
+ */
+uint8_t PlcDO_GetForce(uint8_t ChIn)
+{
+	return ((ChIn < PLC_DO_SZ) ? PLC_DO_FORCE_OWN[ChIn] : 0);
+}
+
+/** @brief  Start pulse train (PTO).
+ *  @param  DOIn - channel (PTO settings).
+ *  @return Result code:
+ *  @arg    = PLC_PTO_OK
+ *  @arg    = PLC_PTO_ERR_...
+ *  @note   First pulse is delayed by 2 periods of PLC_TIM2_PERIOD__MIN.
+ *          PLC_DO_USER_FUNC.PtoDone() is called when the last pulse is queued.
+ */
+uint8_t PlcDO_PtoStart(PlcDO_t *DOIn)
+{
+	PlcDO_Pto_t *Pto;
+	PlcPto_Cfg_t Cfg;
+	uint8_t      Res;
+
+	if(!DOIn || DOIn->Ch >= PLC_DO_SZ || PLC_DO_PTO[DOIn->Ch].Dma == NULL) return (PLC_PTO_ERR_ARG);
+
+	Pto = &PLC_DO_PTO[DOIn->Ch];
+	if(Pto->Busy) PlcDO_PtoStop(DOIn);
+
+	Cfg.Pulses    = ((DOIn->PtoPulses > PLC_DO_PTO_PULSES__MAX) ? PLC_DO_PTO_PULSES__MAX : DOIn->PtoPulses);
+	Cfg.FreqStart = DOIn->PtoFreqStart;
+	Cfg.FreqMax   = DOIn->PtoFreqMax;
+	Cfg.Accel     = DOIn->PtoAccel;
+	Cfg.Profile   = DOIn->PtoProfile;
+	Cfg.Ccr       = ((DOIn->TimCh == TIM_CHANNEL_1) ? PLC_PTO_CCR1 : PLC_PTO_CCR2);
+	Cfg.TickHz    = PLC_TIM2_HZ;
+	Cfg.ArrMin    = PLC_TIM2_PERIOD__MIN;
+	Cfg.ArrMax    = PLC_TIM2_PERIOD__MAX;
+
+	Res = PlcPto_Build(&Cfg, &Pto->Prof);
+	if(Res != PLC_PTO_OK) return (Res);
+
+	//lead-in: output is low while DMA loads the first step into preload registers
+	//         PSC of PWM plan is replaced by TIM-tick of PTO (PLC_TIM2_HZ)
+	PlcTim_SetUpdateBurst(DOIn->Tim, 0);
+	PlcTim_SetPreload(DOIn->Tim, DOIn->TimCh, BIT_TRUE);
+	PlcTim_SetChannelPwm(DOIn->Tim, DOIn->TimCh, PLC_TIM2_PRESCALER, PLC_TIM2_PERIOD__MIN, 0);
+	PlcTim_GenUpdate(DOIn->Tim);
+
+	Pto->Seg     = 0;
+	Pto->RepLeft = 0;
+	Pto->Busy    = BIT_TRUE;
+	PlcDO_PtoNext(Pto);
+
+	PlcTim_StartChannel(DOIn->Tim, DOIn->TimCh);
+
+	return (PLC_PTO_OK);
+}
+
+/** @brief  Stop pulse train (PTO) and return TIM to PWM settings of channel.
+ *  @param  DOIn - channel.
+ *  @return None.
+ */
+void PlcDO_PtoStop(PlcDO_t *DOIn)
+{
+	PlcDO_Pto_t *Pto;
+
+	if(!DOIn || DOIn->Ch >= PLC_DO_SZ || PLC_DO_PTO[DOIn->Ch].Dma == NULL) return;
+
+	Pto = &PLC_DO_PTO[DOIn->Ch];
+
+	//ISR does not continue the train after this point
+	Pto->Busy = BIT_FALSE;
+	PlcTim_SetUpdateBurst(DOIn->Tim, 0);
+	HAL_DMA_Abort(Pto->Dma);
+
+	PlcTim_SetChannelPwm(DOIn->Tim, DOIn->TimCh, DOIn->Psc, DOIn->Arr, DOIn->Ccr);
+	PlcTim_GenUpdate(DOIn->Tim);
 }
@@ -0,0 +1,117 @@
+/* @page dwt.c
+ *       PLC411::RTE
+ *       DWT cycle counter driver
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "dwt.h"
+
+
+/** @def Microseconds per second
+ */
+#define PLC_DWT_US_PER_S                         (uint32_t)1000000
+
+/** @def Nanoseconds per microsecond
+ */
+#define PLC_DWT_NS_PER_US                        (uint32_t)1000
+
+
+/** @var Extension of counter: the latest reading, count of wraps
+ */
+static uint32_t PLC_DWT_CYC_LAST = 0;
+static uint32_t PLC_DWT_CYC_HIGH = 0;
+
+
+/** @brief  Init. (enable cycle counter).
+ *  @param  None.
+ *  @return None.
+ */
+void PlcDwt_Init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+	PLC_DWT_CYC_LAST = DWT->CYCCNT;
+}
+
+/** @brief  Get cycle counter.
+ *  @param  None.
+ *  @return Value of DWT.CYCCNT (core clock cycles).
+ *  @note   May be called from ISR.
+ */
+uint32_t PlcDwt_GetCyc(void)
+{
+	return (DWT->CYCCNT);
+}
+
+/** @brief  Get 64-bit cycle counter.
+ *  @param  None.
+ *  @return Cycles since start.
+ *  @note   May be called from ISR.
+ */
+uint64_t PlcDwt_GetCyc64(void)
+{
+	uint32_t Prim = __get_PRIMASK();
+	uint32_t Cyc;
+	uint64_t Res;
+
+	__disable_irq();
+
+	Cyc = DWT->CYCCNT;
+	if(Cyc < PLC_DWT_CYC_LAST) PLC_DWT_CYC_HIGH++;
+	PLC_DWT_CYC_LAST = Cyc;
+	Res = (((uint64_t)PLC_DWT_CYC_HIGH << 32) | Cyc);
+
+	__set_PRIMASK(Prim);
+
+	return (Res);
+}
+
+/** @brief  Get 64-bit clock.
+ *  @param  None.
+ *  @return Nanoseconds since start (resolution is one cycle).
+ *  @note   May be called from ISR.
+ */
+uint64_t PlcDwt_GetNs(void)
+{
+	uint64_t Cyc = PlcDwt_GetCyc64();
+	uint32_t Clk = SystemCoreClock/PLC_DWT_US_PER_S;
+
+	if(!Clk) return (0);
+
+	//whole microseconds + fraction (no overflow of Cyc*1000)
+	return ((Cyc/Clk)*PLC_DWT_NS_PER_US + ((Cyc%Clk)*PLC_DWT_NS_PER_US)/Clk);
+}
+
+/** @brief  Tick of 64-bit clock (extension of counter).
+ *  @param  None.
+ *  @return None.
+ *  @note   Called by SysTick ISR.
+ */
+void PlcDwt_Tick(void)
+{
+	(void)PlcDwt_GetCyc64();
+}
+
+/** @brief  Convert cycles into microseconds.
+ *  @param  CycIn - cycles.
+ *  @return Microseconds.
+ */
+uint32_t PlcDwt_CycToUs(uint32_t CycIn)
+{
+	uint32_t Clk = SystemCoreClock/PLC_DWT_US_PER_S;
+
+	return ((Clk) ? (CycIn/Clk) : 0);
+}
+
+/** @brief  Convert microseconds into cycles.
+ *  @param  UsIn - microseconds.
+ *  @return Cycles (limited by 0xFFFFFFFF).
+ */
+uint32_t PlcDwt_UsToCyc(uint32_t UsIn)
+{
+	uint64_t Cyc = (uint64_t)UsIn*(SystemCoreClock/PLC_DWT_US_PER_S);
+
+	return ((Cyc < 0xFFFFFFFF) ? (uint32_t)Cyc : 0xFFFFFFFF);
+}
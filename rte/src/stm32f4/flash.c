@@ -0,0 +1,112 @@
+/* @page flash.c
+ *       PLC411::RTE
+ *       Flash driver (storage of retain-data journal)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "flash.h"
+
+#ifdef RTE_MOD_RETAIN
+
+
+/** @def Errors of flash
+ */
+#define PLC_FLASH_FLAG_ERR                       (uint32_t)(FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+
+
+/** @brief  Erase sector of retain-data journal.
+ *  @param  SectIn - number of sector (0 ... PLC_RETAIN_SECT_NUM-1).
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcFlash_RetainErase(uint8_t SectIn)
+{
+	return (PlcFlash_Erase((SectIn) ? PLC_FLASH_RETAIN_SECT1 : PLC_FLASH_RETAIN_SECT0));
+}
+
+/** @brief  Program words of retain-data journal.
+ *  @param  AddrIn - pointer to the first word in sector.
+ *  @param  DataIn - pointer to words.
+ *  @param  WordsIn - number of words.
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcFlash_RetainWrite(const uint32_t *AddrIn, const uint32_t *DataIn, uint32_t WordsIn)
+{
+	return (PlcFlash_Write((uint32_t)AddrIn, DataIn, WordsIn));
+}
+
+
+/** @var Storage of retain-data journal
+ */
+const PlcRetain_Port_t PlcFlash_RetainPort =
+{
+	{ (const uint32_t *)PLC_FLASH_RETAIN_ADDR0, (const uint32_t *)PLC_FLASH_RETAIN_ADDR1 },
+	PlcFlash_RetainErase,
+	PlcFlash_RetainWrite
+};
+
+
+/** @brief  Erase sector.
+ *  @param  SectorIn - sector (FLASH_SECTOR_...).
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcFlash_Erase(uint32_t SectorIn)
+{
+	FLASH_EraseInitTypeDef Erase;
+	uint32_t Err = 0;
+	HAL_StatusTypeDef Res;
+
+	Erase.TypeErase    = FLASH_TYPEERASE_SECTORS;
+	Erase.Banks        = FLASH_BANK_1;
+	Erase.Sector       = SectorIn;
+	Erase.NbSectors    = 1;
+	Erase.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+
+	if(HAL_FLASH_Unlock() != HAL_OK) return (BIT_FALSE);
+	__HAL_FLASH_CLEAR_FLAG(PLC_FLASH_FLAG_ERR);
+
+	//caches are flushed by HAL
+	Res = HAL_FLASHEx_Erase(&Erase, &Err);
+	HAL_FLASH_Lock();
+
+	return ((Res == HAL_OK && Err == 0xFFFFFFFF) ? BIT_TRUE : BIT_FALSE);
+}
+
+/** @brief  Program words.
+ *  @param  AddrIn - address (aligned to word, erased before).
+ *  @param  DataIn - pointer to words.
+ *  @param  WordsIn - number of words.
+ *  @return Result:
+ *  @arg    = 0 - error (or words are not read back)
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcFlash_Write(uint32_t AddrIn, const uint32_t *DataIn, uint32_t WordsIn)
+{
+	uint8_t  Res = BIT_TRUE;
+	uint32_t i;
+
+	if(!DataIn || (AddrIn & 0x03)) return (BIT_FALSE);
+
+	if(HAL_FLASH_Unlock() != HAL_OK) return (BIT_FALSE);
+	__HAL_FLASH_CLEAR_FLAG(PLC_FLASH_FLAG_ERR);
+
+	for(i=0; i<WordsIn; i++)
+	{
+		if(HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, AddrIn+i*4, DataIn[i]) != HAL_OK || *(volatile const uint32_t *)(AddrIn+i*4) != DataIn[i])
+		{
+			Res = BIT_FALSE;
+			break;
+		}
+	}
+	HAL_FLASH_Lock();
+
+	return (Res);
+}
+
+#endif //RTE_MOD_RETAIN
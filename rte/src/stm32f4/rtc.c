@@ -0,0 +1,241 @@
+/* @page rtc.c
+ *       PLC411::RTE
+ *       RTC driver (calendar of wall clock)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "rtc.h"
+
+#ifdef RTE_MOD_RTC
+
+
+/** @def Date of the first init. (2000-01-01, Saturday)
+ */
+#define PLC_RTC_DR_DEF                           (uint32_t)((6 << RTC_DR_WDU_Pos) | (1 << RTC_DR_MU_Pos) | (1 << RTC_DR_DU_Pos))
+
+/** @def Keys of write protection
+ */
+#define PLC_RTC_WPR_KEY1                         (uint32_t)0xCA
+#define PLC_RTC_WPR_KEY2                         (uint32_t)0x53
+#define PLC_RTC_WPR_LOCK                         (uint32_t)0xFF
+
+/** @def Nanoseconds per second
+ */
+#define PLC_RTC_NS_PER_S                         (uint64_t)1000000000
+
+
+/** @brief  Wait for flag.
+ *  @param  RegIn - pointer to register.
+ *  @param  MskIn - mask of flag.
+ *  @param  TmIn - timeout (us).
+ *  @return Result:
+ *  @arg    = 0 - timeout
+ *  @arg    = 1 - OK (flag is set)
+ */
+static uint8_t PlcRtc_Wait(volatile uint32_t *RegIn, uint32_t MskIn, uint32_t TmIn)
+{
+	uint32_t Start = PlcDwt_GetCyc();
+	uint32_t Tm    = PlcDwt_UsToCyc(TmIn);
+
+	while(!(*RegIn & MskIn))
+	{
+		if((PlcDwt_GetCyc()-Start) > Tm) return (BIT_FALSE);
+	}
+	return (BIT_TRUE);
+}
+
+/** @brief  Wait for synchronization of shadow registers.
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - timeout
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcRtc_Sync(void)
+{
+	uint8_t Res;
+
+	RTC->WPR = PLC_RTC_WPR_KEY1;
+	RTC->WPR = PLC_RTC_WPR_KEY2;
+
+	RTC->ISR &= ~(RTC_ISR_INIT | RTC_ISR_RSF);
+	Res = PlcRtc_Wait(&RTC->ISR, RTC_ISR_RSF, PLC_RTC_TM);
+
+	RTC->WPR = PLC_RTC_WPR_LOCK;
+
+	return (Res);
+}
+
+/** @brief  Enter init. mode (calendar is stopped).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - timeout (RTC is locked)
+ *  @arg    = 1 - OK (RTC is unlocked)
+ */
+static uint8_t PlcRtc_EnterInit(void)
+{
+	RTC->WPR = PLC_RTC_WPR_KEY1;
+	RTC->WPR = PLC_RTC_WPR_KEY2;
+
+	//INIT (other flags are rc_w0, writing of 1 keeps them)
+	RTC->ISR = 0xFFFFFFFF;
+	if(!PlcRtc_Wait(&RTC->ISR, RTC_ISR_INITF, PLC_RTC_TM))
+	{
+		RTC->ISR &= ~RTC_ISR_INIT;
+		RTC->WPR  = PLC_RTC_WPR_LOCK;
+		return (BIT_FALSE);
+	}
+	return (BIT_TRUE);
+}
+
+/** @brief  Exit init. mode (calendar is started).
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - timeout of synchronization
+ *  @arg    = 1 - OK
+ */
+static uint8_t PlcRtc_ExitInit(void)
+{
+	RTC->ISR &= ~RTC_ISR_INIT;
+	RTC->WPR  = PLC_RTC_WPR_LOCK;
+
+	return (PlcRtc_Sync());
+}
+
+/** @brief  Convert value into BCD.
+ *  @param  ValIn - value (0 ... 99).
+ *  @return BCD.
+ */
+static uint32_t PlcRtc_ToBcd(uint8_t ValIn)
+{
+	return ((uint32_t)(((ValIn/10) << 4) | (ValIn%10)));
+}
+
+/** @brief  Convert BCD into value.
+ *  @param  BcdIn - BCD.
+ *  @return Value.
+ */
+static uint8_t PlcRtc_FromBcd(uint32_t BcdIn)
+{
+	return ((uint8_t)(((BcdIn >> 4) & 0x0F)*10 + (BcdIn & 0x0F)));
+}
+
+
+/** @brief  Init. RTC.
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - RTC is not running
+ *  @arg    = 1 - OK
+ *  @note   Called before start of scheduler (start of LSE is waited by DWT).
+ */
+uint8_t PlcRtc_Init(void)
+{
+	uint32_t PredivS = PLC_RTC_PREDIV_S_LSE;
+
+	//access to backup domain
+	__HAL_RCC_PWR_CLK_ENABLE();
+	PWR->CR |= PWR_CR_DBP;
+
+	//RTC is running
+	if((RCC->BDCR & RCC_BDCR_RTCEN) && PLC_RTC_BKP == PLC_RTC_MAGIC)
+	{
+		//LSI is off after reset of MCU
+		if((RCC->BDCR & RCC_BDCR_RTCSEL) == RCC_BDCR_RTCSEL_1)
+		{
+			RCC->CSR |= RCC_CSR_LSION;
+			if(!PlcRtc_Wait(&RCC->CSR, RCC_CSR_LSIRDY, PLC_RTC_TM)) return (BIT_FALSE);
+		}
+		return (PlcRtc_Sync());
+	}
+
+	//RTC clock may be selected only after reset of backup domain
+	RCC->BDCR |= RCC_BDCR_BDRST;
+	RCC->BDCR &= ~RCC_BDCR_BDRST;
+
+	RCC->BDCR |= RCC_BDCR_LSEON;
+	if(PlcRtc_Wait(&RCC->BDCR, RCC_BDCR_LSERDY, PLC_RTC_LSE_TM))
+	{
+		RCC->BDCR |= RCC_BDCR_RTCSEL_0;
+	}
+	else
+	{
+		RCC->BDCR &= ~RCC_BDCR_LSEON;
+		RCC->CSR  |= RCC_CSR_LSION;
+		if(!PlcRtc_Wait(&RCC->CSR, RCC_CSR_LSIRDY, PLC_RTC_TM)) return (BIT_FALSE);
+
+		RCC->BDCR |= RCC_BDCR_RTCSEL_1;
+		PredivS    = PLC_RTC_PREDIV_S_LSI;
+	}
+	RCC->BDCR |= RCC_BDCR_RTCEN;
+
+	if(!PlcRtc_EnterInit()) return (BIT_FALSE);
+
+	//24-hour format, prescalers (two separate writes)
+	RTC->CR   &= ~RTC_CR_FMT;
+	RTC->PRER  = PredivS;
+	RTC->PRER |= (PLC_RTC_PREDIV_A << RTC_PRER_PREDIV_A_Pos);
+	RTC->TR    = 0;
+	RTC->DR    = PLC_RTC_DR_DEF;
+
+	if(!PlcRtc_ExitInit()) return (BIT_FALSE);
+
+	PLC_RTC_BKP = PLC_RTC_MAGIC;
+	return (BIT_TRUE);
+}
+
+/** @brief  Set date and time.
+ *  @param  DtIn - pointer to date and time (valid, see PlcDt_IsValid).
+ *  @return Result:
+ *  @arg    = 0 - error
+ *  @arg    = 1 - OK
+ *  @note   Subseconds are reset (the new second starts now).
+ */
+uint8_t PlcRtc_Set(const PlcDt_t *DtIn)
+{
+	if(!PlcDt_IsValid(DtIn) || !(RCC->BDCR & RCC_BDCR_RTCEN)) return (BIT_FALSE);
+
+	if(!PlcRtc_EnterInit()) return (BIT_FALSE);
+
+	RTC->TR = ((PlcRtc_ToBcd(DtIn->Hour) << RTC_TR_HU_Pos) | (PlcRtc_ToBcd(DtIn->Min) << RTC_TR_MNU_Pos) | (PlcRtc_ToBcd(DtIn->Sec) << RTC_TR_SU_Pos));
+	RTC->DR = ((PlcRtc_ToBcd((uint8_t)(DtIn->Year%100)) << RTC_DR_YU_Pos) | ((uint32_t)PlcDt_GetWday(DtIn) << RTC_DR_WDU_Pos) | (PlcRtc_ToBcd(DtIn->Mon) << RTC_DR_MU_Pos) | (PlcRtc_ToBcd(DtIn->Day) << RTC_DR_DU_Pos));
+
+	return (PlcRtc_ExitInit());
+}
+
+/** @brief  Get date and time.
+ *  @param  DtOut - pointer to date and time.
+ *  @param  NsOut - pointer to nanoseconds of the current second (or NULL).
+ *  @return Result:
+ *  @arg    = 0 - RTC is not running
+ *  @arg    = 1 - OK
+ */
+uint8_t PlcRtc_Get(PlcDt_t *DtOut, uint32_t *NsOut)
+{
+	uint32_t Ss, Tr, Dr, PredivS;
+
+	if(!DtOut || !(RCC->BDCR & RCC_BDCR_RTCEN)) return (BIT_FALSE);
+
+	//SSR locks TR and DR, DR unlocks them
+	Ss = (RTC->SSR & RTC_SSR_SS);
+	Tr = RTC->TR;
+	Dr = RTC->DR;
+
+	DtOut->Year = (uint16_t)(PLC_DT_YEAR__MIN + PlcRtc_FromBcd((Dr >> RTC_DR_YU_Pos) & 0xFF));
+	DtOut->Mon  = PlcRtc_FromBcd((Dr >> RTC_DR_MU_Pos) & 0x1F);
+	DtOut->Day  = PlcRtc_FromBcd((Dr >> RTC_DR_DU_Pos) & 0x3F);
+	DtOut->Hour = PlcRtc_FromBcd((Tr >> RTC_TR_HU_Pos) & 0x3F);
+	DtOut->Min  = PlcRtc_FromBcd((Tr >> RTC_TR_MNU_Pos) & 0x7F);
+	DtOut->Sec  = PlcRtc_FromBcd((Tr >> RTC_TR_SU_Pos) & 0x7F);
+
+	if(NsOut)
+	{
+		//SS counts down from PREDIV_S
+		PredivS = (RTC->PRER & RTC_PRER_PREDIV_S);
+		if(Ss > PredivS) Ss = PredivS;
+		*NsOut  = (uint32_t)(((uint64_t)(PredivS-Ss)*PLC_RTC_NS_PER_S)/(PredivS+1));
+	}
+
+	return (BIT_TRUE);
+}
+
+#endif //RTE_MOD_RTC
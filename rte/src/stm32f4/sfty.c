@@ -0,0 +1,254 @@
+/* @page sfty.c
+ *       PLC411::RTE
+ *       Fail-safe outputs (scan and comms watchdogs)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "sfty.h"
+
+
+#ifdef RTE_MOD_DO
+
+/** @var Watchdogs
+ */
+static PlcSfty_Wd_t PLC_SFTY_WD[PLC_SFTY_WD_SZ];
+
+/** @var Safe outputs (bit per channel): allow, value
+ */
+static volatile uint32_t PLC_SFTY_ALLOW = 0;
+static volatile uint32_t PLC_SFTY_VAL   = 0;
+
+/** @var Forced outputs (bit per channel)
+ */
+static volatile uint32_t PLC_SFTY_FORCED = 0;
+
+/** @var Fault of application (latched until restart)
+ */
+static volatile uint8_t PLC_SFTY_FAULT = BIT_FALSE;
+
+
+/** @brief  Test expired watchdogs.
+ *  @param  None.
+ *  @return Result:
+ *  @arg    = 0 - no expired watchdog
+ *  @arg    = 1 - at least one watchdog is expired (or fault of application)
+ */
+static uint8_t PlcSfty_IsTripped(void)
+{
+	if(PLC_SFTY_FAULT) return (BIT_TRUE);
+
+	for(uint8_t i=0; i<PLC_SFTY_WD_SZ; i++)
+	{
+		if(PLC_SFTY_WD[i].Cplt) return (BIT_TRUE);
+	}
+	return (BIT_FALSE);
+}
+
+/** @brief  Force safe outputs.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called with masked IRQ or from SysTick ISR.
+ */
+static void PlcSfty_Force(void)
+{
+	uint32_t Bit;
+
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		Bit = ((uint32_t)1 << i);
+
+		if(PLC_SFTY_ALLOW & Bit)
+		{
+			PlcDO_ForceVal(i, PLC_DO_FORCE_SFTY, ((PLC_SFTY_VAL & Bit) ? BIT_TRUE : BIT_FALSE));
+			PLC_SFTY_FORCED |= Bit;
+		}
+		else if(PLC_SFTY_FORCED & Bit)
+		{
+			PlcDO_ReleaseVal(i, PLC_DO_FORCE_SFTY);
+			PLC_SFTY_FORCED &= ~Bit;
+		}
+	}
+}
+
+/** @brief  Release forced outputs.
+ *  @param  None.
+ *  @return None.
+ */
+static void PlcSfty_Release(void)
+{
+	for(uint8_t i=0; i<PLC_DO_SZ; i++)
+	{
+		if(PLC_SFTY_FORCED & ((uint32_t)1 << i))
+		{
+			PlcDO_ReleaseVal(i, PLC_DO_FORCE_SFTY);
+		}
+	}
+	PLC_SFTY_FORCED = 0;
+}
+
+
+/** @brief  Init. fail-safe outputs.
+ *  @param  None.
+ *  @return None.
+ */
+void PlcSfty_Init(void)
+{
+	uint32_t Prim = __get_PRIMASK();
+	__disable_irq();
+
+	for(uint8_t i=0; i<PLC_SFTY_WD_SZ; i++)
+	{
+		PLC_SFTY_WD[i].Tm   = 0;
+		PLC_SFTY_WD[i].Left = 0;
+		PLC_SFTY_WD[i].Cplt = BIT_FALSE;
+	}
+	PLC_SFTY_ALLOW  = 0;
+	PLC_SFTY_VAL    = 0;
+	PLC_SFTY_FORCED = 0;
+	PLC_SFTY_FAULT  = BIT_FALSE;
+
+	__set_PRIMASK(Prim);
+}
+
+/** @brief  Set time of watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @param  TmIn - time (ms):
+ *  @arg    = 0 - off
+ *  @arg    = 1 ... PLC_SFTY_TM_MAX
+ *  @return None.
+ */
+void PlcSfty_SetTm(uint8_t WdIn, uint32_t TmIn)
+{
+	uint32_t Prim;
+
+	if(WdIn < PLC_SFTY_WD_SZ)
+	{
+		if(TmIn > PLC_SFTY_TM_MAX) TmIn = PLC_SFTY_TM_MAX;
+
+		Prim = __get_PRIMASK();
+		__disable_irq();
+		PLC_SFTY_WD[WdIn].Tm   = TmIn;
+		PLC_SFTY_WD[WdIn].Left = TmIn;
+		__set_PRIMASK(Prim);
+	}
+}
+
+/** @brief  Kick watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @return None.
+ */
+void PlcSfty_Kick(uint8_t WdIn)
+{
+	if(WdIn < PLC_SFTY_WD_SZ)
+	{
+		//one word, SysTick ISR reads it atomically
+		PLC_SFTY_WD[WdIn].Left = PLC_SFTY_WD[WdIn].Tm;
+	}
+}
+
+/** @brief  Reset expired watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @return None.
+ *  @note   Forced outputs are released if no watchdog is expired.
+ */
+void PlcSfty_Reset(uint8_t WdIn)
+{
+	uint32_t Prim;
+
+	if(WdIn < PLC_SFTY_WD_SZ)
+	{
+		Prim = __get_PRIMASK();
+		__disable_irq();
+
+		PLC_SFTY_WD[WdIn].Left = PLC_SFTY_WD[WdIn].Tm;
+		PLC_SFTY_WD[WdIn].Cplt = BIT_FALSE;
+		if(!PlcSfty_IsTripped()) PlcSfty_Release();
+
+		__set_PRIMASK(Prim);
+	}
+}
+
+/** @brief  Force safe outputs by fault of application.
+ *  @param  None.
+ *  @return None.
+ *  @note   Latched until PlcSfty_Init (restart), watchdogs are not changed.
+ */
+void PlcSfty_Trip(void)
+{
+	uint32_t Prim = __get_PRIMASK();
+	__disable_irq();
+
+	PLC_SFTY_FAULT = BIT_TRUE;
+	PlcSfty_Force();
+
+	__set_PRIMASK(Prim);
+}
+
+/** @brief  Get status of watchdog.
+ *  @param  WdIn - watchdog (PLC_SFTY_WD_...).
+ *  @return Result:
+ *  @arg    = 0 - not expired (or off)
+ *  @arg    = 1 - expired
+ */
+uint8_t PlcSfty_IsCplt(uint8_t WdIn)
+{
+	return ((WdIn < PLC_SFTY_WD_SZ) ? PLC_SFTY_WD[WdIn].Cplt : BIT_FALSE);
+}
+
+/** @brief  Set safe output of DO-channel.
+ *  @param  ChIn - channel number.
+ *  @param  AllowIn - Safe.Allow.
+ *  @param  ValIn - Safe.Value.
+ *  @return None.
+ *  @note   Applied immediately if a watchdog is expired.
+ */
+void PlcSfty_SetOut(uint8_t ChIn, uint8_t AllowIn, uint8_t ValIn)
+{
+	uint32_t Prim;
+	uint32_t Bit;
+
+	if(ChIn < PLC_DO_SZ)
+	{
+		Bit  = ((uint32_t)1 << ChIn);
+		Prim = __get_PRIMASK();
+		__disable_irq();
+
+		if(AllowIn) PLC_SFTY_ALLOW |=  Bit;
+		else        PLC_SFTY_ALLOW &= ~Bit;
+		if(ValIn)   PLC_SFTY_VAL   |=  Bit;
+		else        PLC_SFTY_VAL   &= ~Bit;
+
+		if(PlcSfty_IsTripped()) PlcSfty_Force();
+
+		__set_PRIMASK(Prim);
+	}
+}
+
+/** @brief  Count watchdogs.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called from SysTick ISR (1 ms).
+ */
+void PlcSfty_Tick(void)
+{
+	uint8_t Trip = BIT_FALSE;
+
+	for(uint8_t i=0; i<PLC_SFTY_WD_SZ; i++)
+	{
+		if(PLC_SFTY_WD[i].Tm && !PLC_SFTY_WD[i].Cplt)
+		{
+			if(PLC_SFTY_WD[i].Left) PLC_SFTY_WD[i].Left--;
+
+			if(!PLC_SFTY_WD[i].Left)
+			{
+				PLC_SFTY_WD[i].Cplt = BIT_TRUE;
+				Trip = BIT_TRUE;
+			}
+		}
+	}
+
+	if(Trip) PlcSfty_Force();
+}
+
+#endif //RTE_MOD_DO
@@ -17,6 +17,9 @@ void SysTick_Handler(void)
 	//HAL.Tick
 	HAL_IncTick();
 
+	//64-bit clock (no wrap of DWT.CYCCNT is missed)
+	PlcDwt_Tick();
+
 	//RTOS.Tick (if scheduler is started)
 #if (INCLUDE_xTaskGetSchedulerState == 1 )
 	if(xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
@@ -26,4 +29,39 @@ void SysTick_Handler(void)
 #if (INCLUDE_xTaskGetSchedulerState == 1 )
 	}
 #endif /* INCLUDE_xTaskGetSchedulerState */
+
+#ifdef RTE_MOD_DO
+	//Fail-safe outputs (watchdogs)
+	PlcSfty_Tick();
+#endif // RTE_MOD_DO
+}
+
+
+/** @brief  Get timestamp (us).
+ *  @param  None.
+ *  @return Timestamp (us), wraps every 2^32 us.
+ *  @note   HAL.Tick + fraction of the current SysTick period,
+ *          may be called from ISR.
+ */
+uint32_t PlcSysTick_GetUs(void)
+{
+	uint32_t Load = SysTick->LOAD;
+	uint32_t Ms;
+	uint32_t Val;
+
+	//re-read if HAL.Tick was incremented meanwhile
+	do
+	{
+		Ms  = HAL_GetTick();
+		Val = SysTick->VAL;
+	}
+	while(Ms != HAL_GetTick());
+
+	//SysTick has been reloaded, but HAL.Tick is not incremented yet (called with masked SysTick)
+	if((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) && Val > (Load >> 1))
+	{
+		Ms++;
+	}
+
+	return (Ms*1000 + ((Load - Val)*1000)/(Load + 1));
 }
@@ -12,11 +12,13 @@
  */
 TIM_HandleTypeDef PLC_TIM2;
 TIM_HandleTypeDef PLC_TIM5;
+TIM_HandleTypeDef PLC_TIM4;
 
 /** @var TIM Callback user-functions
  */
 PLC_TIM_UserFunc_t PLC_TIM2_USER_FUNC = { .Elapsed = NULL };
 PLC_TIM_UserFunc_t PLC_TIM5_USER_FUNC = { .Elapsed = NULL };
+PLC_TIM_UserFunc_t PLC_TIM4_USER_FUNC = { .Elapsed = NULL };
 
 
 /** @brief  Start TIM.Channel.
@@ -76,6 +78,91 @@ void PlcTim_SetChannelPulse(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint32_t
 	}
 }
 
+/** @brief  Set prescaler, period and pulse together.
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  PrescalerIn - new value of prescaler (PSC, 16 bit).
+ *  @param  PeriodIn - new value of period (ARR).
+ *  @param  PulseIn - new value of pulse (CCR).
+ *  @return None.
+ *  @note   Update event is held off while the registers are written,
+ *          so with preload on (PlcTim_SetPreload) the set is applied by the same update event
+ *          (PSC is always preloaded).
+ */
+void PlcTim_SetChannelPwm(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint32_t PrescalerIn, uint32_t PeriodIn, uint32_t PulseIn)
+{
+	if(TimIn == &PLC_TIM2 || TimIn == &PLC_TIM5)
+	{
+		SET_BIT(TimIn->Instance->CR1, TIM_CR1_UDIS);
+		__HAL_TIM_SET_PRESCALER(TimIn, PrescalerIn);
+		__HAL_TIM_SET_AUTORELOAD(TimIn, PeriodIn);
+		__HAL_TIM_SET_COMPARE(TimIn, TimChIn, PulseIn);
+		CLEAR_BIT(TimIn->Instance->CR1, TIM_CR1_UDIS);
+	}
+}
+
+/** @brief  Set output compare mode of TIM.Channel (OCxM).
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  OcModeIn - output compare mode (TIM_OCMODE_*).
+ *  @return None
+ */
+static void PlcTim_SetChannelOcMode(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint32_t OcModeIn)
+{
+	switch(TimChIn)
+	{
+		case TIM_CHANNEL_1:
+			MODIFY_REG(TimIn->Instance->CCMR1, TIM_CCMR1_OC1M, OcModeIn);
+			break;
+
+		case TIM_CHANNEL_2:
+			MODIFY_REG(TimIn->Instance->CCMR1, TIM_CCMR1_OC2M, (OcModeIn << 8U));
+			break;
+
+		case TIM_CHANNEL_3:
+			MODIFY_REG(TimIn->Instance->CCMR2, TIM_CCMR2_OC3M, OcModeIn);
+			break;
+
+		case TIM_CHANNEL_4:
+			MODIFY_REG(TimIn->Instance->CCMR2, TIM_CCMR2_OC4M, (OcModeIn << 8U));
+			break;
+	}
+}
+
+/** @brief  Force output level of TIM.Channel.
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  LevelIn - output level:
+ *  @arg    = 0 - low (forced inactive)
+ *  @arg    = 1 - high (forced active)
+ *  @return None
+ *  @note   OCxM is not preloaded, so the level is applied immediately (safe to call from ISR).
+ */
+void PlcTim_ForceChannelOutput(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint8_t LevelIn)
+{
+	if(TimIn == &PLC_TIM2 || TimIn == &PLC_TIM5)
+	{
+		PlcTim_SetChannelOcMode(TimIn, TimChIn, ((LevelIn) ? TIM_OCMODE_FORCED_ACTIVE : TIM_OCMODE_FORCED_INACTIVE));
+	}
+}
+
+/** @brief  Release forced output level of TIM.Channel (return to PWM mode).
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @return None
+ */
+void PlcTim_ReleaseChannelOutput(TIM_HandleTypeDef *TimIn, uint32_t TimChIn)
+{
+	if(TimIn == &PLC_TIM2 || TimIn == &PLC_TIM5)
+	{
+		PlcTim_SetChannelOcMode(TimIn, TimChIn, TIM_OCMODE_PWM1);
+	}
+}
+
 /** @brief  Start TIM.
  *  @param  TimIn - pointer to handle.
  *  @return None
@@ -115,3 +202,88 @@ void PlcTim_RstCnt(TIM_HandleTypeDef *TimIn)
 {
 	PlcTim_SetCnt(TimIn, (uint32_t)0);
 }
+
+/** @brief  Enable/disable preload of period (ARR) and pulse (CCR).
+ *  @param  TimIn - pointer to handle.
+ *  @param  TimChIn - channel:
+ *  @arg    = TIM_CHANNEL_1 ... TIM_CHANNEL_4
+ *  @param  EnIn - preload:
+ *  @arg    = 0 - off (new values are applied immediately)
+ *  @arg    = 1 - on  (new values are applied on update event)
+ *  @return None.
+ */
+void PlcTim_SetPreload(TIM_HandleTypeDef *TimIn, uint32_t TimChIn, uint8_t EnIn)
+{
+	uint32_t Ocpe = 0;
+
+	if(TimIn == &PLC_TIM2 || TimIn == &PLC_TIM5)
+	{
+		switch(TimChIn)
+		{
+			case TIM_CHANNEL_1:
+				Ocpe = TIM_CCMR1_OC1PE;
+				break;
+
+			case TIM_CHANNEL_2:
+				Ocpe = TIM_CCMR1_OC2PE;
+				break;
+
+			case TIM_CHANNEL_3:
+				Ocpe = TIM_CCMR2_OC3PE;
+				break;
+
+			case TIM_CHANNEL_4:
+				Ocpe = TIM_CCMR2_OC4PE;
+				break;
+		}
+
+		if(EnIn)
+		{
+			SET_BIT(TimIn->Instance->CR1, TIM_CR1_ARPE);
+			if(TimChIn == TIM_CHANNEL_1 || TimChIn == TIM_CHANNEL_2) SET_BIT(TimIn->Instance->CCMR1, Ocpe);
+			else                                                     SET_BIT(TimIn->Instance->CCMR2, Ocpe);
+		}
+		else
+		{
+			CLEAR_BIT(TimIn->Instance->CR1, TIM_CR1_ARPE);
+			if(TimChIn == TIM_CHANNEL_1 || TimChIn == TIM_CHANNEL_2) CLEAR_BIT(TimIn->Instance->CCMR1, Ocpe);
+			else                                                     CLEAR_BIT(TimIn->Instance->CCMR2, Ocpe);
+		}
+	}
+}
+
+/** @brief  Generate update event (reload ARR, CCR and reset counter).
+ *  @param  TimIn - pointer to handle.
+ *  @return None.
+ */
+void PlcTim_GenUpdate(TIM_HandleTypeDef *TimIn)
+{
+	if(TimIn == &PLC_TIM2 || TimIn == &PLC_TIM5)
+	{
+		TimIn->Instance->EGR = TIM_EGR_UG;
+	}
+}
+
+/** @brief  Set DMA-burst on update event.
+ *  @param  TimIn - pointer to handle.
+ *  @param  LenIn - quantity of registers from ARR:
+ *  @arg    = 0    - DMA-request is off
+ *  @arg    = 1..4 - ARR, RCR, CCR1, CCR2
+ *  @return None.
+ *  @note   Safe to call from ISR.
+ */
+void PlcTim_SetUpdateBurst(TIM_HandleTypeDef *TimIn, uint8_t LenIn)
+{
+	if(TimIn == &PLC_TIM2 || TimIn == &PLC_TIM5)
+	{
+		if(LenIn)
+		{
+			TimIn->Instance->DCR = (TIM_DMABASE_ARR | ((uint32_t)(LenIn-1) << 8U));
+			SET_BIT(TimIn->Instance->DIER, TIM_DIER_UDE);
+		}
+		else
+		{
+			CLEAR_BIT(TimIn->Instance->DIER, TIM_DIER_UDE);
+		}
+	}
+}
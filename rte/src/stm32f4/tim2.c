@@ -11,13 +11,9 @@
 
 #ifdef PLC_TIM2_DMA
 
-/** @var ADC1.DMA Handler
+/** @var TIM2.UP.DMA Handler
  */
-static DMA_HandleTypeDef PLC_TIM2_CH1_DMA;
-
-/** @var DMA statuses
- */
-static uint8_t PLC_TIM2_CH1_DMA_STATUS = BIT_FALSE;
+DMA_HandleTypeDef PLC_TIM2_UP_DMA;
 
 #endif //PLC_TIM2_DMA
 
@@ -85,37 +81,35 @@ void PlcTim2_Init(void)
 
 #ifdef PLC_TIM2_DMA
 
-	//TIM2.CH1.DMA1 Init.
-	PLC_TIM2_CH1_DMA.Instance                 = DMA1_Stream5;
-	PLC_TIM2_CH1_DMA.Init.Channel   		  = DMA_CHANNEL_3;
-	PLC_TIM2_CH1_DMA.Init.Direction 		  = DMA_MEMORY_TO_PERIPH;
-	PLC_TIM2_CH1_DMA.Init.PeriphInc 		  = DMA_PINC_DISABLE;
-	PLC_TIM2_CH1_DMA.Init.MemInc 			  = DMA_MINC_ENABLE;
-	PLC_TIM2_CH1_DMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
-	PLC_TIM2_CH1_DMA.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
-	PLC_TIM2_CH1_DMA.Init.Mode				  = DMA_NORMAL;
-	PLC_TIM2_CH1_DMA.Init.Priority			  = PLC_DMA_PRIO_DO;
-	PLC_TIM2_CH1_DMA.Init.FIFOMode			  = DMA_FIFOMODE_DISABLE;
-	PLC_TIM2_CH1_DMA.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
-	PLC_TIM2_CH1_DMA.Init.MemBurst            = DMA_MBURST_INC4;
-	PLC_TIM2_CH1_DMA.Init.PeriphBurst         = DMA_PBURST_INC4;
-    if(HAL_DMA_Init(&PLC_TIM2_CH1_DMA) != HAL_OK)
+	//Enable clock
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	//TIM2.UP.DMA1 Init.
+	// (memory and burst length are set by PTO before every transfer)
+	PLC_TIM2_UP_DMA.Instance                 = DMA1_Stream1;
+	PLC_TIM2_UP_DMA.Init.Channel             = DMA_CHANNEL_3;
+	PLC_TIM2_UP_DMA.Init.Direction           = DMA_MEMORY_TO_PERIPH;
+	PLC_TIM2_UP_DMA.Init.PeriphInc           = DMA_PINC_DISABLE;
+	PLC_TIM2_UP_DMA.Init.MemInc              = DMA_MINC_ENABLE;
+	PLC_TIM2_UP_DMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;
+	PLC_TIM2_UP_DMA.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;
+	PLC_TIM2_UP_DMA.Init.Mode                = DMA_NORMAL;
+	PLC_TIM2_UP_DMA.Init.Priority            = PLC_DMA_PRIO_DO;
+	PLC_TIM2_UP_DMA.Init.FIFOMode            = DMA_FIFOMODE_DISABLE;
+	PLC_TIM2_UP_DMA.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+	PLC_TIM2_UP_DMA.Init.MemBurst            = DMA_MBURST_SINGLE;
+	PLC_TIM2_UP_DMA.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+    if(HAL_DMA_Init(&PLC_TIM2_UP_DMA) != HAL_OK)
     {
     	_Error_Handler(__FILE__, __LINE__);
     }
-    // Associate the initialized DMA handle to the the ADC handle
-    __HAL_LINKDMA(&PLC_TIM2, hdma[TIM_DMA_ID_CC1], PLC_TIM2_CH1_DMA);
+    // Associate the initialized DMA handle to the TIM handle
+    __HAL_LINKDMA(&PLC_TIM2, hdma[TIM_DMA_ID_UPDATE], PLC_TIM2_UP_DMA);
 
     //IRQ Init.
     // DMA1
-    HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, PLC_NVIC_PPRIO_DO_DMA, PLC_NVIC_SPRIO_DO_DMA);
-    HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
-    HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, PLC_NVIC_PPRIO_DO_DMA, PLC_NVIC_SPRIO_DO_DMA);
-    HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
-
-
-    HAL_TIM_PWM_Start_DMA(htim, Channel, pData, Length);
-    HAL_TIM_DMABurst_WriteStart(htim, BurstBaseAddress, BurstRequestSrc, BurstBuffer, BurstLength)
+    HAL_NVIC_SetPriority(DMA1_Stream1_IRQn, PLC_NVIC_PPRIO_DO_DMA, PLC_NVIC_SPRIO_DO_DMA);
+    HAL_NVIC_EnableIRQ(DMA1_Stream1_IRQn);
 
 #endif //PLC_TIM2_DMA
 }
@@ -129,10 +123,24 @@ void PlcTim2_DeInit(void)
 	PlcTim_StopChannel(&PLC_TIM2, PLC_TIM2_DO_CH);
 
 #ifdef PLC_TIM2_DMA
-    HAL_DMA_DeInit(PLC_TIM2->hdma[TIM_DMA_ID_CC1]);
+    HAL_NVIC_DisableIRQ(DMA1_Stream1_IRQn);
+    HAL_DMA_DeInit(&PLC_TIM2_UP_DMA);
 #endif //PLC_TIM2_DMA
 
 	__HAL_RCC_TIM2_CLK_DISABLE();
 }
 
+#ifdef PLC_TIM2_DMA
+
+/** @brief  DMA1_Stream1 IRQ Handler (TIM2.UP).
+ *  @param  None.
+ *  @return None.
+ */
+void DMA1_Stream1_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&PLC_TIM2_UP_DMA);
+}
+
+#endif //PLC_TIM2_DMA
+
 #endif //RTE_MOD_DO
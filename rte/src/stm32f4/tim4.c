@@ -0,0 +1,147 @@
+/* @page tim4.c
+ *       PLC411::RTE
+ *       TIM4 driver (scan timer of application)
+ *       Platform-Dependent Code (STM32F4-HAL)
+ *       2023, atgroup09@gmail.com
+ */
+
+#include "tim4.h"
+
+#ifdef RTE_MOD_APP_TIM
+
+/** @def Nanoseconds per second
+ */
+#define PLC_TIM4_NS_PER_S                        (uint32_t)1000000000
+
+
+/** @var Timer limits of planner
+ */
+static const PlcPwmPlan_Tim_t PLC_TIM4_PLAN = PLC_TIM4_PLAN_TIM;
+
+
+/** @brief  Init. TIM4
+ *  @param  None.
+ *  @return None.
+ */
+void PlcTim4_Init(void)
+{
+	TIM_ClockConfigTypeDef TimClockCfg;
+
+	//Enable clock
+	__HAL_RCC_TIM4_CLK_ENABLE();
+
+	//Counter settings
+	PLC_TIM4.Instance               = TIM4;
+	PLC_TIM4.Init.Prescaler         = 0;
+	PLC_TIM4.Init.CounterMode       = TIM_COUNTERMODE_UP;
+	PLC_TIM4.Init.Period            = PLC_TIM4_PERIOD__MAX;
+	PLC_TIM4.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;
+	PLC_TIM4.Init.RepetitionCounter = 0;
+	PLC_TIM4.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+	if(HAL_TIM_Base_Init(&PLC_TIM4) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+
+	//Clock source
+	TimClockCfg.ClockSource = TIM_CLOCKSOURCE_INTERNAL;
+	if(HAL_TIM_ConfigClockSource(&PLC_TIM4, &TimClockCfg) != HAL_OK)
+	{
+		_Error_Handler(__FILE__, __LINE__);
+	}
+
+	//update IRQ by overflow only (not by UG)
+	__HAL_TIM_URS_ENABLE(&PLC_TIM4);
+
+    //IRQ Init.
+    HAL_NVIC_SetPriority(TIM4_IRQn, PLC_NVIC_PPRIO_APP_TIM, PLC_NVIC_SPRIO_APP_TIM);
+    HAL_NVIC_EnableIRQ(TIM4_IRQn);
+}
+
+/** @brief  DeInit TIM4.
+ *  @param  None.
+ *  @return None.
+ */
+void PlcTim4_DeInit(void)
+{
+	PlcTim4_Stop();
+
+    HAL_NVIC_DisableIRQ(TIM4_IRQn);
+	__HAL_RCC_TIM4_CLK_DISABLE();
+}
+
+/** @brief  Start TIM4.
+ *  @param  PeriodNsIn - period (ns, limited by PLC_TIM4_PERIOD_NS__MIN).
+ *  @param  FirstNsIn - delay of the first update event (ns, 0 or >= period - one period).
+ *  @return Period of plan (ns) or 0 (invalid period).
+ */
+uint64_t PlcTim4_Start(uint64_t PeriodNsIn, uint64_t FirstNsIn)
+{
+	PlcPwmPlan_t Plan;
+	uint64_t     PlanNs;
+	uint64_t     First = 0;
+
+	PlcTim4_Stop();
+
+	if(PeriodNsIn < PLC_TIM4_PERIOD_NS__MIN) PeriodNsIn = PLC_TIM4_PERIOD_NS__MIN;
+	if(PlcPwmPlan_Calc(&PLC_TIM4_PLAN, PLC_PWM_PLAN_UNIT_NS, PeriodNsIn, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG) return (0);
+	PlanNs = PlcPwmPlan_PeriodNs(&PLC_TIM4_PLAN, &Plan);
+
+	__HAL_TIM_SET_PRESCALER(&PLC_TIM4, Plan.Psc);
+	__HAL_TIM_SET_AUTORELOAD(&PLC_TIM4, Plan.Arr);
+	//load prescaler
+	PLC_TIM4.Instance->EGR = TIM_EGR_UG;
+
+	//the first update event: counter is preloaded by the rest of period
+	//(period of plan is ~42.9 s max., so product does not overflow)
+	if(FirstNsIn && FirstNsIn < PlanNs)
+	{
+		First = (FirstNsIn*PLC_TIM4_CLK_HZ)/((uint64_t)PLC_TIM4_NS_PER_S*(Plan.Psc+1));
+		if(First > Plan.Arr) First = 0;
+	}
+	__HAL_TIM_SET_COUNTER(&PLC_TIM4, ((First) ? (Plan.Arr+1-(uint32_t)First) : 0));
+	__HAL_TIM_CLEAR_FLAG(&PLC_TIM4, TIM_FLAG_UPDATE);
+
+	__HAL_TIM_ENABLE_IT(&PLC_TIM4, TIM_IT_UPDATE);
+	__HAL_TIM_ENABLE(&PLC_TIM4);
+
+	return (PlanNs);
+}
+
+/** @brief  Stop TIM4.
+ *  @param  None.
+ *  @return None.
+ */
+void PlcTim4_Stop(void)
+{
+	__HAL_TIM_DISABLE_IT(&PLC_TIM4, TIM_IT_UPDATE);
+	__HAL_TIM_DISABLE(&PLC_TIM4);
+	__HAL_TIM_CLEAR_FLAG(&PLC_TIM4, TIM_FLAG_UPDATE);
+}
+
+/** @brief  Get time since the latest update event.
+ *  @param  None.
+ *  @return Time (us).
+ */
+uint32_t PlcTim4_GetElapsedUs(void)
+{
+	uint64_t Ticks = (uint64_t)__HAL_TIM_GET_COUNTER(&PLC_TIM4)*(PLC_TIM4.Instance->PSC+1);
+
+	return ((uint32_t)((Ticks*1000000)/PLC_TIM4_CLK_HZ));
+}
+
+
+/** @brief  TIM4 IRQ Handler (update).
+ *  @param  None.
+ *  @return None.
+ */
+void TIM4_IRQHandler(void)
+{
+	if(__HAL_TIM_GET_FLAG(&PLC_TIM4, TIM_FLAG_UPDATE))
+	{
+		__HAL_TIM_CLEAR_FLAG(&PLC_TIM4, TIM_FLAG_UPDATE);
+		if(PLC_TIM4_USER_FUNC.Elapsed) PLC_TIM4_USER_FUNC.Elapsed();
+	}
+}
+
+#endif //RTE_MOD_APP_TIM
@@ -65,6 +65,22 @@ typedef struct
     void (*GetTime)(IEC_TIME *);
     void (*LedUser)(BOOL *, BOOL *);
 
+    //* since ABI 1.1 (rte_ver_minor >= PLC_APP_VER_MINOR_SET_TIMER)
+    void (*SetTimer)(unsigned long long, unsigned long long);
+
+    //* since ABI 1.2 (rte_ver_minor >= PLC_APP_VER_MINOR_RETAIN)
+    int  (*RetainCheck)(void);
+    void (*RetainInvalidate)(void);
+    void (*RetainValidate)(void);
+    void (*Retain)(unsigned int, unsigned int, void *);
+    void (*Remind)(unsigned int, unsigned int, void *);
+
+    //* since ABI 1.6 (rte_ver_minor >= PLC_APP_VER_MINOR_CNTR_CMP)
+    void (*DICntrCmp)(BYTE *, DWORD *, BOOL *, BYTE *, BOOL *, DWORD *, BOOL *, BYTE *);
+
+    //* since ABI 1.7 (rte_ver_minor >= PLC_APP_VER_MINOR_PTO)
+    void (*DOPto)(BOOL *, BYTE *, DWORD *, DWORD *, DWORD *, DWORD *, BYTE *, BOOL *, BOOL *, BYTE *);
+
 } plc_app_funcs_t;
 
 
@@ -87,6 +103,25 @@ typedef const plc_loc_dsc_t *plc_loc_tbl_t;
 typedef void (*app_fp_t) (void);
 
 
+/** @def Tasks
+ *       masks of tasks (bit i - t_tab[i])
+ */
+#define PLC_APP_TASK_MAX               8                         //Max. number of tasks
+#define PLC_APP_TASK_ALL               (uint32_t)0xFF            //All tasks
+#define PLC_APP_TASK_MAIN              (uint32_t)0x80000000      //Main run (tick, debug, retain)
+
+/** @typedef Tasks
+ *           description of task (TASK of resource)
+ */
+typedef struct _plc_app_task_t
+{
+    uint32_t ticks;                    //@var Interval (number of common_ticktime, 0 - released by event only)
+    uint8_t  priority;                 //@var Priority (0 - the highest)
+    const uint32_t *l_map;             //@var Used located variables (bit i - l_tab[i]) or NULL (all)
+
+} plc_app_task_t;
+
+
 /** @typedef Application ABI-structure
  */
 typedef struct
@@ -163,6 +198,21 @@ typedef struct
     void     (*log_cnt_reset)(void);
     int      (*log_msg_post)(uint8_t, char*, uint32_t);
 
+    //Tasks
+    //* since ABI 1.3 (rte_ver_minor >= PLC_APP_VER_MINOR_TASKS)
+    //* values are generated by target (plc_tasks.h), t_sz = 0 - tasks are run by run()
+    const plc_app_task_t *t_tab;   //Task table
+    uint8_t  t_sz;                 //Task table size
+    void (*run_tasks)(uint32_t);   //Run tasks (mask, PLC_APP_TASK_MAIN - with run())
+
+    //* since ABI 1.4 (rte_ver_minor >= PLC_APP_VER_MINOR_EVT)
+    //* t_evt[i] - located BOOL of SINGLE of task i (rising edge releases the task) or NULL
+    const plc_loc_dsc_t *const *t_evt; //Events of tasks [t_sz] or NULL (no events)
+
+    //* since ABI 1.5 (rte_ver_minor >= PLC_APP_VER_MINOR_CRC)
+    //* CRC-32 of image [plc_app_abi_t ... crc) of STM32 CRC unit, the last word of image (stamped after build)
+    const uint32_t *crc;           //CRC of application image
+
 } plc_app_abi_t;
 
 
@@ -34,6 +34,30 @@ extern plc_app_abi_t *PLC_APP_CURR;
 #define PLC_APP_VER_PATCH              PLC_RTE_VERSION_PATCH
 #define PLC_APP_HW_ID                  PLC_HW_CODE
 
+/** @def The first minor version of Application ABI-structure with the field
+ *  @note fields are appended to plc_app_funcs_t, so they are not written
+ *        into System Functions of application of an older version
+ */
+#define PLC_APP_VER_MINOR_SET_TIMER    1
+#define PLC_APP_VER_MINOR_RETAIN       2
+#define PLC_APP_VER_MINOR_TASKS        3
+#define PLC_APP_VER_MINOR_EVT          4
+#define PLC_APP_VER_MINOR_CRC          5
+#define PLC_APP_VER_MINOR_CNTR_CMP     6
+#define PLC_APP_VER_MINOR_PTO          7
+
+/** @def Max. number of located variables in index (2 bytes per variable)
+ *  @note l_tab of a longer application is scanned for every register
+ */
+#define PLC_APP_LOC_IDX_SZ             (uint16_t)1024
+
+/** @def Background check of application image (CRC, ABI 1.5)
+ *  @note image is checked by idle task in chunks (words per call of PlcApp_CrcStep()),
+ *        a new pass is started every period (ms), so a scan is never delayed
+ */
+#define PLC_APP_CRC_CHUNK_SZ           (uint32_t)256
+#define PLC_APP_CRC_PERIOD             (uint32_t)10000
+
 /** @def Application states
  */
 #define PLC_APP_STATE_STOPED           0x55
@@ -70,6 +94,53 @@ void PlcApp_Stop(void);
  */
 void PlcApp_Run(void);
 
+/** @brief  Run tasks of Application.
+ *  @param  TasksIn - mask of tasks (bit i - task i), PLC_APP_TASK_MAIN - main run (tick, debug, retain).
+ *  @return None.
+ *  @note   Application without tasks (PlcApp_GetTasksSz() = 0) is run by PLC_APP_TASK_MAIN only.
+ */
+void PlcApp_RunTasks(uint32_t TasksIn);
+
+/** @brief  Step of background check of application image.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called by idle task (never blocks), one chunk (PLC_APP_CRC_CHUNK_SZ) per call,
+ *          application without CRC (ABI < 1.5) is not checked.
+ */
+void PlcApp_CrcStep(void);
+
+/** @brief  Get result of background check of application image.
+ *  @param  None.
+ *  @return Result:
+ *  @arg     = 0 - image is valid (or not checked)
+ *  @arg     = 1 - image is corrupted (application is not started any more)
+ */
+uint8_t PlcApp_CrcIsErr(void);
+
+/** @brief  Get the number of tasks of Application.
+ *  @param  None.
+ *  @return The number of tasks (0 - tasks are selected by application, see run()).
+ */
+uint8_t PlcApp_GetTasksSz(void);
+
+/** @brief  Get task of Application.
+ *  @param  iTaskIn - number of task (0 ... PlcApp_GetTasksSz()-1).
+ *  @return Pointer to task or 0.
+ */
+const plc_app_task_t *PlcApp_GetTask(uint8_t iTaskIn);
+
+/** @brief  Get event of task of Application (SINGLE).
+ *  @param  iTaskIn - number of task (0 ... PlcApp_GetTasksSz()-1).
+ *  @return Pointer to located BOOL (rising edge releases the task) or 0 (task without event).
+ */
+const plc_loc_dsc_t *PlcApp_GetTaskEvt(uint8_t iTaskIn);
+
+/** @brief  Get tasks using located variable.
+ *  @param  VarIn - pointer to located variable (PlcApp_TestLocVar).
+ *  @return Mask of tasks (PLC_APP_TASK_ALL - application without tasks), 0 - variable is not bound.
+ */
+uint8_t PlcApp_GetLocTasks(const plc_loc_dsc_t *VarIn);
+
 /** @brief  Test Located variable.
  *  @param  ZoneIn   - ID of zone           (plc_app.v_type).
  *  @param  TypeSzIn - ID of data type size (plc_app.v_size).
@@ -78,6 +149,7 @@ void PlcApp_Run(void);
  *  @param  A01In    - ID of subgroup 1     (plc_app.a_data[1]) (<0 is not used).
  *  @param  A02In    - ID of subgroup 2     (plc_app.a_data[2]) (<0 is not used).
  *  @return Pointer to located variable structure or 0 (if located variable is not supported)
+ *  @note   Index of l_tab (built by PlcApp_Init) is searched, O(log(l_sz)).
  */
 plc_loc_dsc_t *PlcApp_TestLocVar(const uint8_t ZoneIn, const uint8_t TypeSzIn, const uint16_t GroupIn, const int32_t A00In, const int32_t A01In, const int32_t A02In);
 
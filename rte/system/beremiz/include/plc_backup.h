@@ -5,6 +5,33 @@
  * see License.txt for details.
  */
 
+/** @note
+ *        RETAIN variables of application (RTE_MOD_RETAIN), two images in RAM:
+ *        - work image: written by plc_backup_retain every scan (APP_T),
+ *          only changed bytes are copied, changed blocks are marked dirty
+ *        - validated image: dirty blocks are copied into it by plc_backup_validate
+ *          (end of retain-pass of scan), so it is always consistent
+ *
+ *        plc_backup_flush (DATA_T, every RTOS_DATA_RETAIN_FLUSH_TM) commits
+ *        the changed blocks of validated image into the journal in flash (retain.h),
+ *        a commit is atomic: after power loss the image of the last complete commit
+ *        is restored, changes of the last RTOS_DATA_RETAIN_FLUSH_TM may be lost.
+ *
+ *        Flash is erased by plc_backup_prepare (DATA_T) while application is stopped
+ *        and once between flushes after a compaction of journal, since CPU is stalled
+ *        by erasing (~0.25 ... 0.5 s). A commit that finds the spare sector not erased
+ *        (or fails) is deferred to the next flush (plc_backup_is_wait, SYS_STAT1.RetainWait),
+ *        changes are kept in RAM meanwhile.
+ *
+ *        RETAIN variables beyond PLC_RETAIN_SZ are not retained
+ *        (plc_backup_is_ovf, SYS_STAT1.RetainOvf).
+ *
+ *        Stored image belongs to application (id is md5 of application),
+ *        another application starts with default values.
+ *
+ *        Without RTE_MOD_RETAIN default values are used after every start.
+ */
+
 #ifndef _DBG_BACKUP_H_
 #define _DBG_BACKUP_H_
 
@@ -12,6 +39,45 @@
 #include <stdint.h>
 
 
+/*RTE related functions*/
+
+/** @brief  Init. retain-data (restore from flash).
+ *  @param  None.
+ *  @return None.
+ *  @note   Called before start of scheduler.
+ */
+void plc_backup_init(void);
+
+/** @brief  Commit changed retain-data into flash.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called by DATA_T.
+ */
+void plc_backup_flush(void);
+
+/** @brief  Erase flash for the next compaction of journal (if needed).
+ *  @param  None.
+ *  @return None.
+ *  @note   Called by DATA_T while application is stopped,
+ *          once between flushes while it is started (CPU is stalled by erasing).
+ */
+void plc_backup_prepare(void);
+
+/** @brief  Check deferred commits.
+ *  @param  None.
+ *  @return 1 - the last commit is deferred (spare sector is not erased yet or error of flash),
+ *          0 - OK.
+ */
+int plc_backup_is_wait(void);
+
+/** @brief  Check overflow of retain-data.
+ *  @param  None.
+ *  @return 1 - RETAIN variables of application beyond PLC_RETAIN_SZ are not retained,
+ *          0 - OK.
+ */
+int plc_backup_is_ovf(void);
+
+
 /*Bereiz related functions: these functions are used by Beremiz generated plc_debug.c file*/
 void plc_backup_invalidate(void);
 void plc_backup_validate(void);
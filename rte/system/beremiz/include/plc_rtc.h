@@ -5,13 +5,67 @@
  * see License.txt for details.
  */
 
+/** @note
+ *        Time of application (__CURRENT_TIME) is wall clock (ns since 1970-01-01):
+ *        - wall = monotonic 64-bit clock (ns since start, DWT.CYCCNT) + offset,
+ *          so getting of time does not read registers of RTC
+ *        - offset is taken from RTC at start and checked every RTOS_DATA_RTC_SYNC_TM,
+ *          it is corrected if wall clock is away from RTC more than PLC_RTC_SYNC_TOL_NS
+ *        - offset (and RTC) is changed by plc_rtc_dt_set (IDE, SYS_CMD.RTC_SET),
+ *          so time of application may step (as CLOCK_REALTIME of Linux target)
+ *        - latched once per scan with input image (plc_rtc_time_latch),
+ *          so every call of plc_rtc_time_get within a scan gets the same time
+ *
+ *        Without RTE_MOD_RTC wall clock is kept only in RAM (offset is 0 after start).
+ */
+
 #ifndef _RTC_H_
 #define _RTC_H_
 
+#include <stdint.h>
 #include <iec_types_all.h>
+#include "dt.h"
+
+
+/** @def Tolerance of wall clock to RTC (ns)
+ */
+#define PLC_RTC_SYNC_TOL_NS  10000000ULL
+
+
+/** @brief  Init. RTC and wall clock.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called after PlcDwt_Init() before start of scheduler.
+ */
+void  plc_rtc_init(void);
+
+/** @brief  Check wall clock by RTC (correct offset).
+ *  @param  None.
+ *  @return None.
+ */
+void  plc_rtc_sync(void);
+
+/** @brief  Set date and time (RTC and wall clock).
+ *  @param  dt - pointer to date and time.
+ *  @return Result:
+ *  @arg    = 0 - invalid date and time (or error of RTC)
+ *  @arg    = 1 - OK
+ */
+uint8_t plc_rtc_dt_set(const PlcDt_t *dt);
 
+/** @brief  Get date and time (wall clock).
+ *  @param  dt - pointer to date and time.
+ *  @return None.
+ */
+void  plc_rtc_dt_get(PlcDt_t *dt);
 
 void  plc_rtc_time_get(IEC_TIME *curent_time);
 
+/** @brief  Latch time of scan.
+ *  @param  None.
+ *  @return None.
+ */
+void  plc_rtc_time_latch(void);
+
 
 #endif //_RTC_H_
@@ -5,6 +5,13 @@
  * see License.txt for details.
  */
 
+/** @note
+ *        Scan timer of application (PLC_SetTimer):
+ *        - tick_next   - delay of the first scan (ns), 0 - at once
+ *        - tick_period - scan period (ns), 0 - scans are not released
+ *        Setup is taken by APP_T (scan timer is restarted on change).
+ */
+
 #ifndef _PLC_TICK_H_
 #define _PLC_TICK_H_
 
@@ -13,5 +20,12 @@
 
 void plc_tick_setup(uint64_t tick_next, uint64_t tick_period);
 
+/** @brief  Get setup of scan timer.
+ *  @param  tick_next - pointer to delay of the first scan (ns) or NULL.
+ *  @param  tick_period - pointer to scan period (ns) or NULL.
+ *  @return Counter of setups (0 - timer is not set up by application).
+ */
+uint32_t plc_tick_get(uint64_t *tick_next, uint64_t *tick_period);
+
 
 #endif /* _PLC_TICK_H_ */
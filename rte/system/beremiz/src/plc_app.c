@@ -4,7 +4,9 @@
  *       2020-2023, atgroup09@gmail.com
  */
 
+#include <stdlib.h>
 #include "plc_app.h"
+#include "crc.h"
 
 
 /** @var Application ABI-structure
@@ -20,6 +22,248 @@ uint8_t PLC_APP_STATE = PLC_APP_STATE_STOPED;
 const char plc_start_msg[]   = "Application is started.";
 const char plc_app_err_msg[] = "Application is not valid.";
 
+/** @var Index of located variables (positions in l_tab sorted by key)
+ */
+static uint16_t PlcApp_LocIdx[PLC_APP_LOC_IDX_SZ];
+static uint16_t PlcApp_LocIdxSz = 0;
+
+/** @var Index is built (else l_tab is scanned)
+ */
+static uint8_t  PlcApp_LocIdxOk = 0;
+
+/** @var Number of tasks of application (0 - application without tasks)
+ */
+static uint8_t  PlcApp_TasksSz = 0;
+
+/** @var Events of tasks of application (0 - tasks without events)
+ */
+static const plc_loc_dsc_t *const *PlcApp_TasksEvt = 0;
+
+/** @var Background check of application image:
+ *       CRC-word (end of image, 0 - image is not checked), the next word of the current pass (0 - no pass),
+ *       start of the latest pass (ms), image is corrupted
+ */
+static const uint32_t  *PlcApp_CrcEnd = 0;
+static const uint32_t  *PlcApp_CrcPtr = 0;
+static uint32_t         PlcApp_CrcTs  = 0;
+static volatile uint8_t PlcApp_CrcErr = 0;
+
+
+/** @typedef Key of located variable
+ */
+typedef struct PlcApp_LocKey_t_
+{
+    uint8_t  Zone;      //v_type
+    uint8_t  TypeSz;    //v_size
+    uint16_t Group;     //proto
+    uint16_t ASz;       //a_size
+    uint32_t A[3];      //a_data[0..2] (valid < ASz)
+
+} PlcApp_LocKey_t;
+
+
+/** @brief  Get key of located variable.
+ *  @param  VarIn - pointer to located variable.
+ *  @param  KeyOut - pointer to key.
+ *  @return None.
+ */
+static void PlcApp_LocKey(const plc_loc_dsc_t *VarIn, PlcApp_LocKey_t *KeyOut)
+{
+    uint16_t i;
+
+    KeyOut->Zone   = VarIn->v_type;
+    KeyOut->TypeSz = VarIn->v_size;
+    KeyOut->Group  = VarIn->proto;
+    KeyOut->ASz    = VarIn->a_size;
+
+    for(i=0; i<3; i++)
+    {
+        KeyOut->A[i] = ((i < VarIn->a_size) ? VarIn->a_data[i] : 0);
+    }
+}
+
+/** @brief  Compare located variable with key.
+ *  @param  VarIn - pointer to located variable.
+ *  @param  KeyIn - pointer to key.
+ *  @param  NumIn - number of compared a_data (0 ... 3).
+ *  @return Result:
+ *  @arg    < 0 - variable < key
+ *  @arg    = 0 - variable = key
+ *  @arg    > 0 - variable > key
+ *  @note   Absent a_data[i] (i >= a_size) is less than any value.
+ */
+static int PlcApp_LocCmp(const plc_loc_dsc_t *VarIn, const PlcApp_LocKey_t *KeyIn, uint8_t NumIn)
+{
+    uint8_t i, P1, P2;
+
+    if(VarIn->v_type != KeyIn->Zone)   return ((VarIn->v_type < KeyIn->Zone)   ? -1 : 1);
+    if(VarIn->v_size != KeyIn->TypeSz) return ((VarIn->v_size < KeyIn->TypeSz) ? -1 : 1);
+    if(VarIn->proto  != KeyIn->Group)  return ((VarIn->proto  < KeyIn->Group)  ? -1 : 1);
+
+    for(i=0; i<NumIn; i++)
+    {
+        P1 = (i < VarIn->a_size);
+        P2 = (i < KeyIn->ASz);
+        if(P1 != P2) return ((P1 < P2) ? -1 : 1);
+        if(P1 && VarIn->a_data[i] != KeyIn->A[i]) return ((VarIn->a_data[i] < KeyIn->A[i]) ? -1 : 1);
+    }
+    return (0);
+}
+
+/** @brief  Compare located variables of index (qsort).
+ *  @param  AIn - pointer to position 1.
+ *  @param  BIn - pointer to position 2.
+ *  @return Result of comparison (equal keys are sorted by position).
+ */
+static int PlcApp_LocIdxCmp(const void *AIn, const void *BIn)
+{
+    uint16_t A = *(const uint16_t *)AIn;
+    uint16_t B = *(const uint16_t *)BIn;
+    PlcApp_LocKey_t KB;
+    int Res;
+
+    PlcApp_LocKey(PLC_APP_CURR->l_tab[B], &KB);
+
+    Res = PlcApp_LocCmp(PLC_APP_CURR->l_tab[A], &KB, 3);
+    return ((Res) ? Res : ((A < B) ? -1 : 1));
+}
+
+/** @brief  Get the first position of index with key >= KeyIn.
+ *  @param  KeyIn - pointer to key.
+ *  @param  NumIn - number of compared a_data.
+ *  @return Position of index (PlcApp_LocIdxSz - all keys are less).
+ */
+static uint16_t PlcApp_LocIdxFind(const PlcApp_LocKey_t *KeyIn, uint8_t NumIn)
+{
+    uint16_t Lo = 0, Hi = PlcApp_LocIdxSz, Mid;
+
+    while(Lo < Hi)
+    {
+        Mid = Lo + (Hi-Lo)/2;
+
+        if(PlcApp_LocCmp(PLC_APP_CURR->l_tab[PlcApp_LocIdx[Mid]], KeyIn, NumIn) < 0) Lo = Mid+1;
+        else                                                                       Hi = Mid;
+    }
+    return (Lo);
+}
+
+/** @brief  Test located variable by a_data.
+ *  @param  VarIn - pointer to located variable.
+ *  @param  A00In, A01In, A02In - subgroups (<0 is not used).
+ *  @return Result:
+ *  @arg    = 0 - not matched
+ *  @arg    = 1 - matched
+ */
+static uint8_t PlcApp_TestLocVarA(const plc_loc_dsc_t *VarIn, const int32_t A00In, const int32_t A01In, const int32_t A02In)
+{
+    //test by:
+    //  A00 (l_tab[iVar]->a_data[0])
+    //  A01 (l_tab[iVar]->a_data[1])
+    //  A02 (l_tab[iVar]->a_data[2])
+    if(A00In >= 0 && VarIn->a_size >= 1)
+    {
+        if(VarIn->a_data[0] != (uint32_t)A00In) return (BIT_FALSE);
+    }
+
+    if(A01In >= 0 && VarIn->a_size >= 2)
+    {
+        if(VarIn->a_data[1] != (uint32_t)A01In) return (BIT_FALSE);
+    }
+
+    if(A02In >= 0 && VarIn->a_size >= 3)
+    {
+        if(VarIn->a_data[2] != (uint32_t)A02In) return (BIT_FALSE);
+    }
+
+    return (BIT_TRUE);
+}
+
+/** @brief  Build index of located variables.
+ *  @param  None.
+ *  @return None.
+ *  @note   One pass over l_tab and sorting (O(l_sz * log(l_sz))),
+ *          l_tab is scanned by PlcApp_TestLocVar if it is longer than PLC_APP_LOC_IDX_SZ.
+ */
+static void PlcApp_InitLocIdx(void)
+{
+    uint16_t iVar;
+
+    PlcApp_LocIdxSz = 0;
+    PlcApp_LocIdxOk = 0;
+
+    if(!PLC_APP_CURR || !PLC_APP_CURR->l_tab || PLC_APP_CURR->l_sz > PLC_APP_LOC_IDX_SZ) return;
+
+    for(iVar=0; iVar<PLC_APP_CURR->l_sz; iVar++)
+    {
+        //variables without buffer are never bound
+        if(PLC_APP_CURR->l_tab[iVar] && PLC_APP_CURR->l_tab[iVar]->v_buf)
+        {
+            PlcApp_LocIdx[PlcApp_LocIdxSz++] = iVar;
+        }
+    }
+
+    qsort(PlcApp_LocIdx, PlcApp_LocIdxSz, sizeof(PlcApp_LocIdx[0]), PlcApp_LocIdxCmp);
+    PlcApp_LocIdxOk = 1;
+}
+
+
+/** @brief  Get position of located variable in l_tab.
+ *  @param  VarIn - pointer to located variable.
+ *  @return Position or 0xFFFF (not found).
+ */
+static uint16_t PlcApp_GetLocPos(const plc_loc_dsc_t *VarIn)
+{
+    PlcApp_LocKey_t Key;
+    uint16_t iVar, iIdx;
+
+    if(PlcApp_LocIdxOk)
+    {
+        //range of equal keys
+        PlcApp_LocKey(VarIn, &Key);
+
+        for(iIdx=PlcApp_LocIdxFind(&Key, 3); iIdx<PlcApp_LocIdxSz; iIdx++)
+        {
+            iVar = PlcApp_LocIdx[iIdx];
+            if(PLC_APP_CURR->l_tab[iVar] == VarIn) return (iVar);
+            if(PlcApp_LocCmp(PLC_APP_CURR->l_tab[iVar], &Key, 3) != 0) break;
+        }
+        return (0xFFFF);
+    }
+
+    for(iVar=0; iVar<PLC_APP_CURR->l_sz; iVar++)
+    {
+        if(PLC_APP_CURR->l_tab[iVar] == VarIn) return (iVar);
+    }
+    return (0xFFFF);
+}
+
+/** @brief  Init. tasks of application.
+ *  @param  None.
+ *  @return None.
+ *  @note   Task table is taken if it is valid (else application is run by run() only),
+ *          task without interval must have event (SINGLE of located BOOL).
+ */
+static void PlcApp_InitTasks(void)
+{
+    uint8_t i;
+
+    PlcApp_TasksSz  = 0;
+    PlcApp_TasksEvt = 0;
+
+    if(PLC_APP_CURR->rte_ver_minor < PLC_APP_VER_MINOR_TASKS) return;
+    if(!PLC_APP_CURR->t_tab || !PLC_APP_CURR->run_tasks || PLC_APP_CURR->t_sz > PLC_APP_TASK_MAX) return;
+
+    if(PLC_APP_CURR->rte_ver_minor >= PLC_APP_VER_MINOR_EVT) PlcApp_TasksEvt = PLC_APP_CURR->t_evt;
+
+    for(i=0; i<PLC_APP_CURR->t_sz; i++)
+    {
+        if(PlcApp_TasksEvt && PlcApp_TasksEvt[i] && PlcApp_TasksEvt[i]->v_size != PLC_LSZ_X) return;
+        if(!PLC_APP_CURR->t_tab[i].ticks && !(PlcApp_TasksEvt && PlcApp_TasksEvt[i])) return;
+    }
+
+    PlcApp_TasksSz = PLC_APP_CURR->t_sz;
+}
+
 
 /** @brief  Init. Application ABI-structure
  *  @param  None.
@@ -34,6 +278,11 @@ uint8_t PlcApp_Init(void)
         plc_app_cstratup();
 
         PLC_APP_CURR = (plc_app_abi_t *)PLC_APP;
+        PlcApp_InitLocIdx();
+        PlcApp_InitTasks();
+        //CRC is checked by plc_app_is_valid()
+        if(PLC_APP_CURR->rte_ver_minor >= PLC_APP_VER_MINOR_CRC) PlcApp_CrcEnd = PLC_APP_CURR->crc;
+        PlcApp_CrcTs = HAL_GetTick();
         //PLC_APP_CURR->log_msg_post(LOG_DEBUG, (char *)plc_start_msg, sizeof(plc_start_msg));
 
 #ifdef DEBUG_LOG_APP
@@ -49,10 +298,11 @@ uint8_t PlcApp_Init(void)
 /** @brief  Start Application.
  *  @param  None.
  *  @return None.
+ *  @note   Application with corrupted image (PlcApp_CrcIsErr()) is not started.
  */
 void PlcApp_Start(void)
 {
-    if(PLC_APP_CURR)
+    if(PLC_APP_CURR && !PlcApp_CrcErr)
     {
         PLC_APP_CURR->start(0, 0);
         PLC_APP_STATE = PLC_APP_STATE_STARTED;
@@ -84,6 +334,127 @@ void PlcApp_Run(void)
     }
 }
 
+/** @brief  Run tasks of Application.
+ *  @param  TasksIn - mask of tasks (bit i - task i), PLC_APP_TASK_MAIN - main run (tick, debug, retain).
+ *  @return None.
+ */
+void PlcApp_RunTasks(uint32_t TasksIn)
+{
+    if(PLC_APP_CURR)
+    {
+        if(PlcApp_TasksSz)
+        {
+            PLC_APP_CURR->run_tasks(TasksIn);
+        }
+        else if(TasksIn & PLC_APP_TASK_MAIN)
+        {
+            PLC_APP_CURR->run();
+        }
+    }
+}
+
+/** @brief  Step of background check of application image.
+ *  @param  None.
+ *  @return None.
+ *  @note   Called by idle task (never blocks), one chunk (PLC_APP_CRC_CHUNK_SZ) per call,
+ *          application without CRC (ABI < 1.5) is not checked.
+ */
+void PlcApp_CrcStep(void)
+{
+    uint32_t Sz, Crc;
+
+    if(!PlcApp_CrcEnd || PlcApp_CrcErr) return;
+
+    if(!PlcApp_CrcPtr)
+    {
+        //the next pass
+        if((uint32_t)(HAL_GetTick()-PlcApp_CrcTs) < PLC_APP_CRC_PERIOD) return;
+
+        PlcApp_CrcTs  = HAL_GetTick();
+        PlcApp_CrcPtr = (const uint32_t *)PLC_APP_CURR;
+        PlcCrc_Reset();
+    }
+
+    Sz = (uint32_t)(PlcApp_CrcEnd-PlcApp_CrcPtr);
+    if(Sz > PLC_APP_CRC_CHUNK_SZ) Sz = PLC_APP_CRC_CHUNK_SZ;
+
+    Crc = PlcCrc_Put(PlcApp_CrcPtr, Sz);
+    PlcApp_CrcPtr += Sz;
+
+    if(PlcApp_CrcPtr >= PlcApp_CrcEnd)
+    {
+        //pass is completed
+        if(Crc != *PlcApp_CrcEnd) PlcApp_CrcErr = 1;
+        PlcApp_CrcPtr = 0;
+    }
+}
+
+/** @brief  Get result of background check of application image.
+ *  @param  None.
+ *  @return Result:
+ *  @arg     = 0 - image is valid (or not checked)
+ *  @arg     = 1 - image is corrupted (application is not started any more)
+ */
+uint8_t PlcApp_CrcIsErr(void)
+{
+    return (PlcApp_CrcErr);
+}
+
+/** @brief  Get the number of tasks of Application.
+ *  @param  None.
+ *  @return The number of tasks (0 - tasks are selected by application, see run()).
+ */
+uint8_t PlcApp_GetTasksSz(void)
+{
+    return (PlcApp_TasksSz);
+}
+
+/** @brief  Get task of Application.
+ *  @param  iTaskIn - number of task (0 ... PlcApp_GetTasksSz()-1).
+ *  @return Pointer to task or 0.
+ */
+const plc_app_task_t *PlcApp_GetTask(uint8_t iTaskIn)
+{
+    return ((iTaskIn < PlcApp_TasksSz) ? &PLC_APP_CURR->t_tab[iTaskIn] : 0);
+}
+
+/** @brief  Get event of task of Application (SINGLE).
+ *  @param  iTaskIn - number of task (0 ... PlcApp_GetTasksSz()-1).
+ *  @return Pointer to located BOOL (rising edge releases the task) or 0 (task without event).
+ */
+const plc_loc_dsc_t *PlcApp_GetTaskEvt(uint8_t iTaskIn)
+{
+    return ((iTaskIn < PlcApp_TasksSz && PlcApp_TasksEvt) ? PlcApp_TasksEvt[iTaskIn] : 0);
+}
+
+/** @brief  Get tasks using located variable.
+ *  @param  VarIn - pointer to located variable (PlcApp_TestLocVar).
+ *  @return Mask of tasks (PLC_APP_TASK_ALL - application without tasks), 0 - variable is not bound.
+ *  @note   Variable is used by every task if it is not found in l_tab (or task has no l_map).
+ */
+uint8_t PlcApp_GetLocTasks(const plc_loc_dsc_t *VarIn)
+{
+    const plc_app_task_t *Task;
+    uint16_t iVar;
+    uint8_t  i, Res = 0;
+
+    if(!VarIn)           return (0);
+    if(!PlcApp_TasksSz)  return ((uint8_t)PLC_APP_TASK_ALL);
+
+    iVar = PlcApp_GetLocPos(VarIn);
+
+    for(i=0; i<PlcApp_TasksSz; i++)
+    {
+        Task = &PLC_APP_CURR->t_tab[i];
+
+        if(iVar == 0xFFFF || !Task->l_map || (Task->l_map[iVar/32] & ((uint32_t)1 << (iVar%32))))
+        {
+            Res |= (uint8_t)(1 << i);
+        }
+    }
+    return (Res);
+}
+
 
 /** @brief  Test Located variable.
  *  @param  ZoneIn   - ID of zone           (plc_app.v_type).
@@ -93,46 +464,72 @@ void PlcApp_Run(void)
  *  @param  A01In    - ID of subgroup 1     (plc_app.a_data[1]) (<0 is not used).
  *  @param  A02In    - ID of subgroup 2     (plc_app.a_data[2]) (<0 is not used).
  *  @return Pointer to located variable structure or 0 (if located variable is not supported)
+ *  @note   Index of l_tab (built by PlcApp_Init) is searched, O(log(l_sz)).
  */
 plc_loc_dsc_t *PlcApp_TestLocVar(const uint8_t ZoneIn, const uint8_t TypeSzIn, const uint16_t GroupIn, const int32_t A00In, const int32_t A01In, const int32_t A02In)
 {
     plc_loc_dsc_t *Res = 0;
-    uint16_t iVar;
+    const plc_loc_dsc_t *Var;
+    PlcApp_LocKey_t Key;
+    uint16_t iVar, iIdx, iRes = 0xFFFF;
 
     if(PLC_APP_CURR)
     {
         if(PLC_APP_CURR->l_tab && PLC_APP_CURR->l_sz > 0)
         {
-            for(iVar=0; iVar<PLC_APP_CURR->l_sz; iVar++)
+            if(PlcApp_LocIdxOk)
             {
-                //test by:
-                //  Zone   (l_tab[iVar].v_type)
-                //  TypeSz (l_tab[iVar].v_size)
-                //  Group  (l_tab[iVar].proto)
-                //  v_buf
-                if(PLC_APP_CURR->l_tab[iVar]->v_type == ZoneIn && PLC_APP_CURR->l_tab[iVar]->v_size == TypeSzIn && PLC_APP_CURR->l_tab[iVar]->proto == GroupIn && PLC_APP_CURR->l_tab[iVar]->v_buf)
+                //range of Zone, TypeSz, Group:
+                //  variables without a_data (the first ones) match any A00,
+                //  then variables with a_data[0] == A00 (A00 < 0 - the rest of range);
+                //the first matched in l_tab is taken (as by scan)
+                Key.Zone   = ZoneIn;
+                Key.TypeSz = TypeSzIn;
+                Key.Group  = GroupIn;
+                Key.ASz    = 0;
+
+                for(iIdx=PlcApp_LocIdxFind(&Key, 0); iIdx<PlcApp_LocIdxSz; iIdx++)
                 {
-                    //test by:
-                    //  A00 (l_tab[iVar]->a_data[0])
-                    //  A01 (l_tab[iVar]->a_data[1])
-                    //  A02 (l_tab[iVar]->a_data[2])
-                    if(A00In >= 0 && PLC_APP_CURR->l_tab[iVar]->a_size >= 1)
-                    {
-                        if(PLC_APP_CURR->l_tab[iVar]->a_data[0] != (uint32_t)A00In) continue;
-                    }
+                    Var = PLC_APP_CURR->l_tab[PlcApp_LocIdx[iIdx]];
+                    if(Var->a_size > 0 || PlcApp_LocCmp(Var, &Key, 0) != 0) break;
 
-                    if(A01In >= 0 && PLC_APP_CURR->l_tab[iVar]->a_size >= 2)
-                    {
-                        if(PLC_APP_CURR->l_tab[iVar]->a_data[1] != (uint32_t)A01In) continue;
-                    }
+                    if(PlcApp_LocIdx[iIdx] < iRes && PlcApp_TestLocVarA(Var, A00In, A01In, A02In)) iRes = PlcApp_LocIdx[iIdx];
+                }
 
-                    if(A02In >= 0 && PLC_APP_CURR->l_tab[iVar]->a_size >= 3)
+                if(A00In >= 0)
+                {
+                    Key.ASz  = 1;
+                    Key.A[0] = (uint32_t)A00In;
+                    iIdx     = PlcApp_LocIdxFind(&Key, 1);
+                }
+
+                for(; iIdx<PlcApp_LocIdxSz; iIdx++)
+                {
+                    Var = PLC_APP_CURR->l_tab[PlcApp_LocIdx[iIdx]];
+                    if(PlcApp_LocCmp(Var, &Key, (uint8_t)Key.ASz) != 0) break;
+
+                    if(PlcApp_LocIdx[iIdx] < iRes && PlcApp_TestLocVarA(Var, A00In, A01In, A02In)) iRes = PlcApp_LocIdx[iIdx];
+                }
+
+                if(iRes != 0xFFFF) Res = (plc_loc_dsc_t *)PLC_APP_CURR->l_tab[iRes];
+            }
+            else
+            {
+                for(iVar=0; iVar<PLC_APP_CURR->l_sz; iVar++)
+                {
+                    //test by:
+                    //  Zone   (l_tab[iVar].v_type)
+                    //  TypeSz (l_tab[iVar].v_size)
+                    //  Group  (l_tab[iVar].proto)
+                    //  v_buf
+                    if(PLC_APP_CURR->l_tab[iVar]->v_type == ZoneIn && PLC_APP_CURR->l_tab[iVar]->v_size == TypeSzIn && PLC_APP_CURR->l_tab[iVar]->proto == GroupIn && PLC_APP_CURR->l_tab[iVar]->v_buf)
                     {
-                        if(PLC_APP_CURR->l_tab[iVar]->a_data[2] != (uint32_t)A02In) continue;
+                        if(PlcApp_TestLocVarA(PLC_APP_CURR->l_tab[iVar], A00In, A01In, A02In))
+                        {
+                            Res = (plc_loc_dsc_t *)PLC_APP_CURR->l_tab[iVar];
+                            break;
+                        }
                     }
-
-                    Res = (plc_loc_dsc_t *)PLC_APP_CURR->l_tab[iVar];
-                    break;
                 }
             }
         }
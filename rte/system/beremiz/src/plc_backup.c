@@ -6,39 +6,242 @@
  */
 
 #include "plc_backup.h"
+#include "plc_app.h"
+#include "flash.h"
+#include "retain.h"
+
+
+#ifdef RTE_MOD_RETAIN
+
+/** @var Work image (APP_T)
+ */
+static uint8_t  plc_backup_img[PLC_RETAIN_SZ];
+
+/** @var Validated image (committed by DATA_T)
+ */
+static uint8_t  plc_backup_copy[PLC_RETAIN_SZ];
+
+/** @var Blocks of work image changed since the last validation
+ */
+static uint32_t plc_backup_dirty = 0;
+
+/** @var Blocks of validated image not committed yet
+ */
+static volatile uint32_t plc_backup_pend = 0;
+
+/** @var Validated image is being committed (must not be changed)
+ */
+static volatile uint8_t  plc_backup_busy = 0;
+
+/** @var Retain-pass of scan (between invalidate and validate)
+ */
+static uint8_t  plc_backup_pass = 0;
+
+/** @var Commits are deferred (spare sector is not erased or error of flash, see plc_backup_prepare)
+ */
+static volatile uint8_t  plc_backup_wait = 0;
+
+/** @var RETAIN variables beyond PLC_RETAIN_SZ (not retained)
+ */
+static volatile uint8_t  plc_backup_ovf = 0;
+
+/** @var Image is restored from flash
+ */
+static uint8_t  plc_backup_valid = 0;
+
+/** @var Id of application of image
+ */
+static uint32_t plc_backup_id = 0;
+
+#endif //RTE_MOD_RETAIN
+
+
+void plc_backup_init(void)
+{
+#ifdef RTE_MOD_RETAIN
+    //validated image is a buffer of unfinished commit while restoring
+    plc_backup_valid = PlcRetain_Init(&PlcFlash_RetainPort, plc_backup_img, plc_backup_copy, &plc_backup_id);
+    memcpy(plc_backup_copy, plc_backup_img, PLC_RETAIN_SZ);
+#endif //RTE_MOD_RETAIN
+}
+
+void plc_backup_flush(void)
+{
+#ifdef RTE_MOD_RETAIN
+    uint32_t mask, id;
+    uint32_t prim = __get_PRIMASK();
+    uint8_t  res;
+
+    __disable_irq();
+    mask = plc_backup_pend;
+    id   = plc_backup_id;
+    plc_backup_pend = 0;
+    plc_backup_busy = (mask) ? 1 : 0;
+    __set_PRIMASK(prim);
+
+    if(!mask) return;
+
+    res = PlcRetain_Write(plc_backup_copy, mask, id);
+    plc_backup_wait = (res != BIT_TRUE) ? 1 : 0;
+
+    if(res != BIT_TRUE)
+    {
+        //try again by the next flush
+        __disable_irq();
+        plc_backup_pend |= mask;
+        __set_PRIMASK(prim);
+    }
+    plc_backup_busy = 0;
+#endif //RTE_MOD_RETAIN
+}
+
+
+void plc_backup_prepare(void)
+{
+#ifdef RTE_MOD_RETAIN
+    PlcRetain_Prepare();
+#endif //RTE_MOD_RETAIN
+}
+
+
+int plc_backup_is_wait(void)
+{
+#ifdef RTE_MOD_RETAIN
+    return ((plc_backup_wait) ? 1 : 0);
+#else
+    return 0;
+#endif //RTE_MOD_RETAIN
+}
+
+
+int plc_backup_is_ovf(void)
+{
+#ifdef RTE_MOD_RETAIN
+    return ((plc_backup_ovf) ? 1 : 0);
+#else
+    return 0;
+#endif //RTE_MOD_RETAIN
+}
 
 
 void plc_backup_invalidate(void)
 {
-    //pwr_disable_backup_domain_write_protect();
-    //PLC_BKP_VER1++;
-    //pwr_enable_backup_domain_write_protect();
+#ifdef RTE_MOD_RETAIN
+    plc_backup_pass = 1;
+#endif //RTE_MOD_RETAIN
 }
 
 
 void plc_backup_validate(void)
 {
+#ifdef RTE_MOD_RETAIN
+    uint32_t i;
+    uint32_t prim = __get_PRIMASK();
+
+    if(!plc_backup_pass) return;
+    plc_backup_pass = 0;
 
+    if(!plc_backup_dirty) return;
+
+    //blocks stay dirty while the previous commit is written
+    __disable_irq();
+    if(!plc_backup_busy)
+    {
+        for(i=0; i<PLC_RETAIN_BLK_NUM; i++)
+        {
+            if(plc_backup_dirty & ((uint32_t)1 << i))
+            {
+                memcpy(&plc_backup_copy[i*PLC_RETAIN_BLK_SZ], &plc_backup_img[i*PLC_RETAIN_BLK_SZ], PLC_RETAIN_BLK_SZ);
+            }
+        }
+        plc_backup_pend |= plc_backup_dirty;
+        plc_backup_dirty = 0;
+    }
+    __set_PRIMASK(prim);
+#endif //RTE_MOD_RETAIN
 }
 
 
 int plc_backup_check(void)
 {
+#ifdef RTE_MOD_RETAIN
+    uint32_t id = PlcRetain_GetId((PLC_APP_CURR) ? PLC_APP_CURR->id : 0);
+    uint32_t prim;
+
+    //size of retain-data is checked again by the application
+    plc_backup_ovf = 0;
+
+    if(plc_backup_valid && plc_backup_id == id) return 1;
+
+    //another application: defaults are used, the whole image is committed by the first scan
+    prim = __get_PRIMASK();
+    __disable_irq();
+    memset(plc_backup_img, 0, PLC_RETAIN_SZ);
+    plc_backup_dirty = PLC_RETAIN_BLK_ALL;
+    plc_backup_id    = id;
+    plc_backup_valid = 1;
+    __set_PRIMASK(prim);
+#endif //RTE_MOD_RETAIN
+
     return 0; //Fail! Use dafaults!
 }
 
 
 void plc_backup_remind(unsigned int offset, unsigned int count, void *p)
 {
+#ifdef RTE_MOD_RETAIN
+    if(!p) return;
+
+    //variable beyond PLC_RETAIN_SZ keeps default value
+    if(offset >= PLC_RETAIN_SZ || count > PLC_RETAIN_SZ-offset)
+    {
+        plc_backup_ovf = 1;
+        return;
+    }
+
+    memcpy(p, &plc_backup_img[offset], count);
+#else
     (void)offset;
     (void)count;
     (void)p;
+#endif //RTE_MOD_RETAIN
 }
 
 
 void plc_backup_retain(unsigned int offset, unsigned int count, void *p)
 {
+#ifdef RTE_MOD_RETAIN
+    const uint8_t *src = (const uint8_t *)p;
+    unsigned int   n;
+
+    if(!p) return;
+
+    //variables beyond PLC_RETAIN_SZ are not retained (SYS_STAT1.RetainOvf)
+    if(offset >= PLC_RETAIN_SZ || count > PLC_RETAIN_SZ-offset)
+    {
+        plc_backup_ovf = 1;
+        return;
+    }
+
+    //only changed bytes are copied (by parts within blocks)
+    while(count)
+    {
+        n = PLC_RETAIN_BLK_SZ - offset%PLC_RETAIN_BLK_SZ;
+        if(n > count) n = count;
+
+        if(memcmp(&plc_backup_img[offset], src, n))
+        {
+            memcpy(&plc_backup_img[offset], src, n);
+            plc_backup_dirty |= ((uint32_t)1 << (offset/PLC_RETAIN_BLK_SZ));
+        }
+
+        offset += n;
+        src    += n;
+        count  -= n;
+    }
+#else
     (void)offset;
     (void)count;
     (void)p;
+#endif //RTE_MOD_RETAIN
 }
@@ -5,6 +5,7 @@
  */
 
 #include "plc_glue_rte.h"
+#include "crc.h"
 
 
 /*
@@ -180,7 +181,22 @@ bool plc_app_is_valid(void)
         return false;
     }
 
-    ///TODO: Add with CRC check
+    //Check CRC of image (since ABI 1.5, the last word of image)
+    //one pass of CRC unit (~4 cycles per word), scheduler is not started yet
+    if (is_correct && PLC_APP->rte_ver_minor >= PLC_APP_VER_MINOR_CRC)
+    {
+        PLC_CHECK_CODE(PLC_APP->crc);
+        if (PLC_APP->crc <= (const uint32_t *)PLC_APP || PLC_APP->crc >= (const uint32_t *)&_app_end || ((uint32_t)PLC_APP->crc & 0x3))
+        {
+            return false;
+        }
+
+        if (PlcCrc_Calc((const uint32_t *)PLC_APP, (uint32_t)(PLC_APP->crc - (const uint32_t *)PLC_APP)) != *PLC_APP->crc)
+        {
+            return false;
+        }
+    }
+
     return is_correct;
 }
 
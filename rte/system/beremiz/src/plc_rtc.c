@@ -18,9 +18,124 @@
  */
 
 #include "plc_rtc.h"
+#include "dwt.h"
+#include "rtc.h"
 
 
+#define PLC_RTC_NS_PER_S  1000000000ULL
+
+/** @var Time of scan
+ */
+static IEC_TIME plc_rtc_time = { 0, 0 };
+
+/** @var Offset of wall clock to monotonic clock (ns, modulo 2^64)
+ */
+static uint64_t plc_rtc_ofs = 0;
+
+#ifdef RTE_MOD_RTC
+/** @var Offset is taken from RTC
+ */
+static uint8_t  plc_rtc_synced = 0;
+#endif //RTE_MOD_RTC
+
+
+static uint64_t plc_rtc_ofs_get(void)
+{
+    uint32_t prim = __get_PRIMASK();
+    uint64_t ofs;
+
+    __disable_irq();
+    ofs = plc_rtc_ofs;
+    __set_PRIMASK(prim);
+
+    return (ofs);
+}
+
+static void plc_rtc_ofs_set(uint64_t wall_ns, uint64_t mono_ns)
+{
+    uint32_t prim = __get_PRIMASK();
+
+    __disable_irq();
+    plc_rtc_ofs = wall_ns - mono_ns;
+    __set_PRIMASK(prim);
+}
+
+static uint64_t plc_rtc_ns(void)
+{
+    return (PlcDwt_GetNs() + plc_rtc_ofs_get());
+}
+
+
+void plc_rtc_init(void)
+{
+#ifdef RTE_MOD_RTC
+    if(PlcRtc_Init())
+    {
+        plc_rtc_sync();
+    }
+#endif //RTE_MOD_RTC
+}
+
+void plc_rtc_sync(void)
+{
+#ifdef RTE_MOD_RTC
+    PlcDt_t  dt;
+    uint32_t ns;
+    uint64_t mono, wall;
+    int64_t  err;
+    uint8_t  res;
+    uint32_t prim = __get_PRIMASK();
+
+    //reading of RTC and monotonic clock at the same moment (a few us)
+    __disable_irq();
+    res  = PlcRtc_Get(&dt, &ns);
+    mono = PlcDwt_GetNs();
+    __set_PRIMASK(prim);
+
+    if(!res || !PlcDt_IsValid(&dt)) return;
+
+    wall = (uint64_t)PlcDt_ToSec(&dt)*PLC_RTC_NS_PER_S + ns;
+    err  = (int64_t)(wall - (mono + plc_rtc_ofs_get()));
+
+    if(!plc_rtc_synced || err > (int64_t)PLC_RTC_SYNC_TOL_NS || err < -(int64_t)PLC_RTC_SYNC_TOL_NS)
+    {
+        plc_rtc_ofs_set(wall, mono);
+        plc_rtc_synced = 1;
+    }
+#endif //RTE_MOD_RTC
+}
+
+uint8_t plc_rtc_dt_set(const PlcDt_t *dt)
+{
+    if(!PlcDt_IsValid(dt)) return (BIT_FALSE);
+
+#ifdef RTE_MOD_RTC
+    if(!PlcRtc_Set(dt)) return (BIT_FALSE);
+#endif //RTE_MOD_RTC
+
+    //subseconds of RTC are reset by setting
+    plc_rtc_ofs_set((uint64_t)PlcDt_ToSec(dt)*PLC_RTC_NS_PER_S, PlcDwt_GetNs());
+
+    return (BIT_TRUE);
+}
+
+void plc_rtc_dt_get(PlcDt_t *dt)
+{
+    PlcDt_FromSec((uint32_t)(plc_rtc_ns()/PLC_RTC_NS_PER_S), dt);
+}
+
 void plc_rtc_time_get(IEC_TIME *current_time)
 {
-    (void)current_time;
+    if(current_time)
+    {
+        *current_time = plc_rtc_time;
+    }
+}
+
+void plc_rtc_time_latch(void)
+{
+    uint64_t ns = plc_rtc_ns();
+
+    plc_rtc_time.tv_sec  = (long int)(ns/PLC_RTC_NS_PER_S);
+    plc_rtc_time.tv_nsec = (long int)(ns%PLC_RTC_NS_PER_S);
 }
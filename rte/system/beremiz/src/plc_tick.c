@@ -8,9 +8,27 @@
 #include "plc_tick.h"
 
 
+/** @var Setup of scan timer (set and taken by APP_T)
+ */
+static uint64_t plc_tick_next   = 0;
+static uint64_t plc_tick_period = 0;
+static uint32_t plc_tick_cnt    = 0;
+
+
 //Tick period in ns
 void plc_tick_setup(uint64_t tick_next, uint64_t tick_period)
 {
-    (void)tick_next;
-    (void)tick_period;
+    plc_tick_next   = tick_next;
+    plc_tick_period = tick_period;
+
+    //0 is reserved for "not set up"
+    if(++plc_tick_cnt == 0) plc_tick_cnt = 1;
+}
+
+uint32_t plc_tick_get(uint64_t *tick_next, uint64_t *tick_period)
+{
+    if(tick_next)   *tick_next   = plc_tick_next;
+    if(tick_period) *tick_period = plc_tick_period;
+
+    return (plc_tick_cnt);
 }
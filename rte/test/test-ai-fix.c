@@ -0,0 +1,272 @@
+/* @page test-ai-fix.c
+ *       PLC411::RTE
+ *       Host unit test: fixed-point AI survey (ai.h, scale.c, sensors) against float
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Procedure:
+ *        - every ADC-code of every oversampling (0 ... PLC_AI_OVS__MAX) is converted into V
+ *          by PLC_AI_CODE_TO_ANA_Q (PlcAI_GetAnaQ) and by float (PlcAI_GetAna),
+ *          then scaled by ScaleQ and by ScaleA for a set of Ka, Kb (fixed-point range only);
+ *          both are compared with double of the exact V (3.3*Code/(4095*2^n))
+ *        - TMP36 and MCU_TEMP: ScaleQ by sensor factors against the float functions of sensors
+ *        - throughput: ADC-code > V > scale > 16-point table per sample, float against fixed point
+ *          (printed only, time of host is not checked)
+ *
+ *        Checks:
+ *        - V: error <= 0.55 LSB of Q16
+ *        - scaled value (Q16, before REAL): error <= (0.6*|Ka| + 1.1) LSB of Q16,
+ *          below 1 LSB of ADC-code if |Ka| >= 1
+ *        - sensors: the same as float within 0.002 C
+ *        - limits of ScaleQ_Set (NaN, range, negligible Ka), saturation of ScaleQ
+ *
+ *        Results (printed by the test; x86-64, gcc -O2):
+ *        - V: fixed point 7.8e-6 V (0.51 LSB of Q16), float 1.0e-6 V
+ *        - scaled value: fixed point 2.4e-6 of span for |Ka| >= 1 (1 LSB of 16-bit code is 1.5e-5),
+ *          7.6e-6 absolute for Ka = 0.001 (0.5 LSB of Q16); float 3e-5 absolute for small Ka
+ *          (REAL near Kb = 1000), 3.4e-7 of span for Ka = 9000
+ *        - throughput: 31 ns per sample in fixed point, 45 ns in float
+ *        The target (Cortex-M4F) is not measured here: float is single precision in both paths there,
+ *        the gain of fixed point is that the DMA ISR and AI_TIM do not use FPU context.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "test.h"
+#include "ai.h"
+#include "sensors/tmp36.h"
+#include "sensors/tmp-mcu.h"
+
+
+/** @def Q16
+ */
+#define TEST_LSB                                 (1.0/65536.0)
+
+/** @def Samples of benchmark
+ */
+#define TEST_BENCH_SZ                            (uint32_t)4096
+#define TEST_BENCH_RUNS                          (uint32_t)2000
+
+
+/** @brief  Exact analog value (V).
+ */
+static double TestAna(uint32_t CodeIn, uint8_t BitsIn)
+{
+	return (3.3*CodeIn/(4095.0*(1 << BitsIn)));
+}
+
+/** @brief  Float analog value (the same as PlcAI_GetAna).
+ */
+static float TestAnaF(uint32_t CodeIn, uint8_t BitsIn)
+{
+	return (ScaleA((float)CodeIn, PLC_AI_KA_3V3/(float)((uint32_t)1 << BitsIn), PLC_AI_KB_3V3));
+}
+
+
+/** @brief  ADC-code > V.
+ */
+static void TestAnaQ(void)
+{
+	double ErrQ = 0.0, ErrF = 0.0;
+
+	for(uint8_t Bits=0; Bits<=PLC_AI_OVS__MAX; Bits++)
+	{
+		for(uint32_t Code=0; Code<=((uint32_t)PLC_AI_DIG_MAX << Bits); Code++)
+		{
+			double V   = TestAna(Code, Bits);
+			double Err = fabs(PLC_AI_CODE_TO_ANA_Q(Code, Bits)*TEST_LSB - V);
+
+			if(Err > ErrQ) ErrQ = Err;
+			if(fabs(TestAnaF(Code, Bits) - V) > ErrF) ErrF = fabs(TestAnaF(Code, Bits) - V);
+		}
+
+		//full scale
+		TEST_CHECK_MSG(abs(PLC_AI_CODE_TO_ANA_Q((uint32_t)PLC_AI_DIG_MAX << Bits, Bits) - (int32_t)lround(3.3*65536.0)) <= 1, "bits %u", Bits);
+		TEST_CHECK(PLC_AI_CODE_TO_ANA_Q(0, Bits) == 0);
+	}
+
+	TEST_CHECK_MSG(ErrQ <= 0.55*TEST_LSB, "V: error %.3g", ErrQ);
+	printf("  V: max. error: fixed point %.2e V, float %.2e V\n", ErrQ, ErrF);
+}
+
+/** @brief  Scaled value.
+ */
+static void TestScale(void)
+{
+	static const float Ka[] = { 0.001f, 0.01f, 0.1f, 0.4f, 1.0f, 10.0f, 100.0f, 1000.0f, 9000.0f, -1.0f, -250.0f };
+	static const float Kb[] = { 0.0f, -50.0f, 12.5f, 1000.0f };
+	ScaleQ_t Scale;
+
+	for(uint32_t a=0; a<sizeof(Ka)/sizeof(Ka[0]); a++)
+	{
+		double ErrSpan = 0.0, ErrAbs = 0.0, ErrF = 0.0;
+
+		for(uint32_t b=0; b<sizeof(Kb)/sizeof(Kb[0]); b++)
+		{
+			//survey in float (rtos-ai.c)
+			if(fabsf(Ka[a])*PLC_AI_ANA_MAX + fabsf(Kb[b]) >= PLC_AI_FIX_VAL__MAX) continue;
+
+			TEST_CHECK_MSG(ScaleQ_Set(&Scale, Ka[a], Kb[b]) == BIT_TRUE, "Ka %g, Kb %g", Ka[a], Kb[b]);
+
+			for(uint8_t Bits=0; Bits<=PLC_AI_OVS__MAX; Bits++)
+			{
+				double Bound = (0.6*fabs(Ka[a]) + 1.1)*TEST_LSB;
+				double AdcLsb = fabs(Ka[a])*3.3/(4095.0*(1 << Bits));
+
+				for(uint32_t Code=0; Code<=((uint32_t)PLC_AI_DIG_MAX << Bits); Code++)
+				{
+					double Y   = (double)Ka[a]*TestAna(Code, Bits) + Kb[b];
+					double Err = fabs(ScaleQ(PLC_AI_CODE_TO_ANA_Q(Code, Bits), &Scale)*TEST_LSB - Y);
+
+					if(Err > Bound || (fabs(Ka[a]) >= 1.0f && Err >= AdcLsb))
+					{
+						TEST_CHECK_MSG(0, "Ka %g, Kb %g, bits %u, code %u: error %.3g", Ka[a], Kb[b], Bits, Code, Err);
+						if(TestFails > 50) return;
+					}
+					if(Err > ErrAbs) ErrAbs = Err;
+					if(Err/(fabs(Ka[a])*3.3) > ErrSpan) ErrSpan = Err/(fabs(Ka[a])*3.3);
+					if(fabs(ScaleA(TestAnaF(Code, Bits), Ka[a], Kb[b]) - Y) > ErrF) ErrF = fabs(ScaleA(TestAnaF(Code, Bits), Ka[a], Kb[b]) - Y);
+				}
+				TestChecks++;
+			}
+		}
+		printf("  Ka %-8g: max. error: fixed point %.2e (%.2e of span), float %.2e\n", Ka[a], ErrAbs, ErrSpan, ErrF);
+	}
+}
+
+/** @brief  Sensors: fixed point by factors of sensor against float function of sensor.
+ */
+static void TestSensors(void)
+{
+	ScaleQ_t Tmp36, TmpMcu;
+	double   Err36 = 0.0, ErrMcu = 0.0;
+
+	TEST_CHECK(ScaleQ_Set(&Tmp36, TMP36_KA, TMP36_KB) == BIT_TRUE);
+	TEST_CHECK(ScaleQ_Set(&TmpMcu, TMP_MCU_KA, TMP_MCU_KB) == BIT_TRUE);
+
+	for(uint8_t Bits=0; Bits<=PLC_AI_OVS__MAX; Bits++)
+	{
+		for(uint32_t Code=0; Code<=((uint32_t)PLC_AI_DIG_MAX << Bits); Code++)
+		{
+			int32_t VQ = PLC_AI_CODE_TO_ANA_Q(Code, Bits);
+			float   V  = TestAnaF(Code, Bits);
+			double  Err;
+
+			Err = fabs(ScaleQ_ToReal(ScaleQ(VQ, &Tmp36)) - Tmp36_GetTemp(V));
+			if(Err > Err36) Err36 = Err;
+			Err = fabs(ScaleQ_ToReal(ScaleQ(VQ, &TmpMcu)) - TmpMcu_GetTemp(V));
+			if(Err > ErrMcu) ErrMcu = Err;
+		}
+	}
+
+	TEST_CHECK_MSG(Err36 < 0.002, "TMP36: %.4f C", Err36);
+	TEST_CHECK_MSG(ErrMcu < 0.002, "MCU_TEMP: %.4f C", ErrMcu);
+}
+
+/** @brief  Limits of factors, saturation.
+ */
+static void TestLimits(void)
+{
+	ScaleQ_t Scale;
+	float    Ka;
+
+	//NaN, infinity, range of fixed point
+	TEST_CHECK(ScaleQ_Set(&Scale, NAN, 0.0f) == BIT_FALSE);
+	TEST_CHECK(ScaleQ_Set(&Scale, 1.0f, NAN) == BIT_FALSE);
+	TEST_CHECK(ScaleQ_Set(&Scale, INFINITY, 0.0f) == BIT_FALSE);
+	TEST_CHECK(ScaleQ_Set(&Scale, 1.0f, -INFINITY) == BIT_FALSE);
+	TEST_CHECK(ScaleQ_Set(&Scale, 1.0f, 32767.0f) == BIT_FALSE);
+	TEST_CHECK(ScaleQ_Set(&Scale, 2147483648.0f, 0.0f) == BIT_FALSE);
+	TEST_CHECK(ScaleQ_Set(NULL, 1.0f, 0.0f) == BIT_FALSE);
+
+	//negligible Ka: Kb only
+	TEST_CHECK(ScaleQ_Set(&Scale, 1e-30f, 5.0f) == BIT_TRUE);
+	TEST_CHECK(ScaleQ(PLC_AI_CODE_TO_ANA_Q(4095, 0), &Scale) == 5*SCALE_Q_ONE);
+	TEST_CHECK(ScaleQ_Set(&Scale, 0.0f, -5.0f) == BIT_TRUE);
+	TEST_CHECK(ScaleQ(PLC_AI_CODE_TO_ANA_Q(4095, 0), &Scale) == -5*SCALE_Q_ONE);
+
+	//the greatest Ka of fixed point: full scale is not saturated
+	Ka = nextafterf((PLC_AI_FIX_VAL__MAX - 100.0f)/PLC_AI_ANA_MAX, 0.0f);
+	TEST_CHECK(fabsf(Ka)*PLC_AI_ANA_MAX + 100.0f < PLC_AI_FIX_VAL__MAX);
+	TEST_CHECK(ScaleQ_Set(&Scale, Ka, -100.0f) == BIT_TRUE);
+	for(uint8_t Bits=0; Bits<=PLC_AI_OVS__MAX; Bits++)
+	{
+		int32_t Y = ScaleQ(PLC_AI_CODE_TO_ANA_Q((uint32_t)PLC_AI_DIG_MAX << Bits, Bits), &Scale);
+		TEST_CHECK_NEAR(ScaleQ_ToReal(Y), (double)Ka*3.3 - 100.0, (0.6*Ka + 1.1)*TEST_LSB);
+		TEST_CHECK(Y < INT32_MAX);
+	}
+
+	//out of range of Q16 (float survey): saturated, not wrapped
+	TEST_CHECK(ScaleQ_Set(&Scale, 1e6f, 0.0f) == BIT_TRUE);
+	TEST_CHECK(ScaleQ(PLC_AI_CODE_TO_ANA_Q(4095, 0), &Scale) == INT32_MAX);
+	TEST_CHECK(ScaleQ_Set(&Scale, -1e6f, 0.0f) == BIT_TRUE);
+	TEST_CHECK(ScaleQ(PLC_AI_CODE_TO_ANA_Q(4095, 0), &Scale) == INT32_MIN);
+}
+
+/** @brief  Throughput: ADC-code > V > scale > 16-point table.
+ */
+static void TestBench(void)
+{
+	static uint16_t Code[TEST_BENCH_SZ];
+	float           Tbl[PLC_AI_LIN_TBL_SZ];
+	PlcAI_Lin_t     Lin;
+	ScaleQ_t        Scale;
+	struct timespec T0, T1;
+	volatile float  Sink = 0.0f;
+	float           Acc;
+	int32_t         AccQ;
+	double          NsF, NsQ;
+	uint32_t        Seed = 1;
+
+	for(uint32_t i=0; i<TEST_BENCH_SZ; i++)
+	{
+		Seed    = Seed*1103515245 + 12345;
+		Code[i] = (uint16_t)((Seed >> 8)%((uint32_t)PLC_AI_DIG_MAX << 2));
+	}
+	for(int i=0; i<PLC_AI_LIN_PTS__MAX; i++)
+	{
+		//non-uniform X (binary search)
+		Tbl[2*i]   = (float)(i*i);
+		Tbl[2*i+1] = (float)(10.0*i);
+	}
+	PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, PLC_AI_LIN_PTS__MAX, Tbl);
+	ScaleQ_Set(&Scale, 70.0f, -5.0f);
+
+	clock_gettime(CLOCK_MONOTONIC, &T0);
+	for(uint32_t r=0; r<TEST_BENCH_RUNS; r++)
+	{
+		Acc = 0.0f;
+		for(uint32_t i=0; i<TEST_BENCH_SZ; i++) Acc += PlcAI_Lin_Put(&Lin, ScaleA(TestAnaF(Code[i], 2), 70.0f, -5.0f));
+		Sink = Acc;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &T1);
+	NsF = ((T1.tv_sec - T0.tv_sec)*1e9 + (T1.tv_nsec - T0.tv_nsec))/((double)TEST_BENCH_RUNS*TEST_BENCH_SZ);
+
+	clock_gettime(CLOCK_MONOTONIC, &T0);
+	for(uint32_t r=0; r<TEST_BENCH_RUNS; r++)
+	{
+		AccQ = 0;
+		for(uint32_t i=0; i<TEST_BENCH_SZ; i++) AccQ += PlcAI_Lin_Calc(&Lin, ScaleQ(PLC_AI_CODE_TO_ANA_Q(Code[i], 2), &Scale));
+		Sink = ScaleQ_ToReal(AccQ);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &T1);
+	NsQ = ((T1.tv_sec - T0.tv_sec)*1e9 + (T1.tv_nsec - T0.tv_nsec))/((double)TEST_BENCH_RUNS*TEST_BENCH_SZ);
+
+	(void)Sink;
+	printf("  throughput: fixed point %.1f ns per sample, float %.1f ns per sample\n", NsQ, NsF);
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestAnaQ);
+	TEST_RUN(TestScale);
+	TEST_RUN(TestSensors);
+	TEST_RUN(TestLimits);
+	TEST_RUN(TestBench);
+
+	return (TEST_END());
+}
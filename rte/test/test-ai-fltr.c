@@ -0,0 +1,306 @@
+/* @page test-ai-fltr.c
+ *       PLC411::RTE
+ *       Host unit test: AI streaming filters (ai-fltr.c)
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Every filter is compared with a float model of the same filter:
+ *        - step response (0 -> full scale -> 0) and settling of IIR by its time constant
+ *        - noise rejection of a deterministic noisy stream (MA, IIR), spike rejection (MED)
+ *        - limits: codes 0 and 0xFFFF (no overflow of running sum and Q16 state),
+ *          parameters out of range are limited, unknown type switches filter off.
+ *
+ *        Input of filter is ADC-code (integer), NaN can not reach it:
+ *        NaN of scale factors is rejected by rtos-ai.c (fixed-point scale is not used).
+ */
+
+#include <stdlib.h>
+
+#include "test.h"
+#include "ai-fltr.h"
+
+
+/** @def Sample period (us): 16-bit oversampling of 1 MSPS ADC
+ */
+#define TEST_TS                                  (uint32_t)256
+
+/** @def Length of streams
+ */
+#define TEST_STREAM_SZ                           (uint32_t)20000
+
+
+/** @var Random generator (LCG, the same stream on every run)
+ */
+static uint32_t TestSeed = 12345;
+
+static uint32_t TestRand(void)
+{
+	TestSeed = TestSeed*1103515245 + 12345;
+	return ((TestSeed >> 8) & 0xFFFF);
+}
+
+/** @brief  Noisy stream: level +/- uniform noise.
+ */
+static uint16_t TestNoisy(int32_t LevelIn, int32_t NoiseIn)
+{
+	int32_t V = LevelIn + (int32_t)(TestRand()%(uint32_t)(2*NoiseIn+1)) - NoiseIn;
+
+	if(V < 0)      V = 0;
+	if(V > 0xFFFF) V = 0xFFFF;
+	return ((uint16_t)V);
+}
+
+/** @brief  Median of float model.
+ */
+static int TestCmp(const void *AIn, const void *BIn)
+{
+	return ((int)*(const uint16_t *)AIn - (int)*(const uint16_t *)BIn);
+}
+
+
+/** @brief  Off: output is input.
+ */
+static void TestOff(void)
+{
+	PlcAI_Fltr_t F;
+
+	TEST_CHECK(PlcAI_Fltr_Set(&F, PLC_AI_FLTR_OFF, 0, TEST_TS) == BIT_TRUE);
+	for(uint32_t V=0; V<=0xFFFF; V+=257) TEST_CHECK(PlcAI_Fltr_Put(&F, (uint16_t)V) == V);
+
+	//unknown type: off
+	TEST_CHECK(PlcAI_Fltr_Set(&F, 4, 10, TEST_TS) == BIT_FALSE);
+	TEST_CHECK(F.Type == PLC_AI_FLTR_OFF);
+	TEST_CHECK(PlcAI_Fltr_Put(&F, 1234) == 1234);
+
+	TEST_CHECK(PlcAI_Fltr_Set(NULL, PLC_AI_FLTR_MA, 10, TEST_TS) == BIT_FALSE);
+	TEST_CHECK(PlcAI_Fltr_Put(NULL, 777) == 777);
+}
+
+/** @brief  Moving average: exact average of the last Sz values (the fed ones until window is full).
+ */
+static void TestMA(void)
+{
+	static const uint16_t Sz[] = { 1, 2, 3, 8, 17, 64 };
+	static uint16_t Stream[TEST_STREAM_SZ];
+	PlcAI_Fltr_t F;
+
+	for(uint32_t s=0; s<sizeof(Sz)/sizeof(Sz[0]); s++)
+	{
+		PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MA, Sz[s], TEST_TS);
+
+		//step 0 -> full scale -> 0, noisy level, extremes
+		for(uint32_t i=0; i<TEST_STREAM_SZ; i++)
+		{
+			if(i < 100)       Stream[i] = 0;
+			else if(i < 300)  Stream[i] = 0xFFFF;
+			else if(i < 500)  Stream[i] = 0;
+			else              Stream[i] = TestNoisy(30000, 2000);
+		}
+
+		for(uint32_t i=0; i<TEST_STREAM_SZ; i++)
+		{
+			uint32_t N   = ((i+1 < Sz[s]) ? i+1 : Sz[s]);
+			uint64_t Sum = 0;
+
+			for(uint32_t k=0; k<N; k++) Sum += Stream[i-k];
+
+			uint16_t Out = PlcAI_Fltr_Put(&F, Stream[i]);
+			TEST_CHECK_MSG(Out == (uint16_t)((Sum + N/2)/N), "MA %u, sample %u: %u, expected %llu", Sz[s], i, Out, (unsigned long long)((Sum + N/2)/N));
+		}
+
+		//step response: full scale exactly after Sz samples
+		PlcAI_Fltr_Reset(&F);
+		for(uint32_t i=0; i<Sz[s]; i++) PlcAI_Fltr_Put(&F, 0);
+		for(uint32_t i=0; i<Sz[s]; i++)
+		{
+			uint16_t Out = PlcAI_Fltr_Put(&F, 0xFFFF);
+			if(i+1 < Sz[s]) TEST_CHECK_MSG(Out < 0xFFFF, "MA %u: step settled at %u", Sz[s], i);
+			else            TEST_CHECK_MSG(Out == 0xFFFF, "MA %u: step is not settled", Sz[s]);
+		}
+	}
+
+	//limits of window
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MA, 0, TEST_TS);
+	TEST_CHECK(F.Sz == 1);
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MA, 1000, TEST_TS);
+	TEST_CHECK(F.Sz == PLC_AI_FLTR_MA_SZ__MAX);
+}
+
+/** @brief  IIR: float model, settling by time constant.
+ */
+static void TestIIR(void)
+{
+	static const uint16_t Tau[] = { 1, 2, 10, 100, 1000, PLC_AI_FLTR_IIR_TAU__MAX };
+	PlcAI_Fltr_t F;
+
+	for(uint32_t t=0; t<sizeof(Tau)/sizeof(Tau[0]); t++)
+	{
+		double K = (double)TEST_TS/((double)Tau[t]*1000.0 + TEST_TS);
+		double N = (double)Tau[t]*1000.0/TEST_TS;  //samples per time constant
+		double Y;
+		uint16_t Out = 0, Prev;
+		uint32_t i;
+
+		PlcAI_Fltr_Set(&F, PLC_AI_FLTR_IIR, Tau[t], TEST_TS);
+		TEST_CHECK_NEAR((double)F.K/(1 << PLC_AI_FLTR_K_Q), K, 1.0/(1 << PLC_AI_FLTR_K_Q));
+		//model uses the same (Q24) factor
+		K = (double)F.K/(1 << PLC_AI_FLTR_K_Q);
+
+		//starts from the first value
+		TEST_CHECK(PlcAI_Fltr_Put(&F, 0) == 0);
+		Y = 0.0;
+
+		//step to full scale: float model (rounding of Q16 state)
+		for(i=0; i<(uint32_t)(5*N)+10; i++)
+		{
+			Prev = Out;
+			Out  = PlcAI_Fltr_Put(&F, 0xFFFF);
+			Y  += K*(65535.0 - Y);
+			TEST_CHECK_MSG(fabs(Out - Y) <= 1.0 + Y*1e-5, "IIR %u ms, sample %u: %u, model %.3f", Tau[t], i, Out, Y);
+			//no overflow of Q16 state: monotonic rise, no wrap to 0
+			TEST_CHECK_MSG(Out >= Prev, "IIR %u ms, sample %u: %u after %u", Tau[t], i, Out, Prev);
+
+			//63.2% after time constant
+			if(i+1 == (uint32_t)(N+0.5) && N >= 10) TEST_CHECK_MSG(fabs(Out - 65535.0*(1.0-exp(-1.0))) < 65535.0*0.02,
+			                                                       "IIR %u ms: %u after time constant", Tau[t], Out);
+		}
+
+		//settled: 5 time constants (0.7%)
+		TEST_CHECK_MSG(Out >= 65535 - 65535*0.0068 - 1, "IIR %u ms: %u after 5 time constants", Tau[t], Out);
+
+		//full scale is reached and held
+		for(i=0; i<(uint32_t)(20*N)+100; i++) Out = PlcAI_Fltr_Put(&F, 0xFFFF);
+		TEST_CHECK_MSG(Out == 0xFFFF, "IIR %u ms: %u", Tau[t], Out);
+
+		//step down to 0 is symmetric
+		for(i=0; i<(uint32_t)(20*N)+100; i++) Out = PlcAI_Fltr_Put(&F, 0);
+		TEST_CHECK_MSG(Out == 0, "IIR %u ms: %u", Tau[t], Out);
+	}
+
+	//noise rejection: standard deviation of output / input ~ sqrt(K/(2-K))
+	{
+		double SumIn = 0.0, SumIn2 = 0.0, SumOut = 0.0, SumOut2 = 0.0;
+		double K, SdIn, SdOut;
+		uint32_t Cnt = 0;
+
+		PlcAI_Fltr_Set(&F, PLC_AI_FLTR_IIR, 10, TEST_TS);
+		K = (double)F.K/(1 << PLC_AI_FLTR_K_Q);
+
+		for(uint32_t i=0; i<10*TEST_STREAM_SZ; i++)
+		{
+			uint16_t In  = TestNoisy(30000, 2000);
+			uint16_t Out = PlcAI_Fltr_Put(&F, In);
+
+			if(i < 1000) continue;
+			SumIn  += In;  SumIn2  += (double)In*In;
+			SumOut += Out; SumOut2 += (double)Out*Out;
+			Cnt++;
+		}
+		SdIn  = sqrt(SumIn2/Cnt - (SumIn/Cnt)*(SumIn/Cnt));
+		SdOut = sqrt(SumOut2/Cnt - (SumOut/Cnt)*(SumOut/Cnt));
+		TEST_CHECK_NEAR(SumOut/Cnt, SumIn/Cnt, 5.0);
+		TEST_CHECK_NEAR(SdOut/SdIn, sqrt(K/(2.0-K)), 0.3*sqrt(K/(2.0-K)));
+	}
+
+	//limits of time constant and sample period
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_IIR, 0, TEST_TS);
+	TEST_CHECK(F.K == (uint32_t)((((uint64_t)TEST_TS << PLC_AI_FLTR_K_Q) + (1000+TEST_TS)/2)/(1000+TEST_TS)));
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_IIR, 0xFFFF, 1);
+	TEST_CHECK(F.K >= 1);
+	TEST_CHECK_NEAR((double)F.K/(1 << PLC_AI_FLTR_K_Q), 1.0/(PLC_AI_FLTR_IIR_TAU__MAX*1000.0+1.0), 1.0/(1 << PLC_AI_FLTR_K_Q));
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_IIR, 1, 0);
+	TEST_CHECK(F.K >= 1);
+}
+
+/** @brief  Median: float model (sort of the last Sz values), spike rejection.
+ */
+static void TestMED(void)
+{
+	static uint16_t Stream[TEST_STREAM_SZ];
+	uint16_t Sort[PLC_AI_FLTR_MED_SZ__MAX];
+	PlcAI_Fltr_t F;
+
+	for(uint16_t Sz=PLC_AI_FLTR_MED_SZ__MIN; Sz<=PLC_AI_FLTR_MED_SZ__MAX; Sz+=2)
+	{
+		uint32_t Spikes = 0;
+
+		PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MED, Sz, TEST_TS);
+		TEST_CHECK(F.Sz == Sz);
+
+		//noisy level with single spikes (0 / full scale), steps
+		for(uint32_t i=0; i<TEST_STREAM_SZ; i++)
+		{
+			if(i < 100)                 Stream[i] = 0;
+			else if(i < 200)            Stream[i] = 0xFFFF;
+			else                        Stream[i] = TestNoisy(((i/1000) & 1) ? 10000 : 40000, 500);
+			if(i >= 300 && !(i%50))     Stream[i] = (((i/50) & 1) ? 0xFFFF : 0);
+		}
+
+		for(uint32_t i=0; i<TEST_STREAM_SZ; i++)
+		{
+			uint32_t N = ((i+1 < Sz) ? i+1 : Sz);
+			uint16_t Exp;
+
+			memcpy(Sort, &Stream[i+1-N], N*sizeof(uint16_t));
+			qsort(Sort, N, sizeof(uint16_t), TestCmp);
+			Exp = ((N & 1) ? Sort[N/2] : (uint16_t)(((uint32_t)Sort[N/2-1] + Sort[N/2] + 1)/2));
+
+			uint16_t Out = PlcAI_Fltr_Put(&F, Stream[i]);
+			TEST_CHECK_MSG(Out == Exp, "MED %u, sample %u: %u, expected %u", Sz, i, Out, Exp);
+
+			//spike never reaches output
+			if(i >= 300 && (Out == 0 || Out == 0xFFFF)) Spikes++;
+		}
+		TEST_CHECK_MSG(Spikes == 0, "MED %u: %u spikes", Sz, Spikes);
+
+		//step response: delay of (Sz+1)/2 samples
+		PlcAI_Fltr_Reset(&F);
+		for(uint32_t i=0; i<Sz; i++) PlcAI_Fltr_Put(&F, 0);
+		for(uint32_t i=0; i<Sz; i++)
+		{
+			uint16_t Out = PlcAI_Fltr_Put(&F, 0xFFFF);
+			TEST_CHECK_MSG(Out == ((i+1 >= (uint32_t)(Sz+1)/2) ? 0xFFFF : 0), "MED %u, step sample %u: %u", Sz, i, Out);
+		}
+	}
+
+	//limits of window: odd, 3 ... 7
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MED, 0, TEST_TS);
+	TEST_CHECK(F.Sz == PLC_AI_FLTR_MED_SZ__MIN);
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MED, 4, TEST_TS);
+	TEST_CHECK(F.Sz == 5);
+	PlcAI_Fltr_Set(&F, PLC_AI_FLTR_MED, 100, TEST_TS);
+	TEST_CHECK(F.Sz == PLC_AI_FLTR_MED_SZ__MAX);
+}
+
+/** @brief  Set resets state.
+ */
+static void TestReset(void)
+{
+	static const uint8_t Type[] = { PLC_AI_FLTR_MA, PLC_AI_FLTR_IIR, PLC_AI_FLTR_MED };
+	PlcAI_Fltr_t F;
+
+	for(uint32_t t=0; t<sizeof(Type)/sizeof(Type[0]); t++)
+	{
+		PlcAI_Fltr_Set(&F, Type[t], 5, TEST_TS);
+		for(uint32_t i=0; i<100; i++) PlcAI_Fltr_Put(&F, 0xFFFF);
+
+		PlcAI_Fltr_Set(&F, Type[t], 5, TEST_TS);
+		TEST_CHECK_MSG(F.Out == 0 && F.Cnt == 0, "type %u", Type[t]);
+		//the first value after reset is output as is
+		TEST_CHECK_MSG(PlcAI_Fltr_Put(&F, 100) == 100, "type %u", Type[t]);
+	}
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestOff);
+	TEST_RUN(TestMA);
+	TEST_RUN(TestIIR);
+	TEST_RUN(TestMED);
+	TEST_RUN(TestReset);
+
+	return (TEST_END());
+}
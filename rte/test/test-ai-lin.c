@@ -0,0 +1,383 @@
+/* @page test-ai-lin.c
+ *       PLC411::RTE
+ *       Host unit test: AI linearization (ai-lin.c) and fixed-point scale (scale.c)
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Reference curves:
+ *        - Pt100 (IEC 60751, Callendar-Van Dusen): table R (Ohm) -> T (C), non-uniform X (binary search),
+ *          polynomial of normalized R fitted by least squares
+ *        - NTC 10k (B = 3950) in divider 10k / 3.3 V: table V -> T (C), uniform X (direct index,
+ *          step is not exact in Q16)
+ *
+ *        Checks:
+ *        - points and edges of segments (X[i]-1, X[i], X[i]+1 LSB), interpolation against double
+ *        - direct index and binary search give the same output for every Q16 input of the range
+ *        - error of table / polynomial against the reference curve
+ *        - limits (first/last point, Xmin/Xmax, saturation of polynomial), invalid tables
+ *        - ADC code > V > scale (Ka, Kb) > linearization: fixed point against float
+ */
+
+#include "test.h"
+#include "ai-lin.h"
+#include "scale.h"
+
+
+/** @def Q16
+ */
+#define TEST_Q(V)                                ((int32_t)lround((double)(V)*65536.0))
+#define TEST_R(V)                                ((double)(V)/65536.0)
+
+/** @def Pt100 (IEC 60751)
+ */
+#define TEST_PT_R0                               100.0
+#define TEST_PT_A                                3.9083e-3
+#define TEST_PT_B                                -5.775e-7
+#define TEST_PT_C                                -4.183e-12
+
+
+/** @brief  Pt100: resistance by temperature.
+ */
+static double TestPtR(double TIn)
+{
+	double R = TEST_PT_R0*(1.0 + TEST_PT_A*TIn + TEST_PT_B*TIn*TIn);
+
+	if(TIn < 0.0) R += TEST_PT_R0*TEST_PT_C*(TIn-100.0)*TIn*TIn*TIn;
+	return (R);
+}
+
+/** @brief  Pt100: temperature by resistance (Newton).
+ */
+static double TestPtT(double RIn)
+{
+	double T = (RIn/TEST_PT_R0 - 1.0)/TEST_PT_A;
+
+	for(int i=0; i<20; i++) T -= (TestPtR(T) - RIn)/(TestPtR(T+0.001) - TestPtR(T-0.001))*0.002;
+	return (T);
+}
+
+/** @brief  NTC 10k (B = 3950) in divider (10k to 3.3 V): temperature by voltage.
+ */
+static double TestNtcT(double VIn)
+{
+	double R = 10000.0*VIn/(3.3-VIn);
+
+	return (1.0/(1.0/298.15 + log(R/10000.0)/3950.0) - 273.15);
+}
+
+/** @brief  Interpolation of quantized table in double.
+ */
+static double TestInterp(const PlcAI_Lin_t *LinIn, int32_t XIn)
+{
+	uint8_t i;
+
+	if(XIn <= LinIn->X[0])           return (LinIn->Y[0]);
+	if(XIn >= LinIn->X[LinIn->Sz-1]) return (LinIn->Y[LinIn->Sz-1]);
+	for(i=0; XIn >= LinIn->X[i+1]; i++);
+
+	return (LinIn->Y[i] + ((double)LinIn->Y[i+1] - LinIn->Y[i])*((double)XIn - LinIn->X[i])/((double)LinIn->X[i+1] - LinIn->X[i]));
+}
+
+/** @brief  Pt100 table: -200 ... 550 C, step 50 C.
+ */
+static void TestPtTbl(float *TblOut)
+{
+	for(int i=0; i<PLC_AI_LIN_PTS__MAX; i++)
+	{
+		TblOut[2*i]   = (float)TestPtR(-200.0 + 50.0*i);
+		TblOut[2*i+1] = (float)(-200.0 + 50.0*i);
+	}
+}
+
+/** @brief  NTC table: 0.3 ... 3.0 V, step 0.18 V.
+ */
+static void TestNtcTbl(float *TblOut)
+{
+	for(int i=0; i<PLC_AI_LIN_PTS__MAX; i++)
+	{
+		TblOut[2*i]   = (float)(0.3 + 0.18*i);
+		TblOut[2*i+1] = (float)TestNtcT(0.3 + 0.18*i);
+	}
+}
+
+
+/** @brief  Table: points, edges of segments, interpolation, search.
+ */
+static void TestTbl(void)
+{
+	float        Tbl[PLC_AI_LIN_TBL_SZ];
+	PlcAI_Lin_t  Lin, LinBin;
+	int32_t      X, Out;
+	double       Err, ErrMax;
+
+	for(int t=0; t<2; t++)
+	{
+		if(t) TestNtcTbl(Tbl);
+		else  TestPtTbl(Tbl);
+
+		TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, PLC_AI_LIN_PTS__MAX, Tbl) == BIT_TRUE);
+		TEST_CHECK(Lin.Type == PLC_AI_LIN_TBL && Lin.Sz == PLC_AI_LIN_PTS__MAX);
+		//Pt100: non-uniform X, NTC: uniform (+/- 1 LSB of rounding)
+		TEST_CHECK_MSG((t) ? (Lin.Step != 0) : (Lin.Step == 0), "table %d: step %d", t, Lin.Step);
+
+		//the same table by binary search
+		LinBin      = Lin;
+		LinBin.Step = 0;
+
+		//points and edges of segments
+		for(uint8_t i=0; i<Lin.Sz; i++)
+		{
+			TEST_CHECK_MSG(Lin.X[i] == TEST_Q(Tbl[2*i]) && Lin.Y[i] == TEST_Q(Tbl[2*i+1]), "table %d, point %u", t, i);
+			TEST_CHECK_MSG(PlcAI_Lin_Calc(&Lin, Lin.X[i]) == Lin.Y[i], "table %d, point %u", t, i);
+
+			for(int d=-1; d<=1; d+=2)
+			{
+				X   = Lin.X[i] + d;
+				Out = PlcAI_Lin_Calc(&Lin, X);
+				TEST_CHECK_MSG(fabs(Out - TestInterp(&Lin, X)) <= 1.0, "table %d, point %u%+d: %d, expected %.1f", t, i, d, Out, TestInterp(&Lin, X));
+			}
+		}
+
+		//every Q16 input of the range (and beyond): interpolation, direct index = binary search
+		ErrMax = 0.0;
+		for(X=Lin.X[0]-1000; X<=Lin.X[Lin.Sz-1]+1000; X++)
+		{
+			Out = PlcAI_Lin_Calc(&Lin, X);
+			if(fabs(Out - TestInterp(&Lin, X)) > 1.0)
+			{
+				TEST_CHECK_MSG(0, "table %d, X %d: %d, expected %.1f", t, X, Out, TestInterp(&Lin, X));
+				if(TestFails > 50) return;
+			}
+			if(Out != PlcAI_Lin_Calc(&LinBin, X))
+			{
+				TEST_CHECK_MSG(0, "table %d, X %d: direct index %d, binary search %d", t, X, Out, PlcAI_Lin_Calc(&LinBin, X));
+				if(TestFails > 50) return;
+			}
+
+			//against reference curve
+			if(X >= Lin.X[0] && X <= Lin.X[Lin.Sz-1] && !(X & 0xFF))
+			{
+				Err = fabs(TEST_R(Out) - ((t) ? TestNtcT(TEST_R(X)) : TestPtT(TEST_R(X))));
+				if(Err > ErrMax) ErrMax = Err;
+			}
+		}
+		TestChecks++;
+
+		//16 points: Pt100 0.25 C (curvature of CVD, step 50 C), NTC 1.5 C (exponential, step 0.18 V)
+		TEST_CHECK_MSG(ErrMax < ((t) ? 1.5 : 0.25), "table %d: error %.4f C", t, ErrMax);
+
+		//limits
+		TEST_CHECK(PlcAI_Lin_Calc(&Lin, INT32_MIN) == Lin.Y[0]);
+		TEST_CHECK(PlcAI_Lin_Calc(&Lin, INT32_MAX) == Lin.Y[Lin.Sz-1]);
+		TEST_CHECK(PlcAI_Lin_Put(&Lin, -1e30f) == TEST_R(Lin.Y[0]));
+		TEST_CHECK(PlcAI_Lin_Put(&Lin, INFINITY) == (float)TEST_R(Lin.Y[Lin.Sz-1]));
+	}
+
+	//two points: line
+	{
+		const float Tbl2[PLC_AI_LIN_TBL_SZ] = { 4.0f, 0.0f, 20.0f, 100.0f };
+
+		TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 2, Tbl2) == BIT_TRUE);
+		TEST_CHECK_NEAR(PlcAI_Lin_Put(&Lin, 12.0f), 50.0, 1e-4);
+		TEST_CHECK_NEAR(PlcAI_Lin_Put(&Lin, 2.0f), 0.0, 0.0);
+		TEST_CHECK_NEAR(PlcAI_Lin_Put(&Lin, 22.0f), 100.0, 0.0);
+	}
+}
+
+/** @brief  Solve linear system (Gauss, partial pivoting).
+ */
+static void TestSolve(int NIn, double AIn[PLC_AI_LIN_POLY__MAX][PLC_AI_LIN_POLY__MAX+1], double *XOut)
+{
+	for(int c=0; c<NIn; c++)
+	{
+		int p = c;
+		for(int r=c+1; r<NIn; r++) if(fabs(AIn[r][c]) > fabs(AIn[p][c])) p = r;
+		for(int k=0; k<=NIn; k++) { double T = AIn[c][k]; AIn[c][k] = AIn[p][k]; AIn[p][k] = T; }
+		for(int r=c+1; r<NIn; r++)
+		{
+			double F = AIn[r][c]/AIn[c][c];
+			for(int k=c; k<=NIn; k++) AIn[r][k] -= F*AIn[c][k];
+		}
+	}
+	for(int r=NIn-1; r>=0; r--)
+	{
+		double S = AIn[r][NIn];
+		for(int k=r+1; k<NIn; k++) S -= AIn[r][k]*XOut[k];
+		XOut[r] = S/AIn[r][r];
+	}
+}
+
+/** @brief  Polynomial: least-squares fit of Pt100 (0 ... 850 C) on normalized R.
+ */
+static void TestPoly(void)
+{
+	const double RMin = TestPtR(0.0);
+	const double RMax = TestPtR(850.0);
+	double       M[PLC_AI_LIN_POLY__MAX][PLC_AI_LIN_POLY__MAX+1];
+	double       C[PLC_AI_LIN_POLY__MAX];
+	float        Tbl[PLC_AI_LIN_TBL_SZ];
+	PlcAI_Lin_t  Lin;
+	int32_t      X, Out;
+	double       U, Y, Err, ErrMax = 0.0, ErrFit = 0.0;
+
+	//normal equations (degree 4)
+	const int N = 5;
+	memset(M, 0, sizeof(M));
+	for(int s=0; s<=1000; s++)
+	{
+		double Pw[2*PLC_AI_LIN_POLY__MAX];
+		U = s/1000.0;
+		Y = TestPtT(RMin + U*(RMax-RMin));
+		Pw[0] = 1.0;
+		for(int k=1; k<2*N; k++) Pw[k] = Pw[k-1]*U;
+		for(int r=0; r<N; r++)
+		{
+			for(int k=0; k<N; k++) M[r][k] += Pw[r+k];
+			M[r][N] += Pw[r]*Y;
+		}
+	}
+	TestSolve(N, M, C);
+
+	memset(Tbl, 0, sizeof(Tbl));
+	Tbl[0] = (float)RMin;
+	Tbl[1] = (float)RMax;
+	for(int k=0; k<N; k++) Tbl[2+k] = (float)C[k];
+
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, N, Tbl) == BIT_TRUE);
+	TEST_CHECK(Lin.X[0] == TEST_Q(Tbl[0]) && Lin.X[1] == TEST_Q(Tbl[1]));
+
+	for(X=Lin.X[0]; X<=Lin.X[1]; X+=7)
+	{
+		//double Horner of the same (Q16) coefficients
+		U = ((double)X - Lin.X[0])/((double)Lin.X[1] - Lin.X[0]);
+		Y = 0.0;
+		for(int k=N-1; k>=0; k--) Y = Y*U + TEST_R(Lin.Y[k]);
+
+		Out = PlcAI_Lin_Calc(&Lin, X);
+		Err = fabs(TEST_R(Out) - Y);
+		if(Err > ErrMax) ErrMax = Err;
+
+		Err = fabs(TEST_R(Out) - TestPtT(TEST_R(X)));
+		if(Err > ErrFit) ErrFit = Err;
+	}
+
+	//Q30 of U and Q16 of steps: a few LSB of Q16
+	TEST_CHECK_MSG(ErrMax < 5.0/65536.0, "fixed point: error %.3g", ErrMax);
+	//degree 4 on 0 ... 850 C
+	TEST_CHECK_MSG(ErrFit < 0.03, "fit: error %.4f C", ErrFit);
+
+	//limits: Xmin, Xmax
+	TEST_CHECK(PlcAI_Lin_Calc(&Lin, Lin.X[0]-100000) == PlcAI_Lin_Calc(&Lin, Lin.X[0]));
+	TEST_CHECK(PlcAI_Lin_Calc(&Lin, INT32_MAX) == PlcAI_Lin_Calc(&Lin, Lin.X[1]));
+	TEST_CHECK_NEAR(TEST_R(PlcAI_Lin_Calc(&Lin, Lin.X[0])), C[0], 1e-4);
+
+	//saturation: Y(1) = 8*30000 is out of Q16 (no wrap)
+	for(int k=0; k<PLC_AI_LIN_POLY__MAX; k++) Tbl[2+k] = 30000.0f;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, PLC_AI_LIN_POLY__MAX, Tbl) == BIT_TRUE);
+	TEST_CHECK(PlcAI_Lin_Calc(&Lin, Lin.X[1]) == INT32_MAX);
+	for(int k=0; k<PLC_AI_LIN_POLY__MAX; k++) Tbl[2+k] = -30000.0f;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, PLC_AI_LIN_POLY__MAX, Tbl) == BIT_TRUE);
+	TEST_CHECK(PlcAI_Lin_Calc(&Lin, Lin.X[1]) == INT32_MIN);
+
+	//one coefficient: constant
+	Tbl[2] = 12.5f;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, 1, Tbl) == BIT_TRUE);
+	TEST_CHECK(PlcAI_Lin_Put(&Lin, 200.0f) == 12.5f);
+}
+
+/** @brief  Invalid tables: linearization is off.
+ */
+static void TestInvalid(void)
+{
+	float       Tbl[PLC_AI_LIN_TBL_SZ];
+	PlcAI_Lin_t Lin;
+
+	TestPtTbl(Tbl);
+
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 1, Tbl) == BIT_FALSE);
+	TEST_CHECK(Lin.Type == PLC_AI_LIN_OFF);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, PLC_AI_LIN_PTS__MAX+1, Tbl) == BIT_FALSE);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 4, NULL) == BIT_FALSE);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, 3, 4, Tbl) == BIT_FALSE);
+	TEST_CHECK(PlcAI_Lin_Set(NULL, PLC_AI_LIN_TBL, 4, Tbl) == BIT_FALSE);
+
+	//X is not strictly ascending (equal in Q16)
+	Tbl[4] = Tbl[2] + 1e-6f;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 4, Tbl) == BIT_FALSE);
+	TEST_CHECK(Lin.Type == PLC_AI_LIN_OFF);
+	TEST_CHECK(PlcAI_Lin_Put(&Lin, 123.0f) == 123.0f);
+	TestPtTbl(Tbl);
+
+	//NaN, out of range
+	Tbl[3] = NAN;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 4, Tbl) == BIT_FALSE);
+	Tbl[3] = 40000.0f;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 4, Tbl) == BIT_FALSE);
+	Tbl[3] = -PLC_AI_LIN_VAL__MAX;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 4, Tbl) == BIT_FALSE);
+	TestPtTbl(Tbl);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, 4, Tbl) == BIT_TRUE);
+
+	//polynomial: size, Xmax <= Xmin, NaN
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, 0, Tbl) == BIT_FALSE);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, PLC_AI_LIN_POLY__MAX+1, Tbl) == BIT_FALSE);
+	Tbl[0] = 10.0f;
+	Tbl[1] = 10.0f;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, 2, Tbl) == BIT_FALSE);
+	Tbl[1] = 20.0f;
+	Tbl[3] = NAN;
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, 2, Tbl) == BIT_FALSE);
+	TEST_CHECK(Lin.Type == PLC_AI_LIN_OFF);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_POLY, 1, Tbl) == BIT_TRUE);
+
+	//off
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_OFF, 0, NULL) == BIT_TRUE);
+	TEST_CHECK(PlcAI_Lin_Calc(&Lin, 123456) == 123456);
+	TEST_CHECK(PlcAI_Lin_Calc(NULL, 123456) == 123456);
+}
+
+/** @brief  ADC code > V > scale > linearization: fixed point (rtos-ai.c) against float.
+ *  @note   Pt100 transmitter: 0 ... 3.3 V = 18 ... 400 Ohm, 12-bit ADC.
+ */
+static void TestChain(void)
+{
+	float       Tbl[PLC_AI_LIN_TBL_SZ];
+	PlcAI_Lin_t Lin;
+	ScaleQ_t    Scale;
+	float       Ka = ScaleA_Ka(18.0f, 400.0f, 0.0f, 3.3f);
+	float       Kb = ScaleA_Kb(18.0f, 400.0f, 0.0f, 3.3f);
+	double      ErrMax = 0.0, ErrRef = 0.0;
+
+	TestPtTbl(Tbl);
+	TEST_CHECK(PlcAI_Lin_Set(&Lin, PLC_AI_LIN_TBL, PLC_AI_LIN_PTS__MAX, Tbl) == BIT_TRUE);
+	TEST_CHECK(ScaleQ_Set(&Scale, Ka, Kb) == BIT_TRUE);
+
+	for(uint32_t Code=0; Code<=4095; Code++)
+	{
+		double  V   = 3.3*Code/4095.0;
+		int32_t VQ  = TEST_Q(V);
+		float   Fix = ScaleQ_ToReal(PlcAI_Lin_Calc(&Lin, ScaleQ(VQ, &Scale)));
+		float   Flt = PlcAI_Lin_Put(&Lin, ScaleA((float)V, Ka, Kb));
+		double  R   = 18.0 + (400.0-18.0)*V/3.3;
+
+		if(fabs(Fix - Flt) > ErrMax) ErrMax = fabs(Fix - Flt);
+		if(R >= Tbl[0] && R <= Tbl[2*(PLC_AI_LIN_PTS__MAX-1)] && fabs(Fix - TestPtT(R)) > ErrRef) ErrRef = fabs(Fix - TestPtT(R));
+	}
+
+	//the same table, rounding of Q16 input only (1/65536 V = 0.0045 C)
+	TEST_CHECK_MSG(ErrMax < 0.005, "fixed point - float: %.5f C", ErrMax);
+	TEST_CHECK_MSG(ErrRef < 0.25, "fixed point - Pt100: %.4f C", ErrRef);
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestTbl);
+	TEST_RUN(TestPoly);
+	TEST_RUN(TestInvalid);
+	TEST_RUN(TestChain);
+
+	return (TEST_END());
+}
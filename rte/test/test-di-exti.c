@@ -0,0 +1,380 @@
+/* @page test-di-exti.c
+ *       PLC411::RTE
+ *       Host unit test: DI pin table and EXTI dispatcher (di.c)
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        di.c is included into the test, so its static functions and tables are visible.
+ *        Peripherals (EXTI, GPIO, RCC) are host variables, NVIC and GPIO init. are stubs.
+ *        EXTI.PR is a plain variable here: the value written by the dispatcher
+ *        (write 1 to clear) stays in it and is checked by the test.
+ *
+ *        Without TEST_DI_SZ the board table PLC_DI_PINS (di.h) is tested.
+ *        With TEST_DI_SZ = N (Makefile: test-di-exti-N) the driver is built for N channels
+ *        with a table filled by the test (channel i -> pin (7*i+3)%16, ports in turn),
+ *        so the same checks run for several quantities of channels.
+ *        __CLZ counts passes of the dispatcher loop (one call of PlcDI_ExtiLine per pass).
+ */
+
+#include "test.h"
+
+#ifdef TEST_DI_SZ
+//board table is declared but not defined
+#define PLC_DI_PINS                              PLC_DI_PINS_BOARD
+#endif // TEST_DI_SZ
+
+#include "di.h"
+
+
+/** @var Host models of peripherals
+ */
+static EXTI_TypeDef TestExti;
+static RCC_TypeDef  TestRcc;
+static GPIO_TypeDef TestGpio[6];
+
+#undef  EXTI
+#define EXTI                                     (&TestExti)
+#undef  RCC
+#define RCC                                      (&TestRcc)
+#undef  GPIOA
+#define GPIOA                                    (&TestGpio[0])
+#undef  GPIOB
+#define GPIOB                                    (&TestGpio[1])
+#undef  GPIOC
+#define GPIOC                                    (&TestGpio[2])
+#undef  GPIOD
+#define GPIOD                                    (&TestGpio[3])
+#undef  GPIOE
+#define GPIOE                                    (&TestGpio[4])
+#undef  GPIOH
+#define GPIOH                                    (&TestGpio[5])
+
+#define __disable_irq()                          do { } while(0)
+#define __get_PRIMASK()                          (uint32_t)0
+#define __set_PRIMASK(PrimIn)                    (void)(PrimIn)
+
+/** @var Calls of __CLZ (passes of dispatcher loop)
+ */
+static uint32_t TestClzSz;
+
+#undef  __CLZ
+#define __CLZ(ValIn)                             (uint8_t)(TestClzSz++, __builtin_clz(ValIn))
+
+#ifdef TEST_DI_SZ
+#undef  PLC_DI_SZ
+#define PLC_DI_SZ                                (uint8_t)TEST_DI_SZ
+#undef  PLC_DI_PINS
+#define PLC_DI_PINS                              TestPins
+//table of di.c is filled by the test
+#define const
+#endif // TEST_DI_SZ
+
+#include "../src/stm32f4/di.c"
+
+#ifdef TEST_DI_SZ
+#undef  const
+#endif // TEST_DI_SZ
+
+
+/** @var Stub calls
+ */
+static uint32_t TestNvicPrio[EXTI15_10_IRQn+1];
+static uint32_t TestNvicEn[EXTI15_10_IRQn+1];
+
+/** @var Calls of PLC_DI_USER_FUNC.Exti
+ */
+static PlcDI_IRQ_Q_t TestExtiCalls[PLC_DI_EXTI_LINES_SZ];
+static uint32_t      TestExtiCallsSz;
+
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+	TestNvicPrio[IRQn] = PreemptPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	TestNvicEn[IRQn] = 1;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+	TestNvicEn[IRQn] = 0;
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init)
+{
+}
+
+void HAL_GPIO_DeInit(GPIO_TypeDef *GPIOx, uint32_t GPIO_Pin)
+{
+}
+
+uint8_t PlcGpio_DI_Get(GPIO_TypeDef *PortIn, uint16_t PinIn, uint8_t PinModeIn)
+{
+	uint8_t Val = ((PortIn->IDR & PinIn) ? BIT_TRUE : BIT_FALSE);
+
+	return ((PinModeIn) ? !Val : Val);
+}
+
+static void TestExtiCallback(PlcDI_IRQ_Q_t DataIn)
+{
+	if(TestExtiCallsSz < PLC_DI_EXTI_LINES_SZ) TestExtiCalls[TestExtiCallsSz] = DataIn;
+	TestExtiCallsSz++;
+}
+
+
+/** @brief  EXTI line of every single pin is the number of the pin.
+ */
+static void TestExtiLine(void)
+{
+	for(uint32_t Pin=0; Pin<16; Pin++)
+	{
+		TEST_CHECK_MSG(PlcDI_ExtiLine((uint16_t)(1 << Pin)) == Pin, "pin %u", Pin);
+	}
+}
+
+/** @brief  IRQ of EXTI line (lines 5-9 and 10-15 share IRQs).
+ */
+static void TestExtiIRQn(void)
+{
+	for(uint32_t Line=0; Line<5; Line++)
+	{
+		TEST_CHECK(PlcDI_ExtiIRQn(Line) == (IRQn_Type)(EXTI0_IRQn+Line));
+	}
+	TEST_CHECK(PlcDI_ExtiIRQn(0) == EXTI0_IRQn);
+	TEST_CHECK(PlcDI_ExtiIRQn(4) == EXTI4_IRQn);
+	for(uint32_t Line=5; Line<10; Line++)  TEST_CHECK(PlcDI_ExtiIRQn(Line) == EXTI9_5_IRQn);
+	for(uint32_t Line=10; Line<16; Line++) TEST_CHECK(PlcDI_ExtiIRQn(Line) == EXTI15_10_IRQn);
+}
+
+/** @brief  Init. builds line -> channel table from PLC_DI_PINS.
+ */
+static void TestInit(void)
+{
+	uint32_t Mask = 0;
+	uint32_t Line;
+
+	TEST_CHECK(PlcDI_Init() == BIT_TRUE);
+
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		Line = PlcDI_ExtiLine(PLC_DI_PINS[i].Pin);
+		TEST_CHECK_MSG(PLC_DI_EXTI_CH[Line] == i, "channel %u, line %u", i, Line);
+		TEST_CHECK_MSG(TestNvicEn[PlcDI_ExtiIRQn(Line)], "channel %u, IRQ is not enabled", i);
+		TEST_CHECK(TestNvicPrio[PlcDI_ExtiIRQn(Line)] == PLC_NVIC_PPRIO_DI_EXTI);
+		Mask |= ((uint32_t)1 << Line);
+	}
+	TEST_CHECK(PLC_DI_EXTI_MASK == Mask);
+
+	for(Line=0; Line<PLC_DI_EXTI_LINES_SZ; Line++)
+	{
+		if(!(Mask & ((uint32_t)1 << Line))) TEST_CHECK_MSG(PLC_DI_EXTI_CH[Line] == PLC_DI_EXTI_CH_NONE, "line %u", Line);
+	}
+
+#ifndef TEST_DI_SZ
+	//PA8 -> DI.0, PB15 -> DI.1
+	TEST_CHECK(PLC_DI_EXTI_CH[8] == PLC_DI_00);
+	TEST_CHECK(PLC_DI_EXTI_CH[15] == PLC_DI_01);
+#endif // TEST_DI_SZ
+}
+
+/** @brief  Dispatcher: every pending DI-line once, lines in ascending order, other lines are not touched.
+ */
+static void TestDispatch(void)
+{
+	uint32_t Line;
+	uint32_t Foreign = (~PLC_DI_EXTI_MASK) & 0xFFFF;
+
+	PlcDI_Init();
+	PLC_DI_USER_FUNC.Exti = TestExtiCallback;
+
+	//every subset of DI-lines with all foreign lines pending
+	for(uint32_t Set=0; Set<((uint32_t)1 << PLC_DI_SZ); Set++)
+	{
+		uint32_t Pending = Foreign;
+		uint32_t Levels  = 0;
+
+		memset(TestGpio, 0, sizeof(TestGpio));
+		for(uint8_t i=0; i<PLC_DI_SZ; i++)
+		{
+			if(Set & ((uint32_t)1 << i)) Pending |= PLC_DI_PINS[i].Pin;
+
+			//level of channel i = bit i of (Set+1)
+			if(((Set+1) >> i) & 1)
+			{
+				PLC_DI_PINS[i].Port->IDR |= PLC_DI_PINS[i].Pin;
+				Levels |= ((uint32_t)1 << i);
+			}
+		}
+
+		TestExti.PR     = Pending;
+		TestExtiCallsSz = 0;
+		TestClzSz       = 0;
+
+		PlcDI_ExtiDispatch();
+
+		//one pass per pending DI-line, foreign lines and quantity of channels cost nothing
+		TEST_CHECK_MSG(TestClzSz == (uint32_t)__builtin_popcount(Set), "set %u: %u passes", Set, TestClzSz);
+
+		//only DI-lines are written to PR (cleared)
+		TEST_CHECK_MSG(TestExti.PR == (Pending & PLC_DI_EXTI_MASK), "set %u: PR=0x%08X", Set, (unsigned)TestExti.PR);
+
+		TEST_CHECK_MSG(TestExtiCallsSz == (uint32_t)__builtin_popcount(Set), "set %u: %u calls", Set, TestExtiCallsSz);
+
+		Line = 0;
+		for(uint32_t k=0; k<TestExtiCallsSz && k<PLC_DI_EXTI_LINES_SZ; k++)
+		{
+			uint8_t Ch = TestExtiCalls[k].Ch;
+
+			TEST_CHECK_MSG(Ch < PLC_DI_SZ && (Set & ((uint32_t)1 << Ch)), "set %u: call %u, channel %u", Set, k, Ch);
+			if(Ch >= PLC_DI_SZ) continue;
+
+			TEST_CHECK_MSG(TestExtiCalls[k].Val == ((Levels >> Ch) & 1), "set %u: channel %u, level", Set, Ch);
+
+			//ascending lines
+			TEST_CHECK_MSG(k == 0 || PlcDI_ExtiLine(PLC_DI_PINS[Ch].Pin) > Line, "set %u: order", Set);
+			Line = PlcDI_ExtiLine(PLC_DI_PINS[Ch].Pin);
+		}
+	}
+
+	//no callback: lines are cleared anyway
+	PLC_DI_USER_FUNC.Exti = NULL;
+	TestExti.PR = PLC_DI_EXTI_MASK;
+	PlcDI_ExtiDispatch();
+	TEST_CHECK(TestExti.PR == PLC_DI_EXTI_MASK);
+}
+
+/** @brief  Cost of a single edge: one pass for every channel, all other lines pending or not.
+ */
+static void TestDispatchCost(void)
+{
+	PlcDI_Init();
+	PLC_DI_USER_FUNC.Exti = TestExtiCallback;
+
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		//only channel i is pending
+		TestExti.PR     = PLC_DI_PINS[i].Pin;
+		TestExtiCallsSz = 0;
+		TestClzSz       = 0;
+		PlcDI_ExtiDispatch();
+		TEST_CHECK_MSG(TestClzSz == 1 && TestExtiCallsSz == 1, "channel %u: %u passes", i, TestClzSz);
+		TEST_CHECK_MSG(TestExtiCalls[0].Ch == i, "channel %u: called %u", i, TestExtiCalls[0].Ch);
+
+		//channel i and all foreign lines are pending
+		TestExti.PR     = PLC_DI_PINS[i].Pin | ((~PLC_DI_EXTI_MASK) & 0xFFFF);
+		TestExtiCallsSz = 0;
+		TestClzSz       = 0;
+		PlcDI_ExtiDispatch();
+		TEST_CHECK_MSG(TestClzSz == 1 && TestExtiCallsSz == 1, "channel %u + foreign: %u passes", i, TestClzSz);
+	}
+
+	//all channels: one pass per channel
+	TestExti.PR     = 0xFFFF;
+	TestExtiCallsSz = 0;
+	TestClzSz       = 0;
+	PlcDI_ExtiDispatch();
+	TEST_CHECK_MSG(TestClzSz == PLC_DI_SZ && TestExtiCallsSz == PLC_DI_SZ, "all channels: %u passes", TestClzSz);
+
+	PLC_DI_USER_FUNC.Exti = NULL;
+	printf("  %u channels: 1 pass per edge\n", PLC_DI_SZ);
+}
+
+/** @brief  The same line is used by one channel only, DeInit releases the table.
+ */
+static void TestDeInit(void)
+{
+	PlcDI_Init();
+	PlcDI_DeInit();
+
+	TEST_CHECK(PLC_DI_EXTI_MASK == 0);
+	for(uint32_t Line=0; Line<PLC_DI_EXTI_LINES_SZ; Line++)
+	{
+		TEST_CHECK_MSG(PLC_DI_EXTI_CH[Line] == PLC_DI_EXTI_CH_NONE, "line %u", Line);
+	}
+
+	//pending lines are not dispatched after DeInit
+	PLC_DI_USER_FUNC.Exti = TestExtiCallback;
+	TestExtiCallsSz = 0;
+	TestExti.PR     = 0xFFFF;
+	PlcDI_ExtiDispatch();
+	TEST_CHECK(TestExtiCallsSz == 0);
+	TEST_CHECK(TestExti.PR == 0);
+	PLC_DI_USER_FUNC.Exti = NULL;
+}
+
+#ifdef TEST_DI_SZ
+
+/** @brief  Fill the table: channel i -> pin (7*i+3)%16 (every channel has its own line), ports in turn.
+ */
+static void TestPinsFill(void)
+{
+	GPIO_TypeDef *Ports[] = { GPIOA, GPIOB, GPIOC, GPIOD, GPIOE, GPIOH };
+
+	for(uint8_t i=0; i<PLC_DI_SZ; i++)
+	{
+		TestPins[i].Port = Ports[i % (sizeof(Ports)/sizeof(Ports[0]))];
+		TestPins[i].Pin  = (uint16_t)(1 << ((7*i+3) % 16));
+	}
+}
+
+/** @brief  Table with a shared EXTI line or not single pin is rejected, nothing is initialized.
+ */
+static void TestInitInvalid(void)
+{
+	uint16_t Pin;
+
+	for(uint8_t i=1; i<PLC_DI_SZ; i++)
+	{
+		//channel i on the line of channel 0 (other port)
+		TestPinsFill();
+		TestPins[i].Pin = TestPins[0].Pin;
+
+		memset(TestNvicEn, 0, sizeof(TestNvicEn));
+		TEST_CHECK_MSG(PlcDI_Init() == BIT_FALSE, "channel %u shares line of channel 0", i);
+		TEST_CHECK(PLC_DI_EXTI_MASK == 0);
+		for(uint32_t k=0; k<=EXTI15_10_IRQn; k++) TEST_CHECK_MSG(!TestNvicEn[k], "IRQ %u is enabled", k);
+	}
+
+	//two pins in one channel
+	TestPinsFill();
+	Pin = TestPins[PLC_DI_SZ-1].Pin;
+	TestPins[PLC_DI_SZ-1].Pin = (uint16_t)(Pin | (Pin >> 1) | (Pin << 1));
+	TEST_CHECK(PlcDI_Init() == BIT_FALSE);
+	TEST_CHECK(PLC_DI_EXTI_MASK == 0);
+
+	//unused channel (no port) is skipped
+	TestPinsFill();
+	TestPins[1].Port = NULL;
+	TestPins[1].Pin  = TestPins[0].Pin;
+	TEST_CHECK(PlcDI_Init() == BIT_TRUE);
+	TEST_CHECK(PLC_DI_EXTI_CH[PlcDI_ExtiLine(TestPins[0].Pin)] == 0);
+
+	TestPinsFill();
+	TEST_CHECK(PlcDI_Init() == BIT_TRUE);
+}
+
+#endif // TEST_DI_SZ
+
+
+int main(void)
+{
+#ifdef TEST_DI_SZ
+	TestPinsFill();
+#endif // TEST_DI_SZ
+
+	TEST_RUN(TestExtiLine);
+	TEST_RUN(TestExtiIRQn);
+	TEST_RUN(TestInit);
+	TEST_RUN(TestDispatch);
+	TEST_RUN(TestDispatchCost);
+	TEST_RUN(TestDeInit);
+#ifdef TEST_DI_SZ
+	TEST_RUN(TestInitInvalid);
+#endif // TEST_DI_SZ
+
+	return (TEST_END());
+}
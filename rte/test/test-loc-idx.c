@@ -0,0 +1,254 @@
+/* @page test-loc-idx.c
+ *       PLC411::RTE
+ *       Host unit test: index of located variables (plc_app.c)
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        plc_app.c is included into the test, so its static functions and tables are visible.
+ *        l_tab is generated from small ranges of Zone, TypeSz, Group and a_data,
+ *        so it is full of duplicate keys (the first variable in l_tab must be taken),
+ *        variables without a_data and without buffer are mixed in.
+ *        Every query is answered by the index (PlcApp_TestLocVar, PlcApp_GetLocPos)
+ *        and by the linear scan of l_tab (the search used before the index), results must be the same.
+ *        A table longer than PLC_APP_LOC_IDX_SZ is not indexed (l_tab is scanned).
+ */
+
+#include <stdlib.h>
+
+#include "test.h"
+
+#include "../system/beremiz/src/plc_app.c"
+
+
+/** @def Ranges of keys
+ */
+#define TEST_ZONE_SZ                             3
+#define TEST_TYPE_SZ                             3
+#define TEST_GROUP_SZ                            3
+#define TEST_A_SZ                                4    //a_data values 0 ... 3 (queries -1 ... 3)
+
+/** @def Max. size of l_tab
+ */
+#define TEST_L_SZ                                3000
+
+
+/** @var Random generator (LCG, the same stream on every run)
+ */
+static uint32_t TestSeed = 12345;
+
+static uint32_t TestRand(void)
+{
+	TestSeed = TestSeed*1103515245 + 12345;
+	return ((TestSeed >> 8) & 0xFFFF);
+}
+
+
+/** @var Generated application
+ */
+static plc_loc_dsc_t  TestVar[TEST_L_SZ];
+static plc_loc_tbl_t  TestTab[TEST_L_SZ];
+static uint32_t       TestA[TEST_L_SZ][3];
+static uint8_t        TestBuf[TEST_L_SZ];
+static plc_app_abi_t  TestApp;
+
+
+/** @brief  Stubs of RTE (not used by the tested functions).
+ */
+bool plc_app_is_valid(void)
+{
+	return (false);
+}
+
+void plc_app_cstratup(void)
+{
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return (0);
+}
+
+void PlcCrc_Reset(void)
+{
+}
+
+uint32_t PlcCrc_Put(const uint32_t *DataIn, uint32_t SzIn)
+{
+	return (0);
+}
+
+
+/** @brief  Generate l_tab and build index.
+ *  @param  SzIn - size of l_tab.
+ */
+static void TestGen(uint16_t SzIn)
+{
+	for(uint16_t i=0; i<SzIn; i++)
+	{
+		TestVar[i].v_type = (uint8_t)(TestRand()%TEST_ZONE_SZ);
+		TestVar[i].v_size = (uint8_t)(TestRand()%TEST_TYPE_SZ);
+		TestVar[i].proto  = (uint16_t)(TestRand()%TEST_GROUP_SZ);
+		TestVar[i].a_size = (uint16_t)(TestRand()%4);
+		TestVar[i].a_data = TestA[i];
+		for(uint8_t k=0; k<3; k++) TestA[i][k] = TestRand()%TEST_A_SZ;
+
+		//some variables are never bound
+		TestVar[i].v_buf = ((TestRand()%16) ? &TestBuf[i] : 0);
+		TestTab[i] = &TestVar[i];
+	}
+
+	memset(&TestApp, 0, sizeof(TestApp));
+	TestApp.l_tab = TestTab;
+	TestApp.l_sz  = SzIn;
+	PLC_APP_CURR  = &TestApp;
+
+	PlcApp_InitLocIdx();
+}
+
+/** @brief  Linear scan of l_tab (search without index).
+ */
+static plc_loc_dsc_t *TestScan(const uint8_t ZoneIn, const uint8_t TypeSzIn, const uint16_t GroupIn, const int32_t A00In, const int32_t A01In, const int32_t A02In)
+{
+	for(uint16_t iVar=0; iVar<PLC_APP_CURR->l_sz; iVar++)
+	{
+		if(PLC_APP_CURR->l_tab[iVar]->v_type == ZoneIn && PLC_APP_CURR->l_tab[iVar]->v_size == TypeSzIn && PLC_APP_CURR->l_tab[iVar]->proto == GroupIn && PLC_APP_CURR->l_tab[iVar]->v_buf)
+		{
+			if(PlcApp_TestLocVarA(PLC_APP_CURR->l_tab[iVar], A00In, A01In, A02In)) return ((plc_loc_dsc_t *)PLC_APP_CURR->l_tab[iVar]);
+		}
+	}
+	return (0);
+}
+
+/** @brief  All queries: index and scan give the same variable.
+ *  @return Number of found variables.
+ */
+static uint32_t TestQueries(void)
+{
+	plc_loc_dsc_t *Res, *Ref;
+	uint32_t Found = 0;
+
+	for(uint8_t z=0; z<TEST_ZONE_SZ; z++)
+	for(uint8_t t=0; t<TEST_TYPE_SZ; t++)
+	for(uint16_t g=0; g<=TEST_GROUP_SZ; g++)
+	for(int32_t a0=-1; a0<TEST_A_SZ; a0++)
+	for(int32_t a1=-1; a1<TEST_A_SZ; a1++)
+	for(int32_t a2=-1; a2<TEST_A_SZ; a2++)
+	{
+		Res = PlcApp_TestLocVar(z, t, g, a0, a1, a2);
+		Ref = TestScan(z, t, g, a0, a1, a2);
+		TEST_CHECK_MSG(Res == Ref, "l_sz %u: %u.%u.%u.%d.%d.%d: %ld instead of %ld", PLC_APP_CURR->l_sz, z, t, g, a0, a1, a2,
+		               (Res) ? (long)(Res-TestVar) : -1L, (Ref) ? (long)(Ref-TestVar) : -1L);
+		if(Ref) Found++;
+	}
+	return (Found);
+}
+
+/** @brief  Position of every variable (duplicate keys are told apart by pointer).
+ */
+static void TestPos(void)
+{
+	plc_loc_dsc_t Var;
+
+	for(uint16_t i=0; i<PLC_APP_CURR->l_sz; i++)
+	{
+		//variables without buffer are not indexed
+		if(!PLC_APP_CURR->l_tab[i]->v_buf && PlcApp_LocIdxOk) continue;
+		TEST_CHECK_MSG(PlcApp_GetLocPos(PLC_APP_CURR->l_tab[i]) == i, "l_sz %u: position of %u", PLC_APP_CURR->l_sz, i);
+	}
+
+	//not in l_tab (key of the first variable)
+	Var = *PLC_APP_CURR->l_tab[0];
+	TEST_CHECK(PlcApp_GetLocPos(&Var) == 0xFFFF);
+}
+
+
+/** @brief  Index is sorted by key, equal keys by position.
+ */
+static void TestSorted(void)
+{
+	PlcApp_LocKey_t Key;
+
+	TestGen(PLC_APP_LOC_IDX_SZ);
+	TEST_CHECK(PlcApp_LocIdxOk);
+
+	for(uint16_t i=1; i<PlcApp_LocIdxSz; i++)
+	{
+		PlcApp_LocKey(PLC_APP_CURR->l_tab[PlcApp_LocIdx[i]], &Key);
+		TEST_CHECK_MSG(PlcApp_LocCmp(PLC_APP_CURR->l_tab[PlcApp_LocIdx[i-1]], &Key, 3) <= 0, "index %u", i);
+		if(!PlcApp_LocCmp(PLC_APP_CURR->l_tab[PlcApp_LocIdx[i-1]], &Key, 3)) TEST_CHECK(PlcApp_LocIdx[i-1] < PlcApp_LocIdx[i]);
+	}
+}
+
+/** @brief  Index vs. scan for sizes of l_tab up to PLC_APP_LOC_IDX_SZ.
+ */
+static void TestIndex(void)
+{
+	const uint16_t Sz[] = { 1, 2, 17, 100, 500, PLC_APP_LOC_IDX_SZ };
+	uint32_t Found;
+
+	for(uint8_t i=0; i<sizeof(Sz)/sizeof(Sz[0]); i++)
+	{
+		TestGen(Sz[i]);
+		TEST_CHECK_MSG(PlcApp_LocIdxOk, "l_sz %u is not indexed", Sz[i]);
+
+		Found = TestQueries();
+		TestPos();
+
+		//the bigger tables do find variables
+		if(Sz[i] >= 100) TEST_CHECK_MSG(Found > 100, "l_sz %u: %u found", Sz[i], Found);
+	}
+}
+
+/** @brief  Duplicate keys: the first variable in l_tab with buffer is taken.
+ */
+static void TestDuplicates(void)
+{
+	TestGen(PLC_APP_LOC_IDX_SZ);
+
+	//the same key in the whole table, buffers from position 10
+	for(uint16_t i=0; i<PLC_APP_CURR->l_sz; i++)
+	{
+		TestVar[i].v_type = PLC_LT_Q;
+		TestVar[i].v_size = PLC_LSZ_X;
+		TestVar[i].proto  = 1;
+		TestVar[i].a_size = 2;
+		TestA[i][0] = 0;
+		TestA[i][1] = 1;
+		TestVar[i].v_buf  = ((i >= 10) ? &TestBuf[i] : 0);
+	}
+	PlcApp_InitLocIdx();
+
+	TEST_CHECK(PlcApp_TestLocVar(PLC_LT_Q, PLC_LSZ_X, 1, 0, 1, -1) == &TestVar[10]);
+	TEST_CHECK(PlcApp_TestLocVar(PLC_LT_Q, PLC_LSZ_X, 1, -1, -1, -1) == &TestVar[10]);
+	TEST_CHECK(PlcApp_TestLocVar(PLC_LT_Q, PLC_LSZ_X, 1, 0, 2, -1) == 0);
+	TestQueries();
+	TestPos();
+}
+
+/** @brief  Table longer than PLC_APP_LOC_IDX_SZ: not indexed, scan gives the same result.
+ */
+static void TestLong(void)
+{
+	TestGen(TEST_L_SZ);
+	TEST_CHECK(!PlcApp_LocIdxOk);
+	TEST_CHECK(TestQueries() > 100);
+	TestPos();
+
+	//one variable more than PLC_APP_LOC_IDX_SZ
+	TestGen(PLC_APP_LOC_IDX_SZ+1);
+	TEST_CHECK(!PlcApp_LocIdxOk);
+	TestQueries();
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestSorted);
+	TEST_RUN(TestIndex);
+	TEST_RUN(TestDuplicates);
+	TEST_RUN(TestLong);
+
+	return (TEST_END());
+}
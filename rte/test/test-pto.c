@@ -0,0 +1,311 @@
+/* @page test-pto.c
+ *       PLC411::RTE
+ *       Host unit test: pulse train profiles (pto.c)
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Profile is played back as the output driver does (do.c):
+ *        steps of segment one per pulse, the last step Rep times more.
+ *        Pulses are counted by CCR != 0 (the terminal step is not a pulse).
+ */
+
+#include "test.h"
+#include "pto.h"
+
+
+/** @def Timer of DO (tim2.h)
+ */
+#define TEST_PTO_TICK_HZ                         (uint32_t)1000000
+#define TEST_PTO_ARR_MIN                         (uint32_t)(10-1)
+#define TEST_PTO_ARR_MAX                         (uint32_t)(1000000000-1)
+
+/** @def Max. quantity of runs in played profile
+ */
+#define TEST_PTO_RUNS_SZ                         (PLC_PTO_STEPS_SZ*2)
+
+
+/** @typedef Run of played profile (pulses with the same period)
+ */
+typedef struct TestPto_Run_t_
+{
+	uint32_t Arr;
+	uint32_t Cnt;
+
+} TestPto_Run_t;
+
+/** @var Profile (large, not on stack)
+ */
+static PlcPto_Prof_t TestProf;
+
+
+/** @brief  Settings with timer of DO.
+ */
+static PlcPto_Cfg_t TestPto_Cfg(uint32_t PulsesIn, uint32_t FreqStartIn, uint32_t FreqMaxIn, uint32_t AccelIn, uint8_t ProfileIn)
+{
+	PlcPto_Cfg_t Cfg;
+
+	Cfg.Pulses    = PulsesIn;
+	Cfg.FreqStart = FreqStartIn;
+	Cfg.FreqMax   = FreqMaxIn;
+	Cfg.Accel     = AccelIn;
+	Cfg.Profile   = ProfileIn;
+	Cfg.Ccr       = PLC_PTO_CCR1;
+	Cfg.TickHz    = TEST_PTO_TICK_HZ;
+	Cfg.ArrMin    = TEST_PTO_ARR_MIN;
+	Cfg.ArrMax    = TEST_PTO_ARR_MAX;
+
+	return (Cfg);
+}
+
+/** @brief  Play profile back: runs of pulses (adjacent runs with the same period are joined).
+ *  @return Quantity of runs.
+ */
+static uint32_t TestPto_Play(const PlcPto_Cfg_t *CfgIn, const PlcPto_Prof_t *ProfIn, TestPto_Run_t *RunsOut, uint64_t *PulsesOut)
+{
+	uint32_t Runs = 0;
+	uint64_t Pulses = 0;
+
+	for(uint16_t s=0; s<ProfIn->SegsQty; s++)
+	{
+		const PlcPto_Seg_t *Seg = &ProfIn->Segs[s];
+
+		for(uint16_t k=0; k<Seg->Qty; k++)
+		{
+			const PlcPto_Step_t *Step = &ProfIn->Steps[Seg->First+k];
+			uint64_t Cnt = 1 + ((k == Seg->Qty-1) ? Seg->Rep : 0);
+
+			if(!Step->Ccr[CfgIn->Ccr]) continue;
+			Pulses += Cnt;
+
+			if(Runs && RunsOut[Runs-1].Arr == Step->Arr)
+			{
+				RunsOut[Runs-1].Cnt += (uint32_t)Cnt;
+			}
+			else if(Runs < TEST_PTO_RUNS_SZ)
+			{
+				RunsOut[Runs].Arr = Step->Arr;
+				RunsOut[Runs].Cnt = (uint32_t)Cnt;
+				Runs++;
+			}
+		}
+	}
+
+	*PulsesOut = Pulses;
+	return (Runs);
+}
+
+/** @brief  Check built profile.
+ */
+static void TestPto_CheckProf(const PlcPto_Cfg_t *CfgIn)
+{
+	TestPto_Run_t Runs[TEST_PTO_RUNS_SZ];
+	uint32_t      RunsQty;
+	uint64_t      Pulses;
+	uint8_t       Res;
+	uint16_t      Steps = 0;
+
+	memset(&TestProf, 0xA5, sizeof(TestProf));
+	Res = PlcPto_Build(CfgIn, &TestProf);
+	TEST_CHECK_MSG(Res == PLC_PTO_OK, "N=%u Fs=%u Fm=%u A=%u P=%u: result %u", CfgIn->Pulses, CfgIn->FreqStart, CfgIn->FreqMax, CfgIn->Accel, CfgIn->Profile, Res);
+	if(Res != PLC_PTO_OK) return;
+
+	//layout: segments cover steps in order, capacity is not exceeded
+	TEST_CHECK(TestProf.StepsQty >= 2 && TestProf.StepsQty <= PLC_PTO_STEPS_SZ);
+	TEST_CHECK(TestProf.SegsQty >= 1 && TestProf.SegsQty <= TestProf.StepsQty);
+	for(uint16_t s=0; s<TestProf.SegsQty; s++)
+	{
+		TEST_CHECK(TestProf.Segs[s].First == Steps && TestProf.Segs[s].Qty >= 1);
+		Steps += TestProf.Segs[s].Qty;
+	}
+	TEST_CHECK(Steps == TestProf.StepsQty);
+
+	//steps: period in limits, pulse 50% on the selected channel only, terminal step holds output low
+	for(uint16_t i=0; i<TestProf.StepsQty; i++)
+	{
+		const PlcPto_Step_t *Step = &TestProf.Steps[i];
+
+		TEST_CHECK(Step->Arr >= CfgIn->ArrMin && Step->Arr <= CfgIn->ArrMax);
+		TEST_CHECK(Step->Rcr == 0 && Step->Ccr[!CfgIn->Ccr] == 0);
+		if(i < TestProf.StepsQty-1) TEST_CHECK(Step->Ccr[CfgIn->Ccr] == ((Step->Arr+1)>>1));
+		else                        TEST_CHECK(Step->Ccr[CfgIn->Ccr] == 0);
+	}
+	TEST_CHECK(TestProf.Segs[TestProf.SegsQty-1].Rep == 0);
+
+	RunsQty = TestPto_Play(CfgIn, &TestProf, Runs, &Pulses);
+
+	//exact quantity of pulses
+	TEST_CHECK_MSG(Pulses == CfgIn->Pulses, "N=%u Fs=%u Fm=%u A=%u P=%u: %llu pulses", CfgIn->Pulses, CfgIn->FreqStart, CfgIn->FreqMax, CfgIn->Accel, CfgIn->Profile, (unsigned long long)Pulses);
+
+	//ramp is not longer than half of train
+	TEST_CHECK(TestProf.RampPulses <= (CfgIn->Pulses>>1));
+
+	//deceleration is the mirror of acceleration
+	for(uint32_t i=0; i<RunsQty/2; i++)
+	{
+		TEST_CHECK_MSG(Runs[i].Arr == Runs[RunsQty-1-i].Arr && Runs[i].Cnt == Runs[RunsQty-1-i].Cnt,
+		               "N=%u Fs=%u Fm=%u A=%u P=%u: run %u (%u x %u) != run %u (%u x %u)", CfgIn->Pulses, CfgIn->FreqStart, CfgIn->FreqMax, CfgIn->Accel, CfgIn->Profile,
+		               i, Runs[i].Arr, Runs[i].Cnt, RunsQty-1-i, Runs[RunsQty-1-i].Arr, Runs[RunsQty-1-i].Cnt);
+	}
+
+	//frequency does not fall during acceleration
+	for(uint32_t i=1; i<(RunsQty+1)/2; i++)
+	{
+		TEST_CHECK_MSG(Runs[i].Arr <= Runs[i-1].Arr, "N=%u Fs=%u Fm=%u A=%u P=%u: run %u", CfgIn->Pulses, CfgIn->FreqStart, CfgIn->FreqMax, CfgIn->Accel, CfgIn->Profile, i);
+	}
+}
+
+
+/** @brief  Exact quantity of pulses, symmetry and limits over a grid of settings.
+ */
+static void TestPtoGrid(void)
+{
+	static const uint32_t Pulses[]    = { 1, 2, 3, 4, 5, 7, 8, 63, 64, 65, 127, 128, 129, 130, 131, 1000, 4097, 12345, 1000000, 16777216 };
+	static const uint32_t FreqStart[] = { 0, 1, 100, 1000 };
+	static const uint32_t FreqMax[]   = { 1, 1000, 37000, 100000 };
+	static const uint32_t Accel[]     = { 0, 1, 100, 10000, 1000000, 0xFFFFFFFF };
+	PlcPto_Cfg_t Cfg;
+
+	for(uint8_t p=PLC_PTO_PROFILE_TRAP; p<=PLC_PTO_PROFILE_SCURVE; p++)
+	for(uint32_t n=0; n<sizeof(Pulses)/sizeof(Pulses[0]); n++)
+	for(uint32_t fs=0; fs<sizeof(FreqStart)/sizeof(FreqStart[0]); fs++)
+	for(uint32_t fm=0; fm<sizeof(FreqMax)/sizeof(FreqMax[0]); fm++)
+	for(uint32_t a=0; a<sizeof(Accel)/sizeof(Accel[0]); a++)
+	{
+		if(FreqStart[fs] > FreqMax[fm]) continue;
+
+		Cfg = TestPto_Cfg(Pulses[n], FreqStart[fs], FreqMax[fm], Accel[a], p);
+		TestPto_CheckProf(&Cfg);
+
+		Cfg.Ccr = PLC_PTO_CCR2;
+		TestPto_CheckProf(&Cfg);
+	}
+}
+
+/** @brief  Every quantity of pulses of short trains (ramps built pulse-by-pulse and by runs).
+ */
+static void TestPtoShort(void)
+{
+	PlcPto_Cfg_t Cfg;
+
+	for(uint8_t p=PLC_PTO_PROFILE_TRAP; p<=PLC_PTO_PROFILE_SCURVE; p++)
+	for(uint32_t n=1; n<=600; n++)
+	{
+		Cfg = TestPto_Cfg(n, 200, 20000, 50000, p);
+		TestPto_CheckProf(&Cfg);
+	}
+}
+
+/** @brief  Trapezoid: ramp length matches (Fmax^2 - Fs^2) / (2 * Accel), cruise runs at FreqMax.
+ */
+static void TestPtoTrapRamp(void)
+{
+	TestPto_Run_t Runs[TEST_PTO_RUNS_SZ];
+	PlcPto_Cfg_t  Cfg = TestPto_Cfg(100000, 1000, 20000, 40000, PLC_PTO_PROFILE_TRAP);
+	uint64_t      Pulses;
+	uint32_t      RunsQty;
+	double        Ramp = ((double)Cfg.FreqMax*Cfg.FreqMax - (double)Cfg.FreqStart*Cfg.FreqStart)/(2.0*Cfg.Accel);
+
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK_NEAR(TestProf.RampPulses, Ramp, 1.0);
+
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(RunsQty & 1);
+	TEST_CHECK(Runs[RunsQty/2].Arr == TEST_PTO_TICK_HZ/Cfg.FreqMax-1);
+	TEST_CHECK(Runs[RunsQty/2].Cnt >= Cfg.Pulses-2*TestProf.RampPulses);
+
+	//S-curve: the same average acceleration, ramp is 1.5 times longer
+	Cfg.Profile = PLC_PTO_PROFILE_SCURVE;
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK_NEAR(TestProf.RampPulses, 1.5*Ramp, 1.0);
+}
+
+/** @brief  Degenerate profiles.
+ */
+static void TestPtoDegenerate(void)
+{
+	TestPto_Run_t Runs[TEST_PTO_RUNS_SZ];
+	PlcPto_Cfg_t  Cfg;
+	uint64_t      Pulses;
+	uint32_t      RunsQty;
+
+	//one pulse: no ramps
+	Cfg = TestPto_Cfg(1, 100, 10000, 1000, PLC_PTO_PROFILE_TRAP);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK(TestProf.RampPulses == 0);
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(RunsQty == 1 && Pulses == 1);
+
+	//two pulses, long ramp: triangle of one pulse up and one down
+	Cfg = TestPto_Cfg(2, 100, 10000, 1, PLC_PTO_PROFILE_SCURVE);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK(TestProf.RampPulses == 1);
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(RunsQty == 1 && Runs[0].Cnt == 2);
+
+	//three pulses: triangle with one cruise pulse
+	Cfg = TestPto_Cfg(3, 100, 10000, 10, PLC_PTO_PROFILE_TRAP);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK(TestProf.RampPulses == 1);
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(Pulses == 3 && (RunsQty == 1 || RunsQty == 3));
+
+	//no acceleration: all pulses at FreqMax
+	Cfg = TestPto_Cfg(1000, 100, 10000, 0, PLC_PTO_PROFILE_TRAP);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK(TestProf.RampPulses == 0);
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(RunsQty == 1 && Runs[0].Cnt == 1000 && Runs[0].Arr == 99);
+
+	//start frequency is max. frequency: no ramps
+	Cfg = TestPto_Cfg(1000, 10000, 10000, 100, PLC_PTO_PROFILE_SCURVE);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK(TestProf.RampPulses == 0);
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(RunsQty == 1 && Runs[0].Arr == 99);
+
+	//start from 0 Hz with 1 Hz max.: the slowest pulse is limited by ARR max.
+	Cfg = TestPto_Cfg(4, 0, 1, 1, PLC_PTO_PROFILE_TRAP);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	RunsQty = TestPto_Play(&Cfg, &TestProf, Runs, &Pulses);
+	TEST_CHECK(Pulses == 4);
+	for(uint32_t i=0; i<RunsQty; i++) TEST_CHECK(Runs[i].Arr <= TEST_PTO_ARR_MAX);
+
+	//max. frequency of timer
+	Cfg = TestPto_Cfg(10, 0, TEST_PTO_TICK_HZ/(TEST_PTO_ARR_MIN+1), 0, PLC_PTO_PROFILE_TRAP);
+	TEST_CHECK(PlcPto_Build(&Cfg, &TestProf) == PLC_PTO_OK);
+	TEST_CHECK(TestProf.Steps[0].Arr == TEST_PTO_ARR_MIN);
+}
+
+/** @brief  Invalid settings are rejected.
+ */
+static void TestPtoErrors(void)
+{
+	PlcPto_Cfg_t Cfg = TestPto_Cfg(100, 100, 1000, 100, PLC_PTO_PROFILE_TRAP);
+	PlcPto_Cfg_t Bad;
+
+	TEST_CHECK(PlcPto_Build(NULL, &TestProf) == PLC_PTO_ERR_ARG);
+	TEST_CHECK(PlcPto_Build(&Cfg, NULL) == PLC_PTO_ERR_ARG);
+
+	Bad = Cfg; Bad.TickHz = 0;                                        TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_ARG);
+	Bad = Cfg; Bad.ArrMin = Bad.ArrMax+1;                             TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_ARG);
+	Bad = Cfg; Bad.Ccr = 2;                                           TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_ARG);
+	Bad = Cfg; Bad.Pulses = 0;                                        TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_PULSES);
+	Bad = Cfg; Bad.FreqMax = 0;                                       TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_FREQ);
+	Bad = Cfg; Bad.FreqMax = TEST_PTO_TICK_HZ/(TEST_PTO_ARR_MIN+1)+1; TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_FREQ);
+	Bad = Cfg; Bad.FreqStart = Bad.FreqMax+1;                         TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_FREQ);
+	Bad = Cfg; Bad.Profile = 2;                                       TEST_CHECK(PlcPto_Build(&Bad, &TestProf) == PLC_PTO_ERR_PROFILE);
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestPtoGrid);
+	TEST_RUN(TestPtoShort);
+	TEST_RUN(TestPtoTrapRamp);
+	TEST_RUN(TestPtoDegenerate);
+	TEST_RUN(TestPtoErrors);
+
+	return (TEST_END());
+}
@@ -0,0 +1,289 @@
+/* @page test-pwm-plan.c
+ *       PLC411::RTE
+ *       Host unit test: PWM period planner (pwm-plan.c)
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Every plan is compared with brute force over allowed prescalers
+ *        (Pmin ... min(PSC_MAX+1, Ticks/Res)):
+ *        - error of period of plan is the least one (|(PSC+1)*(ARR+1)*Den - Num|)
+ *        - the least prescaler is used on equal error
+ *        - error is not greater than a half of the least prescaled tick
+ *        - ARR+1 >= requested resolution (or PLC_PWM_PLAN_ERR_RES if it is not reachable)
+ *
+ *        Frequency requests (DO timer) are checked for every integer frequency 1 Hz ... 1 MHz
+ *        against all allowed prescalers (the search window of the planner does not miss any better one).
+ *
+ *        Period requests (DO timer, TIM4) are checked for every ns of short periods
+ *        and for log-spaced long periods against prescalers of the search window
+ *        (Pmin ... Pmin+PLC_PWM_PLAN_SEARCH_SZ-1): long periods at low resolution
+ *        may have an exact divider far above the window, the error is a half of prescaled tick anyway.
+ */
+
+#include "test.h"
+#include "pwm-plan.h"
+
+
+/** @var Timer limits (DO timers, TIM4)
+ */
+static const PlcPwmPlan_Tim_t TEST_TIM_DO   = { 100000000, 0xFFFF, 99, 999999999 };
+static const PlcPwmPlan_Tim_t TEST_TIM_TIM4 = { 100000000, 0xFFFF, 99, 0xFFFF };
+
+/** @var Brute force of the same request
+ */
+typedef struct TestRef_t_
+{
+	uint64_t Num, Den;
+	uint64_t Ticks;
+	uint64_t PMin, PMax;
+	uint64_t Err;
+	uint64_t P;
+	uint8_t  Limit;
+
+} TestRef_t;
+
+
+/** @brief  Error of period.
+ */
+static uint64_t TestErr(const TestRef_t *RefIn, uint64_t PIn, uint64_t AIn)
+{
+	uint64_t AP = AIn*PIn*RefIn->Den;
+
+	return ((AP > RefIn->Num) ? AP-RefIn->Num : RefIn->Num-AP);
+}
+
+/** @brief  Brute force over prescalers.
+ *  @param  TimIn - timer limits.
+ *  @param  UnitIn - unit of request.
+ *  @param  ValIn - request.
+ *  @param  ResIn - requested resolution.
+ *  @param  WinIn - search window of the planner:
+ *  @arg    = 0 - all allowed prescalers
+ *  @arg    = 1 - Pmin ... Pmin+PLC_PWM_PLAN_SEARCH_SZ-1
+ *  @param  RefIn - result.
+ */
+static void TestRef(const PlcPwmPlan_Tim_t *TimIn, uint8_t UnitIn, uint64_t ValIn, uint32_t ResIn, uint8_t WinIn, TestRef_t *RefIn)
+{
+	uint64_t ArrSz = (uint64_t)TimIn->ArrMax+1;
+	uint64_t Res   = ((ResIn > TimIn->ArrMin+1) ? ResIn : TimIn->ArrMin+1);
+	uint64_t P, A, PD, Err;
+
+	if(UnitIn == PLC_PWM_PLAN_UNIT_HZ)
+	{
+		RefIn->Num = TimIn->ClkHz;
+		RefIn->Den = ValIn;
+	}
+	else
+	{
+		//100 MHz: ticks = ns/10
+		RefIn->Num = ValIn*(TimIn->ClkHz/10000000);
+		RefIn->Den = 100;
+	}
+
+	RefIn->Ticks = (RefIn->Num + RefIn->Den/2)/RefIn->Den;
+	RefIn->Limit = (RefIn->Ticks < (uint64_t)TimIn->ArrMin+1 || RefIn->Ticks > ((uint64_t)TimIn->PscMax+1)*ArrSz);
+	RefIn->Err   = UINT64_MAX;
+	RefIn->P     = 0;
+	if(RefIn->Limit) return;
+
+	RefIn->PMin = (RefIn->Ticks + ArrSz - 1)/ArrSz;
+	RefIn->PMax = ((ResIn) ? RefIn->Ticks/Res : RefIn->PMin);
+	if(RefIn->PMax > (uint64_t)TimIn->PscMax+1) RefIn->PMax = (uint64_t)TimIn->PscMax+1;
+	if(WinIn && RefIn->PMax > RefIn->PMin+PLC_PWM_PLAN_SEARCH_SZ-1) RefIn->PMax = RefIn->PMin+PLC_PWM_PLAN_SEARCH_SZ-1;
+	if(RefIn->PMax < RefIn->PMin)               RefIn->PMax = RefIn->PMin;
+
+	for(P=RefIn->PMin; P<=RefIn->PMax; P++)
+	{
+		PD = P*RefIn->Den;
+		A  = (RefIn->Num + PD/2)/PD;
+		if(A < (uint64_t)TimIn->ArrMin+1) A = (uint64_t)TimIn->ArrMin+1;
+		if(A > ArrSz)                     A = ArrSz;
+
+		Err = TestErr(RefIn, P, A);
+		if(Err < RefIn->Err)
+		{
+			RefIn->Err = Err;
+			RefIn->P   = P;
+		}
+	}
+}
+
+/** @brief  Check plan of request against brute force.
+ *  @param  WinIn - search window (see TestRef).
+ *  @return 1 if all checks are passed.
+ */
+static int TestPlan(const PlcPwmPlan_Tim_t *TimIn, uint8_t UnitIn, uint64_t ValIn, uint32_t ResIn, uint8_t WinIn)
+{
+	TestRef_t    Ref;
+	PlcPwmPlan_t Plan = { 0, 0 };
+	uint8_t      Rc   = PlcPwmPlan_Calc(TimIn, UnitIn, ValIn, ResIn, &Plan);
+	uint64_t     P    = (uint64_t)Plan.Psc+1;
+	uint64_t     A    = (uint64_t)Plan.Arr+1;
+	uint64_t     Err;
+	unsigned long Fails = TestFails;
+
+	TestRef(TimIn, UnitIn, ValIn, ResIn, WinIn, &Ref);
+
+	if(Ref.Limit)
+	{
+		TEST_CHECK_MSG(Rc == PLC_PWM_PLAN_ERR_RANGE, "unit %u, val %llu: rc %u", UnitIn, (unsigned long long)ValIn, Rc);
+		return (TestFails == Fails);
+	}
+
+	Err = TestErr(&Ref, P, A);
+
+	//limits of timer
+	TEST_CHECK_MSG(Plan.Psc <= TimIn->PscMax && Plan.Arr >= TimIn->ArrMin && Plan.Arr <= TimIn->ArrMax,
+	               "unit %u, val %llu, res %u: PSC %u, ARR %u", UnitIn, (unsigned long long)ValIn, ResIn, Plan.Psc, Plan.Arr);
+
+	//the least error, the least prescaler on equal error
+	TEST_CHECK_MSG(Err == Ref.Err && P == Ref.P,
+	               "unit %u, val %llu, res %u: P %llu err %llu, brute force P %llu err %llu", UnitIn, (unsigned long long)ValIn, ResIn,
+	               (unsigned long long)P, (unsigned long long)Err, (unsigned long long)Ref.P, (unsigned long long)Ref.Err);
+
+	//a half of the least prescaled tick
+	TEST_CHECK_MSG(Err*2 <= Ref.PMin*Ref.Den, "unit %u, val %llu, res %u: err %llu", UnitIn, (unsigned long long)ValIn, ResIn, (unsigned long long)Err);
+
+	//resolution
+	if(Rc == PLC_PWM_PLAN_ERR_RES)
+	{
+		TEST_CHECK_MSG(ResIn && A < ResIn, "unit %u, val %llu, res %u: ERR_RES with ARR+1 %llu", UnitIn, (unsigned long long)ValIn, ResIn, (unsigned long long)A);
+		//not reachable: the best resolution (Pmin) is not enough
+		TEST_CHECK_MSG(Ref.Ticks/Ref.PMin < ResIn, "unit %u, val %llu, res %u: resolution is reachable", UnitIn, (unsigned long long)ValIn, ResIn);
+	}
+	else
+	{
+		TEST_CHECK_MSG(Rc == PLC_PWM_PLAN_OK, "unit %u, val %llu, res %u: rc %u", UnitIn, (unsigned long long)ValIn, ResIn, Rc);
+		TEST_CHECK_MSG(A >= ResIn, "unit %u, val %llu, res %u: ARR+1 %llu", UnitIn, (unsigned long long)ValIn, ResIn, (unsigned long long)A);
+	}
+
+	return (TestFails == Fails);
+}
+
+
+/** @brief  Every integer frequency 1 Hz ... 1 MHz of DO timer.
+ */
+static void TestFreqAll(void)
+{
+	static const uint32_t Res[] = { 0, 100, 1000, 10000 };
+
+	for(uint32_t r=0; r<sizeof(Res)/sizeof(Res[0]); r++)
+	{
+		for(uint64_t F=1; F<=1000000; F++)
+		{
+			if(!TestPlan(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_HZ, F, Res[r], 0) && TestFails > 50) return;
+		}
+	}
+}
+
+/** @brief  Period requests: every ns of short periods, log-spaced long periods.
+ */
+static void TestPeriod(void)
+{
+	static const uint32_t Res[] = { 0, 100, 10000 };
+	uint64_t T;
+
+	//TIM4 (ARR is 16-bit): prescaler changes every 655.36 us
+	for(T=1; T<=2000000; T++)
+	{
+		if(!TestPlan(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, T, 0, 1) && TestFails > 50) return;
+	}
+	for(T=2000000; T<=(uint64_t)50000000000; T+=T/997+1)
+	{
+		if(!TestPlan(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, T, 0, 1) && TestFails > 50) return;
+	}
+
+	//DO timer
+	for(uint32_t r=0; r<sizeof(Res)/sizeof(Res[0]); r++)
+	{
+		for(T=1; T<=200000; T++)
+		{
+			if(!TestPlan(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_NS, T, Res[r], 1) && TestFails > 50) return;
+		}
+		for(T=200000; T<=(uint64_t)1000000000000; T+=T/997+1)
+		{
+			if(!TestPlan(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_NS, T, Res[r], 1) && TestFails > 50) return;
+		}
+	}
+}
+
+/** @brief  Limits of timer and invalid arguments.
+ */
+static void TestLimits(void)
+{
+	PlcPwmPlan_Tim_t Tim;
+	PlcPwmPlan_t     Plan;
+
+	//out of range: limit plans
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_HZ, 2000000, 0, &Plan) == PLC_PWM_PLAN_ERR_RANGE);
+	TEST_CHECK(Plan.Psc == 0 && Plan.Arr == TEST_TIM_DO.ArrMin);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, 500, 0, &Plan) == PLC_PWM_PLAN_ERR_RANGE);
+	TEST_CHECK(Plan.Psc == 0 && Plan.Arr == TEST_TIM_TIM4.ArrMin);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, (uint64_t)100000000000, 0, &Plan) == PLC_PWM_PLAN_ERR_RANGE);
+	TEST_CHECK(Plan.Psc == TEST_TIM_TIM4.PscMax && Plan.Arr == TEST_TIM_TIM4.ArrMax);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, UINT64_MAX, 0, &Plan) == PLC_PWM_PLAN_ERR_RANGE);
+	TEST_CHECK(Plan.Psc == TEST_TIM_TIM4.PscMax && Plan.Arr == TEST_TIM_TIM4.ArrMax);
+
+	//the longest and the shortest periods of TIM4
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, (uint64_t)42949672960, 0, &Plan) == PLC_PWM_PLAN_OK);
+	TEST_CHECK(Plan.Psc == 0xFFFF && Plan.Arr == 0xFFFF);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, 1000, 0, &Plan) == PLC_PWM_PLAN_OK);
+	TEST_CHECK(Plan.Psc == 0 && Plan.Arr == 99);
+
+	//invalid arguments: plan is not changed
+	Plan.Psc = 123;
+	Plan.Arr = 456;
+	TEST_CHECK(PlcPwmPlan_Calc(NULL, PLC_PWM_PLAN_UNIT_HZ, 1000, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_HZ, 1000, 0, NULL) == PLC_PWM_PLAN_ERR_ARG);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_HZ, 0, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG);
+	TEST_CHECK(PlcPwmPlan_Calc(&TEST_TIM_DO, 2, 1000, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG);
+	Tim = TEST_TIM_DO;
+	Tim.ClkHz = 0;
+	TEST_CHECK(PlcPwmPlan_Calc(&Tim, PLC_PWM_PLAN_UNIT_HZ, 1000, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG);
+	Tim = TEST_TIM_DO;
+	Tim.PscMax = 0x10000;
+	TEST_CHECK(PlcPwmPlan_Calc(&Tim, PLC_PWM_PLAN_UNIT_HZ, 1000, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG);
+	Tim = TEST_TIM_DO;
+	Tim.ArrMin = Tim.ArrMax+1;
+	TEST_CHECK(PlcPwmPlan_Calc(&Tim, PLC_PWM_PLAN_UNIT_HZ, 1000, 0, &Plan) == PLC_PWM_PLAN_ERR_ARG);
+	TEST_CHECK(Plan.Psc == 123 && Plan.Arr == 456);
+}
+
+/** @brief  Frequency and period of plan.
+ */
+static void TestReport(void)
+{
+	PlcPwmPlan_t Plan;
+
+	for(uint64_t F=1; F<=1000000; F+=F/64+1)
+	{
+		PlcPwmPlan_Calc(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_HZ, F, 10000, &Plan);
+
+		double Ticks = ((double)Plan.Psc+1)*((double)Plan.Arr+1);
+		TEST_CHECK_NEAR(PlcPwmPlan_FreqMilliHz(&TEST_TIM_DO, &Plan), 1e11/Ticks, 0.5);
+		TEST_CHECK_NEAR(PlcPwmPlan_PeriodNs(&TEST_TIM_DO, &Plan), Ticks*10.0, 0.5);
+	}
+
+	//exact dividers
+	PlcPwmPlan_Calc(&TEST_TIM_DO, PLC_PWM_PLAN_UNIT_HZ, 1000, 0, &Plan);
+	TEST_CHECK(PlcPwmPlan_FreqMilliHz(&TEST_TIM_DO, &Plan) == 1000000);
+	TEST_CHECK(PlcPwmPlan_PeriodNs(&TEST_TIM_DO, &Plan) == 1000000);
+	PlcPwmPlan_Calc(&TEST_TIM_TIM4, PLC_PWM_PLAN_UNIT_NS, 10000000, 0, &Plan);
+	TEST_CHECK(PlcPwmPlan_PeriodNs(&TEST_TIM_TIM4, &Plan) == 10000000);
+
+	TEST_CHECK(PlcPwmPlan_FreqMilliHz(NULL, &Plan) == 0);
+	TEST_CHECK(PlcPwmPlan_PeriodNs(&TEST_TIM_DO, NULL) == 0);
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestFreqAll);
+	TEST_RUN(TestPeriod);
+	TEST_RUN(TestLimits);
+	TEST_RUN(TestReport);
+
+	return (TEST_END());
+}
@@ -0,0 +1,488 @@
+/* @page test-retain.c
+ *       PLC411::RTE
+ *       Host unit test: retain-data journal (retain.c), power loss
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Storage is a RAM model of flash: erased word is 0xFFFFFFFF,
+ *        a word is programmed once after erase (programming clears bits only).
+ *        Power is cut after a random number of operations:
+ *        - word being programmed is torn (a random part of its bits is cleared)
+ *          or complete (power is cut just after it)
+ *        - sector being erased is left with random content
+ *        - further operations fail until restart (PlcRetain_Init, may be cut as well)
+ *
+ *        After every cut the journal is restarted, the restored image (and id)
+ *        must be the image of the last complete commit or the image being committed,
+ *        never a mix of blocks of them. A commit must never erase (see PlcRetain_Prepare).
+ */
+
+#include <stdlib.h>
+
+#include "test.h"
+#include "retain.h"
+
+
+/** @def Words of sector
+ */
+#define TEST_SECT_WSZ                            (PLC_RETAIN_SECT_SZ/4)
+
+/** @def Operations of erasing (a cut while erasing is as probable as while programming of 64 words)
+ */
+#define TEST_ERASE_OPS                           64
+
+/** @def Number of power cuts
+ */
+#define TEST_CUTS                                20000
+
+
+/** @var Random generator (LCG, the same stream on every run)
+ */
+static uint32_t TestSeed = 12345;
+
+static uint32_t TestRand(void)
+{
+	TestSeed = TestSeed*1103515245 + 12345;
+	return ((TestSeed >> 8) & 0xFFFF);
+}
+
+static uint32_t TestRand32(void)
+{
+	return ((TestRand() << 16) | TestRand());
+}
+
+
+/** @var Flash model
+ */
+static uint32_t TestFlash[PLC_RETAIN_SECT_NUM][TEST_SECT_WSZ];
+
+/** @var Operations before power cut (< 0 - power is not cut)
+ */
+static long TestBudget = -1;
+
+/** @var Power is cut (operations fail until restart)
+ */
+static uint8_t TestOff = 0;
+
+/** @var PlcRetain_Write is executed
+ */
+static uint8_t TestInWrite = 0;
+
+/** @var Statistics
+ */
+static unsigned long TestErases = 0, TestWriteErases = 0;
+static unsigned long TestCutProg = 0, TestCutHdr = 0, TestCutErase = 0;
+
+/** @brief  Spend one operation.
+ *  @return 1 - done, 0 - power is cut while the operation.
+ */
+static uint8_t TestOp(void)
+{
+	if(TestBudget < 0) return (1);
+	if(TestBudget-- > 0) return (1);
+	TestOff = 1;
+	return (0);
+}
+
+/** @brief  Erase sector (port).
+ */
+static uint8_t TestErase(uint8_t SectIn)
+{
+	uint32_t i, k;
+
+	if(TestOff || SectIn >= PLC_RETAIN_SECT_NUM) return (BIT_FALSE);
+
+	TestErases++;
+	if(TestInWrite) TestWriteErases++;
+
+	for(k=0; k<TEST_ERASE_OPS; k++)
+	{
+		if(TestOp()) continue;
+
+		TestCutErase++;
+		for(i=0; i<TEST_SECT_WSZ; i++)
+		{
+			switch(TestRand()%3)
+			{
+				case 0:  TestFlash[SectIn][i] = 0xFFFFFFFF;  break;
+				case 1:  TestFlash[SectIn][i] = TestRand32(); break;
+				default: break;
+			}
+		}
+		return (BIT_FALSE);
+	}
+
+	memset(TestFlash[SectIn], 0xFF, sizeof(TestFlash[SectIn]));
+	return (BIT_TRUE);
+}
+
+/** @brief  Program words (port).
+ */
+static uint8_t TestWrite(const uint32_t *AddrIn, const uint32_t *DataIn, uint32_t WordsIn)
+{
+	uint32_t *Addr = (uint32_t *)AddrIn;
+	uint32_t  Off, i;
+
+	if(TestOff) return (BIT_FALSE);
+
+	Off = (uint32_t)(Addr - TestFlash[0]);
+	TEST_CHECK_MSG(Off + WordsIn <= PLC_RETAIN_SECT_NUM*TEST_SECT_WSZ, "write out of storage (word %u)", Off);
+	if(Off + WordsIn > PLC_RETAIN_SECT_NUM*TEST_SECT_WSZ) return (BIT_FALSE);
+
+	for(i=0; i<WordsIn; i++)
+	{
+		TEST_CHECK_MSG(Addr[i] == 0xFFFFFFFF, "word %u is programmed twice", Off+i);
+
+		if(!TestOp())
+		{
+			TestCutProg++;
+			if((Off % TEST_SECT_WSZ) == 0) TestCutHdr++;
+			Addr[i] &= ((TestRand()%2) ? DataIn[i] : (DataIn[i] | TestRand32()));
+			return (BIT_FALSE);
+		}
+		Addr[i] &= DataIn[i];
+	}
+	return (BIT_TRUE);
+}
+
+/** @var Storage
+ */
+static const PlcRetain_Port_t TestPort =
+{
+	{ TestFlash[0], TestFlash[1] },
+	TestErase,
+	TestWrite
+};
+
+/** @var Buffer for records of an unfinished commit
+ */
+static uint8_t TestTmp[PLC_RETAIN_SZ];
+
+
+/** @brief  Restart (power is on).
+ */
+static uint8_t TestInit(uint8_t *ImgOut, uint32_t *IdOut)
+{
+	TestBudget = -1;
+	TestOff    = 0;
+	return (PlcRetain_Init(&TestPort, ImgOut, TestTmp, IdOut));
+}
+
+/** @brief  Commit (power is on).
+ */
+static uint8_t TestCommit(const uint8_t *ImgIn, uint32_t MaskIn, uint32_t IdIn)
+{
+	uint8_t Res;
+
+	TestInWrite = 1;
+	Res = PlcRetain_Write(ImgIn, MaskIn, IdIn);
+	TestInWrite = 0;
+	return (Res);
+}
+
+/** @brief  Change random blocks of image.
+ *  @return Mask of changed blocks.
+ */
+static uint32_t TestChange(uint8_t *ImgIn)
+{
+	uint32_t Mask = 0, Num, Blk, i;
+
+	Num = ((TestRand()%16) ? 1 + TestRand()%4 : PLC_RETAIN_BLK_NUM);
+	for(i=0; i<Num; i++)
+	{
+		Blk   = ((Num == PLC_RETAIN_BLK_NUM) ? i : TestRand()%PLC_RETAIN_BLK_NUM);
+		Mask |= ((uint32_t)1 << Blk);
+		ImgIn[Blk*PLC_RETAIN_BLK_SZ + TestRand()%PLC_RETAIN_BLK_SZ] ^= (uint8_t)(1 + TestRand()%255);
+	}
+	return (Mask);
+}
+
+
+/** @brief  Layout of journal.
+ */
+static void TestLayout(void)
+{
+	TEST_CHECK(PLC_RETAIN_REC_WSZ == 11);
+	TEST_CHECK(PLC_RETAIN_REC_NUM == 372);
+	TEST_CHECK(PLC_RETAIN_HDR_WSZ*4 + PLC_RETAIN_REC_NUM*PLC_RETAIN_REC_WSZ*4 <= PLC_RETAIN_SECT_SZ);
+}
+
+/** @brief  Commits without power loss: restore, fill of journal, deferred commit.
+ */
+static void TestJournal(void)
+{
+	static uint8_t Img[PLC_RETAIN_SZ], Ok[PLC_RETAIN_SZ], Out[PLC_RETAIN_SZ];
+	uint32_t Id, Commits, Erases, i;
+	uint8_t  Res;
+
+	memset(TestFlash, 0xFF, sizeof(TestFlash));
+
+	//nothing is stored
+	memset(Out, 0x5A, PLC_RETAIN_SZ);
+	Id = 7;
+	TEST_CHECK(TestInit(Out, &Id) == BIT_FALSE);
+	TEST_CHECK(Id == 0);
+	for(i=0; i<PLC_RETAIN_SZ && !Out[i]; i++);
+	TEST_CHECK(i == PLC_RETAIN_SZ);
+
+	//empty mask, not inited storage
+	TEST_CHECK(TestCommit(Img, 0, 1) == BIT_TRUE);
+	TEST_CHECK(TestCommit(0, 1, 1) == BIT_FALSE);
+
+	//the first commit is a compaction, then 169 commits of 1 block per sector
+	Erases = TestErases;
+	memset(Img, 0, PLC_RETAIN_SZ);
+	TestChange(Img);
+	TEST_CHECK(TestCommit(Img, PLC_RETAIN_BLK_ALL, 1) == BIT_TRUE);
+	for(Commits=0; Commits<1000; Commits++)
+	{
+		memcpy(Ok, Img, PLC_RETAIN_SZ);
+		Img[(Commits%PLC_RETAIN_BLK_NUM)*PLC_RETAIN_BLK_SZ]++;
+		Res = TestCommit(Img, ((uint32_t)1 << (Commits%PLC_RETAIN_BLK_NUM)), 1);
+		if(Res != BIT_TRUE) break;
+	}
+	TEST_CHECK_MSG(Res == PLC_RETAIN_WAIT, "Res = %u", Res);
+	TEST_CHECK_MSG(Commits == 2*((PLC_RETAIN_REC_NUM-PLC_RETAIN_BLK_NUM-1)/2)+1, "commits before WAIT = %u", Commits);
+	TEST_CHECK(TestErases == Erases);
+
+	//deferred commit is lost by restart
+	TEST_CHECK(TestInit(Out, &Id) == BIT_TRUE);
+	TEST_CHECK(Id == 1);
+	TEST_CHECK(!memcmp(Out, Ok, PLC_RETAIN_SZ));
+
+	//the other sector was written: erased by restart (PlcRetain_Init) - no erase by commit
+	Erases = TestErases;
+	TEST_CHECK(TestCommit(Img, ((uint32_t)1 << (Commits%PLC_RETAIN_BLK_NUM)), 1) == BIT_TRUE);
+	for(i=0; i<1000; i++)
+	{
+		Img[5]++;
+		if((Res = TestCommit(Img, 1, 1)) != BIT_TRUE) break;
+	}
+	TEST_CHECK(Res == PLC_RETAIN_WAIT);
+	TEST_CHECK(TestErases == Erases);
+
+	//stop of application: the other sector is erased once, deferred commit is done
+	TEST_CHECK(PlcRetain_Prepare() == BIT_TRUE);
+	TEST_CHECK(TestErases == Erases+1);
+	TEST_CHECK(PlcRetain_Prepare() == BIT_TRUE);
+	TEST_CHECK(TestErases == Erases+1);
+	TEST_CHECK(TestCommit(Img, 1, 1) == BIT_TRUE);
+	TEST_CHECK(TestInit(Out, &Id) == BIT_TRUE);
+	TEST_CHECK(!memcmp(Out, Img, PLC_RETAIN_SZ));
+
+	//another application: compaction with the new id
+	TEST_CHECK(PlcRetain_Prepare() == BIT_TRUE);
+	memset(Img, 0, PLC_RETAIN_SZ);
+	TEST_CHECK(TestCommit(Img, PLC_RETAIN_BLK_ALL, PlcRetain_GetId("app-2")) == BIT_TRUE);
+	TEST_CHECK(TestInit(Out, &Id) == BIT_TRUE);
+	TEST_CHECK(Id == PlcRetain_GetId("app-2"));
+	TEST_CHECK(!memcmp(Out, Img, PLC_RETAIN_SZ));
+
+	TEST_CHECK(TestWriteErases == 0);
+}
+
+/** @brief  Generation of active sector (header is checked by magic only).
+ */
+static uint32_t TestGen(void)
+{
+	uint32_t Gen = 0;
+
+	for(uint8_t i=0; i<PLC_RETAIN_SECT_NUM; i++)
+	{
+		if(TestFlash[i][0] == PLC_RETAIN_HDR_MAGIC && TestFlash[i][1] > Gen) Gen = TestFlash[i][1];
+	}
+	return (Gen);
+}
+
+/** @brief  Application is started: commit every flush, the spare sector is reclaimed once between flushes
+ *          (DATA_T, RTOS_DATA_RETAIN_PREP_TM), commits are never deferred.
+ */
+static void TestRunning(void)
+{
+	static uint8_t Img[PLC_RETAIN_SZ], Out[PLC_RETAIN_SZ];
+	unsigned long Erases0, Erases;
+	uint32_t Id, Flush, Gen, Waits = 0, Compacts = 0;
+	uint8_t  Res;
+
+	memset(TestFlash, 0xFF, sizeof(TestFlash));
+	TestInit(Out, &Id);
+	memset(Img, 0, PLC_RETAIN_SZ);
+	TEST_CHECK(TestCommit(Img, PLC_RETAIN_BLK_ALL, 1) == BIT_TRUE);
+	Gen     = TestGen();
+	Erases0 = TestErases;
+
+	for(Flush=0; Flush<20000; Flush++)
+	{
+		//flush: 1 ... 4 blocks, sometimes all
+		Res = TestCommit(Img, TestChange(Img), 1);
+		if(Res == PLC_RETAIN_WAIT) Waits++;
+		TEST_CHECK_MSG(Res != BIT_FALSE, "flush %u", Flush);
+
+		if(TestGen() != Gen)
+		{
+			Gen = TestGen();
+			Compacts++;
+		}
+
+		//between flushes: one sector is erased at most
+		Erases = TestErases;
+		TEST_CHECK(PlcRetain_Prepare() == BIT_TRUE);
+		TEST_CHECK_MSG(TestErases-Erases <= 1, "flush %u: %lu erases", Flush, TestErases-Erases);
+	}
+
+	//one erase per compaction
+	TEST_CHECK_MSG(Waits == 0, "%u deferred commits", Waits);
+	TEST_CHECK(Compacts > 100);
+	TEST_CHECK_MSG(TestErases-Erases0 == Compacts, "%lu erases, %u compactions", TestErases-Erases0, Compacts);
+
+	TEST_CHECK(TestInit(Out, &Id) == BIT_TRUE);
+	TEST_CHECK(!memcmp(Out, Img, PLC_RETAIN_SZ));
+	TEST_CHECK(TestWriteErases == 0);
+}
+
+/** @brief  Garbage in storage (never programmed device).
+ */
+static void TestGarbage(void)
+{
+	static uint8_t Img[PLC_RETAIN_SZ], Out[PLC_RETAIN_SZ];
+	uint32_t Id, i;
+
+	for(i=0; i<TEST_SECT_WSZ; i++)
+	{
+		TestFlash[0][i] = TestRand32();
+		TestFlash[1][i] = TestRand32();
+	}
+	TestFlash[0][0] = PLC_RETAIN_HDR_MAGIC;
+
+	TEST_CHECK(TestInit(Out, &Id) == BIT_FALSE);
+	TEST_CHECK(Id == 0);
+
+	//sectors are erased by PlcRetain_Init
+	memset(Img, 0xA5, PLC_RETAIN_SZ);
+	TEST_CHECK(TestCommit(Img, PLC_RETAIN_BLK_ALL, 3) == BIT_TRUE);
+	TEST_CHECK(TestInit(Out, &Id) == BIT_TRUE);
+	TEST_CHECK(Id == 3);
+	TEST_CHECK(!memcmp(Out, Img, PLC_RETAIN_SZ));
+	TEST_CHECK(TestWriteErases == 0);
+}
+
+/** @brief  Random power cuts while committing, compacting, erasing and restarting.
+ */
+static void TestPowerLoss(void)
+{
+	static uint8_t Img[PLC_RETAIN_SZ], Ok[PLC_RETAIN_SZ], Out[PLC_RETAIN_SZ];
+	uint32_t Id = 1, OkId = 0, RestId, Pend = 0;
+	uint8_t  Stored = BIT_FALSE, InFlight, IsOk, IsNew, Res;
+	unsigned long Cut, Commits = 0, Waits = 0, RestNew = 0, RestOld = 0, Restarts = 0;
+
+	memset(TestFlash, 0xFF, sizeof(TestFlash));
+	TestInit(Out, &RestId);
+	memset(Img, 0, PLC_RETAIN_SZ);
+	memset(Ok,  0, PLC_RETAIN_SZ);
+
+	for(Cut=0; Cut<TEST_CUTS; Cut++)
+	{
+		//run until power cut
+		TestBudget = (long)(TestRand()%1500);
+		TestOff    = 0;
+		InFlight   = BIT_FALSE;
+		for(;;)
+		{
+			//another application (all blocks are committed)
+			if(TestRand()%64 == 0)
+			{
+				Id++;
+				Pend = PLC_RETAIN_BLK_ALL;
+			}
+			Pend |= TestChange(Img);
+
+			Res = TestCommit(Img, Pend, Id);
+			if(Res == BIT_TRUE)
+			{
+				memcpy(Ok, Img, PLC_RETAIN_SZ);
+				OkId   = Id;
+				Stored = BIT_TRUE;
+				Pend   = 0;
+				Commits++;
+			}
+			else if(Res == PLC_RETAIN_WAIT)
+			{
+				Waits++;
+			}
+			else
+			{
+				InFlight = BIT_TRUE;
+				break;
+			}
+
+			//stop of application (deferred commits are kept in RAM otherwise)
+			if((Res == PLC_RETAIN_WAIT && TestRand()%2) || TestRand()%32 == 0)
+			{
+				if(!PlcRetain_Prepare()) break;
+			}
+		}
+		TEST_CHECK(TestOff);
+
+		//restart (may be cut as well)
+		do
+		{
+			Restarts++;
+			TestBudget = ((TestRand()%4) ? -1 : (long)(TestRand()%(2*TEST_ERASE_OPS)));
+			TestOff    = 0;
+			RestId     = 0xDEADBEEF;
+			Res = PlcRetain_Init(&TestPort, Out, TestTmp, &RestId);
+
+			IsOk  = (!memcmp(Out, Ok, PLC_RETAIN_SZ) && RestId == OkId);
+			IsNew = (InFlight && !memcmp(Out, Img, PLC_RETAIN_SZ) && RestId == Id);
+			TEST_CHECK_MSG(IsOk || IsNew, "cut %lu: restored image is neither the old nor the new one", Cut);
+			TEST_CHECK_MSG(Res == (Stored || IsNew), "cut %lu: Res = %u", Cut, Res);
+
+			//the new image is committed (an old one must never appear again)
+			if(IsNew && !IsOk)
+			{
+				memcpy(Ok, Img, PLC_RETAIN_SZ);
+				OkId   = Id;
+				Stored = BIT_TRUE;
+				RestNew++;
+			}
+			else
+			{
+				RestOld++;
+			}
+			InFlight = BIT_FALSE;
+		}
+		while(TestOff);
+
+		//application continues with the restored image
+		memcpy(Img, Ok, PLC_RETAIN_SZ);
+		Id   = OkId;
+		Pend = 0;
+
+		if(TestFails > 50) break;
+	}
+
+	printf("  cuts %lu (program %lu, header %lu, erase %lu), restarts %lu: new %lu, old %lu\n",
+	       Cut, TestCutProg, TestCutHdr, TestCutErase, Restarts, RestNew, RestOld);
+	printf("  commits %lu, deferred %lu, erases %lu\n", Commits, Waits, TestErases);
+
+	TEST_CHECK(TestCutProg > 1000);
+	TEST_CHECK(TestCutHdr > 0);
+	TEST_CHECK(TestCutErase > 100);
+	TEST_CHECK(RestNew > 100);
+	TEST_CHECK(Waits > 0);
+	TEST_CHECK(TestWriteErases == 0);
+}
+
+
+int main(void)
+{
+	TEST_RUN(TestLayout);
+	TEST_RUN(TestJournal);
+	TEST_RUN(TestRunning);
+	TEST_RUN(TestGarbage);
+	TEST_RUN(TestPowerLoss);
+
+	return (TEST_END());
+}
@@ -0,0 +1,73 @@
+/* @page test.h
+ *       PLC411::RTE
+ *       Host unit tests: checks and report
+ *       Host Code (gcc)
+ *       2023, atgroup09@gmail.com
+ */
+
+/** @note
+ *        Every test is a program of one translation unit:
+ *        TEST_RUN(Func) runs a group of checks, TEST_END() prints the summary
+ *        and returns exit code of the program (0 - all checks are passed).
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+
+/** @var Number of checks / failed checks
+ */
+static unsigned long TestChecks = 0;
+static unsigned long TestFails  = 0;
+
+
+/** @def    Check condition.
+ *  @param  CondIn - condition.
+ */
+#define TEST_CHECK(CondIn)                       TEST_CHECK_MSG(CondIn, "%s", #CondIn)
+
+/** @def    Check condition with message.
+ *  @param  CondIn - condition.
+ *  @param  ...    - printf-format and arguments of the message.
+ */
+#define TEST_CHECK_MSG(CondIn, ...)              do { \
+                                                     TestChecks++; \
+                                                     if(!(CondIn)) \
+                                                     { \
+                                                         if(++TestFails <= 50) \
+                                                         { \
+                                                             printf("%s:%d: FAIL: ", __FILE__, __LINE__); \
+                                                             printf(__VA_ARGS__); \
+                                                             printf("\n"); \
+                                                         } \
+                                                     } \
+                                                 } while(0)
+
+/** @def    Check float value.
+ *  @param  ValIn - value.
+ *  @param  ExpIn - expected value.
+ *  @param  TolIn - tolerance (absolute).
+ */
+#define TEST_CHECK_NEAR(ValIn, ExpIn, TolIn)     TEST_CHECK_MSG(fabs((double)(ValIn)-(double)(ExpIn)) <= (double)(TolIn), \
+                                                                "%s = %.9g, expected %.9g +/- %.3g", #ValIn, (double)(ValIn), (double)(ExpIn), (double)(TolIn))
+
+/** @def    Run group of checks.
+ *  @param  FuncIn - function (void).
+ */
+#define TEST_RUN(FuncIn)                         do { \
+                                                     unsigned long Fails = TestFails; \
+                                                     FuncIn(); \
+                                                     printf("%-40s %s\n", #FuncIn, ((TestFails == Fails) ? "ok" : "FAILED")); \
+                                                 } while(0)
+
+/** @def    Print summary.
+ *  @return Exit code of program.
+ */
+#define TEST_END()                               (printf("%s: %lu checks, %lu failed\n", __FILE__, TestChecks, TestFails), ((TestFails) ? 1 : 0))
+
+#endif /* TEST_H_ */
@@ -1,7 +1,11 @@
 @echo off
 
-:: Berimiz application loader
-:: xprog-app.bat file.hex
+:: RTE loader over stm32flash
+:: xprog-rte.bat [file.hex]
+::
+:: The image is linked from 0x08000000 with a gap at 0x08004000 ... 0x0800BFFF
+:: (sectors 1, 2 - retain-data journal), the gap is within the erased range,
+:: so retain-data are reset by loading of RTE.
 
 :: Path to stm32flash.exe
 :: set Bin="C:\Program Files (x86)\YAPLC-1.1.0\stm32flash\stm32flash.exe"
@@ -23,7 +27,9 @@ set g=0x0
 :: =address[:length]
 set S=0x08000000
 
-set Hex="bin\plc411-rte.hex"
+:: Path to HEX-file to load (build result of Eclipse project by default)
+set Hex="Release\plc411-rte.hex"
+if not "%~1"=="" set Hex="%~1"
 
 
 :: Start
@@ -2,7 +2,11 @@
 #UTF8
 
 # RTE loader over stm32flash
-# xprog-rte.bat file.hex
+# xprog-rte.sh [file.hex]
+#
+# The image is linked from 0x08000000 with a gap at 0x08004000 ... 0x0800BFFF
+# (sectors 1, 2 - retain-data journal), the gap is within the erased range,
+# so retain-data are reset by loading of RTE.
 
 # stm32flash bin
 Bin="/usr/local/bin/stm32flash"
@@ -22,8 +26,8 @@ g=0x0
 # =address[:length]
 S=0x08000000
 
-# Path to HEX-file to load
-Hex="bin/plc411-rte.hex"
+# Path to HEX-file to load (build result of Eclipse project by default)
+Hex="${1:-Release/plc411-rte.hex}"
 
 
 if [ ! -f $Bin ]; then